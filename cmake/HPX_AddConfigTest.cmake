@@ -264,6 +264,13 @@ function(hpx_check_for_unistd_h)
   )
 endfunction()
 
+# ##############################################################################
+function(hpx_check_for_linux_io_uring)
+  add_hpx_config_test(
+    HPX_WITH_LINUX_IO_URING SOURCE cmake/tests/linux_io_uring.cpp FILE ${ARGN}
+  )
+endfunction()
+
 # ##############################################################################
 function(hpx_check_for_libfun_std_experimental_optional)
   add_hpx_config_test(
@@ -438,6 +445,14 @@ function(hpx_check_for_cxx17_std_variant)
   )
 endfunction()
 
+# ##############################################################################
+function(hpx_check_for_cxx17_std_experimental_simd)
+  add_hpx_config_test(
+    HPX_WITH_CXX17_STD_EXPERIMENTAL_SIMD
+    SOURCE cmake/tests/cxx17_std_experimental_simd.cpp FILE ${ARGN}
+  )
+endfunction()
+
 # ##############################################################################
 function(hpx_check_for_cxx17_std_transform_scan)
   add_hpx_config_test(
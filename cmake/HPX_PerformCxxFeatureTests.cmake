@@ -97,6 +97,14 @@ function(hpx_perform_cxx_feature_tests)
     DEFINITIONS HPX_HAVE_CXX20_NO_UNIQUE_ADDRESS_ATTRIBUTE
   )
 
+  if(HPX_WITH_DATAPAR_STD_EXPERIMENTAL_SIMD)
+    hpx_check_for_cxx17_std_experimental_simd(
+      DEFINITIONS HPX_HAVE_DATAPAR HPX_HAVE_DATAPAR_STD_EXPERIMENTAL_SIMD
+      REQUIRED
+        "HPX_WITH_DATAPAR_STD_EXPERIMENTAL_SIMD requires C++17 and a standard library providing <experimental/simd> (e.g. libstdc++ V11 or newer)"
+    )
+  endif()
+
   # Check the availability of certain C++ builtins
   hpx_check_for_builtin_integer_pack(DEFINITIONS HPX_HAVE_BUILTIN_INTEGER_PACK)
 
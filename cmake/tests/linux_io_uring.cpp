@@ -0,0 +1,17 @@
+////////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+////////////////////////////////////////////////////////////////////////////////
+
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+
+int main()
+{
+    io_uring_params p{};
+    (void) p;
+    return __NR_io_uring_setup == 0 ? 1 : 0;
+}
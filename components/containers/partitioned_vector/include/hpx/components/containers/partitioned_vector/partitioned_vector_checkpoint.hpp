@@ -0,0 +1,320 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/containers/partitioned_vector/partitioned_vector_checkpoint.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/checkpoint/checkpoint.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_decl.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/hashing/jenkins_hash.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/parallel/algorithms/for_loop.hpp>
+#include <hpx/runtime_local/get_locality_id.hpp>
+#include <hpx/serialization/array.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// partitioned_vector_incremental_checkpoint creates checkpoints of the
+    /// partitions of a partitioned_vector which are located on the calling
+    /// locality (usually from an SPMD style application where every locality
+    /// checkpoints its own data).
+    ///
+    /// The partitions are divided into pages of a fixed number of elements.
+    /// The first checkpoint (the base) holds all pages, every following
+    /// checkpoint (a delta) holds only the pages which have changed since the
+    /// previous checkpoint. Changes are detected by comparing content hashes
+    /// of the pages, thus the elements have to be trivially copyable. Each
+    /// checkpoint additionally holds a manifest (the sizes of the partitions
+    /// and the hashes of all pages) which allows to continue creating deltas
+    /// after restoring the data.
+    ///
+    /// The data is restored by applying a base checkpoint and all of its
+    /// deltas in order.
+    template <typename T, typename Data = std::vector<T>>
+    class partitioned_vector_incremental_checkpoint
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+            "partitioned_vector_incremental_checkpoint requires trivially "
+            "copyable element types as changes are detected using the "
+            "hashes of the element representations");
+
+    private:
+        // the data written for each checkpoint
+        struct record
+        {
+            // zero for a base checkpoint, the number of the delta since the
+            // base checkpoint otherwise
+            std::uint64_t sequence_ = 0;
+            std::uint64_t page_size_ = 0;
+
+            // manifest: sizes of the local partitions and hashes of all pages
+            std::vector<std::uint64_t> segment_sizes_;
+            std::vector<std::vector<std::uint64_t>> hashes_;
+
+            // the pages stored in this checkpoint
+            std::vector<std::uint64_t> segments_;
+            std::vector<std::uint64_t> pages_;
+
+            // the contents of the stored pages, saved directly from the
+            // partitions and loaded into a contiguous buffer
+            std::vector<std::pair<T const*, std::size_t>> page_data_;
+            std::vector<T> data_;
+
+        private:
+            friend class hpx::serialization::access;
+
+            template <typename Archive>
+            void save(Archive& ar, unsigned) const
+            {
+                std::uint64_t count = 0;
+                for (auto const& p : page_data_)
+                    count += p.second;
+
+                // clang-format off
+                ar & sequence_ & page_size_ & segment_sizes_ & hashes_ &
+                    segments_ & pages_ & count;
+                // clang-format on
+
+                for (auto const& p : page_data_)
+                    ar << hpx::serialization::make_array(p.first, p.second);
+            }
+
+            template <typename Archive>
+            void load(Archive& ar, unsigned)
+            {
+                std::uint64_t count = 0;
+
+                // clang-format off
+                ar & sequence_ & page_size_ & segment_sizes_ & hashes_ &
+                    segments_ & pages_ & count;
+                // clang-format on
+
+                data_.resize(count);
+                ar >> hpx::serialization::make_array(data_.data(), count);
+            }
+
+            HPX_SERIALIZATION_SPLIT_MEMBER()
+        };
+
+    public:
+        /// \param page_size    The number of elements per page, this is the
+        ///                     granularity of the change detection.
+        explicit partitioned_vector_incremental_checkpoint(
+            std::size_t page_size = (std::max)(
+                std::size_t(1), std::size_t(64 * 1024 / sizeof(T))))
+          : page_size_(page_size != 0 ? page_size : 1)
+          , sequence_(0)
+          , has_base_(false)
+        {
+        }
+
+        /// Return the number of elements per page
+        std::size_t page_size() const
+        {
+            return page_size_;
+        }
+
+        /// Create a checkpoint of the local partitions of the given vector.
+        ///
+        /// \param v            The vector to checkpoint
+        /// \param force_base   Create a base checkpoint even if a delta could
+        ///                     be created.
+        ///
+        /// \returns A base checkpoint holding all pages if this is the first
+        ///          checkpoint, if the sizes of the local partitions have
+        ///          changed, or if \a force_base is true. A delta holding
+        ///          only the changed pages otherwise.
+        hpx::util::checkpoint save(
+            partitioned_vector<T, Data> const& v, bool force_base = false)
+        {
+            std::vector<Data const*> segments;
+            std::uint32_t const locality_id = hpx::get_locality_id();
+            for (auto it = v.segment_cbegin(locality_id),
+                      end = v.segment_cend(locality_id);
+                 it != end; ++it)
+            {
+                segments.push_back(&*it);
+            }
+
+            record r;
+            r.page_size_ = page_size_;
+            r.segment_sizes_.reserve(segments.size());
+            for (Data const* seg : segments)
+                r.segment_sizes_.push_back(seg->size());
+
+            bool const base = force_base || !has_base_ ||
+                r.segment_sizes_ != segment_sizes_;
+            r.sequence_ = base ? 0 : sequence_;
+
+            // hash all pages
+            r.hashes_.resize(segments.size());
+            for (std::size_t s = 0; s != segments.size(); ++s)
+            {
+                std::vector<std::uint64_t>& hashes = r.hashes_[s];
+                hashes.resize(num_pages(segments[s]->size()));
+
+                T const* data = segments[s]->data();
+                std::size_t const size = segments[s]->size();
+                hpx::for_loop(hpx::execution::par, std::size_t(0),
+                    hashes.size(), [&](std::size_t p) {
+                        std::size_t first = p * page_size_;
+                        hashes[p] = hash_page(data + first,
+                            (std::min)(page_size_, size - first));
+                    });
+            }
+
+            // store all changed pages
+            for (std::size_t s = 0; s != segments.size(); ++s)
+            {
+                T const* data = segments[s]->data();
+                std::size_t const size = segments[s]->size();
+                std::vector<std::uint64_t> const& hashes = r.hashes_[s];
+
+                for (std::size_t p = 0; p != hashes.size(); ++p)
+                {
+                    if (!base && hashes[p] == hashes_[s][p])
+                        continue;
+
+                    std::size_t first = p * page_size_;
+                    r.segments_.push_back(s);
+                    r.pages_.push_back(p);
+                    r.page_data_.emplace_back(
+                        data + first, (std::min)(page_size_, size - first));
+                }
+            }
+
+            hpx::util::checkpoint c =
+                hpx::util::save_checkpoint(hpx::launch::sync, r);
+
+            sequence_ = r.sequence_ + 1;
+            segment_sizes_ = std::move(r.segment_sizes_);
+            hashes_ = std::move(r.hashes_);
+            has_base_ = true;
+
+            return c;
+        }
+
+        /// Restore the local partitions of the given vector from a base
+        /// checkpoint followed by its deltas (in the order they were
+        /// created). The local partitions must have the same sizes as when
+        /// the checkpoints were created. Subsequent invocations of \a save
+        /// will create deltas relative to the restored data.
+        ///
+        /// \param v            The vector to restore
+        /// \param checkpoints  The checkpoints to apply
+        void restore(partitioned_vector<T, Data>& v,
+            std::vector<hpx::util::checkpoint> const& checkpoints)
+        {
+            std::vector<Data*> segments;
+            std::uint32_t const locality_id = hpx::get_locality_id();
+            for (auto it = v.segment_begin(locality_id),
+                      end = v.segment_end(locality_id);
+                 it != end; ++it)
+            {
+                segments.push_back(&*it);
+            }
+
+            record last;
+            std::uint64_t next_sequence = 0;
+            for (hpx::util::checkpoint const& c : checkpoints)
+            {
+                record r;
+                hpx::util::restore_checkpoint(c, r);
+
+                if (r.sequence_ != 0 && r.sequence_ != next_sequence)
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "partitioned_vector_incremental_checkpoint::restore",
+                        "the given checkpoints do not form a sequence of a "
+                        "base checkpoint and its deltas");
+                }
+
+                if (r.segment_sizes_.size() != segments.size())
+                {
+                    HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                        "partitioned_vector_incremental_checkpoint::restore",
+                        "the number of local partitions does not match the "
+                        "checkpoint");
+                }
+                for (std::size_t s = 0; s != segments.size(); ++s)
+                {
+                    if (r.segment_sizes_[s] != segments[s]->size())
+                    {
+                        HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                            "partitioned_vector_incremental_checkpoint::"
+                            "restore",
+                            "the size of a local partition does not match "
+                            "the checkpoint");
+                    }
+                }
+
+                std::size_t offset = 0;
+                for (std::size_t i = 0; i != r.pages_.size(); ++i)
+                {
+                    Data& seg = *segments[r.segments_[i]];
+                    std::size_t first = r.pages_[i] * r.page_size_;
+                    std::size_t count =
+                        (std::min)(std::size_t(r.page_size_), seg.size() - first);
+
+                    std::copy(r.data_.begin() + offset,
+                        r.data_.begin() + offset + count, seg.begin() + first);
+                    offset += count;
+                }
+
+                next_sequence = r.sequence_ + 1;
+                last = std::move(r);
+            }
+
+            if (checkpoints.empty())
+                return;
+
+            page_size_ = last.page_size_;
+            sequence_ = next_sequence;
+            segment_sizes_ = std::move(last.segment_sizes_);
+            hashes_ = std::move(last.hashes_);
+            has_base_ = true;
+        }
+
+    private:
+        std::size_t num_pages(std::size_t size) const
+        {
+            return (size + page_size_ - 1) / page_size_;
+        }
+
+        // combine two 32 bit hashes to reduce the probability of missing a
+        // change because of a collision
+        static std::uint64_t hash_page(T const* data, std::size_t count)
+        {
+            char const* bytes = reinterpret_cast<char const*>(data);
+            std::size_t size = count * sizeof(T);
+
+            util::jenkins_hash h1(0, util::jenkins_hash::seed);
+            util::jenkins_hash h2(0x9e3779b9, util::jenkins_hash::seed);
+
+            return (std::uint64_t(h1(bytes, size)) << 32) | h2(bytes, size);
+        }
+
+    private:
+        std::size_t page_size_;
+        std::uint64_t sequence_;
+        bool has_base_;
+        std::vector<std::uint64_t> segment_sizes_;
+        std::vector<std::vector<std::uint64_t>> hashes_;
+    };
+}    // namespace hpx
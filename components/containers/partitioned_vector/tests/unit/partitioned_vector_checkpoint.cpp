@@ -0,0 +1,128 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_checkpoint.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <vector>
+
+// partitioned_vector<int> and partitioned_vector<double> are predefined in the
+// partitioned_vector module
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void verify_equal(
+    hpx::partitioned_vector<T> const& v1, hpx::partitioned_vector<T> const& v2)
+{
+    HPX_TEST_EQ(v1.size(), v2.size());
+    for (std::size_t i = 0; i != v1.size(); ++i)
+    {
+        HPX_TEST_EQ(v1.get_value(hpx::launch::sync, i),
+            v2.get_value(hpx::launch::sync, i));
+    }
+}
+
+template <typename T>
+void test_incremental_checkpoint()
+{
+    std::size_t const size = 10007;
+    std::size_t const page_size = 100;
+
+    // all partitions are local as each locality checkpoints its own data
+    std::vector<hpx::id_type> localities(4, hpx::find_here());
+    hpx::partitioned_vector<T> v(
+        size, T(1), hpx::container_layout(4, localities));
+
+    hpx::partitioned_vector_incremental_checkpoint<T> ckp(page_size);
+    HPX_TEST_EQ(ckp.page_size(), page_size);
+
+    std::vector<hpx::util::checkpoint> checkpoints;
+    checkpoints.push_back(ckp.save(v));
+    std::size_t const base_size = checkpoints.back().size();
+
+    // an unmodified vector results in an empty delta
+    checkpoints.push_back(ckp.save(v));
+    std::size_t const empty_size = checkpoints.back().size();
+    HPX_TEST_LT(empty_size, base_size);
+
+    // modify a few elements, the delta holds the changed pages only
+    v.set_value(hpx::launch::sync, 0, T(2));
+    v.set_value(hpx::launch::sync, 5000, T(3));
+    v.set_value(hpx::launch::sync, size - 1, T(4));
+    checkpoints.push_back(ckp.save(v));
+
+    std::size_t const delta_size = checkpoints.back().size();
+    HPX_TEST_LT(delta_size, base_size);
+    HPX_TEST_LT(empty_size, delta_size);
+    HPX_TEST_LT(delta_size - empty_size, 4 * page_size * sizeof(T));
+
+    v.set_value(hpx::launch::sync, 42, T(5));
+    checkpoints.push_back(ckp.save(v));
+
+    // restore the data by composing the base with its deltas
+    {
+        hpx::partitioned_vector<T> v2(
+            size, T(0), hpx::container_layout(4, localities));
+
+        hpx::partitioned_vector_incremental_checkpoint<T> ckp2;
+        ckp2.restore(v2, checkpoints);
+        verify_equal(v, v2);
+
+        // the restored manifest allows to continue creating deltas
+        hpx::util::checkpoint c = ckp2.save(v2);
+        HPX_TEST_EQ(c.size(), empty_size);
+    }
+
+    // a forced base checkpoint replaces the previous ones
+    {
+        v.set_value(hpx::launch::sync, 4711, T(6));
+        std::vector<hpx::util::checkpoint> base = {ckp.save(v, true)};
+        HPX_TEST_EQ(base.back().size(), base_size);
+
+        hpx::partitioned_vector<T> v2(
+            size, T(0), hpx::container_layout(4, localities));
+
+        hpx::partitioned_vector_incremental_checkpoint<T> ckp2;
+        ckp2.restore(v2, base);
+        verify_equal(v, v2);
+    }
+
+    // deltas can't be applied out of sequence
+    {
+        hpx::partitioned_vector<T> v2(
+            size, T(0), hpx::container_layout(4, localities));
+
+        std::vector<hpx::util::checkpoint> incomplete = {
+            checkpoints[0], checkpoints[2]};
+
+        bool caught_exception = false;
+        try
+        {
+            hpx::partitioned_vector_incremental_checkpoint<T> ckp2;
+            ckp2.restore(v2, incomplete);
+        }
+        catch (hpx::exception const& e)
+        {
+            HPX_TEST_EQ(e.get_error(), hpx::bad_parameter);
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_incremental_checkpoint<double>();
+    test_incremental_checkpoint<int>();
+
+    return hpx::util::report_errors();
+}
@@ -292,7 +292,6 @@ namespace hpx { namespace server
             std::vector<T> const& val)
         {
             HPX_ASSERT(keys.size() == val.size());
-            HPX_ASSERT(keys.size() <= partition_unordered_map_.size());
 
             for (std::size_t i = 0; i != keys.size(); ++i)
                 partition_unordered_map_[keys[i]] = val[i];
@@ -312,6 +311,18 @@ namespace hpx { namespace server
             return partition_unordered_map_.erase(key);
         }
 
+        /// Erase the elements with the given keys
+        ///
+        /// \return Returns the number of elements erased
+        ///
+        std::size_t erase_values(std::vector<Key> const& keys)
+        {
+            std::size_t count = 0;
+            for (Key const& key : keys)
+                count += partition_unordered_map_.erase(key);
+            return count;
+        }
+
         /// Macros to define HPX component actions for all exported functions.
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, size);
 
@@ -322,6 +333,8 @@ namespace hpx { namespace server
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, set_values);
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, erase);
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(
+            partition_unordered_map, erase_values);
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, get_copied_data);
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, set_copied_data);
@@ -371,6 +384,9 @@ namespace hpx { namespace server
     HPX_REGISTER_ACTION_DECLARATION(                                          \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::erase_action,          \
         HPX_PP_CAT(__unordered_map_erase_action_, name));                     \
+    HPX_REGISTER_ACTION_DECLARATION(                                          \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::erase_values_action,   \
+        HPX_PP_CAT(__unordered_map_erase_values_action_, name));              \
     HPX_REGISTER_ACTION_DECLARATION(                                          \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::get_copied_data_action,\
         HPX_PP_CAT(__unordered_map_get_copied_data_action_, name));           \
@@ -430,6 +446,9 @@ namespace hpx { namespace server
     HPX_REGISTER_ACTION(                                                      \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::erase_action,          \
         HPX_PP_CAT(__unordered_map_erase_action_, name));                     \
+    HPX_REGISTER_ACTION(                                                      \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::erase_values_action,   \
+        HPX_PP_CAT(__unordered_map_erase_values_action_, name));              \
     HPX_REGISTER_ACTION(                                                      \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::get_copied_data_action,\
         HPX_PP_CAT(__unordered_map_get_copied_data_action_, name));           \
@@ -651,6 +670,34 @@ namespace hpx
                 this->get_id(), key);
         }
 
+        /// Erase all values with the given keys from the
+        /// partition_unordered_map container.
+        ///
+        /// \param keys  Keys of the elements in the partition_unordered_map
+        ///
+        /// \return Returns the number of elements erased
+        ///
+        std::size_t erase_values(
+            launch::sync_policy, std::vector<Key> const& keys)
+        {
+            return erase_values(keys).get();
+        }
+
+        /// Erase all values with the given keys from the
+        /// partition_unordered_map container.
+        ///
+        /// \param keys  Keys of the elements in the partition_unordered_map
+        ///
+        /// \return This returns the hpx::future containing the number of
+        ///         elements erased
+        ///
+        future<std::size_t> erase_values(std::vector<Key> const& keys)
+        {
+            HPX_ASSERT(this->get_id());
+            return hpx::async<typename server_type::erase_values_action>(
+                this->get_id(), keys);
+        }
+
         /// Get/set all the data of this partition
         future<typename server_type::data_type> get_data() const
         {
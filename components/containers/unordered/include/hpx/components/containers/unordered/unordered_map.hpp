@@ -11,6 +11,7 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_combinators/when_all.hpp>
 #include <hpx/components_base/component_type.hpp>
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/runtime/components/client_base.hpp>
@@ -344,6 +345,31 @@ namespace hpx
             return this->hasher_(key) % partitions_.size();
         }
 
+        // Group the given keys by the partition they belong to. The returned
+        // indices refer to the positions of the keys in the given sequence.
+        std::vector<std::vector<std::size_t> > get_partition_indices(
+            std::vector<Key> const& keys) const
+        {
+            std::vector<std::vector<std::size_t> > indices(partitions_.size());
+            for (std::size_t i = 0; i != keys.size(); ++i)
+            {
+                indices[get_partition(keys[i])].push_back(i);
+            }
+            return indices;
+        }
+
+        static std::vector<Key> get_partition_keys(
+            std::vector<Key> const& keys, std::vector<std::size_t> const& idx)
+        {
+            std::vector<Key> part_keys;
+            part_keys.reserve(idx.size());
+            for (std::size_t i : idx)
+            {
+                part_keys.push_back(keys[i]);
+            }
+            return part_keys;
+        }
+
         std::vector<hpx::id_type> get_partition_ids() const
         {
             std::vector<hpx::id_type> ids;
@@ -850,6 +876,267 @@ namespace hpx
                 part_data.partition_).erase(key);
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Bulk operations: the given keys are grouped by the partition they
+        // belong to, each partition is accessed using a single operation.
+
+        /// Returns the elements with the given keys from the unordered_map
+        /// container.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the values of the elements, in the same order as
+        ///         the given keys.
+        ///
+        std::vector<T> get_values(launch::sync_policy,
+            std::vector<Key> const& keys) const
+        {
+            return get_values(keys).get();
+        }
+
+        /// Returns the elements with the given keys from the given
+        /// partition of the unordered_map container.
+        ///
+        /// \param part  Sequence number of the partition
+        /// \param keys  Keys of the elements in the partition
+        ///
+        /// \return Returns the values of the elements, in the same order as
+        ///         the given keys.
+        ///
+        std::vector<T> get_values(launch::sync_policy, size_type part,
+            std::vector<Key> const& keys) const
+        {
+            return get_values(part, keys).get();
+        }
+
+        /// Returns the elements with the given keys from the unordered_map
+        /// container asynchronously.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the hpx::future to the values of the elements, in
+        ///         the same order as the given keys.
+        ///
+        future<std::vector<T> > get_values(std::vector<Key> const& keys) const
+        {
+            std::vector<std::vector<std::size_t> > indices =
+                get_partition_indices(keys);
+
+            std::vector<future<std::vector<T> > > part_values;
+            part_values.reserve(partitions_.size());
+            for (std::size_t part = 0; part != partitions_.size(); ++part)
+            {
+                if (!indices[part].empty())
+                {
+                    part_values.push_back(get_values(
+                        part, get_partition_keys(keys, indices[part])));
+                }
+            }
+
+            // put the values received from the partitions in order
+            std::size_t count = keys.size();
+            return when_all(part_values).then(launch::sync,
+                [indices = std::move(indices), count](
+                    future<std::vector<future<std::vector<T> > > >&& f)
+                    -> std::vector<T>
+                {
+                    std::vector<future<std::vector<T> > > part_values =
+                        f.get();
+
+                    std::vector<T> values(count);
+
+                    std::size_t i = 0;
+                    for (std::vector<std::size_t> const& idx : indices)
+                    {
+                        if (idx.empty())
+                            continue;
+
+                        std::vector<T> part = part_values[i++].get();
+                        HPX_ASSERT(part.size() == idx.size());
+
+                        for (std::size_t j = 0; j != idx.size(); ++j)
+                            values[idx[j]] = std::move(part[j]);
+                    }
+                    return values;
+                });
+        }
+
+        /// Returns the elements with the given keys from the given
+        /// partition of the unordered_map container asynchronously.
+        ///
+        /// \param part  Sequence number of the partition
+        /// \param keys  Keys of the elements in the partition
+        ///
+        /// \return Returns the hpx::future to the values of the elements, in
+        ///         the same order as the given keys.
+        ///
+        future<std::vector<T> > get_values(
+            size_type part, std::vector<Key> const& keys) const
+        {
+            HPX_ASSERT(part < partitions_.size());
+
+            partition_data const& part_data = partitions_[part];
+            if (part_data.local_data_)
+            {
+                return make_ready_future(
+                    part_data.local_data_->get_values(keys));
+            }
+
+            return partition_unordered_map_client(part_data.partition_)
+                .get_values(keys);
+        }
+
+        /// Copy the given values into the elements with the given keys in
+        /// the given partition of the unordered_map container.
+        ///
+        /// \param part  Sequence number of the partition
+        /// \param keys  Keys of the elements in the partition
+        /// \param vals  The values to be copied
+        ///
+        void set_values(launch::sync_policy, size_type part,
+            std::vector<Key> const& keys, std::vector<T> const& vals)
+        {
+            set_values(part, keys, vals).get();
+        }
+
+        /// Asynchronously copy the given values into the elements with the
+        /// given keys in the given partition of the unordered_map container.
+        ///
+        /// \param part  Sequence number of the partition
+        /// \param keys  Keys of the elements in the partition
+        /// \param vals  The values to be copied
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        future<void> set_values(size_type part, std::vector<Key> const& keys,
+            std::vector<T> const& vals)
+        {
+            HPX_ASSERT(part < partitions_.size());
+
+            partition_data const& part_data = partitions_[part];
+            if (part_data.local_data_)
+            {
+                part_data.local_data_->set_values(keys, vals);
+                return make_ready_future();
+            }
+
+            return partition_unordered_map_client(part_data.partition_)
+                .set_values(keys, vals);
+        }
+
+        /// Insert all key/value pairs from the range [first, last) into the
+        /// unordered_map container. Existing elements are overwritten.
+        ///
+        /// \param first  Start of the range of key/value pairs
+        /// \param last   End of the range of key/value pairs
+        ///
+        template <typename InIter>
+        void insert(launch::sync_policy, InIter first, InIter last)
+        {
+            insert(first, last).get();
+        }
+
+        /// Asynchronously insert all key/value pairs from the range
+        /// [first, last) into the unordered_map container. Existing elements
+        /// are overwritten.
+        ///
+        /// \param first  Start of the range of key/value pairs
+        /// \param last   End of the range of key/value pairs
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        template <typename InIter>
+        future<void> insert(InIter first, InIter last)
+        {
+            std::vector<std::vector<Key> > keys(partitions_.size());
+            std::vector<std::vector<T> > vals(partitions_.size());
+            for (/**/; first != last; ++first)
+            {
+                std::size_t part = get_partition(first->first);
+                keys[part].push_back(first->first);
+                vals[part].push_back(first->second);
+            }
+
+            std::vector<future<void> > parts;
+            parts.reserve(partitions_.size());
+            for (std::size_t part = 0; part != partitions_.size(); ++part)
+            {
+                if (!keys[part].empty())
+                    parts.push_back(set_values(part, keys[part], vals[part]));
+            }
+
+            return when_all(parts).then(launch::sync,
+                [](future<std::vector<future<void> > >&& f) -> void
+                {
+                    for (future<void>& part : f.get())
+                        part.get();
+                });
+        }
+
+        /// Erase all values with the given keys from the unordered_map
+        /// container.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the number of elements erased
+        ///
+        std::size_t erase(launch::sync_policy, std::vector<Key> const& keys)
+        {
+            return erase(keys).get();
+        }
+
+        /// Erase all values with the given keys from the unordered_map
+        /// container asynchronously.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return This returns the hpx::future containing the number of
+        ///         elements erased
+        ///
+        future<std::size_t> erase(std::vector<Key> const& keys)
+        {
+            std::vector<std::vector<std::size_t> > indices =
+                get_partition_indices(keys);
+
+            std::vector<future<std::size_t> > parts;
+            parts.reserve(partitions_.size());
+            for (std::size_t part = 0; part != partitions_.size(); ++part)
+            {
+                if (!indices[part].empty())
+                {
+                    parts.push_back(erase(
+                        part, get_partition_keys(keys, indices[part])));
+                }
+            }
+
+            return when_all(parts).then(launch::sync,
+                [](future<std::vector<future<std::size_t> > >&& f)
+                    -> std::size_t
+                {
+                    std::size_t count = 0;
+                    for (future<std::size_t>& part : f.get())
+                        count += part.get();
+                    return count;
+                });
+        }
+
+        future<std::size_t> erase(size_type part, std::vector<Key> const& keys)
+        {
+            HPX_ASSERT(part < partitions_.size());
+
+            partition_data const& part_data = partitions_[part];
+            if (part_data.local_data_)
+            {
+                return make_ready_future(
+                    part_data.local_data_->erase_values(keys));
+            }
+
+            return partition_unordered_map_client(
+                part_data.partition_).erase_values(keys);
+        }
+
         ///////////////////////////////////////////////////////////////////////
         typedef segment_unordered_map_iterator<
                 Key, T, Hash, KeyEqual,
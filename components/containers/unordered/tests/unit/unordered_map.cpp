@@ -15,6 +15,7 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -76,10 +77,55 @@ void fill_unordered_map(hpx::unordered_map<Key, Value, Hash, KeyEqual>& m,
     HPX_TEST_EQ(m.size(), count);
 }
 
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void test_bulk_operations(hpx::unordered_map<Key, Value, Hash, KeyEqual>& m,
+    std::size_t count)
+{
+    std::vector<std::pair<std::string, Value>> data;
+    std::vector<std::string> keys;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        std::string idx = std::to_string(i);
+        data.emplace_back(idx, Value(i));
+        keys.push_back(idx);
+    }
+
+    m.insert(hpx::launch::sync, data.begin(), data.end());
+    HPX_TEST_EQ(m.size(), count);
+
+    // request the values in reverse order
+    std::reverse(keys.begin(), keys.end());
+    std::vector<Value> values = m.get_values(hpx::launch::sync, keys);
+    HPX_TEST_EQ(values.size(), count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(values[i], Value(count - i - 1));
+        HPX_TEST_EQ(m[keys[i]], values[i]);
+    }
+
+    // erase every other element
+    std::vector<std::string> erase_keys;
+    for (std::size_t i = 0; i < count; i += 2)
+        erase_keys.push_back(std::to_string(i));
+
+    HPX_TEST_EQ(m.erase(erase_keys).get(), erase_keys.size());
+    HPX_TEST_EQ(m.size(), count - erase_keys.size());
+    HPX_TEST_EQ(m.erase(hpx::launch::sync, erase_keys), std::size_t(0));
+
+    m.erase(hpx::launch::sync, keys);
+    HPX_TEST_EQ(m.size(), std::size_t(0));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename Key, typename Value, typename DistPolicy>
 void trivial_tests(DistPolicy const& policy)
 {
+    // bulk operations
+    {
+        hpx::unordered_map<Key, Value> m(policy);
+        test_bulk_operations(m, 107);
+    }
+
     // bucket_count
     {
         hpx::unordered_map<Key, Value> m(17, policy);
@@ -112,6 +158,11 @@ void trivial_tests(DistPolicy const& policy)
 template <typename Key, typename Value>
 void trivial_tests()
 {
+    // bulk operations
+    {
+        hpx::unordered_map<Key, Value> m;
+        test_bulk_operations(m, 107);
+    }
     // default constructed
     {
         hpx::unordered_map<Key, Value> m;
@@ -78,6 +78,12 @@ namespace hpx { namespace plugins { namespace parcel
 
         void update_num_messages();
         void update_interval();
+        void update_adaptive();
+        void update_latency_budget();
+
+        // adjust the number of parcels to coalesce and the flush interval
+        // based on the observed time between parcels (adaptive mode only)
+        void update_adaptive_parameters(std::int64_t time_since_last_parcel);
 
     private:
         mutable mutex_type mtx_;
@@ -90,6 +96,16 @@ namespace hpx { namespace plugins { namespace parcel
         bool allow_background_flush_;
         std::string action_name_;
 
+        // adaptive coalescing: num_coalesced_parcels_ is the upper limit for
+        // the number of parcels per message, the number of parcels and the
+        // flush interval are chosen such that the parcels don't wait longer
+        // than the latency budget [us]
+        bool adaptive_;
+        std::size_t latency_budget_;
+        double average_time_between_parcels_;    // [ns]
+        std::size_t adaptive_num_coalesced_parcels_;
+        std::size_t adaptive_interval_;          // [us]
+
         // performance counter data
         std::int64_t num_parcels_;
         std::int64_t reset_num_parcels_;
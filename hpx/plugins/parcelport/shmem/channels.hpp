@@ -0,0 +1,346 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/plugins/parcelport/shmem/shared_segment.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <string>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // All records and blocks placed into shared memory are aligned to (and
+    // padded to a multiple of) the size of a cache line.
+    constexpr std::uint64_t record_alignment = 64;
+
+    constexpr std::uint64_t align_up(std::uint64_t size)
+    {
+        return (size + record_alignment - 1) & ~(record_alignment - 1);
+    }
+
+    // "hpxshmem"
+    constexpr std::uint64_t segment_magic = 0x68707873686d656dULL;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A record describes one message (a set of encoded parcels) written to a
+    // channel. The body of the message (the transmission chunks, the
+    // references to the zero-copy chunks, and the serialized data) follows
+    // the record directly, or is placed into the message region of the
+    // sender if it is too large to be written to the channel.
+    enum record_kind : std::uint32_t
+    {
+        record_wrap = 0,            // skip to the beginning of the channel
+        record_inline = 1,          // the body follows the record
+        record_out_of_line = 2      // a region_ref to the body follows
+    };
+
+    struct record_header
+    {
+        std::uint32_t size_;        // bytes occupied in the channel
+        std::uint32_t kind_;
+        std::uint32_t sender_pid_;
+        std::uint32_t sender_nonce_;
+        std::uint64_t buffer_size_;
+        std::uint64_t data_size_;
+        std::uint32_t num_zero_copy_chunks_;
+        std::uint32_t num_non_zero_copy_chunks_;
+        std::uint64_t body_size_;
+    };
+
+    static_assert(sizeof(record_header) <= record_alignment,
+        "a record header has to fit into the minimal record");
+
+    // Refers to memory in the message region of the sender (segment_ == 0)
+    // or to a dedicated shared memory object holding a single message
+    // (segment_ != 0).
+    struct region_ref
+    {
+        std::uint64_t segment_;
+        std::uint64_t offset_;
+        std::uint64_t size_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct segment_header
+    {
+        std::atomic<std::uint64_t> magic_;
+        std::uint32_t num_channels_;
+        std::uint32_t channel_size_;
+
+        // all channels ever claimed have an index below this value
+        std::atomic<std::uint32_t> num_active_;
+    };
+
+    // Each channel is a single producer, single consumer ring buffer. A
+    // channel is claimed by a sending connection for its whole lifetime,
+    // the receiving locality polls all active channels.
+    struct channel_header
+    {
+        std::atomic<std::uint32_t> owner_;
+
+        // the number of bytes ever written/consumed, written only by the
+        // current owner and the receiver, respectively
+        alignas(record_alignment) std::atomic<std::uint64_t> head_;
+        alignas(record_alignment) std::atomic<std::uint64_t> tail_;
+    };
+
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+        "the shared memory parcelport relies on address free atomics");
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The receive channels of a locality placed into a shared memory segment
+    // owned by this locality. Sending localities map the segment and write
+    // their messages to the channels they claimed.
+    class channels
+    {
+    private:
+        static std::uint64_t headers_size(std::uint32_t num_channels)
+        {
+            return align_up(sizeof(segment_header)) +
+                num_channels * align_up(sizeof(channel_header));
+        }
+
+        explicit channels(std::shared_ptr<shared_segment> segment)
+          : segment_(std::move(segment))
+          , header_(reinterpret_cast<segment_header*>(segment_->data()))
+          , channels_(reinterpret_cast<channel_header*>(
+                segment_->data() + align_up(sizeof(segment_header))))
+          , rings_(segment_->data() + headers_size(header_->num_channels_))
+        {
+        }
+
+    public:
+        channels()
+          : header_(nullptr)
+          , channels_(nullptr)
+          , rings_(nullptr)
+        {
+        }
+
+        /// Create the receive channels of this locality
+        static channels create(std::string const& name,
+            std::uint32_t num_channels, std::uint32_t channel_size,
+            error_code& ec = throws)
+        {
+            channel_size = static_cast<std::uint32_t>(align_up(channel_size));
+
+            std::shared_ptr<shared_segment> segment =
+                shared_segment::create(name,
+                    headers_size(num_channels) +
+                        std::uint64_t(num_channels) * channel_size,
+                    ec);
+            if (!segment)
+                return channels();
+
+            char* data = segment->data();
+            segment_header* header = new (data) segment_header;
+            header->num_channels_ = num_channels;
+            header->channel_size_ = channel_size;
+            header->num_active_.store(0, std::memory_order_relaxed);
+
+            data += align_up(sizeof(segment_header));
+            for (std::uint32_t i = 0; i != num_channels; ++i)
+            {
+                channel_header* c = new (data) channel_header;
+                c->owner_.store(0, std::memory_order_relaxed);
+                c->head_.store(0, std::memory_order_relaxed);
+                c->tail_.store(0, std::memory_order_relaxed);
+                data += align_up(sizeof(channel_header));
+            }
+
+            header->magic_.store(segment_magic, std::memory_order_release);
+            return channels(std::move(segment));
+        }
+
+        /// Map the receive channels of another locality
+        static channels open(std::string const& name, error_code& ec = throws)
+        {
+            std::shared_ptr<shared_segment> segment =
+                shared_segment::open(name, ec);
+            if (!segment)
+                return channels();
+
+            segment_header const* header =
+                reinterpret_cast<segment_header const*>(segment->data());
+            if (segment->size() < sizeof(segment_header) ||
+                header->magic_.load(std::memory_order_acquire) !=
+                    segment_magic)
+            {
+                HPX_THROWS_IF(ec, network_error, "shmem::channels::open",
+                    "shared memory object '" + name +
+                        "' does not hold shared memory parcelport channels");
+                return channels();
+            }
+
+            return channels(std::move(segment));
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return header_ != nullptr;
+        }
+
+        std::string const& name() const
+        {
+            return segment_->name();
+        }
+
+        std::uint32_t num_channels() const
+        {
+            return header_->num_channels_;
+        }
+
+        std::uint32_t num_active() const
+        {
+            return header_->num_active_.load(std::memory_order_acquire);
+        }
+
+        std::uint64_t channel_size() const
+        {
+            return header_->channel_size_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// Claim an unused channel, returns num_channels() if all channels
+        /// are in use.
+        std::uint32_t claim(std::uint32_t owner)
+        {
+            HPX_ASSERT(owner != 0);
+            for (std::uint32_t i = 0; i != num_channels(); ++i)
+            {
+                std::uint32_t expected = 0;
+                if (get(i).owner_.compare_exchange_strong(expected, owner,
+                        std::memory_order_acq_rel, std::memory_order_relaxed))
+                {
+                    std::uint32_t active =
+                        header_->num_active_.load(std::memory_order_relaxed);
+                    while (active < i + 1 &&
+                        !header_->num_active_.compare_exchange_weak(active,
+                            i + 1, std::memory_order_release,
+                            std::memory_order_relaxed))
+                    {
+                    }
+                    return i;
+                }
+            }
+            return num_channels();
+        }
+
+        void release(std::uint32_t channel)
+        {
+            get(channel).owner_.store(0, std::memory_order_release);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // sending side (the owner of the channel)
+
+        /// Reserve the given number of bytes (a multiple of record_alignment)
+        /// for a new record, returns nullptr if there is not enough space
+        /// available at this point. The record becomes visible to the
+        /// receiver only after it was committed. Records may not be larger
+        /// than half of the channel, otherwise the padding needed for
+        /// wrapping around could prevent them from ever being written.
+        record_header* begin_write(
+            std::uint32_t channel, std::uint64_t size, std::uint64_t& new_head)
+        {
+            HPX_ASSERT(size % record_alignment == 0);
+            HPX_ASSERT(size <= channel_size() / 2);
+
+            channel_header& c = get(channel);
+            std::uint64_t const head = c.head_.load(std::memory_order_relaxed);
+            std::uint64_t const tail = c.tail_.load(std::memory_order_acquire);
+
+            std::uint64_t const capacity = channel_size();
+            std::uint64_t offset = head % capacity;
+            std::uint64_t padding =
+                offset + size > capacity ? capacity - offset : 0;
+
+            if (head + padding + size - tail > capacity)
+                return nullptr;
+
+            if (padding != 0)
+            {
+                record_header* wrap = at(channel, offset);
+                wrap->size_ = static_cast<std::uint32_t>(padding);
+                wrap->kind_ = record_wrap;
+                offset = 0;
+            }
+
+            new_head = head + padding + size;
+            return at(channel, offset);
+        }
+
+        void commit(std::uint32_t channel, std::uint64_t new_head)
+        {
+            get(channel).head_.store(new_head, std::memory_order_release);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // receiving side, calls for the same channel have to be serialized
+
+        /// Return the next record available in the given channel, if any
+        record_header* peek(std::uint32_t channel)
+        {
+            channel_header& c = get(channel);
+            std::uint64_t tail = c.tail_.load(std::memory_order_relaxed);
+
+            while (tail != c.head_.load(std::memory_order_acquire))
+            {
+                record_header* record =
+                    at(channel, tail % channel_size());
+                if (record->kind_ != record_wrap)
+                    return record;
+
+                tail += record->size_;
+                c.tail_.store(tail, std::memory_order_release);
+            }
+            return nullptr;
+        }
+
+        /// Release the space occupied by the given record
+        void consume(std::uint32_t channel, record_header const* record)
+        {
+            channel_header& c = get(channel);
+            c.tail_.store(c.tail_.load(std::memory_order_relaxed) +
+                    record->size_,
+                std::memory_order_release);
+        }
+
+    private:
+        channel_header& get(std::uint32_t channel)
+        {
+            HPX_ASSERT(channel < num_channels());
+            return *reinterpret_cast<channel_header*>(
+                reinterpret_cast<char*>(channels_) +
+                channel * align_up(sizeof(channel_header)));
+        }
+
+        record_header* at(std::uint32_t channel, std::uint64_t offset)
+        {
+            return reinterpret_cast<record_header*>(
+                rings_ + channel * channel_size() + offset);
+        }
+
+        std::shared_ptr<shared_segment> segment_;
+        segment_header* header_;
+        channel_header* channels_;
+        char* rings_;
+    };
+}}}}
+
+#endif
@@ -0,0 +1,124 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/util/ios_flags_saver.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace hpx { namespace parcelset
+{
+    namespace policies { namespace shmem
+    {
+        // The shared memory objects created by a locality are named after the
+        // process id and a random number (which guards against stale objects
+        // left behind by a process with the same id).
+        inline std::string segment_name(std::uint32_t pid, std::uint32_t nonce)
+        {
+            return "/hpx.shmem." + std::to_string(pid) + "." +
+                std::to_string(nonce);
+        }
+
+        class locality
+        {
+        public:
+            locality()
+              : pid_(0), nonce_(0)
+            {}
+
+            locality(std::string const& node, std::uint32_t pid,
+                    std::uint32_t nonce)
+              : node_(node), pid_(pid), nonce_(nonce)
+            {}
+
+            /// The name of the node the locality is running on
+            std::string const& node() const
+            {
+                return node_;
+            }
+
+            std::uint32_t pid() const
+            {
+                return pid_;
+            }
+
+            std::uint32_t nonce() const
+            {
+                return nonce_;
+            }
+
+            /// The name of the shared memory segment holding the receive
+            /// channels of this locality
+            std::string name() const
+            {
+                return segment_name(pid_, nonce_);
+            }
+
+            static const char *type()
+            {
+                return "shmem";
+            }
+
+            explicit operator bool() const noexcept
+            {
+                return pid_ != 0;
+            }
+
+            void save(serialization::output_archive & ar) const
+            {
+                ar << node_;
+                ar << pid_;
+                ar << nonce_;
+            }
+
+            void load(serialization::input_archive & ar)
+            {
+                ar >> node_;
+                ar >> pid_;
+                ar >> nonce_;
+            }
+
+        private:
+            friend bool operator==(locality const & lhs, locality const & rhs)
+            {
+                return lhs.pid_ == rhs.pid_ && lhs.nonce_ == rhs.nonce_ &&
+                    lhs.node_ == rhs.node_;
+            }
+
+            friend bool operator<(locality const & lhs, locality const & rhs)
+            {
+                if (lhs.node_ != rhs.node_)
+                    return lhs.node_ < rhs.node_;
+                if (lhs.pid_ != rhs.pid_)
+                    return lhs.pid_ < rhs.pid_;
+                return lhs.nonce_ < rhs.nonce_;
+            }
+
+            friend std::ostream & operator<<(std::ostream & os, locality const & loc)
+            {
+                hpx::util::ios_flags_saver ifs(os);
+                os << loc.node_ << ":" << loc.name();
+
+                return os;
+            }
+
+            std::string node_;
+            std::uint32_t pid_;
+            std::uint32_t nonce_;
+        };
+    }}
+}}
+
+#endif
@@ -0,0 +1,257 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/plugins/parcelport/shmem/channels.hpp>
+#include <hpx/plugins/parcelport/shmem/shared_segment.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Every allocation in the message region is preceded by a block header.
+    // The block stays in use until the receiver has released it.
+    struct alignas(record_alignment) region_block
+    {
+        std::atomic<std::uint32_t> in_use_;
+        std::uint64_t size_;        // including this header
+    };
+
+    inline std::string region_name(std::string const& name)
+    {
+        return name + ".r";
+    }
+
+    inline std::string dedicated_segment_name(
+        std::string const& name, std::uint64_t segment)
+    {
+        return name + "." + std::to_string(segment);
+    }
+
+    // The memory allocated for a message, the mapping of a dedicated segment
+    // is kept alive as long as this object exists.
+    struct region_allocation
+    {
+        region_ref ref_;
+        char* data_;
+        std::shared_ptr<shared_segment> segment_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The message region is a shared memory segment owned by the sending
+    // locality. Large messages (and all zero-copy chunks) are copied into
+    // the region once, the receiver refers to them in place and releases
+    // them when done. Blocks are allocated in order, the space of released
+    // blocks is reclaimed starting with the oldest one.
+    //
+    // Requests not fitting into the region at the point of the allocation
+    // are served by creating a dedicated shared memory object for the
+    // message which is removed by the receiver as soon as it has mapped it.
+    class message_region
+    {
+        using mutex_type = hpx::lcos::local::spinlock;
+
+    public:
+        message_region()
+          : capacity_(0)
+          , head_(0)
+          , tail_(0)
+          , next_segment_(0)
+        {
+        }
+
+        HPX_NON_COPYABLE(message_region);
+
+        /// Create the message region of this locality
+        bool create(
+            std::string const& name, std::size_t size, error_code& ec = throws)
+        {
+            size = static_cast<std::size_t>(align_up(size));
+            segment_ = shared_segment::create(
+                region_name(name), size + record_alignment, ec);
+            if (!segment_)
+                return false;
+
+            name_ = name;
+            capacity_ = size;
+            return true;
+        }
+
+        void destroy()
+        {
+            segment_.reset();
+        }
+
+        /// Allocate memory for a message of the given size
+        region_allocation allocate(std::size_t size, error_code& ec = throws)
+        {
+            region_allocation result;
+
+            std::uint64_t const need = sizeof(region_block) + align_up(size);
+            if (segment_ && need <= capacity_)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                reclaim();
+
+                std::uint64_t offset = head_ % capacity_;
+                std::uint64_t const padding =
+                    offset + need > capacity_ ? capacity_ - offset : 0;
+
+                if (head_ + padding + need - tail_ <= capacity_)
+                {
+                    if (padding != 0)
+                    {
+                        region_block* pad = block_at(offset);
+                        pad->size_ = padding;
+                        pad->in_use_.store(0, std::memory_order_relaxed);
+                        head_ += padding;
+                        offset = 0;
+                    }
+
+                    region_block* block = block_at(offset);
+                    block->size_ = need;
+                    block->in_use_.store(1, std::memory_order_relaxed);
+                    head_ += need;
+
+                    result.ref_.segment_ = 0;
+                    result.ref_.offset_ =
+                        record_alignment + offset + sizeof(region_block);
+                    result.ref_.size_ = size;
+                    result.data_ = segment_->data() + result.ref_.offset_;
+                    return result;
+                }
+            }
+
+            // create a dedicated shared memory object for this message
+            std::uint64_t const segment = ++next_segment_;
+            result.segment_ = shared_segment::create(
+                dedicated_segment_name(name_, segment),
+                size == 0 ? 1 : size, ec);
+            if (!result.segment_)
+                return result;
+
+            // the receiver removes the object once it has mapped it
+            result.segment_->release_ownership();
+
+            result.ref_.segment_ = segment;
+            result.ref_.offset_ = 0;
+            result.ref_.size_ = size;
+            result.data_ = result.segment_->data();
+            return result;
+        }
+
+    private:
+        region_block* block_at(std::uint64_t offset)
+        {
+            return new (segment_->data() + record_alignment + offset)
+                region_block;
+        }
+
+        region_block const* block_at(std::uint64_t offset) const
+        {
+            return reinterpret_cast<region_block const*>(
+                segment_->data() + record_alignment + offset);
+        }
+
+        void reclaim()
+        {
+            while (tail_ != head_)
+            {
+                region_block const* block = block_at(tail_ % capacity_);
+                if (block->in_use_.load(std::memory_order_acquire) != 0)
+                    break;
+                tail_ += block->size_;
+            }
+        }
+
+        mutex_type mtx_;
+        std::shared_ptr<shared_segment> segment_;
+        std::string name_;
+
+        std::uint64_t capacity_;
+        std::uint64_t head_;
+        std::uint64_t tail_;
+
+        std::atomic<std::uint64_t> next_segment_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Keeps memory referred to by a received message alive. Blocks in the
+    // message region of the sender are handed back to the sender once the
+    // last reference goes away.
+    class region_reference
+    {
+    public:
+        region_reference(
+            std::shared_ptr<shared_segment> segment, region_block* block)
+          : segment_(std::move(segment))
+          , block_(block)
+        {
+        }
+
+        HPX_NON_COPYABLE(region_reference);
+
+        ~region_reference()
+        {
+            if (block_ != nullptr)
+                block_->in_use_.store(0, std::memory_order_release);
+        }
+
+    private:
+        std::shared_ptr<shared_segment> segment_;
+        region_block* block_;
+    };
+
+    // A received zero-copy chunk referring to the memory it was placed in by
+    // the sender.
+    struct received_chunk
+    {
+        received_chunk()
+          : data_(nullptr)
+          , size_(0)
+        {
+        }
+
+        received_chunk(
+            std::shared_ptr<region_reference> ref, char* data, std::size_t size)
+          : ref_(std::move(ref))
+          , data_(data)
+          , size_(size)
+        {
+        }
+
+        char* data() const
+        {
+            return data_;
+        }
+
+        std::size_t size() const
+        {
+            return size_;
+        }
+
+        std::shared_ptr<region_reference> ref_;
+        char* data_;
+        std::size_t size_;
+    };
+}}}}
+
+#endif
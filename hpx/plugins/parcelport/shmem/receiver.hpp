@@ -0,0 +1,223 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/plugins/parcelport/shmem/channels.hpp>
+#include <hpx/plugins/parcelport/shmem/locality.hpp>
+#include <hpx/plugins/parcelport/shmem/message_region.hpp>
+#include <hpx/plugins/parcelport/shmem/shared_segment.hpp>
+#include <hpx/runtime/parcelset/decode_parcels.hpp>
+#include <hpx/runtime/parcelset/parcel_buffer.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    template <typename Parcelport>
+    struct receiver
+    {
+        typedef hpx::lcos::local::spinlock mutex_type;
+
+        // the received zero-copy chunks refer to the memory the sender has
+        // placed them in
+        typedef parcel_buffer<std::vector<char>, received_chunk> buffer_type;
+        typedef buffer_type::transmission_chunk_type transmission_chunk_type;
+
+        explicit receiver(Parcelport& pp)
+          : pp_(pp)
+        {}
+
+        void run(channels inbox)
+        {
+            channel_mtxs_.reset(new mutex_type[inbox.num_channels()]);
+            inbox_ = std::move(inbox);
+        }
+
+        void clear()
+        {
+            std::unique_lock<mutex_type> l(regions_mtx_);
+            regions_.clear();
+        }
+
+        bool background_work(std::size_t num_thread)
+        {
+            if (!inbox_)
+                return false;
+
+            bool has_work = false;
+
+            std::uint32_t const num_active = inbox_.num_active();
+            for (std::uint32_t i = 0; i != num_active; ++i)
+            {
+                // only one thread at a time may receive from a channel
+                std::unique_lock<mutex_type> l(
+                    channel_mtxs_[i], std::try_to_lock);
+                if (!l)
+                    continue;
+
+                record_header const* record = inbox_.peek(i);
+                if (record == nullptr)
+                    continue;
+
+                buffer_type buffer;
+                receive_record(*record, buffer);
+
+                // the message was copied out of the channel (or refers to the
+                // message region of the sender), release the space for new
+                // records before handling the parcels
+                inbox_.consume(i, record);
+                l.unlock();
+
+                decode_parcels(pp_, std::move(buffer), num_thread);
+                has_work = true;
+            }
+
+            return has_work;
+        }
+
+    private:
+        void receive_record(record_header const& record, buffer_type& buffer)
+        {
+            performance_counters::parcels::data_point& data =
+                buffer.data_point_;
+            data.time_ = hpx::chrono::high_resolution_clock::now();
+            data.bytes_ = static_cast<std::size_t>(record.buffer_size_);
+
+            buffer.size_ = record.buffer_size_;
+            buffer.data_size_ = record.data_size_;
+            buffer.num_chunks_ = buffer_type::count_chunks_type(
+                record.num_zero_copy_chunks_,
+                record.num_non_zero_copy_chunks_);
+
+            char const* body = reinterpret_cast<char const*>(&record + 1);
+
+            // the body of large messages is located in the message region of
+            // the sender, it is released as soon as it has been copied
+            received_chunk body_chunk;
+            if (record.kind_ == record_out_of_line)
+            {
+                region_ref ref;
+                std::memcpy(&ref, body, sizeof(region_ref));
+                body_chunk = resolve(record, ref);
+                body = body_chunk.data();
+            }
+            char const* const body_end = body + record.body_size_;
+
+            // the transmission chunks are sent only if there are zero-copy
+            // chunks
+            std::size_t const num_zero_copy_chunks =
+                record.num_zero_copy_chunks_;
+            if (num_zero_copy_chunks != 0)
+            {
+                buffer.transmission_chunks_.resize(num_zero_copy_chunks +
+                    record.num_non_zero_copy_chunks_);
+
+                std::size_t const size = buffer.transmission_chunks_.size() *
+                    sizeof(transmission_chunk_type);
+                std::memcpy(
+                    static_cast<void*>(buffer.transmission_chunks_.data()),
+                    body, size);
+                body += size;
+
+                buffer.chunks_.reserve(num_zero_copy_chunks);
+                for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+                {
+                    region_ref ref;
+                    std::memcpy(&ref, body, sizeof(region_ref));
+                    body += sizeof(region_ref);
+
+                    buffer.chunks_.push_back(resolve(record, ref));
+                }
+            }
+
+            HPX_ASSERT(body <= body_end);
+            buffer.data_.assign(body, body_end);
+
+            data.time_ = hpx::chrono::high_resolution_clock::now() - data.time_;
+        }
+
+        // Map the memory a message refers to
+        received_chunk resolve(record_header const& record,
+            region_ref const& ref)
+        {
+            std::string const name =
+                segment_name(record.sender_pid_, record.sender_nonce_);
+
+            std::shared_ptr<shared_segment> segment;
+            region_block* block = nullptr;
+            if (ref.segment_ == 0)
+            {
+                segment = sender_region(name);
+                block = reinterpret_cast<region_block*>(
+                    segment->data() + ref.offset_ - sizeof(region_block));
+            }
+            else
+            {
+                // dedicated objects are used for one message only, remove
+                // the name right away, the mapping stays valid
+                std::string const dedicated =
+                    dedicated_segment_name(name, ref.segment_);
+                segment = shared_segment::open(dedicated);
+                shared_segment::remove(dedicated);
+            }
+
+            if (ref.offset_ + ref.size_ > segment->size())
+            {
+                HPX_THROW_EXCEPTION(network_error,
+                    "shmem::receiver::resolve",
+                    "received a reference beyond the end of the shared "
+                    "memory object '" + segment->name() + "'");
+            }
+
+            char* data = segment->data() + ref.offset_;
+            return received_chunk(
+                std::make_shared<region_reference>(std::move(segment), block),
+                data, static_cast<std::size_t>(ref.size_));
+        }
+
+        std::shared_ptr<shared_segment> sender_region(std::string const& name)
+        {
+            std::unique_lock<mutex_type> l(regions_mtx_);
+
+            auto it = regions_.find(name);
+            if (it != regions_.end())
+                return it->second;
+
+            std::shared_ptr<shared_segment> region =
+                shared_segment::open(region_name(name));
+            regions_.emplace(name, region);
+            return region;
+        }
+
+        Parcelport & pp_;
+
+        channels inbox_;
+        std::unique_ptr<mutex_type[]> channel_mtxs_;
+
+        // the mapped message regions of the senders
+        mutex_type regions_mtx_;
+        std::map<std::string, std::shared_ptr<shared_segment>> regions_;
+    };
+}}}}
+
+#endif
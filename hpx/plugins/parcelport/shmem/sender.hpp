@@ -0,0 +1,151 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/assert.hpp>
+#include <hpx/functional/unique_function.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/plugins/parcelport/shmem/channels.hpp>
+#include <hpx/plugins/parcelport/shmem/locality.hpp>
+#include <hpx/plugins/parcelport/shmem/message_region.hpp>
+#include <hpx/plugins/parcelport/shmem/sender_connection.hpp>
+#include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/runtime/parcelset/parcelport.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    struct sender
+    {
+        using connection_type = sender_connection;
+        using connection_ptr = std::shared_ptr<connection_type>;
+        using connection_list = std::deque<connection_ptr>;
+
+        using mutex_type = hpx::lcos::local::spinlock;
+
+        sender(locality const& here, message_region& region)
+          : here_(here)
+          , region_(region)
+        {
+        }
+
+        connection_ptr create_connection(parcelset::locality const& l,
+            parcelset::parcelport* pp, error_code& ec)
+        {
+            locality const& dest = l.get<locality>();
+
+            channels dest_channels;
+            {
+                std::unique_lock<mutex_type> lk(channels_mtx_);
+                auto it = channels_.find(dest.name());
+                if (it != channels_.end())
+                {
+                    dest_channels = it->second;
+                }
+            }
+
+            if (!dest_channels)
+            {
+                dest_channels = channels::open(dest.name(), ec);
+                if (!dest_channels)
+                    return connection_ptr();
+
+                std::unique_lock<mutex_type> lk(channels_mtx_);
+                channels_.emplace(dest.name(), dest_channels);
+            }
+
+            if (&ec != &throws)
+                ec = make_success_code();
+
+            return std::make_shared<connection_type>(
+                this, l, std::move(dest_channels), region_, here_, pp);
+        }
+
+        void add(connection_ptr const & ptr)
+        {
+            std::unique_lock<mutex_type> l(connections_mtx_);
+            connections_.push_back(ptr);
+        }
+
+        void send_messages(
+            connection_ptr connection
+        )
+        {
+            // Check if sending has been completed....
+            if (connection->send())
+            {
+                error_code ec;
+                util::unique_function_nonser<
+                    void(
+                        error_code const&
+                      , parcelset::locality const&
+                      , connection_ptr
+                    )
+                > postprocess_handler;
+                std::swap(postprocess_handler, connection->postprocess_handler_);
+                postprocess_handler(
+                    ec, connection->destination(), connection);
+            }
+            else
+            {
+                std::unique_lock<mutex_type> l(connections_mtx_);
+                connections_.push_back(std::move(connection));
+            }
+        }
+
+        bool background_work()
+        {
+            connection_ptr connection;
+            {
+                std::unique_lock<mutex_type> l(connections_mtx_, std::try_to_lock);
+                if(l && !connections_.empty())
+                {
+                    connection = std::move(connections_.front());
+                    connections_.pop_front();
+                }
+            }
+            bool has_work = false;
+            if(connection)
+            {
+                send_messages(std::move(connection));
+                has_work = true;
+            }
+            return has_work;
+        }
+
+        void clear()
+        {
+            std::unique_lock<mutex_type> l(channels_mtx_);
+            channels_.clear();
+        }
+
+    private:
+        locality here_;
+        message_region& region_;
+
+        // the mapped channels of the destinations, shared by all connections
+        mutex_type channels_mtx_;
+        std::map<std::string, channels> channels_;
+
+        // connections waiting for space in the channel of the destination
+        mutex_type connections_mtx_;
+        connection_list connections_;
+    };
+}}}}
+
+#endif
@@ -0,0 +1,317 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/assert.hpp>
+#include <hpx/functional/unique_function.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/plugins/parcelport/shmem/channels.hpp>
+#include <hpx/plugins/parcelport/shmem/locality.hpp>
+#include <hpx/plugins/parcelport/shmem/message_region.hpp>
+#include <hpx/runtime/parcelset/parcelport.hpp>
+#include <hpx/runtime/parcelset/parcelport_connection.hpp>
+#include <hpx/runtime/parcelset_fwd.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    struct sender;
+    struct sender_connection;
+
+    void add_connection(sender *, std::shared_ptr<sender_connection> const&);
+
+    struct sender_connection
+      : parcelset::parcelport_connection<
+            sender_connection
+          , std::vector<char>
+        >
+    {
+    private:
+        typedef sender sender_type;
+
+        typedef std::vector<char> data_type;
+
+        enum connection_state
+        {
+            initialized
+          , placed_message
+        };
+
+        typedef
+            parcelset::parcelport_connection<sender_connection, data_type>
+            base_type;
+
+        typedef parcel_buffer_type::transmission_chunk_type
+            transmission_chunk_type;
+
+    public:
+        sender_connection(sender_type* s, parcelset::locality const& there,
+                channels dest, message_region& region,
+                locality const& here, parcelset::parcelport* pp)
+          : state_(initialized)
+          , sender_(s)
+          , dest_(std::move(dest))
+          , channel_(dest_.num_channels())
+          , region_(region)
+          , here_(here)
+          , body_ref_()
+          , kind_(record_inline)
+          , record_size_(0)
+          , pp_(pp)
+          , there_(there)
+        {
+        }
+
+        ~sender_connection()
+        {
+            if (channel_ != dest_.num_channels())
+                dest_.release(channel_);
+        }
+
+        parcelset::locality const& destination() const
+        {
+            return there_;
+        }
+
+        void verify_(parcelset::locality const & parcel_locality_id) const
+        {
+        }
+
+        template <typename Handler, typename ParcelPostprocess>
+        void async_write(Handler && handler, ParcelPostprocess && parcel_postprocess)
+        {
+            HPX_ASSERT(!handler_);
+            HPX_ASSERT(!postprocess_handler_);
+            HPX_ASSERT(!buffer_.data_.empty());
+            buffer_.data_point_.time_ = hpx::chrono::high_resolution_clock::now();
+
+            state_ = initialized;
+
+            handler_ = std::forward<Handler>(handler);
+
+            if(!send())
+            {
+                postprocess_handler_
+                    = std::forward<ParcelPostprocess>(parcel_postprocess);
+                add_connection(sender_, shared_from_this());
+            }
+            else
+            {
+                HPX_ASSERT(!handler_);
+                error_code ec;
+                parcel_postprocess(ec, there_, shared_from_this());
+            }
+        }
+
+        bool send()
+        {
+            switch(state_)
+            {
+                case initialized:
+                    return place_message();
+                case placed_message:
+                    return write_record();
+                default:
+                    HPX_ASSERT(false);
+            }
+
+            return false;
+        }
+
+        // Copy the zero-copy chunks into the message region of this
+        // locality, the receiver refers to them in place. The body of the
+        // message is placed into the region as well if it is too large to be
+        // written to the channel.
+        bool place_message()
+        {
+            HPX_ASSERT(state_ == initialized);
+
+            error_code ec(lightweight);
+
+            chunk_refs_.clear();
+            for (serialization::serialization_chunk const& c : buffer_.chunks_)
+            {
+                if (c.type_ != serialization::chunk_type_pointer)
+                    continue;
+
+                region_allocation chunk = region_.allocate(c.size_, ec);
+                if (ec)
+                    return done(ec);
+
+                std::memcpy(chunk.data_, c.data_.cpos_, c.size_);
+                chunk_refs_.push_back(chunk.ref_);
+            }
+
+            std::uint64_t const body_size = this->body_size();
+            std::uint64_t const inline_size =
+                align_up(sizeof(record_header) + body_size);
+
+            if (inline_size <= max_inline_size())
+            {
+                kind_ = record_inline;
+                record_size_ = inline_size;
+            }
+            else
+            {
+                region_allocation body = region_.allocate(body_size, ec);
+                if (ec)
+                    return done(ec);
+
+                write_body(body.data_);
+
+                kind_ = record_out_of_line;
+                record_size_ = align_up(sizeof(record_header) +
+                    sizeof(region_ref));
+                body_ref_ = body.ref_;
+            }
+
+            state_ = placed_message;
+            return write_record();
+        }
+
+        bool write_record()
+        {
+            HPX_ASSERT(state_ == placed_message);
+
+            // claim a channel of the destination, this may fail if all
+            // channels are in use by other connections at this point
+            if (channel_ == dest_.num_channels())
+            {
+                channel_ = dest_.claim(here_.pid());
+                if (channel_ == dest_.num_channels())
+                    return false;
+            }
+
+            std::uint64_t new_head = 0;
+            record_header* record =
+                dest_.begin_write(channel_, record_size_, new_head);
+            if (record == nullptr)
+                return false;
+
+            record->size_ = static_cast<std::uint32_t>(record_size_);
+            record->kind_ = kind_;
+            record->sender_pid_ = here_.pid();
+            record->sender_nonce_ = here_.nonce();
+            record->buffer_size_ = buffer_.size_;
+            record->data_size_ = buffer_.data_size_;
+            record->num_zero_copy_chunks_ = buffer_.num_chunks_.first;
+            record->num_non_zero_copy_chunks_ = buffer_.num_chunks_.second;
+            record->body_size_ = body_size();
+
+            char* body = reinterpret_cast<char*>(record + 1);
+            if (kind_ == record_inline)
+            {
+                write_body(body);
+            }
+            else
+            {
+                std::memcpy(body, &body_ref_, sizeof(region_ref));
+            }
+
+            dest_.commit(channel_, new_head);
+
+            return done(error_code(lightweight));
+        }
+
+        bool done(error_code const& ec)
+        {
+            handler_(ec);
+            handler_.reset();
+            buffer_.data_point_.time_ =
+                hpx::chrono::high_resolution_clock::now() - buffer_.data_point_.time_;
+            pp_->add_sent_data(buffer_.data_point_);
+            buffer_.clear();
+            chunk_refs_.clear();
+
+            state_ = initialized;
+
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        std::uint64_t body_size() const
+        {
+            return buffer_.transmission_chunks_.size() *
+                    sizeof(transmission_chunk_type) +
+                chunk_refs_.size() * sizeof(region_ref) +
+                buffer_.data_.size();
+        }
+
+        // messages larger than a quarter of the channel are placed into the
+        // message region
+        std::uint64_t max_inline_size() const
+        {
+            return dest_.channel_size() / 4;
+        }
+
+        void write_body(char* body) const
+        {
+            std::size_t const chunks_size =
+                buffer_.transmission_chunks_.size() *
+                sizeof(transmission_chunk_type);
+            if (chunks_size != 0)
+            {
+                std::memcpy(
+                    body, buffer_.transmission_chunks_.data(), chunks_size);
+                body += chunks_size;
+            }
+
+            std::size_t const refs_size =
+                chunk_refs_.size() * sizeof(region_ref);
+            if (refs_size != 0)
+            {
+                std::memcpy(body, chunk_refs_.data(), refs_size);
+                body += refs_size;
+            }
+
+            std::memcpy(body, buffer_.data_.data(), buffer_.data_.size());
+        }
+
+        connection_state state_;
+        sender_type * sender_;
+
+        channels dest_;
+        std::uint32_t channel_;
+        message_region& region_;
+        locality here_;
+
+        std::vector<region_ref> chunk_refs_;
+        region_ref body_ref_;
+        record_kind kind_;
+        std::uint64_t record_size_;
+
+        util::unique_function_nonser<
+            void(
+                error_code const&
+            )
+        > handler_;
+        util::unique_function_nonser<
+            void(
+                error_code const&
+              , parcelset::locality const&
+              , std::shared_ptr<sender_connection>
+            )
+        > postprocess_handler_;
+
+        parcelset::parcelport* pp_;
+
+        parcelset::locality there_;
+    };
+}}}}
+
+#endif
@@ -0,0 +1,188 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+
+#include <hpx/modules/errors.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string>
+
+namespace hpx { namespace parcelset { namespace policies { namespace shmem
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // A POSIX shared memory object mapped into the address space of this
+    // process. The mapping is removed when the last reference to the segment
+    // goes away, the shared memory object itself is removed at that point
+    // only if this process created it (and still owns it).
+    class shared_segment
+    {
+    private:
+        shared_segment(std::string const& name, void* data, std::size_t size,
+                bool owner)
+          : name_(name)
+          , data_(static_cast<char*>(data))
+          , size_(size)
+          , owner_(owner)
+        {
+        }
+
+        static std::string error_message(char const* what,
+            std::string const& name, int err)
+        {
+            return std::string(what) + " failed for shared memory object '" +
+                name + "': " + std::strerror(err);
+        }
+
+    public:
+        HPX_NON_COPYABLE(shared_segment);
+
+        ~shared_segment()
+        {
+            ::munmap(data_, size_);
+            if (owner_)
+                ::shm_unlink(name_.c_str());
+        }
+
+        /// Create a new shared memory object of the given size and map it.
+        /// Fails if an object with the same name exists already.
+        static std::shared_ptr<shared_segment> create(
+            std::string const& name, std::size_t size, error_code& ec = throws)
+        {
+            int fd = ::shm_open(
+                name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+            if (fd == -1)
+            {
+                HPX_THROWS_IF(ec, network_error,
+                    "shmem::shared_segment::create",
+                    error_message("shm_open", name, errno));
+                return std::shared_ptr<shared_segment>();
+            }
+
+            if (::ftruncate(fd, static_cast<off_t>(size)) != 0)
+            {
+                int const err = errno;
+                ::close(fd);
+                ::shm_unlink(name.c_str());
+                HPX_THROWS_IF(ec, network_error,
+                    "shmem::shared_segment::create",
+                    error_message("ftruncate", name, err));
+                return std::shared_ptr<shared_segment>();
+            }
+
+            void* data = ::mmap(
+                nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            int const err = errno;
+            ::close(fd);
+
+            if (data == MAP_FAILED)
+            {
+                ::shm_unlink(name.c_str());
+                HPX_THROWS_IF(ec, network_error,
+                    "shmem::shared_segment::create",
+                    error_message("mmap", name, err));
+                return std::shared_ptr<shared_segment>();
+            }
+
+            if (&ec != &throws)
+                ec = make_success_code();
+
+            return std::shared_ptr<shared_segment>(
+                new shared_segment(name, data, size, true));
+        }
+
+        /// Map an existing shared memory object created by another process
+        static std::shared_ptr<shared_segment> open(
+            std::string const& name, error_code& ec = throws)
+        {
+            int fd = ::shm_open(name.c_str(), O_RDWR, 0);
+            if (fd == -1)
+            {
+                HPX_THROWS_IF(ec, network_error, "shmem::shared_segment::open",
+                    error_message("shm_open", name, errno));
+                return std::shared_ptr<shared_segment>();
+            }
+
+            struct stat st;
+            if (::fstat(fd, &st) != 0 || st.st_size == 0)
+            {
+                int const err = errno;
+                ::close(fd);
+                HPX_THROWS_IF(ec, network_error, "shmem::shared_segment::open",
+                    error_message("fstat", name, err));
+                return std::shared_ptr<shared_segment>();
+            }
+
+            std::size_t const size = static_cast<std::size_t>(st.st_size);
+            void* data = ::mmap(
+                nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            int const err = errno;
+            ::close(fd);
+
+            if (data == MAP_FAILED)
+            {
+                HPX_THROWS_IF(ec, network_error, "shmem::shared_segment::open",
+                    error_message("mmap", name, err));
+                return std::shared_ptr<shared_segment>();
+            }
+
+            if (&ec != &throws)
+                ec = make_success_code();
+
+            return std::shared_ptr<shared_segment>(
+                new shared_segment(name, data, size, false));
+        }
+
+        /// Remove the shared memory object with the given name, existing
+        /// mappings stay valid
+        static void remove(std::string const& name)
+        {
+            ::shm_unlink(name.c_str());
+        }
+
+        /// Hand the responsibility for removing the shared memory object to
+        /// another process
+        void release_ownership()
+        {
+            owner_ = false;
+        }
+
+        std::string const& name() const
+        {
+            return name_;
+        }
+
+        char* data() const
+        {
+            return data_;
+        }
+
+        std::size_t size() const
+        {
+            return size_;
+        }
+
+    private:
+        std::string name_;
+        char* data_;
+        std::size_t size_;
+        bool owner_;
+    };
+}}}}
+
+#endif
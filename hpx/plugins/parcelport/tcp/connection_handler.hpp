@@ -15,6 +15,7 @@
 #if defined(HPX_HAVE_PARCELPORT_TCP)
 #include <hpx/config/asio.hpp>
 
+#include <hpx/plugins/parcelport/tcp/io_uring_service.hpp>
 #include <hpx/plugins/parcelport/tcp/locality.hpp>
 #include <hpx/runtime/parcelset/locality.hpp>
 #include <hpx/runtime/parcelset/parcelport_impl.hpp>
@@ -37,6 +38,7 @@ namespace hpx { namespace parcelset
     {
         class receiver;
         class sender;
+        class io_uring_service;
         class HPX_EXPORT connection_handler;
     }}
 
@@ -125,6 +127,12 @@ namespace hpx { namespace parcelset
             typedef std::set<boost::weak_ptr<sender> > write_connections_set;
             write_connections_set write_connections_;
 #endif
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            /// Performs the socket operations if io_uring is available
+            std::unique_ptr<io_uring_service> io_uring_;
+#endif
+            io_uring_service* get_io_uring() const;
         };
     }}
 }}
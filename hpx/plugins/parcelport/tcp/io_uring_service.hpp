@@ -0,0 +1,142 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PARCELPORT_TCP) &&                                        \
+    defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+
+#include <hpx/functional/unique_function.hpp>
+#include <hpx/io_service/io_service_pool.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <vector>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace hpx { namespace parcelset { namespace policies { namespace tcp
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Performs the socket operations of the TCP parcelport using a Linux
+    // io_uring instance instead of the Boost.Asio reactor.
+    //
+    // Operations issued concurrently by different connections are placed
+    // into the submission queue and handed to the kernel with a single
+    // system call: the first thread finding no submission in progress
+    // submits everything which was queued in the meantime. Messages small
+    // enough to fit into one of the registered buffers are copied into such
+    // a buffer and written (read) with a single fixed buffer operation.
+    //
+    // A dedicated thread reaps the completions and posts the handlers to the
+    // io_service pool of the parcelport, the handlers are invoked with the
+    // same arguments as the handlers passed to boost::asio::async_write and
+    // boost::asio::async_read.
+    class HPX_EXPORT io_uring_service
+    {
+        using mutex_type = hpx::lcos::local::spinlock;
+
+    public:
+        using handler_type = util::unique_function_nonser<void(
+            boost::system::error_code const&, std::size_t)>;
+
+        /// Set up the io_uring instance. The object is invalid (converts to
+        /// false) if io_uring is not supported by the running kernel.
+        io_uring_service(util::io_service_pool& pool, std::uint32_t entries,
+            std::size_t num_buffers, std::size_t buffer_size);
+
+        ~io_uring_service();
+
+        HPX_NON_COPYABLE(io_uring_service);
+
+        explicit operator bool() const noexcept
+        {
+            return ring_fd_ != -1;
+        }
+
+        /// Stop reaping completions, all operations issued afterwards fail
+        /// with operation_aborted.
+        void stop();
+
+        /// Write all of the given buffers to the socket
+        void async_write(int fd,
+            std::vector<boost::asio::const_buffer> const& buffers,
+            handler_type&& handler);
+
+        /// Read from the socket until all of the given buffers are filled
+        void async_read(int fd,
+            std::vector<boost::asio::mutable_buffer> const& buffers,
+            handler_type&& handler);
+
+    private:
+        struct operation;
+
+        bool setup_ring(std::uint32_t entries);
+        void setup_buffers(std::size_t num_buffers, std::size_t buffer_size);
+
+        int acquire_buffer();
+        void release_buffer(int index);
+
+        void submit(operation* op);
+        void flush();
+        unsigned unsubmitted() const;
+        void prepare(io_uring_sqe& sqe, operation* op);
+        void complete(operation* op, int result);
+        void post(operation* op, boost::system::error_code const& ec);
+
+        void run();
+
+        util::io_service_pool& pool_;
+
+        int ring_fd_;
+        std::atomic<bool> stopped_;
+
+        // the memory mapped submission and completion queues
+        void* sq_ring_;
+        void* cq_ring_;
+        std::size_t sq_ring_size_;
+        std::size_t cq_ring_size_;
+
+        unsigned* sq_head_;
+        unsigned* sq_tail_;
+        unsigned sq_mask_;
+        unsigned sq_entries_;
+        unsigned* sq_array_;
+        io_uring_sqe* sqes_;
+
+        unsigned* cq_head_;
+        unsigned* cq_tail_;
+        unsigned cq_mask_;
+        io_uring_cqe* cqes_;
+
+        // operations waiting to be placed into the submission queue
+        mutex_type sq_mtx_;
+        std::deque<operation*> waiting_;
+        bool submitting_;
+
+        // the registered buffers
+        std::unique_ptr<char[]> buffers_;
+        std::size_t buffer_size_;
+        mutex_type buffers_mtx_;
+        std::vector<int> free_buffers_;
+
+        std::unique_ptr<operation> stop_op_;
+        std::thread reaper_;
+    };
+}}}}
+
+#endif
@@ -21,6 +21,7 @@
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/functional/bind.hpp>
 #include <hpx/functional/protect.hpp>
+#include <hpx/plugins/parcelport/tcp/io_uring_service.hpp>
 #include <hpx/runtime/parcelset/decode_parcels.hpp>
 #include <hpx/runtime/parcelset/detail/data_point.hpp>
 #include <hpx/runtime/parcelset/detail/gatherer.hpp>
@@ -51,6 +52,7 @@
 namespace hpx { namespace parcelset { namespace policies { namespace tcp
 {
     class connection_handler;
+    class io_uring_service;
 
     class receiver
       : public parcelport_connection<receiver, std::vector<char>, std::vector<char> >
@@ -58,7 +60,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         typedef hpx::lcos::local::spinlock mutex_type;
     public:
         receiver(boost::asio::io_service& io_service, std::uint64_t max_inbound_size,
-            connection_handler& parcelport)
+            connection_handler& parcelport, io_uring_service* io_uring = nullptr)
           : socket_(io_service)
           , max_inbound_size_(max_inbound_size)
           , ack_(0)
@@ -66,6 +68,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
           , timer_()
           , mtx_()
           , operation_in_flight_(0)
+          , io_uring_(io_uring)
         {}
 
         ~receiver()
@@ -119,7 +122,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                         std::size_t, Handler)
                     = &receiver::handle_read_header<Handler>;
 
-                boost::asio::async_read(socket_, buffers,
+                do_async_read(buffers,
                     util::bind(f, shared_from_this(),
                         boost::asio::placeholders::error,
                         boost::asio::placeholders::bytes_transferred,
@@ -143,6 +146,41 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         }
 
     private:
+        // Issue the socket operations either through the io_uring service or
+        // through Boost.Asio
+        template <typename Handler>
+        void do_async_read(
+            std::vector<boost::asio::mutable_buffer> const& buffers,
+            Handler&& handler)
+        {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (io_uring_ != nullptr)
+            {
+                io_uring_->async_read(socket_.native_handle(), buffers,
+                    std::forward<Handler>(handler));
+                return;
+            }
+#endif
+            boost::asio::async_read(
+                socket_, buffers, std::forward<Handler>(handler));
+        }
+
+        template <typename Handler>
+        void do_async_write(
+            boost::asio::const_buffer const& buffer, Handler&& handler)
+        {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (io_uring_ != nullptr)
+            {
+                io_uring_->async_write(socket_.native_handle(), {buffer},
+                    std::forward<Handler>(handler));
+                return;
+            }
+#endif
+            boost::asio::async_write(
+                socket_, buffer, std::forward<Handler>(handler));
+        }
+
         /// Handle a completed read of the message size from the
         /// message header.
         template <typename Handler>
@@ -230,7 +268,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                         IPPROTO_TCP, TCP_QUICKACK> quickack(true);
                     socket_.set_option(quickack);
 #endif
-                    boost::asio::async_read(socket_, buffers,
+                    do_async_read(buffers,
                         util::bind(f, shared_from_this(),
                             boost::asio::placeholders::error,
                             util::protect(handler)));
@@ -289,7 +327,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                         IPPROTO_TCP, TCP_QUICKACK> quickack(true);
                     socket_.set_option(quickack);
 #endif
-                    boost::asio::async_read(socket_, buffers,
+                    do_async_read(buffers,
                         util::bind(f, shared_from_this(),
                             boost::asio::placeholders::error,
                             util::protect(handler)));
@@ -334,8 +372,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                             boost::asio::error::not_connected));
                         return;
                     }
-                    boost::asio::async_write(socket_,
-                        boost::asio::buffer(&ack_, sizeof(ack_)),
+                    do_async_write(boost::asio::buffer(&ack_, sizeof(ack_)),
                         util::bind(f, shared_from_this(),
                             boost::asio::placeholders::error,
                             util::protect(handler)));
@@ -375,6 +412,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
         mutex_type mtx_;
         hpx::util::atomic_count operation_in_flight_;
+
+        io_uring_service* io_uring_;
     };
 }}}}
 
@@ -19,6 +19,7 @@
 #include <hpx/functional/bind.hpp>
 #include <hpx/functional/deferred_call.hpp>
 #include <hpx/functional/unique_function.hpp>
+#include <hpx/plugins/parcelport/tcp/io_uring_service.hpp>
 #include <hpx/plugins/parcelport/tcp/locality.hpp>
 #include <hpx/runtime/parcelset/detail/data_point.hpp>
 #include <hpx/runtime/parcelset/detail/gatherer.hpp>
@@ -49,6 +50,8 @@
 
 namespace hpx { namespace parcelset { namespace policies { namespace tcp
 {
+    class io_uring_service;
+
     class sender
       : public parcelset::parcelport_connection<sender, std::vector<char> >
     {
@@ -57,14 +60,18 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
     public:
         /// Construct a sending parcelport_connection with the given io_service.
+        /// All socket operations are performed using the given io_uring
+        /// service if one is passed.
         sender(boost::asio::io_service& io_service,
                 parcelset::locality const& locality_id,
-                parcelset::parcelport* pp)
+                parcelset::parcelport* pp,
+                io_uring_service* io_uring = nullptr)
           : socket_(io_service)
           , ack_(0)
           , there_(locality_id)
           , timer_()
           , pp_(pp)
+          , io_uring_(io_uring)
         {
         }
 
@@ -171,6 +178,14 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
             using util::placeholders::_1;
             using util::placeholders::_2;
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (io_uring_ != nullptr)
+            {
+                io_uring_->async_write(socket_.native_handle(), buffers,
+                    util::bind(f, shared_from_this(), _1, _2));
+                return;
+            }
+#endif
             boost::asio::async_write(socket_, buffers,
                 util::bind(f, shared_from_this(), _1, _2));
         }
@@ -239,6 +254,15 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                 = &sender::handle_read_ack;
 
             using util::placeholders::_1;
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (io_uring_ != nullptr)
+            {
+                io_uring_->async_read(socket_.native_handle(),
+                    {boost::asio::buffer(&ack_, sizeof(ack_))},
+                    util::bind(f, shared_from_this(), _1));
+                return;
+            }
+#endif
             boost::asio::async_read(socket_,
                 boost::asio::buffer(&ack_, sizeof(ack_)),
                 util::bind(f, shared_from_this(), _1));
@@ -276,6 +300,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         hpx::chrono::high_resolution_timer timer_;
         parcelset::parcelport* pp_;
 
+        io_uring_service* io_uring_;
+
         postprocess_handler_type handler_;
         util::unique_function_nonser<
             void(
@@ -18,6 +18,7 @@
 #include <hpx/cache/lru_cache.hpp>
 #include <hpx/cache/statistics/local_full_statistics.hpp>
 #include <hpx/components_base/pinned_ptr.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/runtime_configuration.hpp>
@@ -78,13 +79,24 @@ public:
       , gva
       , hpx::util::cache::statistics::local_full_statistics
     > gva_cache_type;
+
+    // The cache is split into a (configurable) number of shards, each of
+    // which is protected by its own lock. Eviction is LRU per shard and
+    // approximates LRU for the cache as a whole.
+    struct gva_cache_shard
+    {
+        mutable mutex_type mtx_;
+        std::shared_ptr<gva_cache_type> cache_;
+    };
+
+    typedef util::cache_aligned_data_derived<gva_cache_shard>
+        gva_cache_shard_type;
     // }}}
 
     typedef std::set<naming::gid_type> migrated_objects_table_type;
     typedef std::map<naming::gid_type, std::int64_t> refcnt_requests_type;
 
-    mutable mutex_type gva_cache_mtx_;
-    std::shared_ptr<gva_cache_type> gva_cache_;
+    std::vector<std::unique_ptr<gva_cache_shard_type>> gva_cache_shards_;
 
     mutable mutex_type migrated_objects_mtx_;
     migrated_objects_table_type migrated_objects_table_;
@@ -301,6 +313,15 @@ private:
     std::uint64_t get_cache_update_entry_time(bool reset);
     std::uint64_t get_cache_erase_entry_time(bool reset);
 
+    // Helper functions to access the shards of the gva cache
+    gva_cache_shard& get_cache_shard(naming::gid_type const& gid) const;
+
+    template <typename F>
+    void for_each_cache_shard(gva_cache_key const& key, F&& f) const;
+
+    template <typename F>
+    void for_each_cache_shard(F&& f) const;
+
 public:
     /// \brief Add a locality to the runtime.
     bool register_locality(
@@ -100,6 +100,9 @@ namespace hpx { namespace components { namespace detail
         void free(void *p, std::size_t count = 1) override;
         bool did_alloc (void *p) const override;
 
+        std::size_t alloc_some(void** result, std::size_t count) override;
+        void free_some(std::size_t count) override;
+
         // Get the global id of the managed_component instance given by the
         // parameter p.
         //
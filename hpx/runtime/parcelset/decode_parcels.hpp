@@ -31,6 +31,7 @@
 #include <cstdint>
 #include <exception>
 #include <functional>
+#include <memory>
 #include <sstream>
 #include <utility>
 #include <vector>
@@ -113,6 +114,7 @@ namespace hpx { namespace parcelset
       , std::size_t parcel_count
       , std::vector<serialization::serialization_chunk> &chunks
       , std::size_t num_thread = -1
+      , std::shared_ptr<void> chunks_owner = std::shared_ptr<void>()
     )
     {
         std::size_t inbound_data_size = static_cast<std::size_t>(
@@ -131,7 +133,7 @@ namespace hpx { namespace parcelset
                     std::vector<parcel> deferred_parcels;
                     // De-serialize the parcel data
                     serialization::input_archive archive(buffer.data_,
-                        inbound_data_size, &chunks);
+                        inbound_data_size, &chunks, std::move(chunks_owner));
 
                     if(parcel_count == 0)
                     {
@@ -286,8 +288,22 @@ namespace hpx { namespace parcelset
     {
         std::vector<serialization::serialization_chunk>
             chunks(decode_chunks(buffer));
+
+        // Hand the memory of the received zero-copy chunks over to the
+        // archive, this allows for the de-serialized objects to refer to the
+        // received data instead of copying it. Moving the chunk containers
+        // leaves the chunk data in place.
+        std::shared_ptr<void> chunks_owner;
+        if (pp.allow_zero_copy_receive_optimizations() &&
+            !buffer.chunks_.empty())
+        {
+            using chunks_type = decltype(buffer.chunks_);
+            chunks_owner =
+                std::make_shared<chunks_type>(std::move(buffer.chunks_));
+        }
+
         decode_message_with_chunks(pp, std::move(buffer),
-            parcel_count, chunks, num_thread);
+            parcel_count, chunks, num_thread, std::move(chunks_owner));
     }
 
     template <typename Parcelport, typename Buffer>
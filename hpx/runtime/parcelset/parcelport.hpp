@@ -320,6 +320,12 @@ namespace hpx { namespace parcelset
             return allow_zero_copy_optimizations_;
         }
 
+        /// Return whether received zero copy chunks may be used in place
+        bool allow_zero_copy_receive_optimizations() const
+        {
+            return allow_zero_copy_receive_optimizations_;
+        }
+
         bool async_serialization() const
         {
             return async_serialization_;
@@ -367,6 +373,7 @@ namespace hpx { namespace parcelset
         /// serialization is allowed to use array optimization
         bool allow_array_optimizations_;
         bool allow_zero_copy_optimizations_;
+        bool allow_zero_copy_receive_optimizations_;
 
         /// async serialization of parcels
         bool async_serialization_;
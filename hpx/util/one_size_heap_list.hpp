@@ -9,9 +9,11 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/util/wrapper_heap_base.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <list>
 #include <memory>
@@ -37,6 +39,53 @@ namespace hpx { namespace util
         typedef wrapper_heap_base::heap_parameters heap_parameters;
 
     private:
+        // Each worker thread reserves a range of consecutive elements from
+        // one of the heaps and hands them out without synchronization. The
+        // elements are never reused after they have been freed (this would
+        // reuse their global ids), instead the number of freed elements is
+        // accumulated per heap and reported to the heaps in batches.
+        struct thread_cache
+        {
+            enum
+            {
+                // maximum number of heaps with pending frees
+                max_pending_heaps = 4,
+                // report the pending frees after this many frees
+                flush_threshold = 256
+            };
+
+            struct pending_free
+            {
+                std::shared_ptr<util::wrapper_heap_base> heap_;
+                std::size_t count_;
+            };
+
+            thread_cache()
+              : next_(nullptr)
+              , end_(nullptr)
+              , used_(false)
+              , num_pending_heaps_(0)
+              , num_pending_(0)
+            {
+            }
+
+            bool add_pending(void* p);
+            bool add_pending(
+                std::shared_ptr<util::wrapper_heap_base> const& heap);
+
+            // the reserved elements [next_, end_) belong to heap_
+            std::shared_ptr<util::wrapper_heap_base> heap_;
+            char* next_;
+            char* end_;
+
+            // elements were handed out since the last flush
+            bool used_;
+
+            pending_free pending_[max_pending_heaps];
+            std::size_t num_pending_heaps_;
+            std::size_t num_pending_;
+        };
+
         template <typename Heap>
         static std::shared_ptr<util::wrapper_heap_base> create_heap(
             char const* name, std::size_t counter, heap_parameters parameters)
@@ -60,6 +109,8 @@ namespace hpx { namespace util
 #endif
             , create_heap_(nullptr)
             , parameters_({0, 0, 0})
+            , num_caches_(caches_uninitialized)
+            , cache_size_(0)
         {
             HPX_ASSERT(false); // shouldn't ever be called
         }
@@ -76,6 +127,8 @@ namespace hpx { namespace util
 #endif
             , create_heap_(&one_size_heap_list::create_heap<Heap>)
             , parameters_(parameters)
+            , num_caches_(caches_uninitialized)
+            , cache_size_(0)
         {}
 
         template <typename Heap>
@@ -90,6 +143,8 @@ namespace hpx { namespace util
 #endif
             , create_heap_(&one_size_heap_list::create_heap<Heap>)
             , parameters_(parameters)
+            , num_caches_(caches_uninitialized)
+            , cache_size_(0)
         {}
 
         ~one_size_heap_list() noexcept;
@@ -106,7 +161,21 @@ namespace hpx { namespace util
 
         std::string name() const;
 
+    private:
+        // allocate up to count consecutive elements from any of the heaps
+        std::size_t alloc_some(void** p, std::size_t count,
+            std::shared_ptr<util::wrapper_heap_base>& heap);
+
+        thread_cache* get_cache();
+        std::size_t init_caches();
+        void* refill_cache();
+        void free_cached(void* p);
+        void flush_cache(thread_cache& cache);
+
     protected:
+        // return the heap which allocated the given element
+        std::shared_ptr<util::wrapper_heap_base> find_heap(void* p);
+
         mutable mutex_type mtx_;
         list_type heap_list_;
 
@@ -124,6 +193,14 @@ namespace hpx { namespace util
             char const*, std::size_t, heap_parameters);
 
         heap_parameters const parameters_;
+
+    private:
+        static constexpr std::size_t caches_uninitialized = std::size_t(-1);
+
+        // one cache per worker thread, initialized on first use
+        std::atomic<std::size_t> num_caches_;
+        std::size_t cache_size_;
+        std::unique_ptr<util::cache_aligned_data<thread_cache>[]> caches_;
     };
 }}
 
@@ -29,6 +29,14 @@ namespace hpx { namespace util
         virtual bool did_alloc (void *p) const = 0;
         virtual void free(void *p, std::size_t count = 1) = 0;
 
+        // Allocate up to count consecutive elements, returns the number of
+        // elements actually allocated (zero if the heap is exhausted).
+        virtual std::size_t alloc_some(void** result, std::size_t count) = 0;
+
+        // Return count elements to the heap without identifying them, used
+        // for releasing elements which were allocated by this heap in bulk.
+        virtual void free_some(std::size_t count) = 0;
+
         virtual naming::gid_type get_gid(util::unique_id_ranges& ids, void* p,
             components::component_type type) = 0;
 
@@ -0,0 +1,62 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file thread_local_slab_allocator.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx { namespace util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The slab allocator keeps one heap per OS-thread. Each heap manages a set
+    // of size classes (multiples of 32 bytes up to 1024 bytes), the blocks of
+    // a size class are carved from larger slabs and are kept in a free list
+    // owned by the heap. Allocations and deallocations on the owning thread
+    // don't need any synchronization. Blocks released on a different thread
+    // are pushed onto a lock-free list of remotely freed blocks which is
+    // drained by the owning heap whenever one of its free lists runs empty.
+    //
+    // Heaps of exited threads are adopted by newly created threads, their
+    // slabs are never returned to the system. Requests for larger blocks and
+    // all requests while the allocator is disabled are forwarded to the
+    // global operator new.
+
+    /// Allocate a block of at least \a size bytes. The returned memory is
+    /// suitably aligned for all types not requiring extended alignment.
+    HPX_CORE_EXPORT void* slab_allocate(std::size_t size);
+
+    /// Release a block previously allocated using \a slab_allocate. The block
+    /// may be released on any thread.
+    HPX_CORE_EXPORT void slab_deallocate(void* p) noexcept;
+
+    /// Enable or disable the slab allocator. Blocks allocated while the
+    /// allocator was enabled may still be released after disabling it (and
+    /// vice versa).
+    HPX_CORE_EXPORT void enable_slab_allocator(bool enable);
+
+    /// Return whether the slab allocator is currently enabled
+    HPX_CORE_EXPORT bool slab_allocator_enabled();
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Statistics of the slab allocator (aggregated over all heaps)
+
+    /// Number of allocations served from a heap
+    HPX_CORE_EXPORT std::int64_t get_slab_allocation_count(bool reset);
+
+    /// Number of allocations forwarded to the global operator new
+    HPX_CORE_EXPORT std::int64_t get_slab_fallback_allocation_count(bool reset);
+
+    /// Number of blocks released on a thread not owning them
+    HPX_CORE_EXPORT std::int64_t get_slab_remote_free_count(bool reset);
+
+    /// Number of bytes currently held in slabs by all heaps
+    HPX_CORE_EXPORT std::int64_t get_slab_reserved_size();
+}}    // namespace hpx::util
@@ -0,0 +1,382 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/thread_local_slab_allocator.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace hpx { namespace util {
+
+    namespace {
+
+        ///////////////////////////////////////////////////////////////////////
+        constexpr std::size_t granularity = 32;
+        constexpr std::size_t num_size_classes = 32;
+        constexpr std::size_t max_block_size = granularity * num_size_classes;
+
+        // the minimal size of the slabs the blocks are carved from, slabs
+        // hold at least min_blocks_per_slab blocks
+        constexpr std::size_t min_slab_size = 16384;
+        constexpr std::size_t min_blocks_per_slab = 8;
+
+        struct slab_heap;
+
+        // every block is preceded by a header identifying its owning heap
+        // (nullptr for blocks allocated using the global operator new)
+        struct alignas(16) block_header
+        {
+            slab_heap* owner;
+            std::size_t size_class;
+        };
+
+        // free blocks are linked through their first bytes
+        struct free_block
+        {
+            free_block* next;
+        };
+
+        inline block_header* get_header(void* p)
+        {
+            return static_cast<block_header*>(p) - 1;
+        }
+
+        inline void* get_block(block_header* h)
+        {
+            return h + 1;
+        }
+
+        // counters are modified by the owning thread only, but may be read
+        // concurrently
+        inline void increment(std::atomic<std::int64_t>& counter,
+            std::int64_t value = 1) noexcept
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + value,
+                std::memory_order_relaxed);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        struct slab_heap
+        {
+            slab_heap()
+              : remote_frees_(nullptr)
+              , allocations_(0)
+              , remote_free_count_(0)
+              , reserved_size_(0)
+            {
+                for (free_block*& l : free_lists_)
+                {
+                    l = nullptr;
+                }
+            }
+
+            void* allocate(std::size_t size_class)
+            {
+                free_block* b = free_lists_[size_class];
+                if (b == nullptr)
+                {
+                    collect_remote_frees();
+                    b = free_lists_[size_class];
+                    if (b == nullptr)
+                    {
+                        add_slab(size_class);
+                        b = free_lists_[size_class];
+                    }
+                }
+
+                free_lists_[size_class] = b->next;
+                increment(allocations_);
+                return b;
+            }
+
+            void deallocate_local(void* p, std::size_t size_class) noexcept
+            {
+                free_block* b = static_cast<free_block*>(p);
+                b->next = free_lists_[size_class];
+                free_lists_[size_class] = b;
+            }
+
+            // may be called concurrently from any thread
+            void deallocate_remote(void* p) noexcept
+            {
+                free_block* b = static_cast<free_block*>(p);
+                free_block* head = remote_frees_.load(std::memory_order_relaxed);
+                do
+                {
+                    b->next = head;
+                } while (!remote_frees_.compare_exchange_weak(head, b,
+                    std::memory_order_release, std::memory_order_relaxed));
+            }
+
+            void collect_remote_frees() noexcept
+            {
+                free_block* b =
+                    remote_frees_.exchange(nullptr, std::memory_order_acquire);
+
+                std::int64_t count = 0;
+                while (b != nullptr)
+                {
+                    free_block* next = b->next;
+                    deallocate_local(b, get_header(b)->size_class);
+                    b = next;
+                    ++count;
+                }
+                increment(remote_free_count_, count);
+            }
+
+            void add_slab(std::size_t size_class)
+            {
+                std::size_t const block_size =
+                    sizeof(block_header) + (size_class + 1) * granularity;
+
+                std::size_t num_blocks = min_slab_size / block_size;
+                if (num_blocks < min_blocks_per_slab)
+                    num_blocks = min_blocks_per_slab;
+
+                std::size_t const slab_size = num_blocks * block_size;
+                char* slab = static_cast<char*>(::operator new(slab_size));
+                slabs_.push_back(slab);
+
+                // link the new blocks in address order
+                for (std::size_t i = num_blocks; i != 0; --i)
+                {
+                    block_header* h = reinterpret_cast<block_header*>(
+                        slab + (i - 1) * block_size);
+                    h->owner = this;
+                    h->size_class = size_class;
+                    deallocate_local(get_block(h), size_class);
+                }
+
+                increment(reserved_size_, std::int64_t(slab_size));
+            }
+
+            free_block* free_lists_[num_size_classes];
+            std::atomic<free_block*> remote_frees_;
+            std::vector<char*> slabs_;
+
+            std::atomic<std::int64_t> allocations_;
+            std::atomic<std::int64_t> remote_free_count_;
+            std::atomic<std::int64_t> reserved_size_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // All heaps ever created are kept alive as blocks allocated from a
+        // heap may be released after the owning thread has exited. Heaps of
+        // exited threads are reused by new threads.
+        struct slab_heap_registry
+        {
+            slab_heap_registry()
+              : enabled_(true)
+              , fallback_allocations_(0)
+              , allocations_base_(0)
+              , fallback_allocations_base_(0)
+              , remote_free_count_base_(0)
+            {
+            }
+
+            slab_heap* acquire_heap()
+            {
+                std::lock_guard<std::mutex> l(mtx_);
+                if (!orphans_.empty())
+                {
+                    slab_heap* heap = orphans_.back();
+                    orphans_.pop_back();
+                    return heap;
+                }
+
+                heaps_.push_back(new slab_heap);
+                return heaps_.back();
+            }
+
+            void release_heap(slab_heap* heap)
+            {
+                std::lock_guard<std::mutex> l(mtx_);
+                orphans_.push_back(heap);
+            }
+
+            template <typename F>
+            std::int64_t accumulate(F&& f)
+            {
+                std::int64_t result = 0;
+                for (slab_heap const* heap : heaps_)
+                {
+                    result += f(*heap);
+                }
+                return result;
+            }
+
+            std::int64_t get_count(std::atomic<std::int64_t> slab_heap::*count,
+                std::int64_t& base, bool reset)
+            {
+                std::lock_guard<std::mutex> l(mtx_);
+                std::int64_t const total =
+                    accumulate([count](slab_heap const& heap) {
+                        return (heap.*count).load(std::memory_order_relaxed);
+                    });
+
+                std::int64_t const result = total - base;
+                if (reset)
+                    base = total;
+                return result;
+            }
+
+            std::mutex mtx_;
+            std::vector<slab_heap*> heaps_;
+            std::vector<slab_heap*> orphans_;
+
+            std::atomic<bool> enabled_;
+            std::atomic<std::int64_t> fallback_allocations_;
+
+            std::int64_t allocations_base_;
+            std::int64_t fallback_allocations_base_;
+            std::int64_t remote_free_count_base_;
+        };
+
+        // the registry is intentionally never destroyed, threads may exit
+        // (and blocks may be released) during static destruction
+        slab_heap_registry& get_registry()
+        {
+            static slab_heap_registry* registry = new slab_heap_registry;
+            return *registry;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        thread_local slab_heap* current_heap = nullptr;
+        thread_local bool current_heap_released = false;
+
+        // hands the heap of the current thread back to the registry on exit
+        struct heap_releaser
+        {
+            ~heap_releaser()
+            {
+                if (current_heap != nullptr)
+                {
+                    get_registry().release_heap(current_heap);
+                    current_heap = nullptr;
+                }
+                current_heap_released = true;
+            }
+        };
+
+        slab_heap* get_current_heap()
+        {
+            if (current_heap == nullptr && !current_heap_released)
+            {
+                static thread_local heap_releaser releaser;
+                (void) releaser;
+
+                current_heap = get_registry().acquire_heap();
+            }
+            return current_heap;
+        }
+
+        void* fallback_allocate(std::size_t size)
+        {
+            block_header* h = static_cast<block_header*>(
+                ::operator new(sizeof(block_header) + size));
+            h->owner = nullptr;
+            h->size_class = 0;
+
+            get_registry().fallback_allocations_.fetch_add(
+                1, std::memory_order_relaxed);
+            return get_block(h);
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void* slab_allocate(std::size_t size)
+    {
+        if (size > max_block_size ||
+            !get_registry().enabled_.load(std::memory_order_relaxed))
+        {
+            return fallback_allocate(size);
+        }
+
+        slab_heap* heap = get_current_heap();
+        if (heap == nullptr)
+        {
+            return fallback_allocate(size);
+        }
+
+        std::size_t const size_class =
+            size == 0 ? 0 : (size - 1) / granularity;
+        return heap->allocate(size_class);
+    }
+
+    void slab_deallocate(void* p) noexcept
+    {
+        if (p == nullptr)
+            return;
+
+        block_header* h = get_header(p);
+        if (h->owner == nullptr)
+        {
+            ::operator delete(h);
+        }
+        else if (h->owner == current_heap)
+        {
+            h->owner->deallocate_local(p, h->size_class);
+        }
+        else
+        {
+            h->owner->deallocate_remote(p);
+        }
+    }
+
+    void enable_slab_allocator(bool enable)
+    {
+        get_registry().enabled_.store(enable, std::memory_order_relaxed);
+    }
+
+    bool slab_allocator_enabled()
+    {
+        return get_registry().enabled_.load(std::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t get_slab_allocation_count(bool reset)
+    {
+        slab_heap_registry& registry = get_registry();
+        return registry.get_count(
+            &slab_heap::allocations_, registry.allocations_base_, reset);
+    }
+
+    std::int64_t get_slab_fallback_allocation_count(bool reset)
+    {
+        slab_heap_registry& registry = get_registry();
+
+        std::lock_guard<std::mutex> l(registry.mtx_);
+        std::int64_t const total =
+            registry.fallback_allocations_.load(std::memory_order_relaxed);
+
+        std::int64_t const result = total - registry.fallback_allocations_base_;
+        if (reset)
+            registry.fallback_allocations_base_ = total;
+        return result;
+    }
+
+    std::int64_t get_slab_remote_free_count(bool reset)
+    {
+        slab_heap_registry& registry = get_registry();
+        return registry.get_count(&slab_heap::remote_free_count_,
+            registry.remote_free_count_base_, reset);
+    }
+
+    std::int64_t get_slab_reserved_size()
+    {
+        slab_heap_registry& registry = get_registry();
+
+        std::lock_guard<std::mutex> l(registry.mtx_);
+        return registry.accumulate([](slab_heap const& heap) {
+            return heap.reserved_size_.load(std::memory_order_relaxed);
+        });
+    }
+}}    // namespace hpx::util
@@ -0,0 +1,596 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/cache/statistics/no_statistics.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace util { namespace cache {
+    ///////////////////////////////////////////////////////////////////////////
+    /// \class flat_lru_cache flat_lru_cache.hpp hpx/cache/flat_lru_cache.hpp
+    ///
+    /// \brief The \a flat_lru_cache implements the same functionality as the
+    ///        \a lru_cache, but stores all entries in a contiguous slab
+    ///        indexed by an open-addressing hash table. The LRU order is
+    ///        maintained by intrusive (index based) links between the slab
+    ///        entries. Lookups, insertions, updates and evictions are O(1)
+    ///        and do not allocate memory once the cache has reached its
+    ///        capacity.
+    ///
+    /// \tparam Key           The type of the keys to use to identify the
+    ///                       entries stored in the cache
+    /// \tparam Entry         The type of the items to be held in the cache.
+    /// \tparam Statistics    A (optional) type allowing to collect some basic
+    ///                       statistics about the operation of the cache
+    ///                       instance. The type must conform to the
+    ///                       CacheStatistics concept. The default value is
+    ///                       the type \a statistics#no_statistics which does
+    ///                       not collect any numbers, but provides empty stubs
+    ///                       allowing the code to compile.
+    /// \tparam Hash          A (optional) function object used to compute
+    ///                       the hash value of a key. The default is
+    ///                       std::hash<Key>.
+    /// \tparam KeyEqual      A (optional) function object used to compare
+    ///                       two keys for equality. The default is
+    ///                       std::equal_to<Key>.
+    ///
+    /// \note Both, \a Key and \a Entry have to be default constructible.
+    template <typename Key, typename Entry,
+        typename Statistics = statistics::no_statistics,
+        typename Hash = std::hash<Key>,
+        typename KeyEqual = std::equal_to<Key>>
+    class flat_lru_cache
+    {
+    public:
+        typedef Key key_type;
+        typedef Entry entry_type;
+        typedef Statistics statistics_type;
+        typedef Hash hasher;
+        typedef KeyEqual key_equal;
+        typedef std::pair<key_type, entry_type> entry_pair;
+        typedef std::size_t size_type;
+
+    private:
+        typedef typename statistics_type::update_on_exit update_on_exit;
+
+        static constexpr size_type npos = size_type(-1);
+
+        // minimal number of slots in the hash table
+        static constexpr size_type min_table_size = 16;
+
+        struct node
+        {
+            entry_pair value_;
+            std::size_t hash_;
+            size_type prev_;    // towards the most recently used entry
+            size_type next_;    // towards the least recently used entry
+        };
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Construct an instance of a flat_lru_cache.
+        ///
+        /// \param max_size   [in] The maximal size this cache is allowed to
+        ///                   reach any time. The default is zero (no size
+        ///                   limitation). The unit of this value is usually
+        ///                   determined by the unit of the values returned by
+        ///                   the entry's \a get_size function.
+        ///
+        flat_lru_cache(size_type max_size = 0)
+          : max_size_(max_size)
+          , current_size_(0)
+          , head_(npos)
+          , tail_(npos)
+          , free_(npos)
+        {
+        }
+
+        flat_lru_cache(flat_lru_cache&& other)
+          : max_size_(other.max_size_)
+          , current_size_(other.current_size_)
+          , head_(other.head_)
+          , tail_(other.tail_)
+          , free_(other.free_)
+          , nodes_(std::move(other.nodes_))
+          , index_(std::move(other.index_))
+          , hash_(std::move(other.hash_))
+          , key_equal_(std::move(other.key_equal_))
+          , statistics_(std::move(other.statistics_))
+        {
+            other.current_size_ = 0;
+            other.head_ = other.tail_ = other.free_ = npos;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Return current size of the cache.
+        ///
+        /// \returns The current size of this cache instance.
+        size_type size() const
+        {
+            return current_size_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Access the maximum size the cache is allowed to grow to.
+        ///
+        /// \returns    The maximum size this cache instance is currently
+        ///             allowed to reach. If this number is zero the cache has
+        ///             no limitation with regard to a maximum size.
+        size_type capacity() const
+        {
+            return max_size_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Change the maximum size this cache can grow to
+        ///
+        /// \param max_size    [in] The new maximum size this cache will be
+        ///             allowed to grow to.
+        ///
+        /// \note       This function pre-allocates the storage needed to hold
+        ///             \a max_size entries.
+        void reserve(size_type max_size)
+        {
+            if (max_size > max_size_)
+            {
+                max_size_ = max_size;
+                if (max_size_ != size_type(-1))
+                {
+                    nodes_.reserve(max_size_ + 1);
+                    rehash(max_size_ + 1);
+                }
+                return;
+            }
+
+            max_size_ = max_size;
+            while (current_size_ > max_size_)
+            {
+                evict();
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Check whether the cache currently holds an entry identified
+        ///        by the given key
+        ///
+        /// \param k      [in] The key for the entry which should be looked up
+        ///               in the cache.
+        ///
+        /// \note         This function does not touch the entry. It just
+        ///               checks if the cache contains an entry corresponding
+        ///               to the given key.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool holds_key(key_type const& key)
+        {
+            return find(key, hash_(key)) != npos;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \param key     [in] The key for the entry which should be retrieved
+        ///               from the cache.
+        /// \param realkey [out] If the entry indexed by the key is found in
+        ///               the cache this value on successful return will be a
+        ///               copy of the key stored in the cache.
+        /// \param entry  [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the corresponding entry.
+        ///
+        /// \note         The function will "touch" the entry and mark it as
+        ///               recently used if the key was found in the cache.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(
+            key_type const& key, key_type& realkey, entry_type& entry)
+        {
+            update_on_exit update(statistics_, statistics::method_get_entry);
+
+            size_type n = find(key, hash_(key));
+            if (n == npos)
+            {
+                // Got miss
+                statistics_.got_miss();    // update statistics
+                return false;
+            }
+
+            touch(n);
+
+            // update statistics
+            statistics_.got_hit();
+
+            // got hit
+            realkey = nodes_[n].value_.first;
+            entry = nodes_[n].value_.second;
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \param key     [in] The key for the entry which should be retrieved
+        ///               from the cache.
+        /// \param entry  [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the corresponding entry.
+        ///
+        /// \note         The function will "touch" the entry and mark it as
+        ///               recently used if the key was found in the cache.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(key_type const& key, entry_type& entry)
+        {
+            key_type tmp;
+            return get_entry(key, tmp, entry);
+        }
+
+        /// \brief Insert a new entry into this cache
+        ///
+        /// \param key    [in] The key for the entry which should be added to
+        ///               the cache.
+        /// \param entry  [in] The entry which should be added to the cache.
+        ///
+        /// \returns      This function returns \a false if the entry was
+        ///               already held by the cache, otherwise it returns
+        ///               \a true.
+        bool insert(key_type const& key, entry_type const& entry)
+        {
+            update_on_exit update(statistics_, statistics::method_insert_entry);
+
+            std::size_t h = hash_(key);
+            if (find(key, h) != npos)
+            {
+                return false;
+            }
+
+            insert_nonexist(key, entry, h);
+            return true;
+        }
+
+        void insert_nonexist(key_type const& key, entry_type const& entry)
+        {
+            insert_nonexist(key, entry, hash_(key));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache
+        ///
+        /// \param key    [in] The key for the value which should be updated in
+        ///               the cache.
+        /// \param entry  [in] The entry which should be used as a replacement
+        ///               for the existing value in the cache. If the key is
+        ///               not held by the cache a new entry is inserted.
+        ///
+        /// \note         The function will "touch" the entry and mark it as
+        ///               recently used if the key was found in the cache.
+        void update(key_type const& key, entry_type const& entry)
+        {
+            update_on_exit update(statistics_, statistics::method_update_entry);
+
+            // Is it already in the cache?
+            std::size_t h = hash_(key);
+            size_type n = find(key, h);
+            if (n == npos)
+            {
+                statistics_.got_miss();    // update statistics
+                // got miss
+                update_on_exit update(
+                    statistics_, statistics::method_insert_entry);
+                insert_nonexist(key, entry, h);
+                return;
+            }
+
+            // got hit!
+            nodes_[n].value_.second = entry;
+            touch(n);
+            // update statistics
+            statistics_.got_hit();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache
+        ///
+        /// \param key    [in] The key for the value which should be updated in
+        ///               the cache.
+        /// \param entry  [in] The value which should be used as a replacement
+        ///               for the existing value in the cache.
+        /// \param f      [in] A callable taking two arguments, \a k and the
+        ///               key found in the cache (in that order). If \a f
+        ///               returns true, then the update will not succeed.
+        ///
+        /// \note         The function will "touch" the entry and mark it as
+        ///               recently used if the key was found in the cache.
+        ///
+        /// \returns      This function returns \a true if the entry has been
+        ///               successfully updated, otherwise it returns \a false.
+        ///               If the entry currently is not held by the cache it is
+        ///               added and the return value reflects the outcome of
+        ///               the corresponding insert operation.
+        template <typename F>
+        bool update_if(key_type const& key, entry_type const& entry, F&& f)
+        {
+            update_on_exit update(statistics_, statistics::method_update_entry);
+
+            // Is it already in the cache?
+            std::size_t h = hash_(key);
+            size_type n = find(key, h);
+            if (n == npos)
+            {
+                // got miss
+                statistics_.got_miss();    // update statistics
+                update_on_exit update(
+                    statistics_, statistics::method_insert_entry);
+                insert_nonexist(key, entry, h);
+                return true;
+            }
+
+            if (f(key, nodes_[n].value_.first))
+                return false;
+
+            // got hit!
+            touch(n);
+            nodes_[n].value_.second = entry;
+
+            // update statistics
+            statistics_.got_hit();
+
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Remove stored entries from the cache for which the supplied
+        ///        function object returns true.
+        ///
+        /// \param ep     [in] This parameter has to be a (unary) function
+        ///               object. It is invoked for each of the entries
+        ///               currently held in the cache. An entry is considered
+        ///               for removal from the cache whenever the value
+        ///               returned from this invocation is \a true.
+        ///
+        /// \returns      This function returns the number of removed entries.
+        template <typename Func>
+        size_type erase(Func const& ep)
+        {
+            update_on_exit update(statistics_, statistics::method_erase_entry);
+
+            size_type erased = 0;
+            for (size_type n = head_; n != npos;)
+            {
+                size_type next = nodes_[n].next_;
+                if (ep(nodes_[n].value_))
+                {
+                    ++erased;
+                    remove(n);
+
+                    // update statistics
+                    statistics_.got_eviction();
+                }
+                n = next;
+            }
+
+            return erased;
+        }
+
+        /// \brief Remove all stored entries from the cache
+        ///
+        /// \returns      This function returns the number of removed entries.
+        size_type erase()
+        {
+            return clear();
+        }
+
+        /// \brief Clear the cache
+        ///
+        /// Unconditionally removes all stored entries from the cache.
+        size_type clear()
+        {
+            size_type erased = current_size_;
+            current_size_ = 0;
+            head_ = tail_ = free_ = npos;
+            nodes_.clear();
+            std::fill(index_.begin(), index_.end(), size_type(0));
+            return erased;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Allow to access the embedded statistics instance
+        ///
+        /// \returns      This function returns a reference to the statistics
+        ///               instance embedded inside this cache
+        statistics_type const& get_statistics() const
+        {
+            return statistics_;
+        }
+
+        statistics_type& get_statistics()
+        {
+            return statistics_;
+        }
+
+    private:
+        ///////////////////////////////////////////////////////////////////////
+        // The hash table stores the slab index of an entry plus one, zero
+        // marks an empty slot. Collisions are resolved by linear probing.
+        size_type find(key_type const& key, std::size_t h) const
+        {
+            if (index_.empty())
+                return npos;
+
+            size_type const mask = index_.size() - 1;
+            for (size_type i = h & mask; index_[i] != 0; i = (i + 1) & mask)
+            {
+                node const& nd = nodes_[index_[i] - 1];
+                if (nd.hash_ == h && key_equal_(nd.value_.first, key))
+                    return index_[i] - 1;
+            }
+            return npos;
+        }
+
+        void insert_index(size_type n)
+        {
+            size_type const mask = index_.size() - 1;
+            size_type i = nodes_[n].hash_ & mask;
+            while (index_[i] != 0)
+                i = (i + 1) & mask;
+            index_[i] = n + 1;
+        }
+
+        // Remove the given slab entry from the hash table. The entries
+        // following the removed one in its probe sequence are shifted
+        // backwards, which avoids the need for tombstones.
+        void erase_index(size_type n)
+        {
+            size_type const mask = index_.size() - 1;
+            size_type j = nodes_[n].hash_ & mask;
+            while (index_[j] != n + 1)
+                j = (j + 1) & mask;
+
+            for (size_type k = (j + 1) & mask; index_[k] != 0;
+                 k = (k + 1) & mask)
+            {
+                size_type ideal = nodes_[index_[k] - 1].hash_ & mask;
+                if (((k - ideal) & mask) >= ((k - j) & mask))
+                {
+                    index_[j] = index_[k];
+                    j = k;
+                }
+            }
+            index_[j] = 0;
+        }
+
+        // make sure the hash table can hold the given number of entries
+        // while staying at most half full
+        void rehash(size_type count)
+        {
+            size_type table_size = min_table_size;
+            while (table_size < 2 * count)
+                table_size *= 2;
+
+            if (table_size <= index_.size())
+                return;
+
+            index_.assign(table_size, size_type(0));
+            for (size_type n = head_; n != npos; n = nodes_[n].next_)
+                insert_index(n);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void link_front(size_type n)
+        {
+            nodes_[n].prev_ = npos;
+            nodes_[n].next_ = head_;
+            if (head_ != npos)
+                nodes_[head_].prev_ = n;
+            else
+                tail_ = n;
+            head_ = n;
+        }
+
+        void unlink(size_type n)
+        {
+            node& nd = nodes_[n];
+            if (nd.prev_ != npos)
+                nodes_[nd.prev_].next_ = nd.next_;
+            else
+                head_ = nd.next_;
+
+            if (nd.next_ != npos)
+                nodes_[nd.next_].prev_ = nd.prev_;
+            else
+                tail_ = nd.prev_;
+        }
+
+        void touch(size_type n)
+        {
+            if (n != head_)
+            {
+                unlink(n);
+                link_front(n);
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void insert_nonexist(
+            key_type const& key, entry_type const& entry, std::size_t h)
+        {
+            rehash(current_size_ + 1);
+
+            // insert ...
+            size_type n = free_;
+            if (n != npos)
+            {
+                free_ = nodes_[n].next_;
+                nodes_[n].value_ = entry_pair(key, entry);
+                nodes_[n].hash_ = h;
+            }
+            else
+            {
+                n = nodes_.size();
+                nodes_.push_back(node{entry_pair(key, entry), h, npos, npos});
+            }
+
+            link_front(n);
+            insert_index(n);
+            ++current_size_;
+
+            // update statistics
+            statistics_.got_insertion();
+
+            // Do we need to evict a cache entry?
+            if (current_size_ > max_size_)
+            {
+                // evict an entry
+                evict();
+            }
+        }
+
+        // release the given entry and put its slab slot onto the free list
+        void remove(size_type n)
+        {
+            erase_index(n);
+            unlink(n);
+
+            nodes_[n].value_ = entry_pair();
+            nodes_[n].next_ = free_;
+            free_ = n;
+
+            --current_size_;
+        }
+
+        void evict()
+        {
+            statistics_.got_eviction();
+            remove(tail_);
+        }
+
+        size_type max_size_;
+        size_type current_size_;
+
+        size_type head_;    // most recently used entry
+        size_type tail_;    // least recently used entry
+        size_type free_;    // list of unused slab entries
+
+        std::vector<node> nodes_;
+        std::vector<size_type> index_;
+
+        hasher hash_;
+        key_equal key_equal_;
+
+        statistics_type statistics_;
+    };
+}}}    // namespace hpx::util::cache
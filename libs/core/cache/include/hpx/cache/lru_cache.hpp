@@ -137,6 +137,24 @@ namespace hpx { namespace util { namespace cache {
             return map_.find(key) != map_.end();
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Invoke the given function for the keys of all entries
+        ///        currently stored in the cache
+        ///
+        /// \param f      [in] The function to invoke, it is passed the key
+        ///               of each entry, most recently used entries first.
+        ///
+        /// \note         This function does not call the entry's function
+        ///               \a entry#touch and does not modify the statistics.
+        template <typename F>
+        void for_each_key(F&& f) const
+        {
+            for (entry_pair const& e : storage_)
+            {
+                f(e.first);
+            }
+        }
+
         ///////////////////////////////////////////////////////////////////////
         /// \brief Get a specific entry identified by the given key.
         ///
@@ -0,0 +1,152 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the hit, miss and insert throughput of the
+// lru_cache, the flat_lru_cache, and the local_cache (using lru_entry).
+
+#include <hpx/hpx_init.hpp>
+
+#include <hpx/cache/entries/lru_entry.hpp>
+#include <hpx/cache/flat_lru_cache.hpp>
+#include <hpx/cache/local_cache.hpp>
+#include <hpx/cache/lru_cache.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t sum = 0;    // prevent the lookups from being optimized away
+
+template <typename Cache>
+void insert_entries(Cache& cache, std::vector<std::uint64_t> const& keys)
+{
+    for (std::uint64_t k : keys)
+        cache.insert(k, k);
+}
+
+template <typename Cache>
+void lookup_entries(Cache& cache, std::vector<std::uint64_t> const& keys)
+{
+    for (std::uint64_t k : keys)
+    {
+        std::uint64_t value = 0;
+        if (cache.get_entry(k, value))
+            sum += value;
+    }
+}
+
+template <typename Cache>
+void measure(std::string const& name, std::size_t cache_size,
+    std::vector<std::uint64_t> const& keys,
+    std::vector<std::uint64_t> const& hit_keys,
+    std::vector<std::uint64_t> const& miss_keys)
+{
+    Cache cache(cache_size);
+
+    hpx::chrono::high_resolution_timer t;
+    insert_entries(cache, keys);
+    double insert_time = t.elapsed();
+
+    t.restart();
+    lookup_entries(cache, hit_keys);
+    double hit_time = t.elapsed();
+
+    t.restart();
+    lookup_entries(cache, miss_keys);
+    double miss_time = t.elapsed();
+
+    std::cout << std::left << std::setw(16) << name << std::right
+              << "insert: " << std::setw(12) << keys.size() / insert_time
+              << " [op/s], hit: " << std::setw(12)
+              << hit_keys.size() / hit_time << " [op/s], miss: "
+              << std::setw(12) << miss_keys.size() / miss_time << " [op/s]"
+              << std::endl;
+
+    hpx::util::print_cdash_timing(
+        (name + "Insert").c_str(), insert_time / keys.size());
+    hpx::util::print_cdash_timing(
+        (name + "Hit").c_str(), hit_time / hit_keys.size());
+    hpx::util::print_cdash_timing(
+        (name + "Miss").c_str(), miss_time / miss_keys.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t cache_size = vm["cache_size"].as<std::size_t>();
+    std::size_t num_entries = vm["num_entries"].as<std::size_t>();
+    std::size_t num_lookups = vm["num_lookups"].as<std::size_t>();
+
+    std::mt19937_64 gen(std::random_device{}());
+
+    // keys to insert, all distinct
+    std::vector<std::uint64_t> keys(num_entries);
+    for (std::size_t i = 0; i != num_entries; ++i)
+        keys[i] = i * 0x9e3779b97f4a7c15ull;
+
+    // all lookups refer to keys which are held by the cache
+    std::uint64_t first_held = num_entries > cache_size ?
+        num_entries - cache_size :
+        0;
+    std::uniform_int_distribution<std::uint64_t> hit_dist(
+        first_held, num_entries - 1);
+
+    std::vector<std::uint64_t> hit_keys(num_lookups);
+    for (auto& k : hit_keys)
+        k = keys[hit_dist(gen)];
+
+    // none of the lookups refer to keys which are held by the cache
+    std::vector<std::uint64_t> miss_keys(num_lookups);
+    for (auto& k : miss_keys)
+        k = gen() | 1;
+
+    typedef hpx::util::cache::lru_cache<std::uint64_t, std::uint64_t>
+        lru_cache_type;
+    typedef hpx::util::cache::flat_lru_cache<std::uint64_t, std::uint64_t>
+        flat_lru_cache_type;
+    typedef hpx::util::cache::local_cache<std::uint64_t,
+        hpx::util::cache::entries::lru_entry<std::uint64_t>>
+        local_cache_type;
+
+    measure<lru_cache_type>(
+        "lru_cache", cache_size, keys, hit_keys, miss_keys);
+    measure<flat_lru_cache_type>(
+        "flat_lru_cache", cache_size, keys, hit_keys, miss_keys);
+    measure<local_cache_type>(
+        "local_cache", cache_size, keys, hit_keys, miss_keys);
+
+    std::cout << "(checksum: " << sum << ")" << std::endl;
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("cache_size", value<std::size_t>()->default_value(4096),
+         "maximal number of entries held by the caches (default: 4096)")
+        ("num_entries,n", value<std::size_t>()->default_value(100000),
+         "number of items to insert into the caches (default: 100000)")
+        ("num_lookups", value<std::size_t>()->default_value(1000000),
+         "number of lookups to perform (default: 1000000)")
+        ;
+    // clang-format on
+
+    return hpx::init(desc_commandline, argc, argv);
+}
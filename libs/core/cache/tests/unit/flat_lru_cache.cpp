@@ -0,0 +1,258 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/cache/flat_lru_cache.hpp>
+#include <hpx/cache/statistics/local_statistics.hpp>
+#include <hpx/hpx_main.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+struct data
+{
+    data(char const* const k, char const* const v)
+      : key(k)
+      , value(v)
+    {
+    }
+
+    char const* const key;
+    char const* const value;
+};
+
+data cache_entries[] = {data("white", "255,255,255"),
+    data("yellow", "255,255,0"), data("green", "0,255,0"),
+    data("blue", "0,0,255"), data("magenta", "255,0,255"),
+    data("black", "0,0,0"), data(nullptr, nullptr)};
+
+typedef hpx::util::cache::flat_lru_cache<std::string, std::string,
+    hpx::util::cache::statistics::local_statistics>
+    cache_type;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_lru_insert()
+{
+    cache_type c(3);
+
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.capacity());
+
+    // insert all items into the cache
+    for (data* d = &cache_entries[0]; d->key != nullptr; ++d)
+    {
+        HPX_TEST(c.insert(d->key, d->value));
+        HPX_TEST_LTE(c.size(), static_cast<cache_type::size_type>(3));
+    }
+
+    // there should be 3 items in the cache
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.size());
+
+    // the last 3 items should have survived
+    HPX_TEST(!c.holds_key("white"));
+    HPX_TEST(c.holds_key("blue"));
+    HPX_TEST(c.holds_key("magenta"));
+    HPX_TEST(c.holds_key("black"));
+
+    // inserting an existing item fails
+    HPX_TEST(!c.insert("black", "0,0,0"));
+    HPX_TEST_EQ(
+        c.get_statistics().evictions(false), static_cast<std::size_t>(3));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_lru_insert_with_touch()
+{
+    cache_type c(3);
+
+    // insert 3 items into the cache
+    int i = 0;
+    data* d = &cache_entries[0];
+
+    for (/**/; i < 3 && d->key != nullptr; ++d, ++i)
+    {
+        HPX_TEST(c.insert(d->key, d->value));
+        HPX_TEST_LTE(c.size(), static_cast<cache_type::size_type>(3));
+    }
+
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.size());
+
+    // now touch the first item
+    std::string white;
+    HPX_TEST(c.get_entry("white", white));
+    HPX_TEST_EQ(white, "255,255,255");
+
+    // add two more items
+    for (i = 0; i < 2 && d->key != nullptr; ++d, ++i)
+    {
+        HPX_TEST(c.insert(d->key, d->value));
+        HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.size());
+    }
+
+    // there should be 3 items in the cache, and white should be there as well
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.size());
+    HPX_TEST(c.holds_key("white"));
+    HPX_TEST(!c.holds_key("yellow"));
+    HPX_TEST(!c.holds_key("green"));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_lru_clear()
+{
+    cache_type c(3);
+
+    // insert all items into the cache
+    for (data* d = &cache_entries[0]; d->key != nullptr; ++d)
+    {
+        HPX_TEST(c.insert(d->key, d->value));
+    }
+
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.clear());
+
+    // there should be no items in the cache
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(0), c.size());
+    HPX_TEST(!c.holds_key("black"));
+
+    // the cache is still usable
+    HPX_TEST(c.insert("black", "0,0,0"));
+    HPX_TEST(c.holds_key("black"));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+struct erase_func
+{
+    erase_func(std::string const& key)
+      : key_(key)
+    {
+    }
+
+    template <typename Entry>
+    bool operator()(Entry const& e) const
+    {
+        return key_ == e.first;
+    }
+
+    std::string key_;
+};
+
+void test_lru_erase_one()
+{
+    cache_type c(3);
+
+    // insert all items into the cache
+    for (data* d = &cache_entries[0]; d->key != nullptr; ++d)
+    {
+        HPX_TEST(c.insert(d->key, d->value));
+    }
+
+    std::string blue;
+    HPX_TEST(c.get_entry("blue", blue));
+
+    HPX_TEST_EQ(
+        static_cast<cache_type::size_type>(1), c.erase(erase_func("blue")));
+
+    // there should be 2 items in the cache
+    HPX_TEST(!c.get_entry("blue", blue));
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(2), c.size());
+    HPX_TEST(c.holds_key("magenta"));
+    HPX_TEST(c.holds_key("black"));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_lru_update()
+{
+    cache_type c(4);    // this time we can hold 4 items
+
+    // insert 3 items into the cache
+    int i = 0;
+    data* d = &cache_entries[0];
+
+    for (/**/; i < 3 && d->key != nullptr; ++d, ++i)
+    {
+        HPX_TEST(c.insert(d->key, d->value));
+    }
+
+    // there should be 3 items in the cache
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.size());
+
+    // now update some items
+    c.update("black", "255,0,0");    // isn't in the cache
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(4), c.size());
+
+    c.update("yellow", "255,0,0");
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(4), c.size());
+
+    std::string yellow;
+    HPX_TEST(c.get_entry("yellow", yellow));
+    HPX_TEST_EQ(yellow, "255,0,0");
+
+    // update_if does not modify the entry if the callable returns true
+    HPX_TEST(!c.update_if("yellow", "0,0,0",
+        [](std::string const&, std::string const&) { return true; }));
+    HPX_TEST(c.get_entry("yellow", yellow));
+    HPX_TEST_EQ(yellow, "255,0,0");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// exercise the hash table with many insertions, lookups and evictions
+void test_lru_many()
+{
+    typedef hpx::util::cache::flat_lru_cache<std::size_t, std::size_t>
+        int_cache_type;
+
+    std::size_t const capacity = 1000;
+    int_cache_type c;
+    c.reserve(capacity);
+
+    for (std::size_t i = 0; i != 10 * capacity; ++i)
+    {
+        HPX_TEST(c.insert(i, 2 * i));
+        HPX_TEST_LTE(c.size(), capacity);
+
+        // keep the first entry alive
+        std::size_t value = 0;
+        HPX_TEST(c.get_entry(0, value));
+        HPX_TEST_EQ(value, std::size_t(0));
+    }
+
+    HPX_TEST_EQ(c.size(), capacity);
+    HPX_TEST(c.holds_key(0));
+
+    for (std::size_t i = 9 * capacity + 1; i != 10 * capacity; ++i)
+    {
+        std::size_t value = 0;
+        HPX_TEST(c.get_entry(i, value));
+        HPX_TEST_EQ(value, 2 * i);
+    }
+
+    for (std::size_t i = 1; i != 9 * capacity; ++i)
+    {
+        HPX_TEST(!c.holds_key(i));
+    }
+
+    // erase every second entry and check that the remaining ones are found
+    c.erase([](std::pair<std::size_t, std::size_t> const& p) {
+        return p.first % 2 == 0;
+    });
+
+    for (std::size_t i = 9 * capacity + 1; i != 10 * capacity; ++i)
+    {
+        HPX_TEST_EQ(c.holds_key(i), i % 2 != 0);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_lru_insert();
+    test_lru_insert_with_touch();
+    test_lru_clear();
+    test_lru_erase_one();
+    test_lru_update();
+    test_lru_many();
+
+    return hpx::util::report_errors();
+}
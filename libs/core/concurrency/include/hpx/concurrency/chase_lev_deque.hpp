@@ -0,0 +1,206 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Chase-Lev work-stealing deque, following
+//
+//   D. Chase and Y. Lev, "Dynamic Circular Work-Stealing Deque", SPAA 2005
+//   N. M. Le, A. Pop, A. Cohen and F. Zappa Nardelli, "Correct and Efficient
+//   Work-Stealing for Weak Memory Models", PPoPP 2013
+//
+// A single owner thread pushes and pops items at the bottom end of the deque
+// without any atomic read-modify-write operations (except when racing with a
+// thief for the very last item). Any number of thieves concurrently take
+// items from the top end using a compare-and-swap.
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace concurrency {
+
+    template <typename T>
+    class chase_lev_deque
+    {
+        static_assert(std::is_trivially_copyable<T>::value,
+            "chase_lev_deque requires trivially copyable value types");
+
+        // circular array of items, its size is always a power of two
+        struct array
+        {
+            explicit array(std::int64_t capacity)
+              : mask_(capacity - 1)
+              , items_(new std::atomic<T>[std::size_t(capacity)])
+            {
+                HPX_ASSERT((capacity & (capacity - 1)) == 0);
+            }
+
+            std::int64_t capacity() const
+            {
+                return mask_ + 1;
+            }
+
+            T get(std::int64_t i) const
+            {
+                return items_[std::size_t(i & mask_)].load(
+                    std::memory_order_relaxed);
+            }
+
+            void put(std::int64_t i, T const& val)
+            {
+                items_[std::size_t(i & mask_)].store(
+                    val, std::memory_order_relaxed);
+            }
+
+            std::int64_t const mask_;
+            std::unique_ptr<std::atomic<T>[]> items_;
+        };
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+
+        explicit chase_lev_deque(std::size_t initial_capacity = 128)
+          : array_(nullptr)
+        {
+            std::int64_t capacity = 2;
+            while (capacity < std::int64_t(initial_capacity))
+                capacity <<= 1;
+
+            arrays_.emplace_back(new array(capacity));
+            array_.store(arrays_.back().get(), std::memory_order_relaxed);
+
+            top_.data_.store(0, std::memory_order_relaxed);
+            bottom_.data_.store(0, std::memory_order_relaxed);
+        }
+
+        chase_lev_deque(chase_lev_deque const&) = delete;
+        chase_lev_deque& operator=(chase_lev_deque const&) = delete;
+
+        // Add an item to the bottom of the deque. Must be called by the owner
+        // only.
+        void push_bottom(T const& val)
+        {
+            std::int64_t b = bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t t = top_.data_.load(std::memory_order_acquire);
+            array* a = array_.load(std::memory_order_relaxed);
+
+            if (b - t > a->capacity() - 1)
+            {
+                a = grow(a, t, b);
+            }
+
+            a->put(b, val);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom_.data_.store(b + 1, std::memory_order_relaxed);
+        }
+
+        // Remove an item from the bottom of the deque. Must be called by the
+        // owner only.
+        bool pop_bottom(T& val)
+        {
+            std::int64_t b = bottom_.data_.load(std::memory_order_relaxed) - 1;
+            array* a = array_.load(std::memory_order_relaxed);
+            bottom_.data_.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t t = top_.data_.load(std::memory_order_relaxed);
+
+            if (t <= b)
+            {
+                val = a->get(b);
+                if (t == b)
+                {
+                    // last item, race against thieves
+                    bool result = top_.data_.compare_exchange_strong(t, t + 1,
+                        std::memory_order_seq_cst, std::memory_order_relaxed);
+                    bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                    return result;
+                }
+                return true;
+            }
+
+            // deque was empty
+            bottom_.data_.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        // Remove an item from the top of the deque. May be called by any
+        // thread.
+        bool steal(T& val)
+        {
+            std::int64_t t = top_.data_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t b = bottom_.data_.load(std::memory_order_acquire);
+
+            if (t < b)
+            {
+                array* a = array_.load(std::memory_order_acquire);
+                T item = a->get(t);
+                if (!top_.data_.compare_exchange_strong(t, t + 1,
+                        std::memory_order_seq_cst, std::memory_order_relaxed))
+                {
+                    return false;    // lost the race
+                }
+                val = item;
+                return true;
+            }
+            return false;
+        }
+
+        bool empty() const
+        {
+            std::int64_t b = bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t t = top_.data_.load(std::memory_order_relaxed);
+            return b <= t;
+        }
+
+        std::size_t size() const
+        {
+            std::int64_t b = bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t t = top_.data_.load(std::memory_order_relaxed);
+            return b > t ? std::size_t(b - t) : 0;
+        }
+
+        std::size_t capacity() const
+        {
+            return std::size_t(
+                array_.load(std::memory_order_relaxed)->capacity());
+        }
+
+    private:
+        // Double the size of the array. Old arrays are kept alive until the
+        // deque is destroyed as thieves might still be reading from them.
+        array* grow(array* a, std::int64_t t, std::int64_t b)
+        {
+            std::unique_ptr<array> new_array(new array(2 * a->capacity()));
+            for (std::int64_t i = t; i != b; ++i)
+            {
+                new_array->put(i, a->get(i));
+            }
+
+            array* result = new_array.get();
+            arrays_.push_back(std::move(new_array));
+            array_.store(result, std::memory_order_release);
+            return result;
+        }
+
+        util::cache_line_data<std::atomic<std::int64_t>> top_;
+        util::cache_line_data<std::atomic<std::int64_t>> bottom_;
+        std::atomic<array*> array_;
+
+        // accessed by the owner only
+        std::vector<std::unique_ptr<array>> arrays_;
+    };
+}}    // namespace hpx::concurrency
@@ -0,0 +1,156 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/chase_lev_deque.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <hpx/modules/program_options.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using deque_type = hpx::concurrency::chase_lev_deque<std::uint64_t>;
+
+std::uint64_t threads = 4;
+std::uint64_t items = 500000;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_sequential()
+{
+    deque_type q(4);
+    HPX_TEST(q.empty());
+
+    // force the deque to grow a couple of times
+    for (std::uint64_t i = 0; i != 100; ++i)
+        q.push_bottom(i);
+
+    HPX_TEST(!q.empty());
+    HPX_TEST_EQ(q.size(), std::size_t(100));
+    HPX_TEST_LTE(std::size_t(128), q.capacity());
+
+    // the owner sees LIFO order, thieves see FIFO order
+    std::uint64_t val = 0;
+    HPX_TEST(q.pop_bottom(val));
+    HPX_TEST_EQ(val, std::uint64_t(99));
+    HPX_TEST(q.steal(val));
+    HPX_TEST_EQ(val, std::uint64_t(0));
+
+    std::uint64_t count = 2;
+    while (q.pop_bottom(val))
+        ++count;
+
+    HPX_TEST_EQ(count, std::uint64_t(100));
+    HPX_TEST(q.empty());
+    HPX_TEST(!q.steal(val));
+    HPX_TEST(!q.pop_bottom(val));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// The owner pushes all items (popping some of them back), while all other
+// threads concurrently steal. Every item has to be seen exactly once.
+void test_concurrent()
+{
+    deque_type q;
+    std::vector<std::atomic<std::uint8_t>> seen(items);
+    for (auto& s : seen)
+        s.store(0);
+
+    std::atomic<bool> done(false);
+    std::atomic<std::uint64_t> taken(0);
+
+    auto thief = [&]() {
+        std::uint64_t val = 0;
+        while (!done.load() || !q.empty())
+        {
+            if (q.steal(val))
+            {
+                ++seen[val];
+                ++taken;
+            }
+        }
+    };
+
+    std::vector<std::thread> thieves;
+    for (std::uint64_t i = 1; i < threads; ++i)
+        thieves.emplace_back(thief);
+
+    std::uint64_t val = 0;
+    for (std::uint64_t i = 0; i != items; ++i)
+    {
+        q.push_bottom(i);
+        if (i % 3 == 0 && q.pop_bottom(val))
+        {
+            ++seen[val];
+            ++taken;
+        }
+    }
+
+    while (q.pop_bottom(val))
+    {
+        ++seen[val];
+        ++taken;
+    }
+    done.store(true);
+
+    for (std::thread& t : thieves)
+        t.join();
+
+    HPX_TEST_EQ(taken.load(), items);
+    for (auto& s : seen)
+        HPX_TEST_EQ(s.load(), std::uint8_t(1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char** argv)
+{
+    using hpx::program_options::command_line_parser;
+    using hpx::program_options::notify;
+    using hpx::program_options::options_description;
+    using hpx::program_options::store;
+    using hpx::program_options::value;
+    using hpx::program_options::variables_map;
+
+    variables_map vm;
+
+    options_description desc_cmdline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_cmdline.add_options()
+        ("help,h", "print out program usage (this message)")
+        ("threads,t", value<std::uint64_t>(&threads)->default_value(4),
+         "the number of threads accessing the deque (one owner, all others "
+         "are stealing)")
+        ("items,i", value<std::uint64_t>(&items)->default_value(500000),
+         "the number of items to push onto the deque")
+    ;
+    // clang-format on
+
+    store(command_line_parser(argc, argv)
+              .options(desc_cmdline)
+              .allow_unregistered()
+              .run(),
+        vm);
+
+    notify(vm);
+
+    // print help screen
+    if (vm.count("help"))
+    {
+        std::cout << desc_cmdline;
+        return hpx::util::report_errors();
+    }
+
+    test_sequential();
+    test_concurrent();
+
+    return hpx::util::report_errors();
+}
@@ -46,6 +46,7 @@
  */
 #include <cerrno>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <stdexcept>
 
@@ -74,10 +75,36 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
     namespace posix {
         HPX_CORE_EXPORT extern bool use_guard_pages;
 
+        ///////////////////////////////////////////////////////////////////////
+        // Stacks released by free_stack() are kept mapped in a pool (one per
+        // NUMA domain) and are handed out again by alloc_stack(). The pool
+        // releases the physical pages of the pooled stacks lazily (using
+        // madvise) and limits the overall amount of address space held by
+        // the pooled stacks to the given number of bytes (zero disables the
+        // pool).
+        HPX_CORE_EXPORT extern std::size_t stack_pool_max_size;
+
+        // Retrieve a pooled stack of the given size, returns nullptr if none
+        // is available.
+        HPX_CORE_EXPORT void* stack_pool_get(std::size_t size);
+
+        // Return a stack of the given size to the pool, returns false if the
+        // pool is full (the stack has to be freed by the caller).
+        HPX_CORE_EXPORT bool stack_pool_put(void* stack, std::size_t size);
+
+        // Release all pooled stacks.
+        HPX_CORE_EXPORT void stack_pool_clear();
+
+        // Access the statistics of the stack pool
+        HPX_CORE_EXPORT std::int64_t get_stack_pool_hit_count(bool reset);
+        HPX_CORE_EXPORT std::int64_t get_stack_pool_miss_count(bool reset);
+        HPX_CORE_EXPORT std::int64_t get_stack_pool_reserved_size(bool reset);
+
 #if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
     _POSIX_MAPPED_FILES > 0
 
-        inline void* alloc_stack(std::size_t size)
+        // unconditionally map a new stack
+        inline void* map_stack(std::size_t size)
         {
             void* real_stack = ::mmap(nullptr, size + EXEC_PAGESIZE,
                 PROT_EXEC | PROT_READ | PROT_WRITE,
@@ -151,7 +178,8 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
             return false;
         }
 
-        inline void free_stack(void* stack, std::size_t size)
+        // unconditionally unmap the given stack
+        inline void unmap_stack(void* stack, std::size_t size)
         {
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
             if (use_guard_pages)
@@ -169,6 +197,21 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
 #endif
         }
 
+        inline void* alloc_stack(std::size_t size)
+        {
+            void* stack = stack_pool_get(size);
+            if (stack != nullptr)
+                return stack;
+
+            return map_stack(size);
+        }
+
+        inline void free_stack(void* stack, std::size_t size)
+        {
+            if (!stack_pool_put(stack, size))
+                unmap_stack(stack, size);
+        }
+
 #else    // non-mmap()
 
         //this should be a fine default.
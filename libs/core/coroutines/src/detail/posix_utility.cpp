@@ -9,6 +9,19 @@
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__) || defined(__APPLE__)
 #include <hpx/coroutines/detail/posix_utility.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#if defined(__linux) || defined(linux) || defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 namespace hpx { namespace threads { namespace coroutines { namespace detail {
     namespace posix {
@@ -16,5 +29,209 @@ namespace hpx { namespace threads { namespace coroutines { namespace detail {
         // this global (urghhh) variable is used to control whether guard pages
         // will be used or not
         HPX_CORE_EXPORT bool use_guard_pages = true;
+
+        // maximum number of bytes held by all pooled stacks
+        HPX_CORE_EXPORT std::size_t stack_pool_max_size = 0;
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+
+        namespace {
+            ///////////////////////////////////////////////////////////////////
+            // The NUMA domain the calling OS-thread is running on. Worker
+            // threads are usually bound to a core, thus the value is computed
+            // only once per OS-thread.
+            std::size_t get_numa_domain()
+            {
+#if defined(SYS_getcpu)
+                static thread_local std::size_t domain = std::size_t(-1);
+                if (domain == std::size_t(-1))
+                {
+                    unsigned cpu = 0, node = 0;
+                    if (::syscall(SYS_getcpu, &cpu, &node, nullptr) != 0)
+                        node = 0;
+                    domain = node % HPX_HAVE_MAX_NUMA_DOMAIN_COUNT;
+                }
+                return domain;
+#else
+                return 0;
+#endif
+            }
+
+            // Release the physical pages of the given stack, while keeping
+            // the address range mapped.
+            void release_stack_pages(void* stack, std::size_t size)
+            {
+#if defined(MADV_FREE)
+                // MADV_FREE lets the kernel reclaim the pages only when under
+                // memory pressure, which avoids page faults on reuse. It is
+                // not supported by older kernels.
+                if (::madvise(stack, size, MADV_FREE) == 0)
+                    return;
+#endif
+                ::madvise(stack, size, MADV_DONTNEED);
+            }
+
+            ///////////////////////////////////////////////////////////////////
+            struct stack_pool
+            {
+                struct domain_pool
+                {
+                    std::mutex mtx_;
+                    // pooled stacks, grouped by stack size
+                    std::vector<std::pair<std::size_t, std::vector<void*>>>
+                        stacks_;
+                };
+
+                void* get(std::size_t size)
+                {
+                    domain_pool& pool = domains_[get_numa_domain()];
+
+                    std::lock_guard<std::mutex> l(pool.mtx_);
+                    for (auto& p : pool.stacks_)
+                    {
+                        if (p.first == size && !p.second.empty())
+                        {
+                            void* stack = p.second.back();
+                            p.second.pop_back();
+
+                            reserved_size_ -= size;
+                            ++hits_;
+                            return stack;
+                        }
+                    }
+
+                    ++misses_;
+                    return nullptr;
+                }
+
+                bool put(void* stack, std::size_t size)
+                {
+                    // reserve the space for the stack in the pool
+                    std::size_t reserved = reserved_size_ += size;
+                    if (reserved > stack_pool_max_size)
+                    {
+                        reserved_size_ -= size;
+                        return false;
+                    }
+
+                    // the first page of the stack (the top most address) is
+                    // never released, see reset_stack
+                    if (size > EXEC_PAGESIZE)
+                        release_stack_pages(stack, size - EXEC_PAGESIZE);
+
+                    domain_pool& pool = domains_[get_numa_domain()];
+
+                    std::lock_guard<std::mutex> l(pool.mtx_);
+                    for (auto& p : pool.stacks_)
+                    {
+                        if (p.first == size)
+                        {
+                            p.second.push_back(stack);
+                            return true;
+                        }
+                    }
+
+                    pool.stacks_.emplace_back(size, std::vector<void*>(1, stack));
+                    return true;
+                }
+
+                void clear()
+                {
+                    for (domain_pool& pool : domains_)
+                    {
+                        std::lock_guard<std::mutex> l(pool.mtx_);
+                        for (auto& p : pool.stacks_)
+                        {
+                            for (void* stack : p.second)
+                            {
+                                unmap_stack(stack, p.first);
+                                reserved_size_ -= p.first;
+                            }
+                            p.second.clear();
+                        }
+                    }
+                }
+
+                domain_pool domains_[HPX_HAVE_MAX_NUMA_DOMAIN_COUNT];
+
+                std::atomic<std::size_t> reserved_size_{0};
+                std::atomic<std::int64_t> hits_{0};
+                std::atomic<std::int64_t> misses_{0};
+            };
+
+            // The pool is intentionally never destroyed as stacks may be
+            // released during global destruction.
+            stack_pool& get_stack_pool()
+            {
+                static stack_pool* pool = new stack_pool;
+                return *pool;
+            }
+        }    // namespace
+
+        void* stack_pool_get(std::size_t size)
+        {
+            if (stack_pool_max_size == 0)
+                return nullptr;
+            return get_stack_pool().get(size);
+        }
+
+        bool stack_pool_put(void* stack, std::size_t size)
+        {
+            if (stack_pool_max_size == 0)
+                return false;
+            return get_stack_pool().put(stack, size);
+        }
+
+        void stack_pool_clear()
+        {
+            get_stack_pool().clear();
+        }
+
+        std::int64_t get_stack_pool_hit_count(bool reset)
+        {
+            return util::get_and_reset_value(get_stack_pool().hits_, reset);
+        }
+
+        std::int64_t get_stack_pool_miss_count(bool reset)
+        {
+            return util::get_and_reset_value(get_stack_pool().misses_, reset);
+        }
+
+        std::int64_t get_stack_pool_reserved_size(bool)
+        {
+            return static_cast<std::int64_t>(
+                get_stack_pool().reserved_size_.load());
+        }
+
+#else    // non-mmap()
+
+        void* stack_pool_get(std::size_t)
+        {
+            return nullptr;
+        }
+
+        bool stack_pool_put(void*, std::size_t)
+        {
+            return false;
+        }
+
+        void stack_pool_clear() {}
+
+        std::int64_t get_stack_pool_hit_count(bool)
+        {
+            return 0;
+        }
+
+        std::int64_t get_stack_pool_miss_count(bool)
+        {
+            return 0;
+        }
+
+        std::int64_t get_stack_pool_reserved_size(bool)
+        {
+            return 0;
+        }
+#endif
 }}}}}    // namespace hpx::threads::coroutines::detail::posix
 #endif
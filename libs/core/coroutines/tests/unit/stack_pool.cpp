@@ -0,0 +1,141 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that stacks released by free_stack() are pooled and reused by
+// alloc_stack(), and that the pool honors its size limit.
+
+#include <hpx/config.hpp>
+#include <hpx/modules/testing.hpp>
+
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__) || defined(__APPLE__)
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0
+
+namespace posix = hpx::threads::coroutines::detail::posix;
+
+constexpr std::size_t stack_size = 8 * EXEC_PAGESIZE;
+
+void reset_counters()
+{
+    posix::get_stack_pool_hit_count(true);
+    posix::get_stack_pool_miss_count(true);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_reuse()
+{
+    posix::stack_pool_max_size = 2 * stack_size;
+    reset_counters();
+
+    // the pool is empty, a new stack is mapped
+    void* stack = posix::alloc_stack(stack_size);
+    HPX_TEST(stack != nullptr);
+    HPX_TEST_EQ(posix::get_stack_pool_miss_count(false), std::int64_t(1));
+    HPX_TEST_EQ(posix::get_stack_pool_hit_count(false), std::int64_t(0));
+    HPX_TEST_EQ(posix::get_stack_pool_reserved_size(false), std::int64_t(0));
+
+    std::memset(stack, 0x42, stack_size);
+
+    // releasing the stack keeps it in the pool
+    posix::free_stack(stack, stack_size);
+    HPX_TEST_EQ(posix::get_stack_pool_reserved_size(false),
+        std::int64_t(stack_size));
+
+    // a stack of a different size is not handed out
+    HPX_TEST(posix::stack_pool_get(2 * stack_size) == nullptr);
+    HPX_TEST_EQ(posix::get_stack_pool_miss_count(false), std::int64_t(2));
+
+    // the pooled stack is reused and is still writable
+    void* reused = posix::alloc_stack(stack_size);
+    HPX_TEST_EQ(reused, stack);
+    HPX_TEST_EQ(posix::get_stack_pool_hit_count(false), std::int64_t(1));
+    HPX_TEST_EQ(posix::get_stack_pool_reserved_size(false), std::int64_t(0));
+
+    std::memset(reused, 0x42, stack_size);
+
+    posix::free_stack(reused, stack_size);
+    posix::stack_pool_clear();
+}
+
+void test_limit()
+{
+    posix::stack_pool_max_size = 2 * stack_size;
+    reset_counters();
+
+    void* stacks[3];
+    for (void*& stack : stacks)
+        stack = posix::alloc_stack(stack_size);
+
+    // only two of the stacks fit into the pool, the last one is unmapped
+    HPX_TEST(posix::stack_pool_put(stacks[0], stack_size));
+    HPX_TEST(posix::stack_pool_put(stacks[1], stack_size));
+    HPX_TEST(!posix::stack_pool_put(stacks[2], stack_size));
+    posix::unmap_stack(stacks[2], stack_size);
+
+    HPX_TEST_EQ(posix::get_stack_pool_reserved_size(false),
+        std::int64_t(2 * stack_size));
+
+    posix::stack_pool_clear();
+}
+
+void test_clear()
+{
+    posix::stack_pool_max_size = 2 * stack_size;
+    reset_counters();
+
+    void* first = posix::alloc_stack(stack_size);
+    void* second = posix::alloc_stack(stack_size);
+    posix::free_stack(first, stack_size);
+    posix::free_stack(second, stack_size);
+    HPX_TEST_EQ(posix::get_stack_pool_reserved_size(false),
+        std::int64_t(2 * stack_size));
+
+    // clearing the pool unmaps all pooled stacks
+    posix::stack_pool_clear();
+    HPX_TEST_EQ(posix::get_stack_pool_reserved_size(false), std::int64_t(0));
+    HPX_TEST(posix::stack_pool_get(stack_size) == nullptr);
+
+    // clearing an empty pool is harmless
+    posix::stack_pool_clear();
+    HPX_TEST_EQ(posix::get_stack_pool_reserved_size(false), std::int64_t(0));
+}
+
+void test_disabled()
+{
+    posix::stack_pool_max_size = 0;
+    reset_counters();
+
+    void* stack = posix::alloc_stack(stack_size);
+    HPX_TEST(!posix::stack_pool_put(stack, stack_size));
+    HPX_TEST_EQ(posix::get_stack_pool_reserved_size(false), std::int64_t(0));
+    posix::unmap_stack(stack, stack_size);
+}
+
+int main()
+{
+    test_reuse();
+    test_limit();
+    test_clear();
+    test_disabled();
+
+    return hpx::util::report_errors();
+}
+
+#else
+
+int main()
+{
+    return hpx::util::report_errors();
+}
+#endif
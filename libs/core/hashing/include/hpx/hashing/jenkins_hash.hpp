@@ -129,6 +129,11 @@ namespace hpx { namespace util {
             return hash(key, std::strlen(key));
         }
 
+        size_type operator()(char const* key, std::size_t length) const
+        {
+            return hash(key, length);
+        }
+
         /// re-seed the hash generator
         bool reset(size_type size)
         {
@@ -0,0 +1,49 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace hpx { namespace traits {
+    namespace detail {
+        template <typename Iter,
+            typename T = typename std::iterator_traits<Iter>::value_type>
+        struct is_vector_iterator
+          : std::integral_constant<bool,
+                std::is_same<Iter,
+                    typename std::vector<T>::iterator>::value ||
+                    std::is_same<Iter,
+                        typename std::vector<T>::const_iterator>::value>
+        {
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // An iterator is contiguous if the elements it refers to are stored next
+    // to each other in memory. This is known to be the case for pointers and
+    // for the iterators of std::vector (except std::vector<bool>).
+    template <typename Iter, typename Enable = void>
+    struct is_contiguous_iterator : std::is_pointer<Iter>
+    {
+    };
+
+    template <typename Iter>
+    struct is_contiguous_iterator<Iter,
+        typename std::enable_if<!std::is_pointer<Iter>::value &&
+            std::is_object<
+                typename std::iterator_traits<Iter>::value_type>::value &&
+            !std::is_abstract<
+                typename std::iterator_traits<Iter>::value_type>::value &&
+            !std::is_same<typename std::iterator_traits<Iter>::value_type,
+                bool>::value>::type> : detail::is_vector_iterator<Iter>
+    {
+    };
+}}    // namespace hpx::traits
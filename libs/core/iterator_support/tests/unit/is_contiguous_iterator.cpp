@@ -0,0 +1,66 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/iterator_support/traits/is_contiguous_iterator.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <deque>
+#include <iterator>
+#include <list>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void pointer_iterator()
+{
+    HPX_TEST_MSG(
+        (hpx::traits::is_contiguous_iterator<int*>::value == true), "pointer");
+    HPX_TEST_MSG((hpx::traits::is_contiguous_iterator<int const*>::value ==
+                     true),
+        "pointer-const");
+}
+
+void vector_iterator()
+{
+    typedef std::vector<int> vector;
+
+    HPX_TEST_MSG((hpx::traits::is_contiguous_iterator<
+                      vector::iterator>::value == true),
+        "vector");
+    HPX_TEST_MSG((hpx::traits::is_contiguous_iterator<
+                      vector::const_iterator>::value == true),
+        "vector-const");
+    HPX_TEST_MSG((hpx::traits::is_contiguous_iterator<
+                      std::vector<bool>::iterator>::value == false),
+        "vector-bool");
+}
+
+void non_contiguous_iterator()
+{
+    HPX_TEST_MSG((hpx::traits::is_contiguous_iterator<
+                      std::deque<int>::iterator>::value == false),
+        "deque");
+    HPX_TEST_MSG((hpx::traits::is_contiguous_iterator<
+                      std::list<int>::iterator>::value == false),
+        "list");
+    HPX_TEST_MSG((hpx::traits::is_contiguous_iterator<std::back_insert_iterator<
+                      std::vector<int>>>::value == false),
+        "back_insert_iterator");
+    HPX_TEST_MSG(
+        (hpx::traits::is_contiguous_iterator<int>::value == false), "int");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    {
+        pointer_iterator();
+        vector_iterator();
+        non_contiguous_iterator();
+    }
+
+    return hpx::util::report_errors();
+}
@@ -18,10 +18,13 @@
 #endif
 
 // Does not rely on CXX11_STD_ATOMIC_128BIT
+#include <hpx/concurrency/chase_lev_deque.hpp>
 #include <hpx/concurrency/concurrentqueue.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <thread>
 #include <utility>
 
 namespace hpx { namespace threads { namespace policies {
@@ -138,6 +141,127 @@ namespace hpx { namespace threads { namespace policies {
         };
     };
 
+    ////////////////////////////////////////////////////////////////////////////
+    // Chase-Lev work-stealing deque: LIFO for the owning worker thread,
+    // stealing at the opposite end for all other threads.
+    //
+    // Only the worker thread the queue is bound to (see bind_owner) may push
+    // to and pop from the bottom end of the deque. Items pushed by any other
+    // thread are placed into a separate MPMC inbox, which is drained by the
+    // owner once its deque runs empty (and periodically, to avoid starving
+    // those items). Items pushed to the other end are handed out only after
+    // both, the deque and the inbox have run empty.
+    template <typename T>
+    struct chase_lev_lifo_backend
+    {
+        using container_type = hpx::concurrency::chase_lev_deque<T>;
+        using inbox_type = hpx::concurrency::ConcurrentQueue<T>;
+
+        using value_type = T;
+        using reference = T&;
+        using const_reference = T const&;
+        using size_type = std::uint64_t;
+
+        // the owner looks at the inbox first every that many pops
+        static constexpr std::uint32_t inbox_poll_interval = 61;
+
+        chase_lev_lifo_backend(
+            size_type initial_size = 0, size_type num_thread = size_type(-1))
+          : deque_(std::size_t(initial_size))
+          , inbox_(std::size_t(initial_size))
+          , last_(0)
+          , owner_(std::thread::id())
+          , pop_count_(0)
+        {
+        }
+
+        // Make the calling OS-thread the owner of this queue.
+        void bind_owner()
+        {
+            owner_.store(std::this_thread::get_id(), std::memory_order_release);
+        }
+
+        bool push(const_reference val, bool other_end = false)
+        {
+            if (other_end)
+                return last_.enqueue(val);
+
+            if (is_owner())
+            {
+                deque_.push_bottom(val);
+                return true;
+            }
+            return inbox_.enqueue(val);
+        }
+
+        bool pop(reference val, bool /* steal */ = true)
+        {
+            if (is_owner())
+            {
+                if (++pop_count_ == inbox_poll_interval)
+                {
+                    pop_count_ = 0;
+                    if (inbox_.try_dequeue(val))
+                        return true;
+                }
+                return deque_.pop_bottom(val) || inbox_.try_dequeue(val) ||
+                    last_.try_dequeue(val);
+            }
+            return deque_.steal(val) || inbox_.try_dequeue(val) ||
+                last_.try_dequeue(val);
+        }
+
+        bool empty()
+        {
+            return deque_.empty() && inbox_.size_approx() == 0 &&
+                last_.size_approx() == 0;
+        }
+
+    private:
+        bool is_owner() const
+        {
+            return owner_.load(std::memory_order_relaxed) ==
+                std::this_thread::get_id();
+        }
+
+        container_type deque_;
+        inbox_type inbox_;
+        inbox_type last_;
+        std::atomic<std::thread::id> owner_;
+        std::uint32_t pop_count_;    // accessed by the owner only
+    };
+
+    struct chase_lev_lifo
+    {
+        template <typename T>
+        struct apply
+        {
+            using type = chase_lev_lifo_backend<T>;
+        };
+    };
+
+    namespace detail {
+
+        // Queue backends which distinguish between their owning thread and
+        // other threads expose bind_owner(), all others ignore this call.
+        template <typename Queue>
+        auto bind_owner(Queue& queue, int) -> decltype(queue.bind_owner())
+        {
+            queue.bind_owner();
+        }
+
+        template <typename Queue>
+        void bind_owner(Queue&, long)
+        {
+        }
+
+        template <typename Queue>
+        void bind_owner(Queue& queue)
+        {
+            detail::bind_owner(queue, 0);
+        }
+    }    // namespace detail
+
 // LIFO
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
             struct lockfree_lifo;
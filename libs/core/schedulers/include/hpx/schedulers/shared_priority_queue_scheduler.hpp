@@ -12,6 +12,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/debugging/print.hpp>
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/functional/function.hpp>
@@ -26,6 +27,7 @@
 #include <hpx/threading_base/thread_num_tss.hpp>
 #include <hpx/threading_base/thread_queue_init_parameters.hpp>
 #include <hpx/topology/topology.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
 
 #include <array>
 #include <cstddef>
@@ -176,6 +178,10 @@ namespace hpx { namespace threads { namespace policies {
           , thread_init_counter_(0)
         {
             HPX_ASSERT(num_workers_ != 0);
+            std::fill(n_lookup_.begin(), n_lookup_.end(), std::size_t(-1));
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+            numa_counts_.resize(num_workers_);
+#endif
         }
 
         virtual ~shared_priority_queue_scheduler() {}
@@ -194,6 +200,8 @@ namespace hpx { namespace threads { namespace policies {
                     steal_hp_first_ = mode & policies::steal_high_priority_first;
                     core_stealing_ = mode & policies::enable_stealing;
                     numa_stealing_ = mode & policies::enable_stealing_numa;
+                    steal_in_domain_first_ =
+                        mode & policies::steal_in_domain_first;
                     spq_deb.debug(debug::str<>("scheduler_mode")
                         , round_robin_ ? "round_robin" : "thread parent"
                         , ','
@@ -201,7 +209,9 @@ namespace hpx { namespace threads { namespace policies {
                         , ','
                         , core_stealing_ ? "stealing" : "no stealing"
                         , ','
-                        , numa_stealing_ ? "numa stealing" : "no numa stealing");
+                        , numa_stealing_ ? "numa stealing" : "no numa stealing"
+                        , ','
+                        , steal_in_domain_first_ ? "steal in domain first" : "");
             // clang-format on
         }
 
@@ -232,6 +242,20 @@ namespace hpx { namespace threads { namespace policies {
             return std::size_t(-1);
         }
 
+        // ------------------------------------------------------------
+        // NUMA schedule hints refer to the NUMA domains of the system, map
+        // those onto the domains the worker threads of this scheduler are
+        // running on
+        inline std::size_t get_hint_domain(std::int16_t hint) const
+        {
+            if (hint >= 0 && std::size_t(hint) < n_lookup_.size() &&
+                n_lookup_[hint] != std::size_t(-1))
+            {
+                return n_lookup_[hint];
+            }
+            return fast_mod(std::size_t(hint), num_domains_);
+        }
+
         // ------------------------------------------------------------
         bool cleanup_terminated(bool delete_all) override
         {
@@ -386,7 +410,7 @@ namespace hpx { namespace threads { namespace policies {
                 // Create thread on requested NUMA domain
                 spq_deb.set(msg, "HINT_NUMA  ");
                 // TODO: This case does not handle suspended PUs.
-                domain_num = fast_mod(data.schedulehint.hint, num_domains_);
+                domain_num = get_hint_domain(data.schedulehint.hint);
                 // if the thread creating the new task is on the domain
                 // assigned to the new task - try to reuse the core as well
                 if (local_num != std::size_t(-1) &&
@@ -536,28 +560,26 @@ namespace hpx { namespace threads { namespace policies {
                         debug::dec<2>(domain), "Q", debug::dec<3>(q_index));
                     return result;
                 }
-                if (!steal_numa)
+                // steal from other cores on this numa domain, unless tasks
+                // should be stolen from other numa domains right away
+                if ((!steal_numa || steal_in_domain_first_) &&
+                    q_counts_[domain] > 1)
                 {
-                    if (q_counts_[domain] > 1)
+                    // use q+1 to avoid testing the same local queue again
+                    q_index = fast_mod((q_index + 1), q_counts_[domain]);
+                    result =
+                        operation_HP(domain, q_index, origin, var, true, true);
+                    result = result ||
+                        operation(domain, q_index, origin, var, true, true);
+                    if (result)
                     {
-                        // steal from other cores on this numa domain?
-                        // use q+1 to avoid testing the same local queue again
-                        q_index = fast_mod((q_index + 1), q_counts_[domain]);
-                        result = operation_HP(
-                            domain, q_index, origin, var, true, true);
-                        result = result ||
-                            operation(domain, q_index, origin, var, true, true);
-                        if (result)
-                        {
-                            spq_deb.debug(debug::str<>(prefix),
-                                "steal_after_local this numa", "stolen", "D",
-                                debug::dec<2>(domain), "Q",
-                                debug::dec<3>(q_index));
-                            return result;
-                        }
+                        spq_deb.debug(debug::str<>(prefix),
+                            "steal_after_local this numa", "stolen", "D",
+                            debug::dec<2>(domain), "Q", debug::dec<3>(q_index));
+                        return result;
                     }
                 }
-                else
+                if (steal_numa)
                 {
                     // try other numa domains BP/HP
                     for (std::size_t d = 1; d < num_domains_; ++d)
@@ -611,25 +633,35 @@ namespace hpx { namespace threads { namespace policies {
             //
             spq_deb.timed(getnext, debug::dec<>(thread_num));
 
+            std::size_t domain = d_lookup_[this_thread];
+            std::size_t q_index = q_lookup_[this_thread];
+
             auto get_next_thread_function_HP =
-                [&](std::size_t domain, std::size_t q_index,
+                [&](std::size_t d, std::size_t q,
                     thread_holder_type* receiver, threads::thread_data*& thrd,
                     bool stealing, bool allow_stealing) {
-                    return numa_holder_[domain].get_next_thread_HP(
-                        q_index, thrd, stealing, allow_stealing);
+                    bool result = numa_holder_[d].get_next_thread_HP(
+                        q, thrd, stealing, allow_stealing);
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+                    if (result && d != domain)
+                        ++numa_counts_[this_thread].data_.cross_domain_steals_;
+#endif
+                    return result;
                 };
 
             auto get_next_thread_function =
-                [&](std::size_t domain, std::size_t q_index,
+                [&](std::size_t d, std::size_t q,
                     thread_holder_type* receiver, threads::thread_data*& thrd,
                     bool stealing, bool allow_stealing) {
-                    return numa_holder_[domain].get_next_thread(
-                        q_index, thrd, stealing, allow_stealing);
+                    bool result = numa_holder_[d].get_next_thread(
+                        q, thrd, stealing, allow_stealing);
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+                    if (result && d != domain)
+                        ++numa_counts_[this_thread].data_.cross_domain_steals_;
+#endif
+                    return result;
                 };
 
-            std::size_t domain = d_lookup_[this_thread];
-            std::size_t q_index = q_lookup_[this_thread];
-
             // first try a high priority task, allow stealing
             // if stealing of HP tasks in on, this will be fine
             // but send a null function for normal tasks
@@ -639,7 +671,21 @@ namespace hpx { namespace threads { namespace policies {
                 get_next_thread_function);
 
             if (result)
+            {
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+                // count tasks which were placed close to their data but end
+                // up running on a different numa domain
+                threads::thread_schedule_hint const hint =
+                    thrd->get_schedule_hint();
+                if (hint.mode == thread_schedule_hint_mode_numa &&
+                    get_hint_domain(hint.hint) != domain)
+                {
+                    ++numa_counts_[this_thread]
+                          .data_.remote_memory_executions_;
+                }
+#endif
                 return result;
+            }
 
             // if we did not get a task at all, then try converting
             // tasks in the pending queue into staged ones
@@ -666,24 +712,34 @@ namespace hpx { namespace threads { namespace policies {
 
             added = 0;
 
+            std::size_t domain = d_lookup_[this_thread];
+            std::size_t q_index = q_lookup_[this_thread];
+
             auto add_new_function_HP =
-                [&](std::size_t domain, std::size_t q_index,
+                [&](std::size_t d, std::size_t q,
                     thread_holder_type* receiver, std::size_t& added,
                     bool stealing, bool allow_stealing) {
-                    return numa_holder_[domain].add_new_HP(
-                        receiver, q_index, added, stealing, allow_stealing);
+                    bool result = numa_holder_[d].add_new_HP(
+                        receiver, q, added, stealing, allow_stealing);
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+                    if (result && d != domain)
+                        ++numa_counts_[this_thread].data_.cross_domain_steals_;
+#endif
+                    return result;
                 };
 
-            auto add_new_function = [&](std::size_t domain, std::size_t q_index,
+            auto add_new_function = [&](std::size_t d, std::size_t q,
                                         thread_holder_type* receiver,
                                         std::size_t& added, bool stealing,
                                         bool allow_stealing) {
-                return numa_holder_[domain].add_new(
-                    receiver, q_index, added, stealing, allow_stealing);
+                bool result = numa_holder_[d].add_new(
+                    receiver, q, added, stealing, allow_stealing);
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+                if (result && d != domain)
+                    ++numa_counts_[this_thread].data_.cross_domain_steals_;
+#endif
+                return result;
             };
-
-            std::size_t domain = d_lookup_[this_thread];
-            std::size_t q_index = q_lookup_[this_thread];
             //
             thread_holder_type* receiver =
                 numa_holder_[domain].queues_[q_index];
@@ -788,17 +844,21 @@ namespace hpx { namespace threads { namespace policies {
                 // Create thread on requested NUMA domain
                 spq_deb.set(msg, "HINT_NUMA  ");
                 // TODO: This case does not handle suspended PUs.
-                domain_num = fast_mod(schedulehint.mode, num_domains_);
-                // if the thread creating the new task is on the domain
-                // assigned to the new task - try to reuse the core as well
-                if (d_lookup_[thread_num] == domain_num)
+                domain_num = get_hint_domain(schedulehint.hint);
+                // if the thread scheduling the task is on the domain
+                // assigned to the task - try to reuse the core as well
+                if (local_num != std::size_t(-1) &&
+                    d_lookup_[local_num] == domain_num)
                 {
-                    q_index = q_lookup_[thread_num];
+                    q_index = q_lookup_[local_num];
                 }
                 else
                 {
-                    throw std::runtime_error(
-                        "counter problem in thread scheduler");
+                    // otherwise pick the queues on the domain round robin
+                    q_index =
+                        numa_holder_[domain_num].thread_queue(0)->worker_next(
+                            q_counts_[domain_num]);
+                    thread_num = q_offset_[domain_num] + q_index;
                 }
                 break;
             }
@@ -989,6 +1049,15 @@ namespace hpx { namespace threads { namespace policies {
                 }
                 num_domains_ = domain_map.size();
 
+                // remember which numa domain of the system corresponds to
+                // each of the domains used by this scheduler
+                std::fill(n_lookup_.begin(), n_lookup_.end(), std::size_t(-1));
+                for (auto const& d : domain_map)
+                {
+                    if (d.first < n_lookup_.size())
+                        n_lookup_[d.first] = d.second;
+                }
+
                 // if we have zero threads on a numa domain, reindex the domains
                 // to be sequential otherwise it messes up counting as an
                 // indexing operation. This can happen on nodes that have unusual
@@ -1320,6 +1389,20 @@ namespace hpx { namespace threads { namespace policies {
                 "get_num_stolen_to_staged performance counter");
             return 0;
         }
+
+        std::int64_t get_num_stolen_cross_domain(
+            std::size_t num, bool reset) override
+        {
+            return get_numa_count(
+                &numa_steal_counts::cross_domain_steals_, num, reset);
+        }
+
+        std::int64_t get_num_remote_memory_executions(
+            std::size_t num, bool reset) override
+        {
+            return get_numa_count(
+                &numa_steal_counts::remote_memory_executions_, num, reset);
+        }
 #endif
 
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
@@ -1358,6 +1441,8 @@ namespace hpx { namespace threads { namespace policies {
             d_lookup_;    // numa domain
         std::array<std::size_t, HPX_HAVE_MAX_CPU_COUNT>
             q_lookup_;    // queue on domain
+        // lookup for numa domains of the system into domains of this scheduler
+        std::array<std::size_t, HPX_HAVE_MAX_NUMA_DOMAIN_COUNT> n_lookup_;
 #ifdef SHARED_PRIORITY_SCHEDULER_LINUX
         std::array<std::size_t, HPX_HAVE_MAX_CPU_COUNT> schedcpu_;    // cpu_id
 #endif
@@ -1379,6 +1464,38 @@ namespace hpx { namespace threads { namespace policies {
         // when false, no stealing takes place between any cores(queues)
         bool core_stealing_;
 
+        // when true, steal_after_local tries all queues on the own numa domain
+        // before stealing from other numa domains
+        bool steal_in_domain_first_;
+
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+        // per worker thread counts of tasks stolen from other numa domains
+        // and of tasks placed on a numa domain which were run elsewhere
+        struct numa_steal_counts
+        {
+            std::int64_t cross_domain_steals_ = 0;
+            std::int64_t remote_memory_executions_ = 0;
+        };
+        std::vector<util::cache_line_data<numa_steal_counts>> numa_counts_;
+
+        std::int64_t get_numa_count(std::int64_t numa_steal_counts::*count,
+            std::size_t num, bool reset)
+        {
+            if (num != std::size_t(-1))
+            {
+                return util::get_and_reset_value(
+                    numa_counts_[num].data_.*count, reset);
+            }
+
+            std::int64_t result = 0;
+            for (auto& counts : numa_counts_)
+            {
+                result += util::get_and_reset_value(counts.data_.*count, reset);
+            }
+            return result;
+        }
+#endif
+
         // number of worker threads assigned to this pool
         std::size_t num_workers_;
 
@@ -12,6 +12,7 @@
 #include <hpx/serialization/binary_filter.hpp>
 
 #include <cstddef>
+#include <memory>
 
 namespace hpx { namespace serialization {
 
@@ -43,5 +44,14 @@ namespace hpx { namespace serialization {
         virtual void set_filter(binary_filter* filter) = 0;
         virtual void load_binary(void* address, std::size_t count) = 0;
         virtual void load_binary_chunk(void* address, std::size_t count) = 0;
+
+        // Return a pointer to the data of the current zero-copy chunk
+        // (sharing the ownership of the receive buffer) instead of copying
+        // it. An empty pointer is returned if this is not possible.
+        virtual std::shared_ptr<void> load_binary_chunk_shared(
+            std::size_t /* count */, std::size_t /* alignment */)
+        {
+            return std::shared_ptr<void>();
+        }
     };
 }}    // namespace hpx::serialization
@@ -10,6 +10,7 @@
 
 #if defined(HPX_HAVE_DATAPAR)
 
+#include <hpx/serialization/detail/std_experimental_simd.hpp>
 #include <hpx/serialization/detail/vc.hpp>
 
 #endif
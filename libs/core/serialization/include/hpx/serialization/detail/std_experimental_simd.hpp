@@ -0,0 +1,54 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_STD_EXPERIMENTAL_SIMD)
+
+#include <hpx/serialization/array.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/traits/is_bitwise_serializable.hpp>
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#include <experimental/simd>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace serialization {
+
+    template <typename T, typename Abi>
+    void serialize(
+        input_archive& ar, std::experimental::simd<T, Abi>& v, unsigned)
+    {
+        std::array<T, std::experimental::simd<T, Abi>::size()> data;
+        ar& data;
+        v.copy_from(data.data(), std::experimental::element_aligned);
+    }
+
+    template <typename T, typename Abi>
+    void serialize(
+        output_archive& ar, std::experimental::simd<T, Abi> const& v, unsigned)
+    {
+        std::array<T, std::experimental::simd<T, Abi>::size()> data;
+        v.copy_to(data.data(), std::experimental::element_aligned);
+        ar& data;
+    }
+}}    // namespace hpx::serialization
+
+namespace hpx { namespace traits {
+
+    template <typename T, typename Abi>
+    struct is_bitwise_serializable<std::experimental::simd<T, Abi>>
+      : is_bitwise_serializable<typename std::remove_const<T>::type>
+    {
+    };
+}}    // namespace hpx::traits
+
+#endif
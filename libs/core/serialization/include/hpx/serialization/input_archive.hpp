@@ -32,12 +32,16 @@ namespace hpx { namespace serialization {
     {
         using base_type = basic_archive<input_archive>;
 
+        // If chunks_owner is given, it is assumed to keep alive the memory
+        // the zero-copy chunks refer to. This allows for the data of those
+        // chunks to be used in place (see load_array_shared).
         template <typename Container>
         input_archive(Container& buffer, std::size_t inbound_data_size = 0,
-            const std::vector<serialization_chunk>* chunks = nullptr)
+            const std::vector<serialization_chunk>* chunks = nullptr,
+            std::shared_ptr<void> chunks_owner = std::shared_ptr<void>())
           : base_type(0U)
           , buffer_(new input_container<Container>(
-                buffer, chunks, inbound_data_size))
+                buffer, chunks, inbound_data_size, std::move(chunks_owner)))
         {
             // endianness needs to be saves separately as it is needed to
             // properly interpret the flags
@@ -110,6 +114,38 @@ namespace hpx { namespace serialization {
             HPX_ASSERT(0 == static_cast<int>(b) || 1 == static_cast<int>(b));
         }
 
+        // Return a pointer to the data of an array of count elements stored
+        // in the next zero-copy chunk without copying it. The returned
+        // pointer shares the ownership of the receive buffer. An empty
+        // pointer is returned if the array has to be loaded (copied) as
+        // usual, nothing is read from the archive in this case.
+        template <typename T>
+        std::shared_ptr<T> load_array_shared(std::size_t count)
+        {
+            static_assert(hpx::traits::is_bitwise_serializable<T>::value,
+                "Only bitwise serializable data can be used in place");
+
+#if BOOST_ENDIAN_BIG_BYTE
+            bool archive_endianess_differs = endian_little();
+#else
+            bool archive_endianess_differs = endian_big();
+#endif
+            if (count == 0 || disable_array_optimization() ||
+                disable_data_chunking() || archive_endianess_differs)
+            {
+                return std::shared_ptr<T>();
+            }
+
+            std::size_t const size = count * sizeof(T);
+            std::shared_ptr<void> data =
+                buffer_->load_binary_chunk_shared(size, alignof(T));
+            if (!data)
+                return std::shared_ptr<T>();
+
+            size_ += size;
+            return std::static_pointer_cast<T>(data);
+        }
+
         std::size_t bytes_read() const
         {
             return size_;
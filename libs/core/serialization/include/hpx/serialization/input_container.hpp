@@ -19,6 +19,7 @@
 #include <cstdint>
 #include <cstring>    // for memcpy
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace hpx { namespace serialization {
@@ -49,6 +50,19 @@ namespace hpx { namespace serialization {
             return chunks_->size();
         }
 
+        void verify_current_chunk(std::size_t count) const
+        {
+            HPX_ASSERT(current_chunk_ != std::size_t(-1));
+            HPX_ASSERT(get_chunk_type(current_chunk_) == chunk_type_pointer);
+
+            if (get_chunk_size(current_chunk_) != count)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "input_container::load_binary_chunk",
+                    "archive data bstream data chunk size mismatch");
+            }
+        }
+
     public:
         input_container(Container const& cont, std::size_t inbound_data_size)
           : cont_(cont)
@@ -63,7 +77,8 @@ namespace hpx { namespace serialization {
 
         input_container(Container const& cont,
             std::vector<serialization_chunk> const* chunks,
-            std::size_t inbound_data_size)
+            std::size_t inbound_data_size,
+            std::shared_ptr<void> chunks_owner = std::shared_ptr<void>())
           : cont_(cont)
           , current_(0)
           , filter_()
@@ -71,6 +86,7 @@ namespace hpx { namespace serialization {
           , chunks_(nullptr)
           , current_chunk_(std::size_t(-1))
           , current_chunk_size_(0)
+          , chunks_owner_(std::move(chunks_owner))
         {
             if (chunks && chunks->size() != 0)
             {
@@ -156,27 +172,44 @@ namespace hpx { namespace serialization {
             }
             else
             {
-                HPX_ASSERT(current_chunk_ != std::size_t(-1));
-                HPX_ASSERT(
-                    get_chunk_type(current_chunk_) == chunk_type_pointer);
+                verify_current_chunk(count);
 
-                if (get_chunk_size(current_chunk_) != count)
-                {
-                    HPX_THROW_EXCEPTION(serialization_error,
-                        "input_container::load_binary_chunk",
-                        "archive data bstream data chunk size mismatch");
-                    return;
-                }
-
-                // unfortunately we can't implement a zero copy policy on
-                // the receiving end
-                // as the memory was already allocated by the serialization code
+                // the memory was already allocated by the serialization
+                // code, we have to copy the data
                 std::memcpy(
                     address, get_chunk_data(current_chunk_).pos_, count);
                 ++current_chunk_;
             }
         }
 
+        std::shared_ptr<void> load_binary_chunk_shared(
+            std::size_t count, std::size_t alignment)    // override
+        {
+            HPX_ASSERT((std::int64_t) count >= 0);
+
+            // zero-copy receive is possible only if somebody owns the
+            // memory of the chunks
+            if (!chunks_owner_ || chunks_ == nullptr ||
+                count < HPX_ZERO_COPY_SERIALIZATION_THRESHOLD || filter_)
+            {
+                return std::shared_ptr<void>();
+            }
+
+            verify_current_chunk(count);
+
+            void* data = get_chunk_data(current_chunk_).pos_;
+            if (reinterpret_cast<std::uintptr_t>(data) % alignment != 0)
+            {
+                // the data can't be used in place, let the caller copy it
+                return std::shared_ptr<void>();
+            }
+
+            ++current_chunk_;
+
+            // share the ownership of the receive buffer
+            return std::shared_ptr<void>(chunks_owner_, data);
+        }
+
         Container const& cont_;
         std::size_t current_;
         std::unique_ptr<binary_filter> filter_;
@@ -185,5 +218,8 @@ namespace hpx { namespace serialization {
         std::vector<serialization_chunk> const* chunks_;
         std::size_t current_chunk_;
         std::size_t current_chunk_size_;
+
+        // keeps the memory referenced by the zero-copy chunks alive
+        std::shared_ptr<void> chunks_owner_;
     };
 }}    // namespace hpx::serialization
@@ -14,16 +14,17 @@
 #include <hpx/serialization/array.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/traits/is_bitwise_serializable.hpp>
 
 #if !defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
 #include <boost/shared_array.hpp>
-#else
-#include <memory>
 #endif
 
 #include <algorithm>
 #include <cstddef>
+#include <memory>
 #include <type_traits>
+#include <utility>
 
 namespace hpx { namespace serialization {
 
@@ -301,12 +302,42 @@ namespace hpx { namespace serialization {
         }
 
         ///////////////////////////////////////////////////////////////////////
+        // Received data is used in place if the allocator is not
+        // customized (the buffer would be released through it otherwise).
+        using use_data_in_place = std::integral_constant<bool,
+            std::is_same<Allocator, std::allocator<T>>::value &&
+                hpx::traits::is_bitwise_serializable<T>::value>;
+
+        template <typename Archive>
+        bool load_in_place(Archive&, std::false_type)
+        {
+            return false;
+        }
+
+        template <typename Archive>
+        bool load_in_place(Archive& ar, std::true_type)
+        {
+            std::shared_ptr<T> data = ar.template load_array_shared<T>(size_);
+            if (!data)
+                return false;
+
+            // the data stays valid as long as the receive buffer is alive
+            T* p = data.get();
+            data_ = buffer_type(p, [owner = std::move(data)](T*) {});
+            return true;
+        }
+
         template <typename Archive>
         void load(Archive& ar, unsigned int const)
         {
             ar >> size_ >> alloc_;
             // -V128
 
+            if (size_ != 0 && load_in_place(ar, use_data_in_place()))
+            {
+                return;
+            }
+
             data_.reset(alloc_.allocate(size_),
                 [alloc = this->alloc_, size = this->size_](T* p) {
                     serialize_buffer::deleter<allocator_type>(p, alloc, size);
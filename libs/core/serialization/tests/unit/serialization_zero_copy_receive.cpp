@@ -0,0 +1,130 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialization_chunk.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+using buffer_type = hpx::serialization::serialize_buffer<double>;
+
+// Mimic the parcel layer: the zero-copy chunks are received into separately
+// allocated buffers which are owned by the receive buffer.
+struct receive_buffer
+{
+    std::vector<char> data_;
+    std::vector<hpx::serialization::serialization_chunk> chunks_;
+    std::shared_ptr<std::vector<std::vector<char>>> chunk_data_;
+};
+
+receive_buffer send(buffer_type const& buffer)
+{
+    receive_buffer rcv;
+
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+    {
+        hpx::serialization::output_archive oarchive(rcv.data_, 0U, &chunks);
+        oarchive << buffer;
+    }
+
+    rcv.chunk_data_ = std::make_shared<std::vector<std::vector<char>>>();
+    for (auto const& c : chunks)
+    {
+        if (c.type_ == hpx::serialization::chunk_type_pointer)
+        {
+            char const* data = static_cast<char const*>(c.data_.cpos_);
+            rcv.chunk_data_->emplace_back(data, data + c.size_);
+            rcv.chunks_.push_back(hpx::serialization::create_pointer_chunk(
+                rcv.chunk_data_->back().data(), c.size_));
+        }
+        else
+        {
+            rcv.chunks_.push_back(c);
+        }
+    }
+    return rcv;
+}
+
+buffer_type receive(receive_buffer& rcv, bool zero_copy_receive)
+{
+    buffer_type buffer;
+
+    std::shared_ptr<void> chunks_owner;
+    if (zero_copy_receive)
+        chunks_owner = rcv.chunk_data_;
+
+    hpx::serialization::input_archive iarchive(
+        rcv.data_, rcv.data_.size(), &rcv.chunks_, std::move(chunks_owner));
+    iarchive >> buffer;
+
+    return buffer;
+}
+
+bool is_received_in_place(receive_buffer const& rcv, buffer_type const& buffer)
+{
+    for (auto const& c : *rcv.chunk_data_)
+    {
+        if (static_cast<void const*>(c.data()) ==
+            static_cast<void const*>(buffer.data()))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test(std::size_t size, bool zero_copy_receive, bool expect_in_place)
+{
+    buffer_type out(size);
+    for (std::size_t i = 0; i != size; ++i)
+        out[i] = double(i);
+
+    receive_buffer rcv = send(out);
+    buffer_type in = receive(rcv, zero_copy_receive);
+
+    HPX_TEST_EQ(in.size(), size);
+    HPX_TEST_EQ(is_received_in_place(rcv, in), expect_in_place);
+
+    // the received data has to stay valid after the receive buffer is gone
+    std::weak_ptr<std::vector<std::vector<char>>> chunk_data = rcv.chunk_data_;
+    rcv = receive_buffer();
+    HPX_TEST_EQ(chunk_data.expired(), !expect_in_place);
+
+    for (std::size_t i = 0; i != size; ++i)
+        HPX_TEST_EQ(in[i], double(i));
+
+    in = buffer_type();
+    HPX_TEST(chunk_data.expired());
+}
+
+int main()
+{
+    std::size_t const large =
+        2 * HPX_ZERO_COPY_SERIALIZATION_THRESHOLD / sizeof(double);
+    std::size_t const small =
+        HPX_ZERO_COPY_SERIALIZATION_THRESHOLD / (2 * sizeof(double));
+
+    test(large, true, true);
+    test(large, false, false);
+
+    // small arrays are not sent as separate chunks
+    test(small, true, false);
+    test(small, false, false);
+
+    return hpx::util::report_errors();
+}
@@ -213,6 +213,19 @@ namespace hpx { namespace threads { namespace detail {
         {
             return sched_->Scheduler::get_num_stolen_to_staged(num, reset);
         }
+
+        std::int64_t get_num_stolen_cross_domain(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_stolen_cross_domain(num, reset);
+        }
+
+        std::int64_t get_num_remote_memory_executions(
+            std::size_t num, bool reset) override
+        {
+            return sched_->Scheduler::get_num_remote_memory_executions(
+                num, reset);
+        }
 #endif
         std::int64_t get_queue_length(
             std::size_t num_thread, bool reset) override
@@ -220,6 +233,27 @@ namespace hpx { namespace threads { namespace detail {
             return sched_->Scheduler::get_queue_length(num_thread);
         }
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        std::int64_t get_idle_park_time(
+            std::size_t num_thread, bool reset) override
+        {
+            return sched_->Scheduler::get_idle_park_time(num_thread, reset);
+        }
+
+        std::int64_t get_idle_park_rate(
+            std::size_t num_thread, bool reset) override
+        {
+            return sched_->Scheduler::get_idle_park_rate(num_thread, reset);
+        }
+
+        std::int64_t get_average_wake_latency(
+            std::size_t num_thread, bool reset) override
+        {
+            return sched_->Scheduler::get_average_wake_latency(
+                num_thread, reset);
+        }
+#endif
+
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
         std::int64_t get_average_thread_wait_time(
             std::size_t num_thread, bool reset) override
@@ -491,7 +491,7 @@ namespace hpx { namespace threads { namespace detail {
                 detail::scheduling_callbacks callbacks(
                     util::deferred_call(    //-V107
                         &policies::scheduler_base::idle_callback, sched_.get(),
-                        thread_num),
+                        thread_num, &counter_data.busy_loop_counts_),
                     nullptr, nullptr, max_background_threads_,
                     max_idle_loop_count_, max_busy_loop_count_);
 
@@ -1966,6 +1966,9 @@ namespace hpx { namespace threads { namespace detail {
             oldstate == state_stopping || oldstate == state_stopped ||
             oldstate == state_terminating);
 
+        // make sure the worker thread is not parked
+        sched_->Scheduler::unpark(virt_core);
+
         std::thread t;
         std::swap(threads_[virt_core], t);
 
@@ -2015,6 +2018,9 @@ namespace hpx { namespace threads { namespace detail {
         hpx::state expected = state_running;
         state.compare_exchange_strong(expected, state_pre_sleep);
 
+        // make sure the worker thread is not parked
+        sched_->Scheduler::unpark(virt_core);
+
         l.unlock();
 
         HPX_ASSERT(expected == state_running || expected == state_pre_sleep ||
@@ -14,6 +14,12 @@
 template class HPX_CORE_EXPORT hpx::threads::policies::local_queue_scheduler<>;
 template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
     hpx::threads::policies::local_queue_scheduler<>>;
+template class HPX_CORE_EXPORT
+    hpx::threads::policies::local_queue_scheduler<std::mutex,
+        hpx::threads::policies::chase_lev_lifo>;
+template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
+    hpx::threads::policies::local_queue_scheduler<std::mutex,
+        hpx::threads::policies::chase_lev_lifo>>;
 #endif
 
 #if defined(HPX_HAVE_STATIC_SCHEDULER)
@@ -38,6 +44,12 @@ template class HPX_CORE_EXPORT
 template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
     hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
         hpx::threads::policies::lockfree_fifo>>;
+template class HPX_CORE_EXPORT
+    hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+        hpx::threads::policies::chase_lev_lifo>;
+template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
+    hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
+        hpx::threads::policies::chase_lev_lifo>>;
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
 template class HPX_CORE_EXPORT
     hpx::threads::policies::local_priority_queue_scheduler<std::mutex,
@@ -0,0 +1,33 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+
+#include <cstddef>
+
+namespace hpx { namespace threads {
+
+    /// Return whether the system has more than one NUMA domain. The result
+    /// is determined once and cached afterwards.
+    HPX_CORE_EXPORT bool has_multiple_numa_domains();
+
+    /// Return the NUMA domain the given memory range is (mostly) located
+    /// on, or -1 if it can't be determined. The lookup is based on the first,
+    /// the middle, and the last memory page of the range, the NUMA domains of
+    /// the pages are cached by the topology object.
+    HPX_CORE_EXPORT int get_numa_domain(void const* addr, std::size_t size);
+
+    /// Return a schedule hint which places a task touching the given memory
+    /// range on the NUMA domain the memory is located on. If the domain can't
+    /// be determined or the system has a single NUMA domain only, the given
+    /// fallback hint is returned.
+    HPX_CORE_EXPORT thread_schedule_hint get_numa_schedule_hint(
+        void const* addr, std::size_t size,
+        thread_schedule_hint fallback = thread_schedule_hint());
+}}    // namespace hpx::threads
@@ -81,13 +81,28 @@ namespace hpx { namespace threads { namespace policies {
             return description_;
         }
 
-        void idle_callback(std::size_t num_thread);
+        /// This function gets called by the scheduling loop of the given
+        /// worker thread whenever it has been idle for a while. The optional
+        /// busy_loop_count allows to detect whether the worker thread has
+        /// executed any work since the previous invocation.
+        void idle_callback(std::size_t num_thread,
+            std::int64_t const* busy_loop_count = nullptr);
 
         /// This function gets called by the thread-manager whenever new work
         /// has been added, allowing the scheduler to reactivate one or more of
         /// possibly idling OS threads
         void do_some_work(std::size_t);
 
+        /// Wake up the given worker thread if it is parked, wake up all parked
+        /// worker threads if num_thread is std::size_t(-1)
+        void unpark(std::size_t num_thread);
+
+        // statistics for parked worker threads (enable_idle_parking)
+        std::int64_t get_idle_park_time(std::size_t num_thread, bool reset);
+        std::int64_t get_idle_park_rate(std::size_t num_thread, bool reset);
+        std::int64_t get_average_wake_latency(
+            std::size_t num_thread, bool reset);
+
         virtual void suspend(std::size_t num_thread);
         virtual void resume(std::size_t num_thread);
 
@@ -176,6 +191,18 @@ namespace hpx { namespace threads { namespace policies {
             std::size_t num_thread, bool reset) = 0;
         virtual std::int64_t get_num_stolen_to_staged(
             std::size_t num_thread, bool reset) = 0;
+
+        // only NUMA aware schedulers keep track of these
+        virtual std::int64_t get_num_stolen_cross_domain(
+            std::size_t /*num_thread*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_remote_memory_executions(
+            std::size_t /*num_thread*/, bool /*reset*/)
+        {
+            return 0;
+        }
 #endif
 
         virtual std::int64_t get_queue_length(
@@ -326,6 +353,34 @@ namespace hpx { namespace threads { namespace policies {
             double max_idle_backoff_time_;
         };
         std::vector<util::cache_line_data<idle_backoff_data>> wait_counts_;
+
+        // support for parking idle worker threads
+        struct idle_park_data
+        {
+            // futex word, non-zero while the worker thread is parked
+            std::atomic<std::uint32_t> parked_{0};
+            // value of the busy loop count seen by the last idle callback
+            std::int64_t busy_loop_count_ = 0;
+            // start of the current idle period, zero if none
+            std::int64_t idle_since_ = 0;
+            // time at which the last wake up was requested
+            std::atomic<std::int64_t> wake_requested_{0};
+
+            // accumulated statistics since the last reset
+            std::int64_t reset_time_ = 0;
+            std::int64_t park_time_ = 0;
+            std::int64_t wake_latency_ = 0;
+            std::int64_t wake_count_ = 0;
+        };
+        std::unique_ptr<util::cache_line_data<idle_park_data>[]> park_data_;
+        util::cache_line_data<std::atomic<std::size_t>> num_parked_;
+        std::int64_t idle_park_spin_time_;
+        std::int64_t max_idle_park_time_;
+
+        void idle_park(std::size_t num_thread, std::int64_t const* busy);
+        bool unpark_thread(std::size_t num_thread);
+        void park_wait(std::atomic<std::uint32_t>& parked, std::int64_t time);
+        void park_notify(std::atomic<std::uint32_t>& parked);
 #endif
 
         // support for suspension of pus
@@ -58,6 +58,15 @@ namespace hpx { namespace threads { namespace policies {
         /// This option allows for certain schedulers to explicitly disable
         /// exponential idle-back off
         enable_idle_backoff = 0x0800,
+        /// This option tells schedulers that support it to steal from all
+        /// queues on their own NUMA domain before stealing from queues on
+        /// other NUMA domains
+        steal_in_domain_first = 0x1000,
+        /// This option tells the scheduler to park idle worker threads on a
+        /// futex instead of spinning or sleeping (takes precedence over
+        /// enable_idle_backoff). Parked worker threads are woken up one at a
+        /// time as soon as new work is being scheduled.
+        enable_idle_parking = 0x2000,
 
         // clang-format off
         /// This option represents the default mode.
@@ -69,7 +78,8 @@ namespace hpx { namespace threads { namespace policies {
             enable_stealing_numa |
             assign_work_round_robin |
             steal_after_local |
-            enable_idle_backoff,
+            enable_idle_backoff |
+            steal_in_domain_first,
         /// This enables all available options.
         all_flags =
             do_background_work |
@@ -83,7 +93,9 @@ namespace hpx { namespace threads { namespace policies {
             assign_work_thread_parent |
             steal_high_priority_first |
             steal_after_local |
-            enable_idle_backoff
+            enable_idle_backoff |
+            steal_in_domain_first |
+            enable_idle_parking
         // clang-format on
     };
 }}}    // namespace hpx::threads::policies
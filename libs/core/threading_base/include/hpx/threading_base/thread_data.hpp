@@ -462,6 +462,12 @@ namespace hpx { namespace threads {
             priority_ = priority;
         }
 
+        // the schedule hint this thread was created with
+        thread_schedule_hint get_schedule_hint() const noexcept
+        {
+            return schedulehint_;
+        }
+
         // handle thread interruption
         bool interruption_requested() const noexcept
         {
@@ -629,6 +635,7 @@ namespace hpx { namespace threads {
 #endif
         ///////////////////////////////////////////////////////////////////////
         thread_priority priority_;
+        thread_schedule_hint schedulehint_;
 
         bool requested_interrupt_;
         bool enabled_interrupt_;
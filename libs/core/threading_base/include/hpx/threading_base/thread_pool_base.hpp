@@ -384,6 +384,24 @@ namespace hpx { namespace threads {
             return 0;
         }
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        virtual std::int64_t get_idle_park_time(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_idle_park_rate(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_average_wake_latency(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+#endif
+
 #if defined(HPX_HAVE_THREAD_QUEUE_WAITTIME)
         virtual std::int64_t get_average_thread_wait_time(
             std::size_t /*thread_num*/, bool /*reset*/)
@@ -429,6 +447,16 @@ namespace hpx { namespace threads {
         {
             return 0;
         }
+        virtual std::int64_t get_num_stolen_cross_domain(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+        virtual std::int64_t get_num_remote_memory_executions(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
 #endif
 
         virtual std::int64_t get_thread_count(thread_state_enum /*state*/,
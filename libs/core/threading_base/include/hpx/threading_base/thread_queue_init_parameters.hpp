@@ -34,6 +34,7 @@ namespace hpx { namespace threads { namespace policies {
             std::int64_t max_terminated_threads = std::int64_t(
                 HPX_THREAD_QUEUE_MAX_TERMINATED_THREADS),
             double max_idle_backoff_time = double(HPX_IDLE_BACKOFF_TIME_MAX),
+            double idle_park_spin_time = double(HPX_IDLE_PARK_SPIN_TIME),
             std::ptrdiff_t small_stacksize = HPX_SMALL_STACK_SIZE,
             std::ptrdiff_t medium_stacksize = HPX_MEDIUM_STACK_SIZE,
             std::ptrdiff_t large_stacksize = HPX_LARGE_STACK_SIZE,
@@ -47,6 +48,7 @@ namespace hpx { namespace threads { namespace policies {
           , max_delete_count_(max_delete_count)
           , max_terminated_threads_(max_terminated_threads)
           , max_idle_backoff_time_(max_idle_backoff_time)
+          , idle_park_spin_time_(idle_park_spin_time)
           , small_stacksize_(small_stacksize)
           , medium_stacksize_(medium_stacksize)
           , large_stacksize_(large_stacksize)
@@ -64,6 +66,7 @@ namespace hpx { namespace threads { namespace policies {
         std::int64_t max_delete_count_;
         std::int64_t max_terminated_threads_;
         double max_idle_backoff_time_;
+        double idle_park_spin_time_;
         std::ptrdiff_t const small_stacksize_;
         std::ptrdiff_t const medium_stacksize_;
         std::ptrdiff_t const large_stacksize_;
@@ -0,0 +1,68 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/threading_base/numa_schedule_hint.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx { namespace threads {
+
+    bool has_multiple_numa_domains()
+    {
+        static bool const multiple_domains =
+            create_topology().get_number_of_numa_nodes() > 1;
+        return multiple_domains;
+    }
+
+    int get_numa_domain(void const* addr, std::size_t size)
+    {
+        topology const& topo = create_topology();
+
+        char const* const begin = static_cast<char const*>(addr);
+        int const first = topo.get_numa_domain_cached(begin);
+        if (size <= get_memory_page_size())
+        {
+            return first;
+        }
+
+        // the range spans several pages, prefer a domain at least two of the
+        // sampled pages agree on
+        int const middle = topo.get_numa_domain_cached(begin + size / 2);
+        int const last = topo.get_numa_domain_cached(begin + size - 1);
+
+        if (middle != -1 && middle == last)
+        {
+            return middle;
+        }
+        if (first != -1)
+        {
+            return first;
+        }
+        return middle != -1 ? middle : last;
+    }
+
+    thread_schedule_hint get_numa_schedule_hint(
+        void const* addr, std::size_t size, thread_schedule_hint fallback)
+    {
+        // there is no point in placing tasks on systems with one domain
+        if (addr == nullptr || size == 0 || !has_multiple_numa_domains())
+        {
+            return fallback;
+        }
+
+        int const domain = get_numa_domain(addr, size);
+        if (domain < 0)
+        {
+            return fallback;
+        }
+        return thread_schedule_hint(thread_schedule_hint_mode_numa,
+            static_cast<std::int16_t>(domain));
+    }
+}}    // namespace hpx::threads
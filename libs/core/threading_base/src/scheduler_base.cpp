@@ -32,8 +32,28 @@
 #include <utility>
 #include <vector>
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF) && defined(__linux__)
+#include <ctime>
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace threads { namespace policies {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    namespace detail {
+        // nanoseconds since an arbitrary (but fixed) point in time
+        inline std::int64_t park_timestamp()
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                .count();
+        }
+    }    // namespace detail
+#endif
+
     scheduler_base::scheduler_base(std::size_t num_threads,
         char const* description, thread_queue_init_parameters thread_queue_init,
         scheduler_mode mode)
@@ -48,8 +68,6 @@ namespace hpx { namespace threads { namespace policies {
       , polling_function_mpi_(&null_polling_function)
       , polling_function_cuda_(&null_polling_function)
     {
-        set_scheduler_mode(mode);
-
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
         double max_time = thread_queue_init.max_idle_backoff_time_;
 
@@ -59,17 +77,39 @@ namespace hpx { namespace threads { namespace policies {
             data.data_.wait_count_ = 0;
             data.data_.max_idle_backoff_time_ = max_time;
         }
+
+        park_data_.reset(
+            new util::cache_line_data<idle_park_data>[num_threads]);
+        std::int64_t const now = detail::park_timestamp();
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            park_data_[i].data_.reset_time_ = now;
+        }
+        num_parked_.data_.store(0, std::memory_order_relaxed);
+
+        // the spin time is given in microseconds, the maximal time a worker
+        // thread stays parked in milliseconds
+        idle_park_spin_time_ =
+            std::llround(thread_queue_init.idle_park_spin_time_ * 1e3);
+        max_idle_park_time_ = std::llround(max_time * 1e6);
 #endif
 
+        set_scheduler_mode(mode);
+
         for (std::size_t i = 0; i != num_threads; ++i)
             states_[i].store(state_initialized);
     }
 
-    void scheduler_base::idle_callback(std::size_t num_thread)
+    void scheduler_base::idle_callback(
+        std::size_t num_thread, std::int64_t const* busy_loop_count)
     {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-        if (mode_.data_.load(std::memory_order_relaxed) &
-            policies::enable_idle_backoff)
+        scheduler_mode const mode = mode_.data_.load(std::memory_order_relaxed);
+        if (mode & policies::enable_idle_parking)
+        {
+            idle_park(num_thread, busy_loop_count);
+        }
+        else if (mode & policies::enable_idle_backoff)
         {
             // Put this thread to sleep for some time, additionally it gets
             // woken up on new work.
@@ -94,16 +134,340 @@ namespace hpx { namespace threads { namespace policies {
         }
 #else
         (void) num_thread;
+        (void) busy_loop_count;
 #endif
     }
 
     /// This function gets called by the thread-manager whenever new work
     /// has been added, allowing the scheduler to reactivate one or more of
     /// possibly idling OS threads
-    void scheduler_base::do_some_work(std::size_t)
+    void scheduler_base::do_some_work(std::size_t num_thread)
     {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        if (mode_.data_.load(std::memory_order_relaxed) &
+            policies::enable_idle_parking)
+        {
+            // Pairs with the fence in idle_park: either the parking worker
+            // thread sees the new work or we see the parked worker thread.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (num_parked_.data_.load(std::memory_order_acquire) == 0)
+            {
+                return;
+            }
+
+            // Wake up exactly one parked worker thread, prefer the one the
+            // work was scheduled for. Without stealing only the worker thread
+            // owning the queue can run the new work.
+            std::size_t const num_threads = states_.size();
+            if (num_thread < num_threads)
+            {
+                if (unpark_thread(num_thread) ||
+                    !has_scheduler_mode(policies::enable_stealing))
+                {
+                    return;
+                }
+            }
+            else if (!has_scheduler_mode(policies::enable_stealing))
+            {
+                unpark(std::size_t(-1));
+                return;
+            }
+
+            std::size_t const first =
+                num_thread < num_threads ? num_thread + 1 : 0;
+            for (std::size_t i = 0; i != num_threads; ++i)
+            {
+                if (unpark_thread((first + i) % num_threads))
+                {
+                    break;
+                }
+            }
+            return;
+        }
+
         cond_.notify_all();
+#else
+        (void) num_thread;
+#endif
+    }
+
+    void scheduler_base::unpark(std::size_t num_thread)
+    {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        if (num_thread != std::size_t(-1))
+        {
+            HPX_ASSERT(num_thread < states_.size());
+            unpark_thread(num_thread);
+            return;
+        }
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (num_parked_.data_.load(std::memory_order_acquire) != 0)
+        {
+            for (std::size_t i = 0; i != states_.size(); ++i)
+            {
+                unpark_thread(i);
+            }
+        }
+#else
+        (void) num_thread;
+#endif
+    }
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    void scheduler_base::idle_park(
+        std::size_t num_thread, std::int64_t const* busy_loop_count)
+    {
+        idle_park_data& data = park_data_[num_thread].data_;
+        std::int64_t now = detail::park_timestamp();
+
+        // a changed busy loop count means that the worker thread has executed
+        // work since the last idle callback, start a new idle period
+        if (data.idle_since_ == 0 ||
+            (busy_loop_count != nullptr &&
+                *busy_loop_count != data.busy_loop_count_))
+        {
+            data.idle_since_ = now;
+            if (busy_loop_count != nullptr)
+            {
+                data.busy_loop_count_ = *busy_loop_count;
+            }
+        }
+
+        // keep spinning for a while before parking, this avoids the wake up
+        // latency for short idle periods
+        if (now - data.idle_since_ < idle_park_spin_time_ ||
+            states_[num_thread].load(std::memory_order_relaxed) !=
+                state_running)
+        {
+            return;
+        }
+
+        // announce this worker thread as parked and re-check for work that
+        // might have been scheduled before a producer could see it parked
+        data.parked_.store(1, std::memory_order_relaxed);
+        num_parked_.data_.fetch_add(1, std::memory_order_release);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        bool woken_up = false;
+        if (get_queue_length(std::size_t(-1)) != 0 ||
+            states_[num_thread].load(std::memory_order_relaxed) !=
+                state_running)
+        {
+            std::uint32_t expected = 1;
+            if (data.parked_.compare_exchange_strong(
+                    expected, 0, std::memory_order_acq_rel))
+            {
+                num_parked_.data_.fetch_sub(1, std::memory_order_relaxed);
+                data.idle_since_ = 0;
+                return;
+            }
+
+            // a producer has already claimed this worker thread
+            woken_up = true;
+        }
+
+        // Wait for a producer to wake us up. Parked worker threads wake up
+        // on their own after max_idle_backoff_time to give background work
+        // (e.g. networking) a chance to make progress.
+        std::int64_t const deadline = now + max_idle_park_time_;
+        while (!woken_up)
+        {
+            if (data.parked_.load(std::memory_order_acquire) == 0)
+            {
+                woken_up = true;
+                break;
+            }
+
+            std::int64_t const remaining = deadline - detail::park_timestamp();
+            if (remaining <= 0)
+            {
+                std::uint32_t expected = 1;
+                if (data.parked_.compare_exchange_strong(
+                        expected, 0, std::memory_order_acq_rel))
+                {
+                    num_parked_.data_.fetch_sub(1, std::memory_order_relaxed);
+                    break;
+                }
+                woken_up = true;
+                break;
+            }
+
+            park_wait(data.parked_, remaining);
+        }
+
+        std::int64_t const woken = detail::park_timestamp();
+        data.park_time_ += woken - now;
+
+        if (woken_up)
+        {
+            // spin again before parking the next time
+            data.wake_latency_ += (std::max)(std::int64_t(0),
+                woken - data.wake_requested_.load(std::memory_order_relaxed));
+            ++data.wake_count_;
+            data.idle_since_ = 0;
+        }
+    }
+
+    bool scheduler_base::unpark_thread(std::size_t num_thread)
+    {
+        idle_park_data& data = park_data_[num_thread].data_;
+        if (data.parked_.load(std::memory_order_relaxed) == 0)
+        {
+            return false;
+        }
+
+        // the store is published by the successful exchange below
+        data.wake_requested_.store(
+            detail::park_timestamp(), std::memory_order_relaxed);
+
+        std::uint32_t expected = 1;
+        if (!data.parked_.compare_exchange_strong(
+                expected, 0, std::memory_order_acq_rel))
+        {
+            return false;
+        }
+
+        num_parked_.data_.fetch_sub(1, std::memory_order_relaxed);
+        park_notify(data.parked_);
+        return true;
+    }
+
+#if defined(__linux__)
+    void scheduler_base::park_wait(
+        std::atomic<std::uint32_t>& parked, std::int64_t time)
+    {
+        timespec timeout;
+        timeout.tv_sec = static_cast<std::time_t>(time / 1000000000);
+        timeout.tv_nsec = static_cast<long>(time % 1000000000);
+
+        // returns immediately if the worker thread is not parked anymore
+        syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&parked),
+            FUTEX_WAIT_PRIVATE, 1, &timeout, nullptr, 0);
+    }
+
+    void scheduler_base::park_notify(std::atomic<std::uint32_t>& parked)
+    {
+        syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&parked),
+            FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+    }
+#else
+    // All parked worker threads share the same condition variable on
+    // platforms without futexes, only the one which was unparked continues.
+    void scheduler_base::park_wait(
+        std::atomic<std::uint32_t>& parked, std::int64_t time)
+    {
+        std::unique_lock<pu_mutex_type> l(mtx_);
+        cond_.wait_for(l, std::chrono::nanoseconds(time), [&parked]() {
+            return parked.load(std::memory_order_acquire) == 0;
+        });
+    }
+
+    void scheduler_base::park_notify(std::atomic<std::uint32_t>&)
+    {
+        // synchronize with worker threads which are about to wait
+        {
+            std::lock_guard<pu_mutex_type> l(mtx_);
+        }
+        cond_.notify_all();
+    }
+#endif
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t scheduler_base::get_idle_park_time(
+        std::size_t num_thread, bool reset)
+    {
+        std::int64_t result = 0;
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        std::size_t const num_threads = states_.size();
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            if (num_thread != std::size_t(-1) && num_thread != i)
+                continue;
+
+            idle_park_data& data = park_data_[i].data_;
+            result += data.park_time_;
+            if (reset)
+                data.park_time_ = 0;
+        }
+#else
+        (void) num_thread;
+        (void) reset;
+#endif
+        return result;
+    }
+
+    // percentage of the wall clock time the worker threads were parked (in
+    // 0.01%), this is the part of the idle time not consuming any CPU
+    std::int64_t scheduler_base::get_idle_park_rate(
+        std::size_t num_thread, bool reset)
+    {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        std::int64_t park_time = 0;
+        std::int64_t total_time = 0;
+
+        std::int64_t const now = detail::park_timestamp();
+        std::size_t const num_threads = states_.size();
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            if (num_thread != std::size_t(-1) && num_thread != i)
+                continue;
+
+            idle_park_data& data = park_data_[i].data_;
+            park_time += data.park_time_;
+            total_time += now - data.reset_time_;
+            if (reset)
+            {
+                data.park_time_ = 0;
+                data.reset_time_ = now;
+            }
+        }
+
+        if (total_time == 0)
+            return 0;
+
+        return std::int64_t(10000. * double(park_time) / double(total_time));
+#else
+        (void) num_thread;
+        (void) reset;
+        return 0;
+#endif
+    }
+
+    // average time (in nanoseconds) between a wake up request and the parked
+    // worker thread continuing execution
+    std::int64_t scheduler_base::get_average_wake_latency(
+        std::size_t num_thread, bool reset)
+    {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        std::int64_t wake_latency = 0;
+        std::int64_t wake_count = 0;
+
+        std::size_t const num_threads = states_.size();
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            if (num_thread != std::size_t(-1) && num_thread != i)
+                continue;
+
+            idle_park_data& data = park_data_[i].data_;
+            wake_latency += data.wake_latency_;
+            wake_count += data.wake_count_;
+            if (reset)
+            {
+                data.wake_latency_ = 0;
+                data.wake_count_ = 0;
+            }
+        }
+
+        if (wake_count == 0)
+            return 0;
+
+        return wake_latency / wake_count;
+#else
+        (void) num_thread;
+        (void) reset;
+        return 0;
 #endif
     }
 
@@ -253,6 +617,7 @@ namespace hpx { namespace threads { namespace policies {
         {
             state.store(s);
         }
+        unpark(std::size_t(-1));
     }
 
     void scheduler_base::set_all_states_at_least(hpx::state s)
@@ -265,6 +630,7 @@ namespace hpx { namespace threads { namespace policies {
                 state.store(s);
             }
         }
+        unpark(std::size_t(-1));
     }
 
     // return whether all states are at least at the given one
@@ -312,6 +678,7 @@ namespace hpx { namespace threads { namespace policies {
         // distribute the same value across all cores
         mode_.data_.store(mode, std::memory_order_release);
         do_some_work(std::size_t(-1));
+        unpark(std::size_t(-1));
     }
 
     void scheduler_base::add_scheduler_mode(scheduler_mode mode)
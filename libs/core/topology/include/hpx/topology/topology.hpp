@@ -16,7 +16,9 @@
 #include <hpx/topology/cpu_mask.hpp>
 #include <hpx/type_support/static.hpp>
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <iosfwd>
 #include <memory>
 #include <string>
@@ -292,6 +294,17 @@ namespace hpx { namespace threads {
 
         int get_numa_domain(const void* addr) const;
 
+        /// Return the NUMA domain the memory page containing the given
+        /// address is located on. The results are cached per memory page, so
+        /// that repeated lookups for the same data are inexpensive. Returns -1
+        /// if the domain can't be determined, e.g. if the page has not been
+        /// touched yet.
+        int get_numa_domain_cached(const void* addr) const;
+
+        /// Forget all cached NUMA domains of memory pages, this should be
+        /// called after memory was migrated to a different NUMA domain
+        void reset_numa_domain_cache() const;
+
         /// Free memory that was previously allocated by allocate
         void deallocate(void* addr, std::size_t len) const;
 
@@ -377,6 +390,14 @@ namespace hpx { namespace threads {
 #endif
 
         std::size_t num_of_pus_;
+        std::size_t num_of_numa_nodes_;
+
+        // Direct mapped cache of NUMA domains of memory pages, each entry
+        // holds the page number in the upper and the domain in the lower
+        // bits, zero marks an empty entry.
+        static constexpr std::size_t numa_domain_cache_size = 4096;
+        static constexpr std::size_t numa_domain_bits = 8;
+        std::unique_ptr<std::atomic<std::uint64_t>[]> numa_domain_cache_;
 
         using mutex_type = hpx::util::spinlock;
         mutable mutex_type topo_mtx;
@@ -14,7 +14,9 @@
 #include <hpx/topology/topology.hpp>
 #include <hpx/util/ios_flags_saver.hpp>
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <iomanip>
 #include <iostream>
 #include <memory>
@@ -204,6 +206,9 @@ namespace hpx { namespace threads {
 
     topology::topology()
       : topo(nullptr)
+      , num_of_numa_nodes_(0)
+      , numa_domain_cache_(
+            new std::atomic<std::uint64_t>[numa_domain_cache_size])
       , machine_affinity_mask_(0)
     {    // {{{
         int err = hwloc_topology_init(&topo);
@@ -251,6 +256,8 @@ namespace hpx { namespace threads {
             HPX_ASSERT(numa_node < num_of_nodes);
             numa_node_numbers_.push_back(numa_node);
         }
+        num_of_numa_nodes_ = num_of_nodes;
+        reset_numa_domain_cache();
 
         std::size_t num_of_cores = get_number_of_cores();
         if (num_of_cores == 0)
@@ -1379,6 +1386,72 @@ namespace hpx { namespace threads {
 #endif
     }
 
+    int topology::get_numa_domain_cached(const void* addr) const
+    {
+        if (num_of_numa_nodes_ <= 1)
+        {
+            return 0;
+        }
+
+        std::uint64_t const page = reinterpret_cast<std::uintptr_t>(addr) /
+            get_memory_page_size();
+        std::atomic<std::uint64_t>& entry = numa_domain_cache_[(
+            page ^ (page >> 12)) % numa_domain_cache_size];
+
+        std::uint64_t const cached = entry.load(std::memory_order_relaxed);
+        if (cached != 0 && (cached >> numa_domain_bits) == page)
+        {
+            return static_cast<int>(
+                cached & ((std::uint64_t(1) << numa_domain_bits) - 1));
+        }
+
+#if HWLOC_API_VERSION >= 0x00010b06
+        hpx_hwloc_bitmap_wrapper& nodeset = bitmap_storage();
+        if (!nodeset)
+        {
+            nodeset.reset(hwloc_bitmap_alloc());
+        }
+        hwloc_nodeset_t ns =
+            reinterpret_cast<hwloc_nodeset_t>(nodeset.get_bmp());
+
+        // don't throw if the memory location can't be determined, the result
+        // is used as a hint only
+        if (hwloc_get_area_memlocation(
+                topo, addr, 1, ns, HWLOC_MEMBIND_BYNODESET) < 0)
+        {
+            return -1;
+        }
+
+        std::size_t const domain = threads::find_first(
+            bitmap_to_mask(ns, HWLOC_OBJ_NUMANODE));
+
+        // pages which were not touched yet are not located on any domain,
+        // don't cache those as they are placed on first touch
+        if (domain >= num_of_numa_nodes_)
+        {
+            return -1;
+        }
+
+        if (domain < (std::size_t(1) << numa_domain_bits))
+        {
+            entry.store((page << numa_domain_bits) | domain,
+                std::memory_order_relaxed);
+        }
+        return static_cast<int>(domain);
+#else
+        HPX_UNUSED(entry);
+        return -1;
+#endif
+    }
+
+    void topology::reset_numa_domain_cache() const
+    {
+        for (std::size_t i = 0; i != numa_domain_cache_size; ++i)
+        {
+            numa_domain_cache_[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
     /// Free memory that was previously allocated by allocate
     void topology::deallocate(void* addr, std::size_t len) const
     {
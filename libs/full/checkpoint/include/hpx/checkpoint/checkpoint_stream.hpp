@@ -0,0 +1,527 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// This header defines the save_checkpoint_stream and
+/// restore_checkpoint_stream functions. Other than save_checkpoint, these
+/// functions do not materialize the whole byte stream in memory. The objects
+/// are serialized in bounded-size chunks which are written to (or read from)
+/// the given stream directly. The produced data has the same format as a
+/// checkpoint written using operator<<.
+
+/// \file hpx/checkpoint/checkpoint_stream.hpp
+
+#pragma once
+
+#include <hpx/assert.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/checkpoint/checkpoint.hpp>
+#include <hpx/checkpoint_base/checkpoint_data.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/runtime_local/run_as_os_thread.hpp>
+#include <hpx/serialization/traits/serialization_access_data.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Parameters controlling the streaming checkpoint functions.
+    struct checkpoint_stream_params
+    {
+        /// \param chunk_size    The maximal number of bytes buffered before
+        ///                      they are written to (or after they were read
+        ///                      from) the underlying stream.
+        /// \param write_behind  Write the buffered chunks on the io thread
+        ///                      pool while the next chunk is being
+        ///                      serialized.
+        explicit checkpoint_stream_params(
+            std::size_t chunk_size = 4 * 1024 * 1024, bool write_behind = false)
+          : chunk_size_(chunk_size != 0 ? chunk_size : 1)
+          , write_behind_(write_behind)
+        {
+        }
+
+        std::size_t chunk_size_;
+        bool write_behind_;
+    };
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // Serialization container which writes the data to a stream in
+        // chunks of (at most) the given size. The serialization archive
+        // writes the data strictly sequentially.
+        class checkpoint_stream_writer
+        {
+        public:
+            checkpoint_stream_writer(
+                std::ostream& ost, checkpoint_stream_params const& params)
+              : ost_(ost)
+              , chunk_size_(params.chunk_size_)
+              , write_behind_(params.write_behind_ &&
+                    hpx::threads::get_self_ptr() != nullptr)
+              , size_(0)
+            {
+                buffer_.reserve(chunk_size_);
+            }
+
+            checkpoint_stream_writer(checkpoint_stream_writer const&) = delete;
+            checkpoint_stream_writer& operator=(
+                checkpoint_stream_writer const&) = delete;
+
+            ~checkpoint_stream_writer()
+            {
+                // the pending write refers to this object
+                if (pending_.valid())
+                    pending_.wait();
+            }
+
+            std::size_t size() const noexcept
+            {
+                return size_;
+            }
+
+            void resize(std::size_t count) noexcept
+            {
+                size_ += count;
+            }
+
+            void write(std::size_t count, std::size_t current,
+                void const* address)
+            {
+                HPX_ASSERT(current + count == size_);
+                (void) current;
+
+                if (buffer_.size() + count > chunk_size_)
+                    flush_buffer();
+
+                if (count >= chunk_size_)
+                {
+                    // large blocks bypass the buffer, the data is owned by
+                    // the caller, so it has to be written synchronously
+                    wait_pending();
+                    write_data(static_cast<char const*>(address), count);
+                    return;
+                }
+
+                char const* data = static_cast<char const*>(address);
+                buffer_.insert(buffer_.end(), data, data + count);
+            }
+
+            // write out all remaining data
+            void flush()
+            {
+                flush_buffer();
+                wait_pending();
+                ost_.flush();
+            }
+
+        private:
+            void write_data(char const* data, std::size_t count)
+            {
+                ost_.write(data, static_cast<std::streamsize>(count));
+                if (!ost_)
+                {
+                    HPX_THROW_EXCEPTION(hpx::filesystem_error,
+                        "checkpoint_stream_writer::write_data",
+                        "failed writing checkpoint data to stream");
+                }
+            }
+
+            void wait_pending()
+            {
+                if (pending_.valid())
+                    pending_.get();    // rethrows errors
+            }
+
+            void flush_buffer()
+            {
+                if (buffer_.empty())
+                    return;
+
+                wait_pending();
+
+                if (!write_behind_)
+                {
+                    write_data(buffer_.data(), buffer_.size());
+                    buffer_.clear();
+                    return;
+                }
+
+                // continue serializing into the spare buffer while the
+                // current one is written on the io thread pool
+                std::swap(buffer_, spare_);
+                buffer_.clear();
+                buffer_.reserve(chunk_size_);
+
+                pending_ = hpx::threads::run_as_os_thread([this]() {
+                    write_data(spare_.data(), spare_.size());
+                });
+            }
+
+        private:
+            std::ostream& ost_;
+            std::size_t chunk_size_;
+            bool write_behind_;
+            std::size_t size_;
+            std::vector<char> buffer_;
+            std::vector<char> spare_;
+            hpx::future<void> pending_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Serialization container which reads the given number of bytes from
+        // a stream in chunks of (at most) the given size. The serialization
+        // archive reads the data strictly sequentially.
+        class checkpoint_stream_reader
+        {
+        public:
+            checkpoint_stream_reader(std::istream& ist, std::size_t size,
+                checkpoint_stream_params const& params)
+              : ist_(ist)
+              , size_(size)
+              , chunk_size_(params.chunk_size_)
+              , consumed_(0)
+              , pos_(0)
+            {
+            }
+
+            std::size_t size() const noexcept
+            {
+                return size_;
+            }
+
+            void read(std::size_t count, std::size_t current,
+                void* address) const
+            {
+                HPX_ASSERT(current + buffer_.size() == consumed_ + pos_);
+                (void) current;
+
+                char* dest = static_cast<char*>(address);
+
+                std::size_t avail = buffer_.size() - pos_;
+                if (count <= avail)
+                {
+                    std::memcpy(dest, buffer_.data() + pos_, count);
+                    pos_ += count;
+                    return;
+                }
+
+                std::memcpy(dest, buffer_.data() + pos_, avail);
+                dest += avail;
+                count -= avail;
+
+                buffer_.clear();
+                pos_ = 0;
+
+                if (count >= chunk_size_)
+                {
+                    // large blocks bypass the buffer
+                    read_data(dest, count);
+                    return;
+                }
+
+                buffer_.resize((std::min)(chunk_size_, size_ - consumed_));
+                read_data(buffer_.data(), buffer_.size());
+
+                std::memcpy(dest, buffer_.data(), count);
+                pos_ = count;
+            }
+
+            // skip all data which was not consumed, this positions the
+            // stream at the end of the checkpoint data
+            void finish()
+            {
+                if (consumed_ != size_)
+                {
+                    ist_.ignore(static_cast<std::streamsize>(size_ - consumed_));
+                    consumed_ = size_;
+                }
+                buffer_.clear();
+                pos_ = 0;
+            }
+
+        private:
+            void read_data(char* data, std::size_t count) const
+            {
+                if (consumed_ + count > size_ ||
+                    !ist_.read(data, static_cast<std::streamsize>(count)))
+                {
+                    HPX_THROW_EXCEPTION(hpx::filesystem_error,
+                        "checkpoint_stream_reader::read_data",
+                        "failed reading checkpoint data from stream");
+                }
+                consumed_ += count;
+            }
+
+        private:
+            std::istream& ist_;
+            std::size_t size_;
+            std::size_t chunk_size_;
+
+            // number of bytes read from the stream so far
+            mutable std::size_t consumed_;
+
+            // the buffered bytes and the read position inside of those
+            mutable std::vector<char> buffer_;
+            mutable std::size_t pos_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        struct save_stream_funct_obj
+        {
+            template <typename... Ts>
+            std::size_t operator()(Ts&&... ts) const
+            {
+                // reserve space for the size of the checkpoint data, it is
+                // written after all data was serialized
+                std::streampos start = ost_->tellp();
+                if (start == std::streampos(-1))
+                {
+                    HPX_THROW_EXCEPTION(hpx::filesystem_error,
+                        "save_checkpoint_stream",
+                        "the given stream does not support positioning");
+                }
+
+                std::int64_t size = 0;
+                ost_->write(
+                    reinterpret_cast<char const*>(&size), sizeof(std::int64_t));
+
+                {
+                    checkpoint_stream_writer writer(*ost_, params_);
+                    hpx::util::save_checkpoint_data(
+                        writer, std::forward<Ts>(ts)...);
+                    writer.flush();
+
+                    size = static_cast<std::int64_t>(writer.size());
+                }
+
+                // patch the size of the checkpoint data
+                std::streampos end = ost_->tellp();
+                ost_->seekp(start);
+                ost_->write(
+                    reinterpret_cast<char const*>(&size), sizeof(std::int64_t));
+                ost_->seekp(end);
+
+                if (!*ost_)
+                {
+                    HPX_THROW_EXCEPTION(hpx::filesystem_error,
+                        "save_checkpoint_stream",
+                        "failed writing checkpoint data to stream");
+                }
+                return static_cast<std::size_t>(size);
+            }
+
+            std::ostream* ost_;
+            checkpoint_stream_params params_;
+        };
+
+        template <typename T>
+        struct is_checkpoint_stream_argument
+          : std::integral_constant<bool,
+                !hpx::traits::is_launch_policy<
+                    typename std::decay<T>::type>::value &&
+                    !std::is_same<typename std::decay<T>::type,
+                        checkpoint_stream_params>::value>
+        {
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_checkpoint_stream
+    ///
+    /// \tparam T            Containers passed to save_checkpoint_stream to be
+    ///                      serialized and written to the stream.
+    ///
+    /// \tparam Ts           More containers passed to save_checkpoint_stream
+    ///                      to be serialized and written to the stream.
+    ///
+    /// \param ost           The stream to write to. The stream has to support
+    ///                      positioning (as file streams do) and has to stay
+    ///                      valid until the returned future becomes ready.
+    ///
+    /// \param params        The parameters controlling the chunk size and
+    ///                      whether the data is written asynchronously.
+    ///
+    /// \param t             A container to store.
+    ///
+    /// \param ts            Other containers to store.
+    ///
+    /// Save_checkpoint_stream serializes the given objects and writes them to
+    /// the given stream in chunks of at most params.chunk_size_ bytes. The
+    /// written data can be read using restore_checkpoint_stream or using
+    /// operator>> into a checkpoint object.
+    ///
+    /// \returns Save_checkpoint_stream returns a future to the number of bytes
+    ///          written (not counting the size written in front of the data).
+    template <typename T, typename... Ts,
+        typename U = typename std::enable_if<
+            detail::is_checkpoint_stream_argument<T>::value>::type>
+    hpx::future<std::size_t> save_checkpoint_stream(std::ostream& ost,
+        checkpoint_stream_params const& params, T&& t, Ts&&... ts)
+    {
+        return hpx::dataflow(detail::save_stream_funct_obj{&ost, params},
+            detail::prepare_client(std::forward<T>(t)),
+            detail::prepare_client(std::forward<Ts>(ts))...);
+    }
+
+    /// \cond NOINTERNAL
+    template <typename T, typename... Ts,
+        typename U = typename std::enable_if<
+            detail::is_checkpoint_stream_argument<T>::value>::type>
+    hpx::future<std::size_t> save_checkpoint_stream(
+        std::ostream& ost, T&& t, Ts&&... ts)
+    {
+        return save_checkpoint_stream(ost, checkpoint_stream_params(),
+            std::forward<T>(t), std::forward<Ts>(ts)...);
+    }
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_checkpoint_stream - Sync_policy overload
+    ///
+    /// \param sync_p        hpx::launch::sync_policy
+    ///
+    /// Same as above, except that this function returns the number of bytes
+    /// written after all data was written to the stream.
+    template <typename T, typename... Ts,
+        typename U = typename std::enable_if<
+            detail::is_checkpoint_stream_argument<T>::value>::type>
+    std::size_t save_checkpoint_stream(hpx::launch::sync_policy sync_p,
+        std::ostream& ost, checkpoint_stream_params const& params, T&& t,
+        Ts&&... ts)
+    {
+        return hpx::dataflow(sync_p,
+            detail::save_stream_funct_obj{&ost, params},
+            detail::prepare_client(std::forward<T>(t)),
+            detail::prepare_client(std::forward<Ts>(ts))...)
+            .get();
+    }
+
+    /// \cond NOINTERNAL
+    template <typename T, typename... Ts,
+        typename U = typename std::enable_if<
+            detail::is_checkpoint_stream_argument<T>::value>::type>
+    std::size_t save_checkpoint_stream(
+        hpx::launch::sync_policy sync_p, std::ostream& ost, T&& t, Ts&&... ts)
+    {
+        return save_checkpoint_stream(sync_p, ost, checkpoint_stream_params(),
+            std::forward<T>(t), std::forward<Ts>(ts)...);
+    }
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Restore_checkpoint_stream
+    ///
+    /// \tparam T           A container to restore.
+    ///
+    /// \tparam Ts          Other containers to restore. Containers
+    ///                     must be in the same order that they were
+    ///                     written to the stream.
+    ///
+    /// \param ist          The stream to read from.
+    ///
+    /// \param params       The parameters controlling the chunk size.
+    ///
+    /// \param t            A container to restore.
+    ///
+    /// \param ts           Other containers to restore.
+    ///
+    /// Restore_checkpoint_stream reads the data written by either
+    /// save_checkpoint_stream or by operator<< for a checkpoint object in
+    /// chunks of at most params.chunk_size_ bytes and restores the given
+    /// objects from it. Afterwards the stream is positioned at the end of
+    /// the checkpoint data.
+    ///
+    /// \returns Restore_checkpoint_stream returns void.
+    template <typename T, typename... Ts>
+    void restore_checkpoint_stream(std::istream& ist,
+        checkpoint_stream_params const& params, T& t, Ts&... ts)
+    {
+        std::int64_t size = 0;
+        if (!ist.read(reinterpret_cast<char*>(&size), sizeof(std::int64_t)) ||
+            size < 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::filesystem_error,
+                "restore_checkpoint_stream",
+                "failed reading checkpoint data from stream");
+        }
+
+        detail::checkpoint_stream_reader reader(
+            ist, static_cast<std::size_t>(size), params);
+        hpx::util::restore_checkpoint_data_func(
+            reader, detail::restore_impl{}, t, ts...);
+        reader.finish();
+    }
+
+    /// \cond NOINTERNAL
+    template <typename T, typename... Ts,
+        typename U = typename std::enable_if<!std::is_same<
+            typename std::decay<T>::type, checkpoint_stream_params>::value>::type>
+    void restore_checkpoint_stream(std::istream& ist, T& t, Ts&... ts)
+    {
+        restore_checkpoint_stream(ist, checkpoint_stream_params(), t, ts...);
+    }
+    /// \endcond
+}}    // namespace hpx::util
+
+namespace hpx { namespace traits {
+
+    /// \cond NOINTERNAL
+    template <>
+    struct serialization_access_data<util::detail::checkpoint_stream_writer>
+      : default_serialization_access_data<
+            util::detail::checkpoint_stream_writer>
+    {
+        using container_type = util::detail::checkpoint_stream_writer;
+
+        static std::size_t size(container_type const& cont)
+        {
+            return cont.size();
+        }
+
+        static void resize(container_type& cont, std::size_t count)
+        {
+            cont.resize(count);
+        }
+
+        static void write(container_type& cont, std::size_t count,
+            std::size_t current, void const* address)
+        {
+            cont.write(count, current, address);
+        }
+    };
+
+    template <>
+    struct serialization_access_data<util::detail::checkpoint_stream_reader>
+      : default_serialization_access_data<
+            util::detail::checkpoint_stream_reader>
+    {
+        using container_type = util::detail::checkpoint_stream_reader;
+
+        static std::size_t size(container_type const& cont)
+        {
+            return cont.size();
+        }
+
+        static void read(container_type const& cont, std::size_t count,
+            std::size_t current, void* address)
+        {
+            cont.read(count, current, address);
+        }
+    };
+    /// \endcond
+}}    // namespace hpx::traits
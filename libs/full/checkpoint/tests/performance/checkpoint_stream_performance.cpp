@@ -0,0 +1,175 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares writing (and reading) a checkpoint file using an
+// in-memory checkpoint object with the streaming checkpoint functions. As the
+// peak resident set size of a process can only grow, each run measures a
+// single mode only (selected using --mode).
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+
+#include <hpx/modules/checkpoint.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if !defined(HPX_WINDOWS)
+#include <sys/resource.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+// peak resident set size of this process in KiB (if available)
+std::int64_t peak_rss()
+{
+#if !defined(HPX_WINDOWS)
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+#if defined(__APPLE__)
+        return std::int64_t(usage.ru_maxrss) / 1024;
+#else
+        return std::int64_t(usage.ru_maxrss);
+#endif
+    }
+#endif
+    return -1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+using data_type = std::vector<std::vector<double>>;
+
+void save(std::string const& mode, std::string const& filename,
+    data_type const& data, std::size_t chunk_size)
+{
+    std::ofstream ost(filename, std::ios::binary);
+    if (mode == "memory")
+    {
+        hpx::util::checkpoint c =
+            hpx::util::save_checkpoint(hpx::launch::sync, data);
+        ost << c;
+    }
+    else
+    {
+        hpx::util::save_checkpoint_stream(hpx::launch::sync, ost,
+            hpx::util::checkpoint_stream_params(
+                chunk_size, mode == "write_behind"),
+            data);
+    }
+}
+
+void restore(std::string const& mode, std::string const& filename,
+    data_type& data, std::size_t chunk_size)
+{
+    std::ifstream ist(filename, std::ios::binary);
+    if (mode == "memory")
+    {
+        hpx::util::checkpoint c;
+        ist >> c;
+        hpx::util::restore_checkpoint(c, data);
+    }
+    else
+    {
+        hpx::util::restore_checkpoint_stream(
+            ist, hpx::util::checkpoint_stream_params(chunk_size), data);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::string mode = vm["mode"].as<std::string>();
+    std::string filename = vm["filename"].as<std::string>();
+    std::size_t size = vm["size"].as<std::size_t>() * 1024 * 1024;
+    std::size_t block_size = vm["block_size"].as<std::size_t>() * 1024;
+    std::size_t chunk_size = vm["chunk_size"].as<std::size_t>() * 1024;
+
+    if (mode != "memory" && mode != "stream" && mode != "write_behind")
+    {
+        std::cerr << "checkpoint_stream_performance: unknown mode: " << mode
+                  << std::endl;
+        return hpx::finalize();
+    }
+
+    // create the data to be check-pointed
+    std::size_t const elements = block_size / sizeof(double);
+    data_type data(size / block_size, std::vector<double>(elements, 1.0));
+    std::size_t const bytes = data.size() * elements * sizeof(double);
+
+    std::int64_t initial_rss = peak_rss();
+
+    // run benchmark
+    std::uint64_t t = hpx::chrono::high_resolution_clock::now();
+    save(mode, filename, data, chunk_size);
+    double save_time =
+        (hpx::chrono::high_resolution_clock::now() - t) * 1e-9;
+
+    std::int64_t save_rss = peak_rss();
+
+    data_type restored;
+    t = hpx::chrono::high_resolution_clock::now();
+    restore(mode, filename, restored, chunk_size);
+    double restore_time =
+        (hpx::chrono::high_resolution_clock::now() - t) * 1e-9;
+
+    std::int64_t restore_rss = peak_rss();
+
+    std::remove(filename.c_str());
+
+    if (restored != data)
+    {
+        std::cerr << "checkpoint_stream_performance: restored data differs"
+                  << std::endl;
+    }
+
+    double const mbytes = double(bytes) / (1024 * 1024);
+    std::cout << "mode," << mode << "\n"
+              << "data_size[MiB]," << mbytes << "\n"
+              << "save_time[s]," << save_time << "\n"
+              << "save_throughput[MiB/s]," << mbytes / save_time << "\n"
+              << "restore_time[s]," << restore_time << "\n"
+              << "restore_throughput[MiB/s]," << mbytes / restore_time << "\n"
+              << "initial_peak_rss[KiB]," << initial_rss << "\n"
+              << "save_peak_rss[KiB]," << save_rss << "\n"
+              << "restore_peak_rss[KiB]," << restore_rss << std::endl;
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using hpx::program_options::value;
+
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("mode", value<std::string>()->default_value("stream"),
+         "checkpoint mode to measure: memory, stream, or write_behind "
+         "(default: stream)")
+        ("filename",
+         value<std::string>()->default_value("checkpoint_stream.dat"),
+         "name of the checkpoint file (default: checkpoint_stream.dat)")
+        ("size", value<std::size_t>()->default_value(256),
+         "size of the check-pointed data in MiB (default: 256)")
+        ("block_size", value<std::size_t>()->default_value(64),
+         "size of the individual data blocks in KiB (default: 64)")
+        ("chunk_size", value<std::size_t>()->default_value(4096),
+         "size of the chunks written by the streaming modes in KiB "
+         "(default: 4096)")
+        ;
+    // clang-format on
+
+    return hpx::init(cmdline, argc, argv);
+}
@@ -0,0 +1,126 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// This tests the functionality of save_checkpoint_stream and
+// restore_checkpoint_stream.
+
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/modules/checkpoint.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using hpx::util::checkpoint;
+using hpx::util::checkpoint_stream_params;
+using hpx::util::restore_checkpoint;
+using hpx::util::restore_checkpoint_stream;
+using hpx::util::save_checkpoint;
+using hpx::util::save_checkpoint_stream;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_round_trip(checkpoint_stream_params const& params)
+{
+    char character = 'd';
+    int integer = 10;
+    std::string str = "I am a string of characters";
+    std::vector<double> vec(10007);
+    for (std::size_t i = 0; i != vec.size(); ++i)
+        vec[i] = double(i) / 3.0;
+
+    std::stringstream strm;
+    hpx::future<std::size_t> f =
+        save_checkpoint_stream(strm, params, character, integer, str, vec);
+    std::size_t size = f.get();
+
+    // the streamed data has to be identical to a checkpoint
+    checkpoint c =
+        save_checkpoint(hpx::launch::sync, character, integer, str, vec);
+    HPX_TEST_EQ(size, c.size());
+
+    std::stringstream expected;
+    expected << c;
+    HPX_TEST(strm.str() == expected.str());
+
+    char character2 = 0;
+    int integer2 = 0;
+    std::string str2;
+    std::vector<double> vec2;
+
+    restore_checkpoint_stream(
+        strm, params, character2, integer2, str2, vec2);
+
+    HPX_TEST_EQ(character, character2);
+    HPX_TEST_EQ(integer, integer2);
+    HPX_TEST_EQ(str, str2);
+    HPX_TEST(vec == vec2);
+}
+
+void test_multiple_checkpoints(checkpoint_stream_params const& params)
+{
+    //[check_stream_test_1
+    std::vector<int> vec1(1000, 42);
+    std::vector<int> vec2(3000, 43);
+
+    std::stringstream strm;
+    save_checkpoint_stream(hpx::launch::sync, strm, params, vec1);
+    save_checkpoint_stream(hpx::launch::sync, strm, params, vec2);
+
+    // restoring the first checkpoint has to leave the stream positioned at
+    // the start of the second one
+    std::vector<int> vec3;
+    restore_checkpoint_stream(strm, params, vec3);
+    //]
+    HPX_TEST(vec1 == vec3);
+
+    checkpoint c;
+    strm >> c;
+
+    std::vector<int> vec4;
+    restore_checkpoint(c, vec4);
+    HPX_TEST(vec2 == vec4);
+}
+
+void test_from_checkpoint()
+{
+    std::vector<float> vec(12345, 1.0f);
+    std::string str = "checkpoint";
+
+    checkpoint c = save_checkpoint(hpx::launch::sync, vec, str);
+
+    std::stringstream strm;
+    strm << c;
+
+    std::vector<float> vec2;
+    std::string str2;
+    restore_checkpoint_stream(strm, vec2, str2);
+
+    HPX_TEST(vec == vec2);
+    HPX_TEST_EQ(str, str2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    // chunks smaller than the size of a single element force the large
+    // block code paths
+    std::size_t const chunk_sizes[] = {7, 1024, 4 * 1024 * 1024};
+    for (std::size_t chunk_size : chunk_sizes)
+    {
+        test_round_trip(checkpoint_stream_params(chunk_size));
+        test_round_trip(checkpoint_stream_params(chunk_size, true));
+
+        test_multiple_checkpoints(checkpoint_stream_params(chunk_size));
+        test_multiple_checkpoints(checkpoint_stream_params(chunk_size, true));
+    }
+
+    test_from_checkpoint();
+
+    return hpx::util::report_errors();
+}
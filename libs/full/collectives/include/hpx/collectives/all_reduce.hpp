@@ -36,6 +36,11 @@ namespace hpx { namespace lcos {
     /// \params root_site   The site that is responsible for creating the
     ///                     all_reduce support object. This value is optional
     ///                     and defaults to '0' (zero).
+    /// \param alg          The algorithm to use for the all_reduce operation
+    ///                     (default: as selected by the configuration setting
+    ///                     hpx.lcos.collectives.algorithm). The \a tree and
+    ///                     \a recursive_doubling algorithms combine the values
+    ///                     in the order of the sites and ignore \a root_site.
     ///
     /// \note       Each all_reduce operation has to be accompanied with a unique
     ///             usage of the \a HPX_REGISTER_ALLREDUCE macro to define the
@@ -49,7 +54,8 @@ namespace hpx { namespace lcos {
     hpx::future<T> all_reduce(char const* basename, hpx::future<T> result,
         F&& op, std::size_t num_sites = std::size_t(-1),
         std::size_t generation = std::size_t(-1),
-        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0);
+        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0,
+        collective_algorithm alg = collective_algorithm::use_default);
 
     /// AllReduce a set of values from different call sites
     ///
@@ -74,6 +80,11 @@ namespace hpx { namespace lcos {
     /// \params root_site   The site that is responsible for creating the
     ///                     all_reduce support object. This value is optional
     ///                     and defaults to '0' (zero).
+    /// \param alg          The algorithm to use for the all_reduce operation
+    ///                     (default: as selected by the configuration setting
+    ///                     hpx.lcos.collectives.algorithm). The \a tree and
+    ///                     \a recursive_doubling algorithms combine the values
+    ///                     in the order of the sites and ignore \a root_site.
     ///
     /// \note       Each all_reduce operation has to be accompanied with a unique
     ///             usage of the \a HPX_REGISTER_ALLREDUCE macro to define the
@@ -87,7 +98,8 @@ namespace hpx { namespace lcos {
     hpx::future<std::decay_t<T>> all_reduce(char const* basename, T&& result,
         F&& op, std::size_t num_sites = std::size_t(-1),
         std::size_t generation = std::size_t(-1),
-        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0);
+        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0,
+        collective_algorithm alg = collective_algorithm::use_default);
 }}    // namespace hpx::lcos
 
 // clang-format on
@@ -99,7 +111,11 @@ namespace hpx { namespace lcos {
 
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_local/dataflow.hpp>
+#include <hpx/collectives/all_gather.hpp>
+#include <hpx/collectives/broadcast.hpp>
+#include <hpx/collectives/collective_algorithm.hpp>
 #include <hpx/collectives/detail/communicator.hpp>
+#include <hpx/collectives/gather.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/traits/acquire_shared_state.hpp>
 #include <hpx/modules/execution_base.hpp>
@@ -242,12 +258,247 @@ namespace hpx { namespace lcos {
             std::move(fid), std::move(local_result));
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        // Combine the given values in order
+        template <typename T, typename F>
+        T all_reduce_values(std::vector<T>&& values, F& op)
+        {
+            auto it = values.begin();
+            T result = std::move(*it);
+            while (++it != values.end())
+            {
+                result = op(std::move(result), std::move(*it));
+            }
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Reduce the values up a tree of the given arity rooted at site zero
+        // and send the overall result back down the same tree. Each level of
+        // the tree is implemented by a separate gather and broadcast
+        // operation.
+        template <typename T, typename F>
+        T all_reduce_tree(char const* basename, T value, F& op,
+            std::size_t num_sites, std::size_t generation,
+            std::size_t this_site, std::size_t arity)
+        {
+            std::size_t level = 0;
+            std::size_t stride = 1;
+
+            // combine the values of our children as long as we are the root
+            // of the group on the current level
+            for (/**/; stride < num_sites; stride *= arity, ++level)
+            {
+                auto group = get_collective_tree_group(
+                    this_site, num_sites, stride, arity);
+                if (group.index != 0)
+                {
+                    break;
+                }
+                if (group.size == 1)
+                {
+                    continue;
+                }
+
+                std::string name = make_collective_name(
+                    basename, "tree_reduce/", level, generation);
+                value = all_reduce_values(
+                    gather_here(create_gatherer(name.c_str(), group.size,
+                                    std::size_t(-1), group.root),
+                        std::move(value), 0)
+                        .get(),
+                    op);
+            }
+
+            // send our partial result to the parent and receive the overall
+            // result back from it
+            if (stride < num_sites)
+            {
+                auto group = get_collective_tree_group(
+                    this_site, num_sites, stride, arity);
+
+                std::string reduce_name = make_collective_name(
+                    basename, "tree_reduce/", level, generation);
+                std::string broadcast_name = make_collective_name(
+                    basename, "tree_broadcast/", level, generation);
+
+                hpx::future<void> f = gather_there(
+                    hpx::find_from_basename(std::move(reduce_name), group.root),
+                    std::move(value), group.index);
+
+                value = broadcast_from<T>(hpx::find_from_basename(
+                                              std::move(broadcast_name),
+                                              group.root),
+                    group.index)
+                            .get();
+                f.get();
+            }
+
+            // pass the overall result on to our children
+            std::vector<hpx::future<T>> sent;
+            sent.reserve(level);
+            while (level-- != 0)
+            {
+                stride /= arity;
+
+                auto group = get_collective_tree_group(
+                    this_site, num_sites, stride, arity);
+                if (group.size == 1)
+                {
+                    continue;
+                }
+
+                std::string name = make_collective_name(
+                    basename, "tree_broadcast/", level, generation);
+                sent.push_back(broadcast_to(create_broadcast(name.c_str(),
+                                                group.size, std::size_t(-1),
+                                                group.root),
+                    value, 0));
+            }
+
+            for (auto& f : sent)
+            {
+                f.get();    // propagate exceptions
+            }
+            return value;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Exchange partial results pairwise between sites whose (logical)
+        // ranks differ in exactly one bit. If the number of sites is not a
+        // power of two, the first 2*excess sites are combined pairwise before
+        // the exchange and the even sites of each pair receive the result
+        // from their partner afterwards.
+        template <typename T, typename F>
+        T all_reduce_recursive_doubling(char const* basename, T value, F& op,
+            std::size_t num_sites, std::size_t generation,
+            std::size_t this_site)
+        {
+            std::size_t pow2 = 1;
+            while (2 * pow2 <= num_sites)
+            {
+                pow2 *= 2;
+            }
+            std::size_t const excess = num_sites - pow2;
+
+            if (this_site < 2 * excess)
+            {
+                // the odd site of each pair takes part in the exchange
+                std::size_t const partner = this_site | 1;
+                std::string name = make_collective_name(
+                    basename, "recursive_doubling_fold/", 0, generation);
+
+                if (this_site != partner)
+                {
+                    std::string result_name = make_collective_name(basename,
+                        "recursive_doubling_result/", 0, generation);
+
+                    hpx::future<void> f = gather_there(
+                        hpx::find_from_basename(std::move(name), partner),
+                        std::move(value), 0);
+
+                    value = broadcast_from<T>(hpx::find_from_basename(
+                                                  std::move(result_name),
+                                                  partner),
+                        0)
+                                .get();
+                    f.get();
+                    return value;
+                }
+
+                value = all_reduce_values(
+                    gather_here(create_gatherer(
+                                    name.c_str(), 2, std::size_t(-1), partner),
+                        std::move(value), 1)
+                        .get(),
+                    op);
+            }
+
+            // the logical rank of a site, and the site for a logical rank
+            std::size_t const rank = this_site < 2 * excess ?
+                this_site / 2 :
+                this_site - excess;
+            auto site_of = [excess](std::size_t r) {
+                return r < excess ? 2 * r + 1 : r + excess;
+            };
+
+            std::size_t step = 0;
+            for (std::size_t mask = 1; mask < pow2; mask <<= 1, ++step)
+            {
+                // the site with the lower rank creates the support object
+                std::size_t const partner_rank = rank ^ mask;
+                std::size_t const lower =
+                    site_of(rank < partner_rank ? rank : partner_rank);
+
+                std::string name = make_collective_name(
+                    basename, "recursive_doubling/", step, generation);
+
+                hpx::future<hpx::id_type> fid;
+                if (this_site == lower)
+                {
+                    fid = create_all_gather(
+                        name.c_str(), 2, std::size_t(-1), lower);
+                }
+                else
+                {
+                    fid = hpx::find_from_basename(std::move(name), lower);
+                }
+
+                value = all_reduce_values(all_gather(std::move(fid),
+                                              std::move(value),
+                                              this_site == lower ? 0 : 1)
+                                              .get(),
+                    op);
+            }
+
+            // send the result to the site folded into this one
+            if (this_site < 2 * excess)
+            {
+                std::string name = make_collective_name(
+                    basename, "recursive_doubling_result/", 0, generation);
+                broadcast_to(create_broadcast(
+                                 name.c_str(), 2, std::size_t(-1), this_site),
+                    value, 1)
+                    .get();
+            }
+            return value;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename T, typename F>
+        hpx::future<T> all_reduce_algorithm(collective_algorithm alg,
+            char const* basename, hpx::future<T>&& local_result, F&& op,
+            std::size_t num_sites, std::size_t generation,
+            std::size_t this_site)
+        {
+            std::size_t const arity = get_collective_arity();
+
+            // the composite algorithms wait for the results of the individual
+            // steps, run those on a new thread
+            return local_result.then(hpx::launch::async,
+                [alg, basename = std::string(basename),
+                    op = std::forward<F>(op), num_sites, generation, this_site,
+                    arity](hpx::future<T>&& f) mutable -> T {
+                    if (alg == collective_algorithm::recursive_doubling)
+                    {
+                        return all_reduce_recursive_doubling(basename.c_str(),
+                            f.get(), op, num_sites, generation, this_site);
+                    }
+                    return all_reduce_tree(basename.c_str(), f.get(), op,
+                        num_sites, generation, this_site, arity);
+                });
+        }
+    }    // namespace detail
+
     template <typename T, typename F>
     hpx::future<T> all_reduce(char const* basename,
         hpx::future<T>&& local_result, F&& op,
         std::size_t num_sites = std::size_t(-1),
         std::size_t generation = std::size_t(-1),
-        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0)
+        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0,
+        collective_algorithm alg = collective_algorithm::use_default)
     {
         if (num_sites == std::size_t(-1))
         {
@@ -259,6 +510,14 @@ namespace hpx { namespace lcos {
             this_site = static_cast<std::size_t>(hpx::get_locality_id());
         }
 
+        alg = get_collective_algorithm(alg);
+        if (alg != collective_algorithm::flat)
+        {
+            return detail::all_reduce_algorithm(alg, basename,
+                std::move(local_result), std::forward<F>(op), num_sites,
+                generation, this_site);
+        }
+
         if (this_site == root_site)
         {
             return all_reduce(
@@ -319,7 +578,8 @@ namespace hpx { namespace lcos {
     hpx::future<typename std::decay<T>::type> all_reduce(char const* basename,
         T&& local_result, F&& op, std::size_t num_sites = std::size_t(-1),
         std::size_t generation = std::size_t(-1),
-        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0)
+        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0,
+        collective_algorithm alg = collective_algorithm::use_default)
     {
         if (num_sites == std::size_t(-1))
         {
@@ -331,6 +591,14 @@ namespace hpx { namespace lcos {
             this_site = static_cast<std::size_t>(hpx::get_locality_id());
         }
 
+        alg = get_collective_algorithm(alg);
+        if (alg != collective_algorithm::flat)
+        {
+            return detail::all_reduce_algorithm(alg, basename,
+                hpx::make_ready_future(std::forward<T>(local_result)),
+                std::forward<F>(op), num_sites, generation, this_site);
+        }
+
         if (this_site == root_site)
         {
             return all_reduce(
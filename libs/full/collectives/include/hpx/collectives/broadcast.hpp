@@ -33,6 +33,10 @@ namespace hpx { namespace lcos {
     /// \params root_site   The site that is responsible for creating the
     ///                     broadcast support object. This value is optional
     ///                     and defaults to '0' (zero).
+    /// \param alg          The algorithm to use for the broadcast operation
+    ///                     (default: as selected by the configuration setting
+    ///                     hpx.lcos.collectives.algorithm). All participating
+    ///                     sites have to use the same algorithm.
     ///
     /// \note       Each broadcast operation has to be accompanied with a unique
     ///             usage of the \a HPX_REGISTER_BROADCAST macro to define the
@@ -47,7 +51,8 @@ namespace hpx { namespace lcos {
         std::size_t num_sites = std::size_t(-1),
         std::size_t generation = std::size_t(-1),
         std::size_t this_site = std::size_t(-1),
-        std::size_t root_site = 0)
+        std::size_t root_site = 0,
+        collective_algorithm alg = collective_algorithm::use_default)
 
     /// Broadcast a value to different call sites
     ///
@@ -70,6 +75,10 @@ namespace hpx { namespace lcos {
     /// \params root_site   The site that is responsible for creating the
     ///                     broadcast support object. This value is optional
     ///                     and defaults to '0' (zero).
+    /// \param alg          The algorithm to use for the broadcast operation
+    ///                     (default: as selected by the configuration setting
+    ///                     hpx.lcos.collectives.algorithm). All participating
+    ///                     sites have to use the same algorithm.
     ///
     /// \note       Each broadcast operation has to be accompanied with a unique
     ///             usage of the \a HPX_REGISTER_BROADCAST macro to define the
@@ -84,7 +93,8 @@ namespace hpx { namespace lcos {
         std::size_t num_sites = std::size_t(-1),
         std::size_t generation = std::size_t(-1),
         std::size_t this_site = std::size_t(-1),
-        std::size_t root_site = 0)
+        std::size_t root_site = 0,
+        collective_algorithm alg = collective_algorithm::use_default)
 
     /// Receive a value that was broadcast to different call sites
     ///
@@ -100,6 +110,16 @@ namespace hpx { namespace lcos {
     /// \param this_site    The sequence number of this invocation (usually
     ///                     the locality id). This value is optional and
     ///                     defaults to whatever hpx::get_locality_id() returns.
+    /// \params root_site   The site that is responsible for creating the
+    ///                     broadcast support object. This value is optional
+    ///                     and defaults to '0' (zero).
+    /// \param  num_sites   The number of participating sites (default: all
+    ///                     localities). This is used only if \a alg is not
+    ///                     \a collective_algorithm::flat.
+    /// \param alg          The algorithm to use for the broadcast operation
+    ///                     (default: as selected by the configuration setting
+    ///                     hpx.lcos.collectives.algorithm). All participating
+    ///                     sites have to use the same algorithm.
     ///
     /// \note       Each broadcast operation has to be accompanied with a unique
     ///             usage of the \a HPX_REGISTER_BROADCAST macro to define the
@@ -112,7 +132,10 @@ namespace hpx { namespace lcos {
     template <typename T>
     hpx::future<T> broadcast_from(char const* basename,
         std::size_t generation = std::size_t(-1),
-        std::size_t this_site = std::size_t(-1))
+        std::size_t this_site = std::size_t(-1),
+        std::size_t root_site = 0,
+        std::size_t num_sites = std::size_t(-1),
+        collective_algorithm alg = collective_algorithm::use_default)
 
 }}    // namespace hpx::lcos
 
@@ -124,7 +147,9 @@ namespace hpx { namespace lcos {
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
 
 #include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_local/async.hpp>
 #include <hpx/async_local/dataflow.hpp>
+#include <hpx/collectives/collective_algorithm.hpp>
 #include <hpx/collectives/detail/communicator.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/traits/acquire_shared_state.hpp>
@@ -282,27 +307,6 @@ namespace hpx { namespace lcos {
             std::move(fid), std::move(local_result));
     }
 
-    template <typename T>
-    hpx::future<T> broadcast_to(char const* basename,
-        hpx::future<T>&& local_result, std::size_t num_sites = std::size_t(-1),
-        std::size_t generation = std::size_t(-1),
-        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0)
-    {
-        if (num_sites == std::size_t(-1))
-        {
-            num_sites = static_cast<std::size_t>(
-                hpx::get_num_localities(hpx::launch::sync));
-        }
-        if (this_site == std::size_t(-1))
-        {
-            this_site = static_cast<std::size_t>(hpx::get_locality_id());
-        }
-
-        return broadcast_to(
-            create_broadcast(basename, num_sites, generation, root_site),
-            std::move(local_result), this_site);
-    }
-
     template <typename T>
     hpx::future<typename std::decay<T>::type> broadcast_to(
         hpx::future<hpx::id_type>&& fid, T&& local_result,
@@ -337,27 +341,6 @@ namespace hpx { namespace lcos {
             std::move(fid), std::forward<T>(local_result));
     }
 
-    template <typename T>
-    hpx::future<typename std::decay<T>::type> broadcast_to(char const* basename,
-        T&& local_result, std::size_t num_sites = std::size_t(-1),
-        std::size_t generation = std::size_t(-1),
-        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0)
-    {
-        if (num_sites == std::size_t(-1))
-        {
-            num_sites = static_cast<std::size_t>(
-                hpx::get_num_localities(hpx::launch::sync));
-        }
-        if (this_site == std::size_t(-1))
-        {
-            this_site = static_cast<std::size_t>(hpx::get_locality_id());
-        }
-
-        return broadcast_to(
-            create_broadcast(basename, num_sites, generation, root_site),
-            std::forward<T>(local_result), this_site);
-    }
-
     ///////////////////////////////////////////////////////////////////////////
     template <typename T>
     hpx::future<T> broadcast_from(hpx::future<hpx::id_type>&& fid,
@@ -388,16 +371,202 @@ namespace hpx { namespace lcos {
             std::move(fid));
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        // Send the value down a tree of the given arity rooted at root_site.
+        // Each level of the tree is implemented by a separate broadcast
+        // operation. The local_result is used on the root site only.
+        template <typename T>
+        T broadcast_tree(char const* basename, hpx::future<T>&& local_result,
+            std::size_t num_sites, std::size_t generation,
+            std::size_t this_site, std::size_t root_site, std::size_t arity)
+        {
+            // the tree is built over the ranks relative to the root site
+            std::size_t const rank =
+                (this_site + num_sites - root_site) % num_sites;
+            auto site_of = [num_sites, root_site](std::size_t r) {
+                return (r + root_site) % num_sites;
+            };
+
+            // find the level on which this site receives the value
+            std::size_t level = 0;
+            std::size_t stride = 1;
+            for (/**/; stride < num_sites; stride *= arity, ++level)
+            {
+                if (get_collective_tree_group(rank, num_sites, stride, arity)
+                        .index != 0)
+                {
+                    break;
+                }
+            }
+
+            T value = [&]() -> T {
+                if (stride >= num_sites)
+                {
+                    return local_result.get();
+                }
+
+                auto group =
+                    get_collective_tree_group(rank, num_sites, stride, arity);
+                std::string name = make_collective_name(
+                    basename, "tree_broadcast/", level, generation);
+
+                return broadcast_from<T>(hpx::find_from_basename(
+                                             std::move(name),
+                                             site_of(group.root)),
+                    group.index)
+                    .get();
+            }();
+
+            // pass the value on to our children
+            std::vector<hpx::future<T>> sent;
+            sent.reserve(level);
+            while (level-- != 0)
+            {
+                stride /= arity;
+
+                auto group =
+                    get_collective_tree_group(rank, num_sites, stride, arity);
+                if (group.size == 1)
+                {
+                    continue;
+                }
+
+                std::string name = make_collective_name(
+                    basename, "tree_broadcast/", level, generation);
+                sent.push_back(broadcast_to(
+                    create_broadcast(name.c_str(), group.size,
+                        std::size_t(-1), site_of(group.root)),
+                    value, 0));
+            }
+
+            for (auto& f : sent)
+            {
+                f.get();    // propagate exceptions
+            }
+            return value;
+        }
+
+        // recursive doubling for broadcasts is equivalent to a binomial tree
+        inline std::size_t get_broadcast_arity(collective_algorithm alg)
+        {
+            return alg == collective_algorithm::recursive_doubling ?
+                2 :
+                get_collective_arity();
+        }
+
+        template <typename T>
+        hpx::future<T> broadcast_to_algorithm(collective_algorithm alg,
+            char const* basename, hpx::future<T>&& local_result,
+            std::size_t num_sites, std::size_t generation,
+            std::size_t this_site, std::size_t root_site)
+        {
+            std::size_t const arity = get_broadcast_arity(alg);
+
+            // the composite algorithms wait for the results of the individual
+            // steps, run those on a new thread
+            return local_result.then(hpx::launch::async,
+                [basename = std::string(basename), num_sites, generation,
+                    this_site, root_site, arity](hpx::future<T>&& f) -> T {
+                    return broadcast_tree(basename.c_str(), std::move(f),
+                        num_sites, generation, this_site, root_site, arity);
+                });
+        }
+    }    // namespace detail
+
+    template <typename T>
+    hpx::future<T> broadcast_to(char const* basename,
+        hpx::future<T>&& local_result, std::size_t num_sites = std::size_t(-1),
+        std::size_t generation = std::size_t(-1),
+        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0,
+        collective_algorithm alg = collective_algorithm::use_default)
+    {
+        if (num_sites == std::size_t(-1))
+        {
+            num_sites = static_cast<std::size_t>(
+                hpx::get_num_localities(hpx::launch::sync));
+        }
+        if (this_site == std::size_t(-1))
+        {
+            this_site = static_cast<std::size_t>(hpx::get_locality_id());
+        }
+
+        alg = get_collective_algorithm(alg);
+        if (alg != collective_algorithm::flat)
+        {
+            return detail::broadcast_to_algorithm(alg, basename,
+                std::move(local_result), num_sites, generation, this_site,
+                root_site);
+        }
+
+        return broadcast_to(
+            create_broadcast(basename, num_sites, generation, root_site),
+            std::move(local_result), this_site);
+    }
+
+    template <typename T>
+    hpx::future<typename std::decay<T>::type> broadcast_to(char const* basename,
+        T&& local_result, std::size_t num_sites = std::size_t(-1),
+        std::size_t generation = std::size_t(-1),
+        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0,
+        collective_algorithm alg = collective_algorithm::use_default)
+    {
+        if (num_sites == std::size_t(-1))
+        {
+            num_sites = static_cast<std::size_t>(
+                hpx::get_num_localities(hpx::launch::sync));
+        }
+        if (this_site == std::size_t(-1))
+        {
+            this_site = static_cast<std::size_t>(hpx::get_locality_id());
+        }
+
+        alg = get_collective_algorithm(alg);
+        if (alg != collective_algorithm::flat)
+        {
+            return detail::broadcast_to_algorithm(alg, basename,
+                hpx::make_ready_future(std::forward<T>(local_result)),
+                num_sites, generation, this_site, root_site);
+        }
+
+        return broadcast_to(
+            create_broadcast(basename, num_sites, generation, root_site),
+            std::forward<T>(local_result), this_site);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
     template <typename T>
     hpx::future<T> broadcast_from(char const* basename,
         std::size_t generation = std::size_t(-1),
-        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0)
+        std::size_t this_site = std::size_t(-1), std::size_t root_site = 0,
+        std::size_t num_sites = std::size_t(-1),
+        collective_algorithm alg = collective_algorithm::use_default)
     {
         if (this_site == std::size_t(-1))
         {
             this_site = static_cast<std::size_t>(hpx::get_locality_id());
         }
 
+        alg = get_collective_algorithm(alg);
+        if (alg != collective_algorithm::flat)
+        {
+            if (num_sites == std::size_t(-1))
+            {
+                num_sites = static_cast<std::size_t>(
+                    hpx::get_num_localities(hpx::launch::sync));
+            }
+
+            std::size_t const arity = detail::get_broadcast_arity(alg);
+            return hpx::async(hpx::launch::async,
+                [basename = std::string(basename), num_sites, generation,
+                    this_site, root_site, arity]() -> T {
+                    return detail::broadcast_tree(basename.c_str(),
+                        hpx::future<T>(), num_sites, generation, this_site,
+                        root_site, arity);
+                });
+        }
+
         std::string name(basename);
         if (generation != std::size_t(-1))
         {
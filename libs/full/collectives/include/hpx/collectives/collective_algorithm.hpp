@@ -0,0 +1,99 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file collective_algorithm.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <string>
+
+namespace hpx { namespace lcos {
+
+    /// The algorithms available for implementing the collective operations
+    /// \a all_reduce, \a broadcast_to, and \a broadcast_from.
+    enum class collective_algorithm
+    {
+        /// Use the algorithm selected by the configuration setting
+        /// hpx.lcos.collectives.algorithm (default: flat)
+        use_default = -1,
+
+        /// All sites directly communicate with the root site
+        flat = 0,
+
+        /// The sites are arranged in a tree of the arity given by
+        /// hpx.lcos.collectives.arity, each site communicates with its
+        /// parent and its children only
+        tree = 1,
+
+        /// The sites exchange partial results pairwise in log2(num_sites)
+        /// rounds (all_reduce only, broadcasts use a binomial tree instead)
+        recursive_doubling = 2
+    };
+
+    /// Return the algorithm to use for a collective operation. This resolves
+    /// \a collective_algorithm::use_default to the algorithm selected by the
+    /// configuration setting hpx.lcos.collectives.algorithm.
+    HPX_EXPORT collective_algorithm get_collective_algorithm(
+        collective_algorithm alg = collective_algorithm::use_default);
+
+    /// Return the arity of the trees used by the tree-based collective
+    /// operations (configuration setting hpx.lcos.collectives.arity).
+    HPX_EXPORT std::size_t get_collective_arity();
+
+    /// Return the name of the given collective algorithm
+    HPX_EXPORT char const* get_collective_algorithm_name(
+        collective_algorithm alg);
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // Describes the group a site belongs to on one level of a tree based
+        // collective operation. On the level with the given stride, only the
+        // sites that are a multiple of stride participate, each group
+        // consists of up to arity consecutive participating sites.
+        struct collective_tree_group
+        {
+            std::size_t root;     // the first site of the group
+            std::size_t index;    // position of the site in the group
+            std::size_t size;     // number of sites in the group
+        };
+
+        inline collective_tree_group get_collective_tree_group(
+            std::size_t site, std::size_t num_sites, std::size_t stride,
+            std::size_t arity)
+        {
+            std::size_t const span = stride * arity;
+            std::size_t const root = site - site % span;
+            std::size_t const remaining =
+                (num_sites - root + stride - 1) / stride;
+
+            return collective_tree_group{root, (site - root) / stride,
+                remaining < arity ? remaining : arity};
+        }
+
+        // Create the name used to register the support object for one step
+        // of a composite collective operation.
+        inline std::string make_collective_name(char const* basename,
+            char const* operation, std::size_t step, std::size_t generation)
+        {
+            std::string name(basename);
+            name += operation;
+            name += std::to_string(step) + "/";
+            if (generation != std::size_t(-1))
+            {
+                name += std::to_string(generation) + "/";
+            }
+            return name;
+        }
+    }    // namespace detail
+}}    // namespace hpx::lcos
+
+namespace hpx {
+    using lcos::collective_algorithm;
+}    // namespace hpx
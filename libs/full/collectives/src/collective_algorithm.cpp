@@ -0,0 +1,72 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/collectives/collective_algorithm.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <cstddef>
+#include <string>
+
+namespace hpx { namespace lcos {
+
+    collective_algorithm get_collective_algorithm(collective_algorithm alg)
+    {
+        if (alg != collective_algorithm::use_default)
+        {
+            return alg;
+        }
+
+        std::string const name =
+            get_config_entry("hpx.lcos.collectives.algorithm", "flat");
+
+        if (name == "flat")
+        {
+            return collective_algorithm::flat;
+        }
+        if (name == "tree")
+        {
+            return collective_algorithm::tree;
+        }
+        if (name == "recursive_doubling")
+        {
+            return collective_algorithm::recursive_doubling;
+        }
+
+        HPX_THROW_EXCEPTION(bad_parameter,
+            "hpx::lcos::get_collective_algorithm",
+            "unknown collective algorithm: '" + name +
+                "' (valid values are: flat, tree, recursive_doubling)");
+        return collective_algorithm::flat;
+    }
+
+    std::size_t get_collective_arity()
+    {
+        std::size_t const arity = hpx::util::from_string<std::size_t>(
+            get_config_entry("hpx.lcos.collectives.arity", 32));
+
+        // trees need to have at least two children per node
+        return arity < 2 ? 2 : arity;
+    }
+
+    char const* get_collective_algorithm_name(collective_algorithm alg)
+    {
+        switch (get_collective_algorithm(alg))
+        {
+        case collective_algorithm::tree:
+            return "tree";
+
+        case collective_algorithm::recursive_doubling:
+            return "recursive_doubling";
+
+        default:
+            break;
+        }
+        return "flat";
+    }
+}}    // namespace hpx::lcos
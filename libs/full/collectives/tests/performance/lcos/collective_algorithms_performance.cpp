@@ -0,0 +1,230 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the latency of all_reduce and broadcast for the available
+// collective algorithms depending on the number of participating sites
+// (localities) and the size of the payload.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+using payload_type = std::vector<double>;
+
+struct payload_sum
+{
+    payload_type operator()(payload_type lhs, payload_type const& rhs) const
+    {
+        for (std::size_t i = 0; i != lhs.size(); ++i)
+        {
+            lhs[i] += rhs[i];
+        }
+        return lhs;
+    }
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned)
+    {
+    }
+};
+
+struct maximum
+{
+    double operator()(double lhs, double rhs) const
+    {
+        return (std::max)(lhs, rhs);
+    }
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned)
+    {
+    }
+};
+
+// all localities have to run the same sequence of operations, the generation
+// counter makes every invocation unique
+std::size_t generation = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+double measure_all_reduce(hpx::collective_algorithm alg, std::size_t num_sites,
+    std::size_t size, std::size_t iterations)
+{
+    std::size_t const this_site = hpx::get_locality_id();
+    payload_type const payload(size / sizeof(double), double(this_site));
+
+    hpx::chrono::high_resolution_timer t;
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        hpx::all_reduce("/perf/all_reduce/", payload, payload_sum{},
+            num_sites, ++generation, this_site, 0, alg)
+            .get();
+    }
+    return t.elapsed() / iterations;
+}
+
+double measure_broadcast(hpx::collective_algorithm alg, std::size_t num_sites,
+    std::size_t size, std::size_t iterations)
+{
+    std::size_t const this_site = hpx::get_locality_id();
+    payload_type const payload(size / sizeof(double), 42.0);
+
+    hpx::chrono::high_resolution_timer t;
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        if (this_site == 0)
+        {
+            hpx::broadcast_to("/perf/broadcast/", payload, num_sites,
+                ++generation, this_site, 0, alg)
+                .get();
+        }
+        else
+        {
+            hpx::broadcast_from<payload_type>("/perf/broadcast/",
+                ++generation, this_site, 0, num_sites, alg)
+                .get();
+        }
+    }
+    return t.elapsed() / iterations;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void run_benchmark(char const* operation, hpx::collective_algorithm alg,
+    std::size_t num_sites, std::size_t size, std::size_t iterations)
+{
+    std::size_t const this_site = hpx::get_locality_id();
+
+    // the localities not participating in this measurement have to keep
+    // their generation counters in sync nevertheless
+    std::size_t const first_generation = generation;
+
+    double elapsed = 0.0;
+    if (this_site < num_sites)
+    {
+        // warm up
+        if (std::string(operation) == "all_reduce")
+        {
+            measure_all_reduce(alg, num_sites, size, 1);
+            elapsed = measure_all_reduce(alg, num_sites, size, iterations);
+        }
+        else
+        {
+            measure_broadcast(alg, num_sites, size, 1);
+            elapsed = measure_broadcast(alg, num_sites, size, iterations);
+        }
+
+        // the operation is complete once the slowest site is done
+        elapsed = hpx::all_reduce("/perf/latency/", elapsed, maximum{},
+            num_sites, first_generation, this_site, 0,
+            hpx::collective_algorithm::flat)
+                      .get();
+    }
+    generation = first_generation + iterations + 1;
+
+    if (this_site == 0)
+    {
+        hpx::util::format_to(std::cout,
+            "{1:12} {2:20} {3:8} {4:12} {5:14.2f}\n", operation,
+            hpx::lcos::get_collective_algorithm_name(alg), num_sites, size,
+            elapsed * 1e6);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const min_size = vm["min-size"].as<std::size_t>();
+    std::size_t const max_size = vm["max-size"].as<std::size_t>();
+    std::size_t const iterations = vm["iterations"].as<std::size_t>();
+    std::string const algorithm = vm["algorithm"].as<std::string>();
+
+    std::size_t const num_localities =
+        hpx::get_num_localities(hpx::launch::sync);
+
+    std::vector<hpx::collective_algorithm> algorithms;
+    if (algorithm == "all" || algorithm == "flat")
+        algorithms.push_back(hpx::collective_algorithm::flat);
+    if (algorithm == "all" || algorithm == "tree")
+        algorithms.push_back(hpx::collective_algorithm::tree);
+    if (algorithm == "all" || algorithm == "recursive_doubling")
+        algorithms.push_back(hpx::collective_algorithm::recursive_doubling);
+
+    // measure for 2, 4, 8, ... sites and for all localities
+    std::vector<std::size_t> site_counts;
+    for (std::size_t n = 2; n < num_localities; n *= 2)
+    {
+        site_counts.push_back(n);
+    }
+    site_counts.push_back(num_localities);
+
+    if (hpx::get_locality_id() == 0)
+    {
+        std::cout << "-------------- Benchmark Config --------------"
+                  << std::endl;
+        std::cout << "localities   : " << num_localities << std::endl;
+        std::cout << "iterations   : " << iterations << std::endl;
+        std::cout << "arity        : " << hpx::lcos::get_collective_arity()
+                  << std::endl;
+        std::cout << "----------------------------------------------\n"
+                  << std::endl;
+
+        hpx::util::format_to(std::cout, "{1:12} {2:20} {3:8} {4:12} {5:14}\n",
+            "operation", "algorithm", "sites", "size [bytes]",
+            "latency [us]");
+    }
+
+    for (char const* operation : {"all_reduce", "broadcast"})
+    {
+        for (hpx::collective_algorithm alg : algorithms)
+        {
+            for (std::size_t num_sites : site_counts)
+            {
+                for (std::size_t size = min_size; size <= max_size; size *= 2)
+                {
+                    run_benchmark(
+                        operation, alg, num_sites, size, iterations);
+                }
+            }
+        }
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using hpx::program_options::options_description;
+    using hpx::program_options::value;
+
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("min-size", value<std::size_t>()->default_value(8),
+         "the smallest payload size to measure in bytes (default: 8)")
+        ("max-size", value<std::size_t>()->default_value(1024 * 1024),
+         "the largest payload size to measure in bytes (default: 1MB)")
+        ("iterations", value<std::size_t>()->default_value(100),
+         "the number of operations for each measurement (default: 100)")
+        ("algorithm", value<std::string>()->default_value("all"),
+         "the collective algorithm to measure "
+         "(all/flat/tree/recursive_doubling, default: all)")
+        ;
+    // clang-format on
+
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1"};
+
+    return hpx::init(desc_commandline, argc, argv, cfg);
+}
@@ -0,0 +1,192 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify the tree and recursive doubling variants of all_reduce and
+// broadcast. Every locality runs several sites to exercise groups of
+// different sizes and site counts that are not a power of two.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+constexpr std::size_t sites_per_locality = 4;
+
+// non-commutative reduction operation, verifies the order of the sites is
+// preserved
+struct concatenate
+{
+    std::string operator()(
+        std::string const& lhs, std::string const& rhs) const
+    {
+        return lhs + rhs;
+    }
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned)
+    {
+    }
+};
+
+std::vector<std::size_t> local_sites(std::size_t num_sites)
+{
+    std::vector<std::size_t> sites;
+    std::size_t const first = hpx::get_locality_id() * sites_per_locality;
+    for (std::size_t i = 0; i != sites_per_locality; ++i)
+    {
+        if (first + i < num_sites)
+            sites.push_back(first + i);
+    }
+    return sites;
+}
+
+// every algorithm uses its own base name
+std::string make_name(char const* basename, hpx::collective_algorithm alg)
+{
+    return std::string(basename) +
+        hpx::lcos::get_collective_algorithm_name(alg) + "/";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_all_reduce(char const* basename, hpx::collective_algorithm alg,
+    std::size_t num_sites, std::size_t generation)
+{
+    std::string const name = make_name(basename, alg);
+
+    std::vector<hpx::future<std::string>> results;
+    for (std::size_t site : local_sites(num_sites))
+    {
+        results.push_back(hpx::all_reduce(name.c_str(),
+            std::to_string(site) + ",", concatenate{}, num_sites, generation,
+            site, 0, alg));
+    }
+
+    std::string expected;
+    for (std::size_t i = 0; i != num_sites; ++i)
+    {
+        expected += std::to_string(i) + ",";
+    }
+
+    for (auto& f : results)
+    {
+        HPX_TEST_EQ(f.get(), expected);
+    }
+}
+
+void test_all_reduce_sum(char const* basename, hpx::collective_algorithm alg,
+    std::size_t num_sites, std::size_t generation)
+{
+    std::string const name = make_name(basename, alg);
+
+    std::vector<hpx::future<std::uint32_t>> results;
+    for (std::size_t site : local_sites(num_sites))
+    {
+        hpx::future<std::uint32_t> value =
+            hpx::make_ready_future(std::uint32_t(site));
+        results.push_back(hpx::all_reduce(name.c_str(), std::move(value),
+            std::plus<std::uint32_t>{}, num_sites, generation, site, 0, alg));
+    }
+
+    std::uint32_t expected = 0;
+    for (std::size_t i = 0; i != num_sites; ++i)
+    {
+        expected += std::uint32_t(i);
+    }
+
+    for (auto& f : results)
+    {
+        HPX_TEST_EQ(f.get(), expected);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_broadcast(char const* basename, hpx::collective_algorithm alg,
+    std::size_t num_sites, std::size_t generation, std::size_t root_site)
+{
+    std::string const name = make_name(basename, alg);
+    std::string const value = "value-" + std::to_string(generation);
+
+    std::vector<hpx::future<std::string>> results;
+    for (std::size_t site : local_sites(num_sites))
+    {
+        if (site == root_site)
+        {
+            results.push_back(hpx::broadcast_to(name.c_str(), value,
+                num_sites, generation, site, root_site, alg));
+        }
+        else
+        {
+            results.push_back(hpx::broadcast_from<std::string>(name.c_str(),
+                generation, site, root_site, num_sites, alg));
+        }
+    }
+
+    for (auto& f : results)
+    {
+        HPX_TEST_EQ(f.get(), value);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(int argc, char* argv[])
+{
+    std::size_t const num_localities =
+        hpx::get_num_localities(hpx::launch::sync);
+    std::size_t const max_sites = num_localities * sites_per_locality;
+
+    std::size_t generation = 0;
+    for (std::size_t num_sites = 1; num_sites <= max_sites; ++num_sites)
+    {
+        for (hpx::collective_algorithm alg :
+            {hpx::collective_algorithm::tree,
+                hpx::collective_algorithm::recursive_doubling})
+        {
+            test_all_reduce("/test/collective_algorithms/all_reduce/", alg,
+                num_sites, generation);
+            test_all_reduce_sum("/test/collective_algorithms/all_reduce_sum/",
+                alg, num_sites, generation);
+        }
+
+        for (hpx::collective_algorithm alg :
+            {hpx::collective_algorithm::flat, hpx::collective_algorithm::tree,
+                hpx::collective_algorithm::recursive_doubling})
+        {
+            test_broadcast("/test/collective_algorithms/broadcast/", alg,
+                num_sites, generation, 0);
+            test_broadcast("/test/collective_algorithms/broadcast_root/", alg,
+                num_sites, generation, num_sites - 1);
+        }
+
+        ++generation;
+    }
+
+    // the algorithm selected by the configuration is used by default
+    HPX_TEST(hpx::lcos::get_collective_algorithm() ==
+        hpx::collective_algorithm::tree);
+    test_all_reduce("/test/collective_algorithms/all_reduce_default/",
+        hpx::collective_algorithm::use_default, max_sites, 0);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // use an arity which leads to partially filled groups
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1",
+        "hpx.lcos.collectives.algorithm=tree",
+        "hpx.lcos.collectives.arity=3"};
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
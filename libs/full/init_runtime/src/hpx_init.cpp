@@ -9,6 +9,7 @@
 
 #include <hpx/hpx_init.hpp>
 
+#include <hpx/allocator_support/thread_local_slab_allocator.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/command_line_handling/command_line_handling.hpp>
 #include <hpx/coroutines/detail/context_impl.hpp>
@@ -365,7 +366,10 @@ namespace hpx {
     defined(__FreeBSD__)
             threads::coroutines::detail::posix::use_guard_pages =
                 cms.rtcfg_.use_stack_guard_pages();
+            threads::coroutines::detail::posix::stack_pool_max_size =
+                cms.rtcfg_.get_stack_pool_max_size();
 #endif
+            util::enable_slab_allocator(cms.rtcfg_.use_slab_allocator());
 #ifdef HPX_HAVE_VERIFY_LOCKS
             if (cms.rtcfg_.enable_lock_detection())
             {
@@ -56,6 +56,8 @@ char const* const locality_pool_thread_counter_names[] =
     "/threads/count/stolen-from-staged",
     "/threads/count/stolen-to-pending",
     "/threads/count/stolen-to-staged",
+    "/threads/count/stolen-cross-domain",
+    "/threads/count/remote-memory-executions",
 #endif
     nullptr
 };
@@ -80,6 +82,12 @@ char const* const locality_counter_names[] = {
 #if !defined(HPX_WINDOWS) && !defined(HPX_HAVE_GENERIC_CONTEXT_COROUTINES)
     "/threads/count/stack-unbinds",
 #endif
+#endif
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__)
+    "/threads/count/stack-pool-hits",
+    "/threads/count/stack-pool-misses",
+    "/threads/stack-pool/reserved-size",
 #endif
     "/scheduler/utilization/instantaneous", nullptr};
 
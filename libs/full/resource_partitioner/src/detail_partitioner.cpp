@@ -148,6 +148,12 @@ namespace hpx { namespace resource { namespace detail {
         case resource::shared_priority:
             sched = "shared_priority";
             break;
+        case resource::local_workstealing:
+            sched = "local_workstealing";
+            break;
+        case resource::local_priority_workstealing:
+            sched = "local_priority_workstealing";
+            break;
         }
 
         os << "\"" << sched << "\" is running on PUs : \n";
@@ -466,6 +472,15 @@ namespace hpx { namespace resource { namespace detail {
         {
             default_scheduler = scheduling_policy::shared_priority;
         }
+        else if (0 == std::string("local-workstealing").find(cfg_.queuing_))
+        {
+            default_scheduler = scheduling_policy::local_workstealing;
+        }
+        else if (0 ==
+            std::string("local-priority-workstealing").find(cfg_.queuing_))
+        {
+            default_scheduler = scheduling_policy::local_priority_workstealing;
+        }
         else
         {
             throw hpx::detail::command_line_error(
@@ -82,6 +82,9 @@ namespace hpx { namespace util {
         std::size_t get_agas_local_cache_size(
             std::size_t dflt = HPX_AGAS_LOCAL_CACHE_SIZE) const;
 
+        // Get number of independently locked AGAS client-side cache shards
+        std::size_t get_agas_cache_shards() const;
+
         bool get_agas_caching_mode() const;
 
         bool get_agas_range_caching_mode() const;
@@ -110,8 +113,14 @@ namespace hpx { namespace util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
         bool use_stack_guard_pages() const;
+
+        // maximal number of bytes held by the pool of unused thread stacks
+        std::size_t get_stack_pool_max_size() const;
 #endif
 
+        // Use the per-thread slab allocator for the shared states of futures
+        bool use_slab_allocator() const;
+
         // return trace_depth for stack-backtraces
         std::size_t trace_depth() const;
 
@@ -184,6 +184,9 @@ namespace hpx { namespace util {
             "max_idle_backoff_time = "
             "${HPX_MAX_IDLE_BACKOFF_TIME:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_IDLE_BACKOFF_TIME_MAX)) "}",
+            "idle_park_spin_time = "
+            "${HPX_IDLE_PARK_SPIN_TIME:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_IDLE_PARK_SPIN_TIME)) "}",
 #endif
             "default_scheduler_mode = ${HPX_DEFAULT_SCHEDULER_MODE}",
 
@@ -198,8 +201,16 @@ namespace hpx { namespace util {
             "trace_depth = ${HPX_TRACE_DEPTH:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_HAVE_THREAD_BACKTRACE_DEPTH)) "}",
 
-            // arity for collective operations implemented in a tree fashion
+            // allocate the shared states of futures using the per-thread
+            // slab allocator
+            "[hpx.lcos]",
+            "use_slab_allocator = ${HPX_LCOS_USE_SLAB_ALLOCATOR:1}",
+
+            // arity for collective operations implemented in a tree fashion,
+            // algorithm used by all_reduce and broadcast (flat, tree, or
+            // recursive_doubling)
             "[hpx.lcos.collectives]",
+            "algorithm = ${HPX_LCOS_COLLECTIVES_ALGORITHM:flat}",
             "arity = ${HPX_LCOS_COLLECTIVES_ARITY:32}",
             "cut_off = ${HPX_LCOS_COLLECTIVES_CUT_OFF:-1}",
 
@@ -225,6 +236,7 @@ namespace hpx { namespace util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
+            "pool_max_size = ${HPX_STACK_POOL_MAX_SIZE:67108864}",
 #endif
 
             "[hpx.threadpools]",
@@ -315,11 +327,14 @@ namespace hpx { namespace util {
             "service_mode = hosted",
             "local_cache_size = ${HPX_AGAS_LOCAL_CACHE_SIZE:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_AGAS_LOCAL_CACHE_SIZE)) "}",
+            "local_cache_shards = "
+            "${HPX_AGAS_LOCAL_CACHE_SHARDS:$[hpx.os_threads]}",
             "use_range_caching = ${HPX_AGAS_USE_RANGE_CACHING:1}",
             "use_caching = ${HPX_AGAS_USE_CACHING:1}",
 
             "[hpx.components]",
             "load_external = ${HPX_LOAD_EXTERNAL_COMPONENTS:1}",
+            "heap_cache_size = ${HPX_COMPONENTS_HEAP_CACHE_SIZE:32}",
 
             "[hpx.components.barrier]",
             "name = hpx",
@@ -924,6 +939,25 @@ namespace hpx { namespace util {
         return cache_size;
     }
 
+    std::size_t runtime_configuration::get_agas_cache_shards() const
+    {
+        std::size_t num_shards = get_os_thread_count();
+
+        if (has_section("hpx.agas"))
+        {
+            util::section const* sec = get_section("hpx.agas");
+            if (nullptr != sec)
+            {
+                num_shards = hpx::util::get_entry_as<std::size_t>(
+                    *sec, "local_cache_shards", num_shards);
+            }
+        }
+
+        if (num_shards == 0)
+            num_shards = 1;    // limit lower bound
+        return num_shards;
+    }
+
     bool runtime_configuration::get_agas_caching_mode() const
     {
         if (has_section("hpx.agas"))
@@ -1214,8 +1248,36 @@ namespace hpx { namespace util {
         }
         return true;    // default is true
     }
+
+    std::size_t runtime_configuration::get_stack_pool_max_size() const
+    {
+        if (has_section("hpx.stacks"))
+        {
+            util::section const* sec = get_section("hpx.stacks");
+            if (nullptr != sec)
+            {
+                return hpx::util::get_entry_as<std::size_t>(
+                    *sec, "pool_max_size", 67108864);
+            }
+        }
+        return 67108864;    // default is 64MB
+    }
 #endif
 
+    bool runtime_configuration::use_slab_allocator() const
+    {
+        if (has_section("hpx.lcos"))
+        {
+            util::section const* sec = get_section("hpx.lcos");
+            if (nullptr != sec)
+            {
+                return hpx::util::get_entry_as<int>(
+                           *sec, "use_slab_allocator", 1) != 0;
+            }
+        }
+        return true;    // default is true
+    }
+
     std::ptrdiff_t runtime_configuration::init_small_stack_size() const
     {
         return init_stack_size("small_size",
@@ -0,0 +1,265 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_local/async.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/runtime/naming/id_type.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/vector.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+    ///////////////////////////////////////////////////////////////////////////
+    /// \cond NOINTERNAL
+
+    // A non-empty part of a single segment, together with the id of the
+    // segment. This is passed to other localities to allow for them to
+    // fetch the data directly from the locality owning the segment.
+    template <typename LocalIter>
+    struct segment_range
+    {
+        segment_range() = default;
+
+        segment_range(id_type const& id, LocalIter first, LocalIter last)
+          : id_(id)
+          , first_(first)
+          , last_(last)
+        {
+        }
+
+        std::size_t size() const
+        {
+            return static_cast<std::size_t>(std::distance(first_, last_));
+        }
+
+        id_type id_;
+        LocalIter first_;
+        LocalIter last_;
+
+    private:
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            // clang-format off
+            ar & id_ & first_ & last_;
+            // clang-format on
+        }
+    };
+
+    // Collect all non-empty segment parts referenced by [first, last)
+    template <typename SegIter>
+    std::vector<segment_range<
+        typename hpx::traits::segmented_iterator_traits<SegIter>::local_iterator>>
+    get_segment_ranges(SegIter first, SegIter last)
+    {
+        typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+        typedef typename traits::segment_iterator segment_iterator;
+        typedef typename traits::local_iterator local_iterator_type;
+
+        std::vector<segment_range<local_iterator_type>> ranges;
+        if (first == last)
+            return ranges;
+
+        segment_iterator sit = traits::segment(first);
+        segment_iterator send = traits::segment(last);
+
+        if (sit == send)
+        {
+            // all elements are on the same partition
+            local_iterator_type beg = traits::local(first);
+            local_iterator_type end = traits::local(last);
+            if (beg != end)
+                ranges.emplace_back(traits::get_id(sit), beg, end);
+        }
+        else
+        {
+            // handle the remaining part of the first partition
+            local_iterator_type beg = traits::local(first);
+            local_iterator_type end = traits::end(sit);
+            if (beg != end)
+                ranges.emplace_back(traits::get_id(sit), beg, end);
+
+            // handle all of the full partitions
+            for (++sit; sit != send; ++sit)
+            {
+                beg = traits::begin(sit);
+                end = traits::end(sit);
+                if (beg != end)
+                    ranges.emplace_back(traits::get_id(sit), beg, end);
+            }
+
+            // handle the beginning of the last partition
+            beg = traits::begin(sit);
+            end = traits::local(last);
+            if (beg != end)
+                ranges.emplace_back(traits::get_id(sit), beg, end);
+        }
+
+        return ranges;
+    }
+
+    // Wait for all given per-segment operations and return their results,
+    // rethrowing any (remote) exceptions.
+    template <typename ExPolicy, typename T>
+    std::vector<T> get_segment_results(std::vector<future<T>>&& workitems)
+    {
+        hpx::wait_all(workitems);
+
+        std::list<std::exception_ptr> errors;
+        util::detail::handle_remote_exceptions<ExPolicy>::call(
+            workitems, errors);
+
+        std::vector<T> results;
+        results.reserve(workitems.size());
+        for (future<T>& f : workitems)
+            results.push_back(f.get());
+
+        return results;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Copy the elements of a local range into a vector, this is used to move
+    // the data of (part of) a segment to a different locality in one go.
+    template <typename T>
+    struct seg_gather : public detail::algorithm<seg_gather<T>, std::vector<T>>
+    {
+        seg_gather()
+          : seg_gather::algorithm("gather")
+        {
+        }
+
+        template <typename ExPolicy, typename InIter>
+        static std::vector<T> sequential(ExPolicy, InIter first, InIter last)
+        {
+            return std::vector<T>(first, last);
+        }
+
+        template <typename ExPolicy, typename InIter>
+        static typename util::detail::algorithm_result<ExPolicy,
+            std::vector<T>>::type
+        parallel(ExPolicy&& policy, InIter first, InIter last)
+        {
+            return util::detail::algorithm_result<ExPolicy,
+                std::vector<T>>::get(sequential(policy, first, last));
+        }
+    };
+
+    // Fetch the data referenced by the given segment ranges and concatenate
+    // it. All ranges are requested concurrently from the owning localities.
+    template <typename T, typename LocalIter>
+    std::vector<T> gather_segment_ranges(
+        std::vector<segment_range<LocalIter>> const& ranges)
+    {
+        std::vector<future<std::vector<T>>> parts;
+        parts.reserve(ranges.size());
+
+        std::size_t count = 0;
+        for (segment_range<LocalIter> const& r : ranges)
+        {
+            parts.push_back(dispatch_async(r.id_, seg_gather<T>(),
+                hpx::execution::seq, std::true_type(), r.first_, r.last_));
+            count += r.size();
+        }
+
+        std::vector<T> data;
+        data.reserve(count);
+        for (std::vector<T>& part :
+            get_segment_results<hpx::execution::sequenced_policy>(
+                std::move(parts)))
+        {
+            std::move(part.begin(), part.end(), std::back_inserter(data));
+        }
+        return data;
+    }
+
+    // Overwrite a local range with the data referenced by the given segment
+    // ranges. The data is pulled by the locality owning the local range.
+    template <typename Iter>
+    struct seg_pull : public detail::algorithm<seg_pull<Iter>, Iter>
+    {
+        seg_pull()
+          : seg_pull::algorithm("pull")
+        {
+        }
+
+        template <typename ExPolicy, typename FwdIter, typename LocalIter>
+        static FwdIter sequential(ExPolicy, FwdIter first, FwdIter last,
+            std::vector<segment_range<LocalIter>> const& ranges)
+        {
+            typedef typename std::iterator_traits<FwdIter>::value_type
+                value_type;
+
+            std::vector<value_type> data =
+                gather_segment_ranges<value_type>(ranges);
+
+            HPX_ASSERT(static_cast<std::ptrdiff_t>(data.size()) ==
+                std::distance(first, last));
+            HPX_UNUSED(last);
+
+            return std::move(data.begin(), data.end(), first);
+        }
+
+        template <typename ExPolicy, typename FwdIter, typename LocalIter>
+        static typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+        parallel(ExPolicy&& policy, FwdIter first, FwdIter last,
+            std::vector<segment_range<LocalIter>> const& ranges)
+        {
+            return util::detail::algorithm_result<ExPolicy, FwdIter>::get(
+                sequential(policy, first, last, ranges));
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The segmented algorithms which need to exchange data between segments
+    // are implemented as a sequence of blocking steps. Run those directly or
+    // on a new HPX thread, depending on whether the policy is asynchronous.
+    template <typename R, typename F>
+    R execute_segmented_helper(std::false_type, F&& f)
+    {
+        return f();
+    }
+
+    template <typename R, typename F>
+    hpx::future<R> execute_segmented_helper(std::true_type, F&& f)
+    {
+        return hpx::async(std::forward<F>(f));
+    }
+
+    template <typename ExPolicy, typename R, typename F>
+    typename util::detail::algorithm_result<ExPolicy, R>::type
+    execute_segmented(F&& f)
+    {
+        using is_async = hpx::is_async_execution_policy<ExPolicy>;
+
+        return util::detail::algorithm_result<ExPolicy, R>::get(
+            execute_segmented_helper<R>(is_async(), std::forward<F>(f)));
+    }
+
+    /// \endcond
+}}}}    // namespace hpx::parallel::v1::detail
@@ -0,0 +1,172 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/futures/future.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/equal.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/exchange.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_equal
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // Compare a local part of the first sequence with the corresponding
+        // elements of the second sequence. Those are fetched from their
+        // owning localities (which usually is the current locality as well).
+        template <typename T>
+        struct seg_equal : public detail::algorithm<seg_equal<T>, bool>
+        {
+            seg_equal()
+              : seg_equal::algorithm("equal")
+            {
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename LocalIter,
+                typename F, typename Proj1, typename Proj2>
+            static bool sequential(ExPolicy, FwdIter first, FwdIter last,
+                std::vector<segment_range<LocalIter>> const& ranges, F&& f,
+                Proj1&& proj1, Proj2&& proj2)
+            {
+                std::vector<T> data = gather_segment_ranges<T>(ranges);
+                return sequential_equal_binary(first, last, data.begin(),
+                    data.end(), std::forward<F>(f), std::forward<Proj1>(proj1),
+                    std::forward<Proj2>(proj2));
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename LocalIter,
+                typename F, typename Proj1, typename Proj2>
+            static typename util::detail::algorithm_result<ExPolicy, bool>::type
+            parallel(ExPolicy&&, FwdIter first, FwdIter last,
+                std::vector<segment_range<LocalIter>> const& ranges, F&& f,
+                Proj1&& proj1, Proj2&& proj2)
+            {
+                // the fetched data has to outlive the comparison, so this
+                // does not return before the comparison is done
+                std::vector<T> data = gather_segment_ranges<T>(ranges);
+                return util::detail::algorithm_result<ExPolicy, bool>::get(
+                    equal_binary().call(hpx::execution::par, std::false_type(),
+                        first, last, data.begin(), data.end(),
+                        std::forward<F>(f), std::forward<Proj1>(proj1),
+                        std::forward<Proj2>(proj2)));
+            }
+        };
+
+        // Compare [first1, last1) with the sequence of the same length
+        // starting at first2. The elements of the first sequence are compared
+        // on the locality owning them.
+        template <typename ExPolicy, typename SegIter1, typename SegIter2,
+            typename F, typename Proj1, typename Proj2>
+        bool segmented_equal(ExPolicy const& policy, SegIter1 first1,
+            SegIter1 last1, SegIter2 first2, F const& f, Proj1 const& proj1,
+            Proj2 const& proj2)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter1> traits1;
+            typedef typename traits1::local_iterator local_iterator_type1;
+            typedef typename std::iterator_traits<SegIter2>::value_type
+                value_type2;
+            typedef typename std::iterator_traits<SegIter2>::difference_type
+                difference_type2;
+            typedef hpx::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+            std::vector<segment_range<local_iterator_type1>> ranges =
+                get_segment_ranges(first1, last1);
+
+            std::vector<future<bool>> segments;
+            segments.reserve(ranges.size());
+
+            for (auto const& r : ranges)
+            {
+                SegIter2 last2 = std::next(first2, difference_type2(r.size()));
+                segments.push_back(dispatch_async(r.id_,
+                    seg_equal<value_type2>(), policy, is_seq(), r.first_,
+                    r.last_, get_segment_ranges(first2, last2), f, proj1,
+                    proj2));
+                first2 = last2;
+            }
+
+            std::vector<bool> results =
+                get_segment_results<ExPolicy>(std::move(segments));
+
+            return std::all_of(results.begin(), results.end(),
+                [](bool val) { return val; });
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+            typename F, typename Proj1, typename Proj2>
+        typename util::detail::algorithm_result<ExPolicy, bool>::type
+        equal_binary_(ExPolicy&& policy, FwdIter1 first1, FwdIter1 last1,
+            FwdIter2 first2, FwdIter2 last2, F&& f, Proj1&& proj1,
+            Proj2&& proj2, std::true_type)
+        {
+            typedef util::detail::algorithm_result<ExPolicy, bool> result;
+
+            if (std::distance(first1, last1) != std::distance(first2, last2))
+                return result::get(false);
+
+            if (first1 == last1)
+                return result::get(true);
+
+            typedef typename std::decay<ExPolicy>::type policy_type;
+            typedef typename std::decay<F>::type function_type;
+            typedef typename std::decay<Proj1>::type proj1_type;
+            typedef typename std::decay<Proj2>::type proj2_type;
+
+            return execute_segmented<policy_type, bool>(
+                [policy, first1, last1, first2, f = function_type(f),
+                    proj1 = proj1_type(proj1),
+                    proj2 = proj2_type(proj2)]() -> bool {
+                    return segmented_equal(
+                        policy, first1, last1, first2, f, proj1, proj2);
+                });
+        }
+
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+            typename F>
+        typename util::detail::algorithm_result<ExPolicy, bool>::type
+        equal_(ExPolicy&& policy, FwdIter1 first1, FwdIter1 last1,
+            FwdIter2 first2, F&& f, std::true_type)
+        {
+            typedef util::detail::algorithm_result<ExPolicy, bool> result;
+
+            if (first1 == last1)
+                return result::get(true);
+
+            typedef typename std::decay<ExPolicy>::type policy_type;
+            typedef typename std::decay<F>::type function_type;
+
+            return execute_segmented<policy_type, bool>(
+                [policy, first1, last1, first2,
+                    f = function_type(f)]() -> bool {
+                    return segmented_equal(policy, first1, last1, first2, f,
+                        util::projection_identity(),
+                        util::projection_identity());
+                });
+        }
+
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
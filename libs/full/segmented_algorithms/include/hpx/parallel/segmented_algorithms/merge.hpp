@@ -0,0 +1,238 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/async_local/async.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/futures/future.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/merge.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/exchange.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_merge
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // Fill a local part of the destination sequence by merging the
+        // corresponding parts of both input sequences. Those are fetched
+        // from their owning localities by the locality owning the
+        // destination.
+        template <typename Iter>
+        struct seg_merge : public detail::algorithm<seg_merge<Iter>, Iter>
+        {
+            seg_merge()
+              : seg_merge::algorithm("merge")
+            {
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename LocalIter1,
+                typename LocalIter2, typename Comp, typename Proj1,
+                typename Proj2>
+            static FwdIter sequential(ExPolicy, FwdIter first, FwdIter,
+                std::vector<segment_range<LocalIter1>> const& ranges1,
+                std::vector<segment_range<LocalIter2>> const& ranges2,
+                Comp&& comp, Proj1&& proj1, Proj2&& proj2)
+            {
+                typedef typename std::iterator_traits<LocalIter1>::value_type
+                    value_type1;
+                typedef typename std::iterator_traits<LocalIter2>::value_type
+                    value_type2;
+
+                hpx::future<std::vector<value_type1>> f1 =
+                    hpx::async([&ranges1]() {
+                        return gather_segment_ranges<value_type1>(ranges1);
+                    });
+                std::vector<value_type2> data2 =
+                    gather_segment_ranges<value_type2>(ranges2);
+                std::vector<value_type1> data1 = f1.get();
+
+                return sequential_merge(data1.begin(), data1.end(),
+                    data2.begin(), data2.end(), first, std::forward<Comp>(comp),
+                    std::forward<Proj1>(proj1), std::forward<Proj2>(proj2))
+                    .out;
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename LocalIter1,
+                typename LocalIter2, typename Comp, typename Proj1,
+                typename Proj2>
+            static typename util::detail::algorithm_result<ExPolicy,
+                FwdIter>::type
+            parallel(ExPolicy&& policy, FwdIter first, FwdIter last,
+                std::vector<segment_range<LocalIter1>> const& ranges1,
+                std::vector<segment_range<LocalIter2>> const& ranges2,
+                Comp&& comp, Proj1&& proj1, Proj2&& proj2)
+            {
+                return util::detail::algorithm_result<ExPolicy, FwdIter>::get(
+                    sequential(policy, first, last, ranges1, ranges2,
+                        std::forward<Comp>(comp), std::forward<Proj1>(proj1),
+                        std::forward<Proj2>(proj2)));
+            }
+        };
+
+        // Find the number of elements of the first sequence which are among
+        // the first 'count' elements of the merged sequence (merge path).
+        // This reads O(log(count)) elements of both input sequences.
+        template <typename SegIter1, typename SegIter2, typename Comp,
+            typename Proj1, typename Proj2>
+        std::size_t segmented_merge_path(SegIter1 first1, std::size_t size1,
+            SegIter2 first2, std::size_t size2, std::size_t count,
+            Comp const& comp, Proj1 const& proj1, Proj2 const& proj2)
+        {
+            typedef typename std::iterator_traits<SegIter1>::value_type
+                value_type1;
+            typedef typename std::iterator_traits<SegIter2>::value_type
+                value_type2;
+
+            std::size_t low = count > size2 ? count - size2 : 0;
+            std::size_t high = (std::min)(count, size1);
+
+            while (low < high)
+            {
+                std::size_t mid = low + (high - low) / 2;
+
+                value_type1 val1 = *std::next(first1, mid);
+                value_type2 val2 = *std::next(first2, count - mid - 1);
+
+                if (hpx::util::invoke(comp, hpx::util::invoke(proj2, val2),
+                        hpx::util::invoke(proj1, val1)))
+                {
+                    high = mid;
+                }
+                else
+                {
+                    low = mid + 1;
+                }
+            }
+            return low;
+        }
+
+        // Each segment of the destination sequence is filled by its owning
+        // locality, which fetches the required parts of both input sequences
+        // directly. The caller only determines the split points.
+        template <typename ExPolicy, typename SegIter1, typename SegIter2,
+            typename SegIter3, typename Comp, typename Proj1, typename Proj2>
+        util::in_in_out_result<SegIter1, SegIter2, SegIter3> segmented_merge(
+            ExPolicy const& policy, SegIter1 first1, SegIter1 last1,
+            SegIter2 first2, SegIter2 last2, SegIter3 dest, Comp const& comp,
+            Proj1 const& proj1, Proj2 const& proj2)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter3> traits3;
+            typedef typename traits3::local_iterator local_iterator_type3;
+            typedef hpx::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+            std::size_t const size1 = std::distance(first1, last1);
+            std::size_t const size2 = std::distance(first2, last2);
+
+            SegIter3 last3 = std::next(dest, size1 + size2);
+
+            std::vector<segment_range<local_iterator_type3>> ranges =
+                get_segment_ranges(dest, last3);
+
+            // determine the split points of the input sequences for the
+            // boundaries of all destination segments
+            std::vector<std::size_t> offsets(ranges.size() + 1);
+            offsets.back() = size1;
+            {
+                std::vector<future<std::size_t>> splits;
+                splits.reserve(ranges.size() - 1);
+
+                std::size_t count = 0;
+                for (std::size_t i = 0; i + 1 < ranges.size(); ++i)
+                {
+                    count += ranges[i].size();
+                    splits.push_back(hpx::async([=, &comp, &proj1, &proj2]() {
+                        return segmented_merge_path(first1, size1, first2,
+                            size2, count, comp, proj1, proj2);
+                    }));
+                }
+
+                std::vector<std::size_t> results =
+                    get_segment_results<ExPolicy>(std::move(splits));
+                std::copy(results.begin(), results.end(), offsets.begin() + 1);
+            }
+
+            std::vector<future<local_iterator_type3>> segments;
+            segments.reserve(ranges.size());
+
+            std::size_t count = 0;
+            for (std::size_t i = 0; i != ranges.size(); ++i)
+            {
+                std::size_t next_count = count + ranges[i].size();
+
+                SegIter1 beg1 = std::next(first1, offsets[i]);
+                SegIter1 end1 = std::next(first1, offsets[i + 1]);
+                SegIter2 beg2 = std::next(first2, count - offsets[i]);
+                SegIter2 end2 = std::next(first2, next_count - offsets[i + 1]);
+
+                segments.push_back(dispatch_async(ranges[i].id_,
+                    seg_merge<local_iterator_type3>(), policy, is_seq(),
+                    ranges[i].first_, ranges[i].last_,
+                    get_segment_ranges(beg1, end1),
+                    get_segment_ranges(beg2, end2), comp, proj1, proj2));
+
+                count = next_count;
+            }
+
+            get_segment_results<ExPolicy>(std::move(segments));
+
+            return util::in_in_out_result<SegIter1, SegIter2, SegIter3>{
+                last1, last2, last3};
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename RandIter1, typename RandIter2,
+            typename RandIter3, typename Comp, typename Proj1, typename Proj2>
+        typename util::detail::algorithm_result<ExPolicy,
+            util::in_in_out_result<RandIter1, RandIter2, RandIter3>>::type
+        merge_(ExPolicy&& policy, RandIter1 first1, RandIter1 last1,
+            RandIter2 first2, RandIter2 last2, RandIter3 dest, Comp&& comp,
+            Proj1&& proj1, Proj2&& proj2, std::true_type)
+        {
+            typedef util::in_in_out_result<RandIter1, RandIter2, RandIter3>
+                result_type;
+
+            if (first1 == last1 && first2 == last2)
+            {
+                return util::detail::algorithm_result<ExPolicy,
+                    result_type>::get(result_type{last1, last2, dest});
+            }
+
+            typedef typename std::decay<ExPolicy>::type policy_type;
+            typedef typename std::decay<Comp>::type compare_type;
+            typedef typename std::decay<Proj1>::type proj1_type;
+            typedef typename std::decay<Proj2>::type proj2_type;
+
+            return execute_segmented<policy_type, result_type>(
+                [policy, first1, last1, first2, last2, dest,
+                    comp = compare_type(comp), proj1 = proj1_type(proj1),
+                    proj2 = proj2_type(proj2)]() -> result_type {
+                    return segmented_merge(policy, first1, last1, first2,
+                        last2, dest, comp, proj1, proj2);
+                });
+        }
+
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
@@ -0,0 +1,277 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/async_local/async.hpp>
+#include <hpx/futures/future.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/exchange.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_sort
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // Sort a single segment, this forwards to the non-segmented sort
+        template <typename Iter>
+        struct sort_segment : public detail::algorithm<sort_segment<Iter>, Iter>
+        {
+            sort_segment()
+              : sort_segment::algorithm("sort_segment")
+            {
+            }
+
+            template <typename ExPolicy, typename RandomIt, typename Compare,
+                typename Proj>
+            static RandomIt sequential(ExPolicy&& policy, RandomIt first,
+                RandomIt last, Compare&& comp, Proj&& proj)
+            {
+                return detail::sort<RandomIt>::sequential(
+                    std::forward<ExPolicy>(policy), first, last,
+                    std::forward<Compare>(comp), std::forward<Proj>(proj));
+            }
+
+            template <typename ExPolicy, typename RandomIt, typename Compare,
+                typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                RandomIt>::type
+            parallel(ExPolicy&& policy, RandomIt first, RandomIt last,
+                Compare&& comp, Proj&& proj)
+            {
+                return detail::sort<RandomIt>::parallel(
+                    std::forward<ExPolicy>(policy), first, last,
+                    std::forward<Compare>(comp), std::forward<Proj>(proj));
+            }
+        };
+
+        // Replace either the largest or the smallest elements of a sorted
+        // segment with the given (sorted) values and restore the order.
+        template <typename Iter>
+        struct sort_merge_split
+          : public detail::algorithm<sort_merge_split<Iter>, Iter>
+        {
+            sort_merge_split()
+              : sort_merge_split::algorithm("sort_merge_split")
+            {
+            }
+
+            template <typename ExPolicy, typename RandomIt, typename T,
+                typename Compare, typename Proj>
+            static RandomIt sequential(ExPolicy, RandomIt first, RandomIt last,
+                std::vector<T> const& data, bool replace_largest,
+                Compare&& comp, Proj&& proj)
+            {
+                typedef typename std::iterator_traits<RandomIt>::difference_type
+                    difference_type;
+
+                difference_type count = difference_type(data.size());
+                RandomIt middle = replace_largest ? last - count : first + count;
+
+                std::copy(data.begin(), data.end(),
+                    replace_largest ? middle : first);
+                std::inplace_merge(first, middle, last,
+                    util::compare_projected<Compare, Proj>(
+                        std::forward<Compare>(comp), std::forward<Proj>(proj)));
+
+                return last;
+            }
+
+            template <typename ExPolicy, typename RandomIt, typename T,
+                typename Compare, typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                RandomIt>::type
+            parallel(ExPolicy&& policy, RandomIt first, RandomIt last,
+                std::vector<T> const& data, bool replace_largest,
+                Compare&& comp, Proj&& proj)
+            {
+                return util::detail::algorithm_result<ExPolicy, RandomIt>::get(
+                    sequential(policy, first, last, data, replace_largest,
+                        std::forward<Compare>(comp), std::forward<Proj>(proj)));
+            }
+        };
+
+        // Merge-split two neighboring sorted segments: afterwards the left
+        // segment holds the smallest and the right segment the largest
+        // elements of both. Only the elements which have to change sides are
+        // transferred. Returns whether any elements were exchanged.
+        template <typename ExPolicy, typename LocalIter, typename Compare,
+            typename Proj>
+        bool segmented_sort_exchange(ExPolicy const& policy,
+            segment_range<LocalIter> const& left,
+            segment_range<LocalIter> const& right, Compare const& comp,
+            Proj const& proj)
+        {
+            typedef typename std::iterator_traits<LocalIter>::value_type
+                value_type;
+            typedef typename std::iterator_traits<LocalIter>::difference_type
+                difference_type;
+            typedef hpx::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+            util::compare_projected<Compare const&, Proj const&> less(
+                comp, proj);
+
+            // Find the number of elements k to exchange: the k largest
+            // elements of the left segment are greater than the k smallest
+            // elements of the right one. The boundary data is fetched in
+            // chunks of growing size until k is known.
+            std::size_t const size = (std::min)(left.size(), right.size());
+
+            std::vector<value_type> largest, smallest;
+            std::size_t count = 0;
+            for (std::size_t chunk = 1; /**/; chunk *= 2)
+            {
+                chunk = (std::min)(chunk, size);
+
+                future<std::vector<value_type>> f1 = dispatch_async(left.id_,
+                    seg_gather<value_type>(), hpx::execution::seq,
+                    std::true_type(), left.last_ - difference_type(chunk),
+                    left.last_);
+                future<std::vector<value_type>> f2 = dispatch_async(right.id_,
+                    seg_gather<value_type>(), hpx::execution::seq,
+                    std::true_type(), right.first_,
+                    right.first_ + difference_type(chunk));
+
+                largest = f1.get();
+                smallest = f2.get();
+
+                while (count != chunk &&
+                    less(smallest[count], largest[chunk - count - 1]))
+                {
+                    ++count;
+                }
+
+                if (count != chunk || chunk == size)
+                    break;
+            }
+
+            if (count == 0)
+                return false;
+
+            std::vector<future<LocalIter>> segments;
+            segments.reserve(2);
+
+            segments.push_back(dispatch_async(left.id_,
+                sort_merge_split<LocalIter>(), policy, is_seq(), left.first_,
+                left.last_,
+                std::vector<value_type>(
+                    smallest.begin(), smallest.begin() + count),
+                true, comp, proj));
+            segments.push_back(dispatch_async(right.id_,
+                sort_merge_split<LocalIter>(), policy, is_seq(), right.first_,
+                right.last_,
+                std::vector<value_type>(largest.end() - count, largest.end()),
+                false, comp, proj));
+
+            get_segment_results<ExPolicy>(std::move(segments));
+            return true;
+        }
+
+        // The segmented sort first sorts all segments on their localities
+        // and then runs merge-split steps between neighboring segments
+        // (odd-even transposition sort on whole segments) until all segment
+        // boundaries are in order.
+        template <typename ExPolicy, typename SegIter, typename Compare,
+            typename Proj>
+        SegIter segmented_sort(ExPolicy const& policy, SegIter first,
+            SegIter last, Compare const& comp, Proj const& proj)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef hpx::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+            std::vector<segment_range<local_iterator_type>> ranges =
+                get_segment_ranges(first, last);
+
+            // sort all segments locally
+            {
+                std::vector<future<local_iterator_type>> segments;
+                segments.reserve(ranges.size());
+
+                for (auto const& r : ranges)
+                {
+                    segments.push_back(dispatch_async(r.id_,
+                        sort_segment<local_iterator_type>(), policy, is_seq(),
+                        r.first_, r.last_, comp, proj));
+                }
+
+                get_segment_results<ExPolicy>(std::move(segments));
+            }
+
+            // exchange the elements between neighboring segments, alternating
+            // between even and odd pairs
+            std::size_t const count = ranges.size();
+            for (bool exchanged = count > 1; exchanged; /**/)
+            {
+                exchanged = false;
+                for (std::size_t phase = 0; phase != 2; ++phase)
+                {
+                    std::vector<future<bool>> pairs;
+                    pairs.reserve(count / 2);
+
+                    for (std::size_t i = phase; i + 1 < count; i += 2)
+                    {
+                        pairs.push_back(hpx::async([&, i]() -> bool {
+                            return segmented_sort_exchange(
+                                policy, ranges[i], ranges[i + 1], comp, proj);
+                        }));
+                    }
+
+                    for (bool b :
+                        get_segment_results<ExPolicy>(std::move(pairs)))
+                    {
+                        exchanged = exchanged || b;
+                    }
+                }
+            }
+
+            return last;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+        sort_(ExPolicy&& policy, RandomIt first, RandomIt last, Compare&& comp,
+            Proj&& proj, std::true_type)
+        {
+            typedef util::detail::algorithm_result<ExPolicy, RandomIt> result;
+
+            if (first == last)
+                return result::get(std::move(last));
+
+            typedef typename std::decay<ExPolicy>::type policy_type;
+            typedef typename std::decay<Compare>::type compare_type;
+            typedef typename std::decay<Proj>::type proj_type;
+
+            return execute_segmented<policy_type, RandomIt>(
+                [policy, first, last, comp = compare_type(comp),
+                    proj = proj_type(proj)]() -> RandomIt {
+                    return segmented_sort(policy, first, last, comp, proj);
+                });
+        }
+
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
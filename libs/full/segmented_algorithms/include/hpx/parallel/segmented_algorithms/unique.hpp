@@ -0,0 +1,193 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/futures/future.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/unique.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/exchange.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_unique
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // The segmented unique first removes the duplicates inside of each
+        // segment on the owning locality. Afterwards the first remaining
+        // element of a segment is dropped if it is equivalent to the last
+        // remaining element of the preceding segments. Finally, all remaining
+        // elements are moved to the front of the sequence.
+        template <typename ExPolicy, typename SegIter, typename Pred,
+            typename Proj>
+        SegIter segmented_unique(ExPolicy const& policy, SegIter first,
+            SegIter last, Pred const& pred, Proj const& proj)
+        {
+            typedef hpx::traits::segmented_iterator_traits<SegIter> traits;
+            typedef typename traits::local_iterator local_iterator_type;
+            typedef typename std::iterator_traits<SegIter>::value_type
+                value_type;
+            typedef typename std::iterator_traits<
+                local_iterator_type>::difference_type difference_type;
+            typedef hpx::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+            std::vector<segment_range<local_iterator_type>> ranges =
+                get_segment_ranges(first, last);
+
+            // remove the duplicates inside of each segment
+            {
+                std::vector<future<local_iterator_type>> segments;
+                segments.reserve(ranges.size());
+
+                for (auto const& r : ranges)
+                {
+                    segments.push_back(dispatch_async(r.id_,
+                        unique<local_iterator_type>(), policy, is_seq(),
+                        r.first_, r.last_, pred, proj));
+                }
+
+                std::vector<local_iterator_type> results =
+                    get_segment_results<ExPolicy>(std::move(segments));
+
+                for (std::size_t i = 0; i != ranges.size(); ++i)
+                    ranges[i].last_ = results[i];
+            }
+
+            // fetch the first and the last remaining element of each segment
+            // (segments are never empty at this point)
+            std::vector<future<std::vector<value_type>>> boundaries;
+            boundaries.reserve(2 * ranges.size());
+
+            for (auto const& r : ranges)
+            {
+                boundaries.push_back(dispatch_async(r.id_,
+                    seg_gather<value_type>(), hpx::execution::seq,
+                    std::true_type(), r.first_, r.first_ + 1));
+                boundaries.push_back(dispatch_async(r.id_,
+                    seg_gather<value_type>(), hpx::execution::seq,
+                    std::true_type(), r.last_ - 1, r.last_));
+            }
+
+            std::vector<std::vector<value_type>> values =
+                get_segment_results<ExPolicy>(std::move(boundaries));
+
+            // drop the leading elements which duplicate the preceding
+            // segments and determine the ranges of the remaining elements
+            std::vector<segment_range<local_iterator_type>> sources;
+            sources.reserve(ranges.size());
+
+            std::size_t count = 0;
+            value_type const* prev = nullptr;
+            for (std::size_t i = 0; i != ranges.size(); ++i)
+            {
+                segment_range<local_iterator_type> r = ranges[i];
+                if (prev != nullptr &&
+                    hpx::util::invoke(pred, hpx::util::invoke(proj, *prev),
+                        hpx::util::invoke(proj, values[2 * i][0])))
+                {
+                    ++r.first_;
+                }
+
+                if (r.first_ != r.last_)
+                {
+                    prev = &values[2 * i + 1][0];
+                    count += r.size();
+                    sources.push_back(r);
+                }
+            }
+
+            // move the remaining elements to the front, segment by segment.
+            // The elements are only moved towards the front of the sequence,
+            // thus each step reads data which has not been overwritten yet.
+            SegIter dest_last = std::next(first, count);
+            std::vector<segment_range<local_iterator_type>> dests =
+                get_segment_ranges(first, dest_last);
+
+            auto src = sources.begin();
+            difference_type offset = 0;
+            for (auto const& d : dests)
+            {
+                std::vector<segment_range<local_iterator_type>> parts;
+
+                std::size_t size = d.size();
+                while (size != 0)
+                {
+                    difference_type avail =
+                        difference_type(src->size()) - offset;
+                    difference_type part =
+                        (std::min)(avail, difference_type(size));
+
+                    parts.emplace_back(src->id_, src->first_ + offset,
+                        src->first_ + offset + part);
+
+                    size -= std::size_t(part);
+                    offset += part;
+                    if (offset == difference_type(src->size()))
+                    {
+                        ++src;
+                        offset = 0;
+                    }
+                }
+
+                // nothing to do if the elements are in place already
+                if (parts.size() == 1 && parts[0].id_ == d.id_ &&
+                    parts[0].first_ == d.first_)
+                {
+                    continue;
+                }
+
+                future<local_iterator_type> f = dispatch_async(d.id_,
+                    seg_pull<local_iterator_type>(), policy, is_seq(),
+                    d.first_, d.last_, std::move(parts));
+                f.get();
+            }
+
+            return dest_last;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // segmented implementation
+        template <typename ExPolicy, typename FwdIter, typename Pred,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+        unique_(ExPolicy&& policy, FwdIter first, FwdIter last, Pred&& pred,
+            Proj&& proj, std::true_type)
+        {
+            typedef util::detail::algorithm_result<ExPolicy, FwdIter> result;
+
+            if (first == last)
+                return result::get(std::move(last));
+
+            typedef typename std::decay<ExPolicy>::type policy_type;
+            typedef typename std::decay<Pred>::type pred_type;
+            typedef typename std::decay<Proj>::type proj_type;
+
+            return execute_segmented<policy_type, FwdIter>(
+                [policy, first, last, pred = pred_type(pred),
+                    proj = proj_type(proj)]() -> FwdIter {
+                    return segmented_unique(policy, first, last, pred, proj);
+                });
+        }
+
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
@@ -0,0 +1,123 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_equal.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/parallel/segmented_algorithms/equal.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double);
+// HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void fill_vector(hpx::partitioned_vector<T>& v)
+{
+    std::size_t i = 0;
+    typename hpx::partitioned_vector<T>::iterator it = v.begin(), end = v.end();
+    for (/**/; it != end; ++it, ++i)
+        *it = T(i);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename DistPolicy1, typename DistPolicy2,
+    typename ExPolicy>
+void equal_algo_tests_with_policy(std::size_t size,
+    DistPolicy1 const& dist_policy1, DistPolicy2 const& dist_policy2,
+    ExPolicy const& policy)
+{
+    hpx::partitioned_vector<T> v1(size, dist_policy1);
+    fill_vector(v1);
+
+    hpx::partitioned_vector<T> v2(size, dist_policy2);
+    fill_vector(v2);
+
+    HPX_TEST(hpx::equal(policy, v1.begin(), v1.end(), v2.begin()));
+    HPX_TEST(hpx::equal(policy, v1.begin(), v1.end(), v2.begin(), v2.end()));
+    HPX_TEST(!hpx::equal(
+        policy, v1.begin(), v1.end(), v2.begin(), v2.end() - 1));
+
+    // compare shifted sequences
+    HPX_TEST(
+        !hpx::equal(policy, v1.begin() + 1, v1.end(), v2.begin(), v2.end() - 1));
+
+    v2[size / 2] = T(size);
+    HPX_TEST(!hpx::equal(policy, v1.begin(), v1.end(), v2.begin()));
+    HPX_TEST(!hpx::equal(policy, v1.begin(), v1.end(), v2.begin(), v2.end()));
+    HPX_TEST(hpx::equal(
+        policy, v1.begin(), v1.begin() + size / 2, v2.begin(), v2.begin() + size / 2));
+}
+
+template <typename T, typename DistPolicy1, typename DistPolicy2,
+    typename ExPolicy>
+void equal_algo_tests_with_policy_async(std::size_t size,
+    DistPolicy1 const& dist_policy1, DistPolicy2 const& dist_policy2,
+    ExPolicy const& policy)
+{
+    hpx::partitioned_vector<T> v1(size, dist_policy1);
+    fill_vector(v1);
+
+    hpx::partitioned_vector<T> v2(size, dist_policy2);
+    fill_vector(v2);
+
+    using hpx::execution::task;
+
+    auto f1 = hpx::equal(policy(task), v1.begin(), v1.end(), v2.begin());
+    HPX_TEST(f1.get());
+
+    v2[size - 1] = T(size);
+    auto f2 = hpx::equal(
+        policy(task), v1.begin(), v1.end(), v2.begin(), v2.end());
+    HPX_TEST(!f2.get());
+}
+
+template <typename T, typename DistPolicy1, typename DistPolicy2>
+void equal_tests_with_policy(std::size_t size, DistPolicy1 const& dist_policy1,
+    DistPolicy2 const& dist_policy2)
+{
+    using namespace hpx::execution;
+
+    equal_algo_tests_with_policy<T>(size, dist_policy1, dist_policy2, seq);
+    equal_algo_tests_with_policy<T>(size, dist_policy1, dist_policy2, par);
+
+    equal_algo_tests_with_policy_async<T>(
+        size, dist_policy1, dist_policy2, seq);
+    equal_algo_tests_with_policy_async<T>(
+        size, dist_policy1, dist_policy2, par);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void equal_tests()
+{
+    std::size_t const length = 1000;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    equal_tests_with_policy<T>(
+        length, hpx::container_layout, hpx::container_layout);
+    equal_tests_with_policy<T>(
+        length, hpx::container_layout(3), hpx::container_layout(3));
+    equal_tests_with_policy<T>(length, hpx::container_layout(3, localities),
+        hpx::container_layout(localities));
+    equal_tests_with_policy<T>(length, hpx::container_layout(localities),
+        hpx::container_layout(5, localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    equal_tests<double>();
+    equal_tests<int>();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,136 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_merge.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/parallel/segmented_algorithms/merge.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double);
+// HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> fill_vector(
+    hpx::partitioned_vector<T>& v, std::size_t step, std::size_t offset)
+{
+    std::vector<T> expected;
+    expected.reserve(v.size());
+
+    std::size_t i = 0;
+    typename hpx::partitioned_vector<T>::iterator it = v.begin(), end = v.end();
+    for (/**/; it != end; ++it, ++i)
+    {
+        T val = T(i * step + offset);
+        *it = val;
+        expected.push_back(val);
+    }
+    return expected;
+}
+
+template <typename T>
+void compare_vectors(
+    hpx::partitioned_vector<T> const& v, std::vector<T> const& expected)
+{
+    HPX_TEST_EQ(v.size(), expected.size());
+
+    std::size_t i = 0;
+    typename hpx::partitioned_vector<T>::const_iterator it = v.begin(),
+                                                        end = v.end();
+    for (/**/; it != end; ++it, ++i)
+    {
+        HPX_TEST_EQ(*it, expected[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename DistPolicy, typename ExPolicy>
+void merge_algo_tests_with_policy(std::size_t size1, std::size_t size2,
+    DistPolicy const& dist_policy, ExPolicy const& policy)
+{
+    hpx::partitioned_vector<T> v1(size1, dist_policy);
+    std::vector<T> data1 = fill_vector(v1, 2, 0);
+
+    hpx::partitioned_vector<T> v2(size2, dist_policy);
+    std::vector<T> data2 = fill_vector(v2, 3, 1);
+
+    std::vector<T> expected;
+    std::merge(data1.begin(), data1.end(), data2.begin(), data2.end(),
+        std::back_inserter(expected));
+
+    hpx::partitioned_vector<T> dest(size1 + size2, dist_policy);
+    auto result = hpx::merge(
+        policy, v1.begin(), v1.end(), v2.begin(), v2.end(), dest.begin());
+    HPX_TEST(result == dest.end());
+    compare_vectors(dest, expected);
+}
+
+template <typename T, typename DistPolicy, typename ExPolicy>
+void merge_algo_tests_with_policy_async(std::size_t size1, std::size_t size2,
+    DistPolicy const& dist_policy, ExPolicy const& policy)
+{
+    hpx::partitioned_vector<T> v1(size1, dist_policy);
+    std::vector<T> data1 = fill_vector(v1, 1, 0);
+
+    hpx::partitioned_vector<T> v2(size2, dist_policy);
+    std::vector<T> data2 = fill_vector(v2, 1, size1 / 2);
+
+    std::vector<T> expected;
+    std::merge(data1.begin(), data1.end(), data2.begin(), data2.end(),
+        std::back_inserter(expected));
+
+    using hpx::execution::task;
+
+    hpx::partitioned_vector<T> dest(size1 + size2, dist_policy);
+    auto f = hpx::merge(policy(task), v1.begin(), v1.end(), v2.begin(),
+        v2.end(), dest.begin());
+    HPX_TEST(f.get() == dest.end());
+    compare_vectors(dest, expected);
+}
+
+template <typename T, typename DistPolicy>
+void merge_tests_with_policy(
+    std::size_t size1, std::size_t size2, DistPolicy const& dist_policy)
+{
+    using namespace hpx::execution;
+
+    merge_algo_tests_with_policy<T>(size1, size2, dist_policy, seq);
+    merge_algo_tests_with_policy<T>(size1, size2, dist_policy, par);
+
+    merge_algo_tests_with_policy_async<T>(size1, size2, dist_policy, seq);
+    merge_algo_tests_with_policy_async<T>(size1, size2, dist_policy, par);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void merge_tests()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    merge_tests_with_policy<T>(1000, 700, hpx::container_layout);
+    merge_tests_with_policy<T>(1000, 700, hpx::container_layout(3));
+    merge_tests_with_policy<T>(
+        1000, 700, hpx::container_layout(3, localities));
+    merge_tests_with_policy<T>(300, 1000, hpx::container_layout(localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    merge_tests<double>();
+    merge_tests<int>();
+
+    return hpx::util::report_errors();
+}
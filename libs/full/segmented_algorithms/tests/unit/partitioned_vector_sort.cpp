@@ -0,0 +1,139 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/parallel/segmented_algorithms/sort.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double);
+// HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> fill_vector(hpx::partitioned_vector<T>& v)
+{
+    std::vector<T> expected;
+    expected.reserve(v.size());
+
+    std::size_t i = 0;
+    typename hpx::partitioned_vector<T>::iterator it = v.begin(), end = v.end();
+    for (/**/; it != end; ++it, ++i)
+    {
+        T val = T((i * 7919) % 101);
+        *it = val;
+        expected.push_back(val);
+    }
+    return expected;
+}
+
+template <typename T>
+void compare_vectors(
+    hpx::partitioned_vector<T> const& v, std::vector<T> const& expected)
+{
+    HPX_TEST_EQ(v.size(), expected.size());
+
+    std::size_t i = 0;
+    typename hpx::partitioned_vector<T>::const_iterator it = v.begin(),
+                                                        end = v.end();
+    for (/**/; it != end; ++it, ++i)
+    {
+        HPX_TEST_EQ(*it, expected[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename DistPolicy, typename ExPolicy>
+void sort_algo_tests_with_policy(
+    std::size_t size, DistPolicy const& dist_policy, ExPolicy const& policy)
+{
+    {
+        hpx::partitioned_vector<T> v(size, dist_policy);
+        std::vector<T> expected = fill_vector(v);
+        std::sort(expected.begin(), expected.end());
+
+        auto result = hpx::parallel::sort(policy, v.begin(), v.end());
+        HPX_TEST(result == v.end());
+        compare_vectors(v, expected);
+    }
+
+    {
+        hpx::partitioned_vector<T> v(size, dist_policy);
+        std::vector<T> expected = fill_vector(v);
+        std::sort(expected.begin(), expected.end(), std::greater<T>());
+
+        hpx::parallel::sort(policy, v.begin(), v.end(), std::greater<T>());
+        compare_vectors(v, expected);
+    }
+
+    {
+        // sort a sub-range which starts and ends inside of partitions
+        hpx::partitioned_vector<T> v(size, dist_policy);
+        std::vector<T> expected = fill_vector(v);
+        std::sort(expected.begin() + 1, expected.end() - 1);
+
+        hpx::parallel::sort(policy, v.begin() + 1, v.end() - 1);
+        compare_vectors(v, expected);
+    }
+}
+
+template <typename T, typename DistPolicy, typename ExPolicy>
+void sort_algo_tests_with_policy_async(
+    std::size_t size, DistPolicy const& dist_policy, ExPolicy const& policy)
+{
+    hpx::partitioned_vector<T> v(size, dist_policy);
+    std::vector<T> expected = fill_vector(v);
+    std::sort(expected.begin(), expected.end());
+
+    using hpx::execution::task;
+
+    auto f = hpx::parallel::sort(policy(task), v.begin(), v.end());
+    HPX_TEST(f.get() == v.end());
+    compare_vectors(v, expected);
+}
+
+template <typename T, typename DistPolicy>
+void sort_tests_with_policy(std::size_t size, DistPolicy const& dist_policy)
+{
+    using namespace hpx::execution;
+
+    sort_algo_tests_with_policy<T>(size, dist_policy, seq);
+    sort_algo_tests_with_policy<T>(size, dist_policy, par);
+
+    sort_algo_tests_with_policy_async<T>(size, dist_policy, seq);
+    sort_algo_tests_with_policy_async<T>(size, dist_policy, par);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void sort_tests()
+{
+    std::size_t const length = 1000;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    sort_tests_with_policy<T>(length, hpx::container_layout);
+    sort_tests_with_policy<T>(length, hpx::container_layout(3));
+    sort_tests_with_policy<T>(length, hpx::container_layout(3, localities));
+    sort_tests_with_policy<T>(length, hpx::container_layout(localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    sort_tests<double>();
+    sort_tests<int>();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,113 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_unique.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/parallel/segmented_algorithms/unique.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double);
+// HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> fill_vector(hpx::partitioned_vector<T>& v, std::size_t run)
+{
+    std::vector<T> expected;
+    expected.reserve(v.size());
+
+    std::size_t i = 0;
+    typename hpx::partitioned_vector<T>::iterator it = v.begin(), end = v.end();
+    for (/**/; it != end; ++it, ++i)
+    {
+        T val = T(i / run);
+        *it = val;
+        expected.push_back(val);
+    }
+    return expected;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename DistPolicy, typename ExPolicy>
+void unique_algo_tests_with_policy(std::size_t size, std::size_t run,
+    DistPolicy const& dist_policy, ExPolicy const& policy)
+{
+    hpx::partitioned_vector<T> v(size, dist_policy);
+    std::vector<T> expected = fill_vector(v, run);
+    auto expected_end = std::unique(expected.begin(), expected.end());
+
+    auto result = hpx::parallel::unique(policy, v.begin(), v.end());
+
+    HPX_TEST_EQ(std::distance(v.begin(), result),
+        std::distance(expected.begin(), expected_end));
+    HPX_TEST(std::equal(v.begin(), result, expected.begin()));
+}
+
+template <typename T, typename DistPolicy, typename ExPolicy>
+void unique_algo_tests_with_policy_async(std::size_t size, std::size_t run,
+    DistPolicy const& dist_policy, ExPolicy const& policy)
+{
+    hpx::partitioned_vector<T> v(size, dist_policy);
+    std::vector<T> expected = fill_vector(v, run);
+    auto expected_end = std::unique(expected.begin(), expected.end());
+
+    using hpx::execution::task;
+
+    auto f = hpx::parallel::unique(policy(task), v.begin(), v.end());
+    auto result = f.get();
+
+    HPX_TEST_EQ(std::distance(v.begin(), result),
+        std::distance(expected.begin(), expected_end));
+    HPX_TEST(std::equal(v.begin(), result, expected.begin()));
+}
+
+template <typename T, typename DistPolicy>
+void unique_tests_with_policy(std::size_t size, DistPolicy const& dist_policy)
+{
+    using namespace hpx::execution;
+
+    // runs shorter than, equal to, and longer than the partitions
+    std::size_t const runs[] = {1, 7, size / 3, size};
+    for (std::size_t run : runs)
+    {
+        unique_algo_tests_with_policy<T>(size, run, dist_policy, seq);
+        unique_algo_tests_with_policy<T>(size, run, dist_policy, par);
+
+        unique_algo_tests_with_policy_async<T>(size, run, dist_policy, seq);
+        unique_algo_tests_with_policy_async<T>(size, run, dist_policy, par);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void unique_tests()
+{
+    std::size_t const length = 1000;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    unique_tests_with_policy<T>(length, hpx::container_layout);
+    unique_tests_with_policy<T>(length, hpx::container_layout(3));
+    unique_tests_with_policy<T>(length, hpx::container_layout(3, localities));
+    unique_tests_with_policy<T>(length, hpx::container_layout(localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    unique_tests<double>();
+    unique_tests<int>();
+
+    return hpx::util::report_errors();
+}
@@ -328,6 +328,12 @@ namespace hpx { namespace threads {
 
         std::int64_t get_cumulative_duration(bool reset);
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        std::int64_t get_idle_park_time(bool reset);
+        std::int64_t get_idle_park_rate(bool reset);
+        std::int64_t get_average_wake_latency(bool reset);
+#endif
+
         std::int64_t get_thread_count_unknown(bool reset)
         {
             return get_thread_count(
@@ -387,6 +393,8 @@ namespace hpx { namespace threads {
         std::int64_t get_num_stolen_from_staged(bool reset);
         std::int64_t get_num_stolen_to_pending(bool reset);
         std::int64_t get_num_stolen_to_staged(bool reset);
+        std::int64_t get_num_stolen_cross_domain(bool reset);
+        std::int64_t get_num_remote_memory_executions(bool reset);
 #endif
 
     private:
@@ -31,6 +31,11 @@
 #include <hpx/topology/topology.hpp>
 #include <hpx/util/from_string.hpp>
 
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__)
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#endif
+
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -166,6 +171,9 @@ namespace hpx { namespace threads {
         double const max_idle_backoff_time = hpx::util::from_string<double>(
             cfg_.rtcfg_.get_entry("hpx.max_idle_backoff_time",
                 std::to_string(HPX_IDLE_BACKOFF_TIME_MAX)));
+        double const idle_park_spin_time = hpx::util::from_string<double>(
+            cfg_.rtcfg_.get_entry("hpx.idle_park_spin_time",
+                std::to_string(HPX_IDLE_PARK_SPIN_TIME)));
 
         std::ptrdiff_t small_stacksize =
             cfg_.rtcfg_.get_stack_size(thread_stacksize_small);
@@ -180,8 +188,8 @@ namespace hpx { namespace threads {
             max_thread_count, min_tasks_to_steal_pending,
             min_tasks_to_steal_staged, min_add_new_count, max_add_new_count,
             min_delete_count, max_delete_count, max_terminated_threads,
-            max_idle_backoff_time, small_stacksize, medium_stacksize,
-            large_stacksize, huge_stacksize);
+            max_idle_backoff_time, idle_park_spin_time, small_stacksize,
+            medium_stacksize, large_stacksize, huge_stacksize);
 
         if (!cfg_.rtcfg_.enable_networking())
         {
@@ -556,6 +564,82 @@ namespace hpx { namespace threads {
 #endif
                 break;
             }
+
+            case resource::local_workstealing:
+            {
+#if defined(HPX_HAVE_LOCAL_SCHEDULER)
+                // set parameters for scheduler and pool instantiation and
+                // perform compatibility checks
+                hpx::detail::ensure_high_priority_compatibility(cfg_.vm_);
+
+                // instantiate the scheduler
+                using local_sched_type =
+                    hpx::threads::policies::local_queue_scheduler<std::mutex,
+                        hpx::threads::policies::chase_lev_lifo>;
+
+                local_sched_type::init_parameter_type init(
+                    thread_pool_init.num_threads_,
+                    thread_pool_init.affinity_data_, thread_queue_init,
+                    "core-local_workstealing_queue_scheduler");
+
+                std::unique_ptr<local_sched_type> sched(
+                    new local_sched_type(init));
+
+                // set the default scheduler flags
+                sched->add_scheduler_mode(thread_pool_init.mode_);
+                // conditionally set/unset this flag
+                sched->update_scheduler_mode(
+                    policies::enable_stealing_numa, !numa_sensitive);
+
+                // instantiate the pool
+                std::unique_ptr<thread_pool_base> pool(
+                    new hpx::threads::detail::scheduled_thread_pool<
+                        local_sched_type>(std::move(sched), thread_pool_init));
+                pools_.push_back(std::move(pool));
+#else
+                throw hpx::detail::command_line_error(
+                    "Command line option --hpx:queuing=local-workstealing "
+                    "is not configured in this build. Please rebuild with "
+                    "'cmake -DHPX_WITH_THREAD_SCHEDULERS=local'.");
+#endif
+                break;
+            }
+
+            case resource::local_priority_workstealing:
+            {
+                // set parameters for scheduler and pool instantiation and
+                // perform compatibility checks
+                std::size_t num_high_priority_queues =
+                    hpx::util::get_num_high_priority_queues(
+                        cfg_, rp.get_num_threads(name));
+
+                // instantiate the scheduler
+                using local_sched_type =
+                    hpx::threads::policies::local_priority_queue_scheduler<
+                        std::mutex, hpx::threads::policies::chase_lev_lifo>;
+
+                local_sched_type::init_parameter_type init(
+                    thread_pool_init.num_threads_,
+                    thread_pool_init.affinity_data_, num_high_priority_queues,
+                    thread_queue_init,
+                    "core-local_priority_workstealing_queue_scheduler");
+
+                std::unique_ptr<local_sched_type> sched(
+                    new local_sched_type(init));
+
+                // set the default scheduler flags
+                sched->add_scheduler_mode(thread_pool_init.mode_);
+                // conditionally set/unset this flag
+                sched->update_scheduler_mode(
+                    policies::enable_stealing_numa, !numa_sensitive);
+
+                // instantiate the pool
+                std::unique_ptr<thread_pool_base> pool(
+                    new hpx::threads::detail::scheduled_thread_pool<
+                        local_sched_type>(std::move(sched), thread_pool_init));
+                pools_.push_back(std::move(pool));
+                break;
+            }
             }
 
             // update the thread_offset for the next pool
@@ -573,7 +657,17 @@ namespace hpx { namespace threads {
         }
     }
 
-    threadmanager::~threadmanager() {}
+    threadmanager::~threadmanager()
+    {
+        // destroying the pools releases the stacks of all remaining threads
+        pools_.clear();
+
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__)
+        // unmap the stacks kept for reuse, they are not needed anymore
+        coroutines::detail::posix::stack_pool_clear();
+#endif
+    }
 
     void threadmanager::init()
     {
@@ -850,6 +944,49 @@ namespace hpx { namespace threads {
         return result;
     }
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    std::int64_t threadmanager::get_idle_park_time(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_idle_park_time(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_idle_park_rate(bool reset)
+    {
+        // weigh the rates of the pools with their number of threads
+        std::int64_t result = 0;
+        std::size_t num_threads = 0;
+        for (auto const& pool_iter : pools_)
+        {
+            std::size_t const pool_threads = pool_iter->get_os_thread_count();
+            result += pool_iter->get_idle_park_rate(all_threads, reset) *
+                std::int64_t(pool_threads);
+            num_threads += pool_threads;
+        }
+        return num_threads == 0 ? 0 : result / std::int64_t(num_threads);
+    }
+
+    std::int64_t threadmanager::get_average_wake_latency(bool reset)
+    {
+        // average over all pools which have seen at least one wake up
+        std::int64_t result = 0;
+        std::int64_t count = 0;
+        for (auto const& pool_iter : pools_)
+        {
+            std::int64_t const latency =
+                pool_iter->get_average_wake_latency(all_threads, reset);
+            if (latency != 0)
+            {
+                result += latency;
+                ++count;
+            }
+        }
+        return count == 0 ? 0 : result / count;
+    }
+#endif
+
 #if defined(HPX_HAVE_BACKGROUND_THREAD_COUNTERS) &&                            \
     defined(HPX_HAVE_THREAD_IDLE_RATES)
     std::int64_t threadmanager::get_background_work_duration(bool reset)
@@ -1053,6 +1190,24 @@ namespace hpx { namespace threads {
             result += pool_iter->get_num_stolen_to_staged(all_threads, reset);
         return result;
     }
+
+    std::int64_t threadmanager::get_num_stolen_cross_domain(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result +=
+                pool_iter->get_num_stolen_cross_domain(all_threads, reset);
+        return result;
+    }
+
+    std::int64_t threadmanager::get_num_remote_memory_executions(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_remote_memory_executions(
+                all_threads, reset);
+        return result;
+    }
 #endif
 
     ///////////////////////////////////////////////////////////////////////////
@@ -126,6 +126,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/adjacent_find.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/find_loop.hpp>
 #include <hpx/parallel/util/invoke_projected.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
@@ -144,6 +145,84 @@ namespace hpx { namespace parallel { inline namespace v1 {
     // adjacent_find
     namespace detail {
         /// \cond NOINTERNAL
+
+        // The comparisons are vectorized for vector-pack execution policies
+        // if the elements are compared using the default predicate.
+        template <typename ExPolicy, typename Iter, typename Pred,
+            typename Proj>
+        struct adjacent_find_vectorizable
+          : std::integral_constant<bool,
+                util::find_loop_vectorizable<ExPolicy, Iter>::value &&
+                    std::is_same<typename std::decay<Pred>::type,
+                        detail::equal_to>::value &&
+                    std::is_same<typename std::decay<Proj>::type,
+                        util::projection_identity>::value>
+        {
+        };
+
+        // Return the offset of the first element in [first, first + count)
+        // which is equal to its successor.
+        template <typename ExPolicy, typename Iter>
+        std::size_t adjacent_find_n(Iter first, std::size_t count)
+        {
+            return util::find_first2_n<ExPolicy>(first, std::next(first),
+                count, [](auto const& v1, auto const& v2) { return v1 == v2; });
+        }
+
+        template <typename ExPolicy, typename InIter, typename Pred,
+            typename Proj>
+        InIter sequential_adjacent_find(InIter first, InIter last,
+            Pred&& pred, Proj&& proj, std::false_type)
+        {
+            return std::adjacent_find(
+                first, last, util::invoke_projected<Pred, Proj>(pred, proj));
+        }
+
+        template <typename ExPolicy, typename InIter, typename Pred,
+            typename Proj>
+        InIter sequential_adjacent_find(
+            InIter first, InIter last, Pred&&, Proj&&, std::true_type)
+        {
+            std::size_t count = std::distance(first, last);
+            if (count < 2)
+                return last;
+
+            std::size_t pos = adjacent_find_n<ExPolicy>(first, count - 1);
+            return pos != count - 1 ? std::next(first, pos) : last;
+        }
+
+        template <typename ExPolicy, typename ZipIter, typename Pred,
+            typename Token>
+        void adjacent_find_partition(ZipIter it, std::size_t part_size,
+            std::size_t base_idx, Pred& pred_projected, Token& tok,
+            std::false_type)
+        {
+            typedef typename ZipIter::reference reference;
+
+            util::loop_idx_n(base_idx, it, part_size, tok,
+                [&pred_projected, &tok](reference t, std::size_t i) {
+                    using hpx::get;
+                    if (pred_projected(get<0>(t), get<1>(t)))
+                        tok.cancel(i);
+                });
+        }
+
+        template <typename ExPolicy, typename ZipIter, typename Pred,
+            typename Token>
+        void adjacent_find_partition(ZipIter it, std::size_t part_size,
+            std::size_t base_idx, Pred&, Token& tok, std::true_type)
+        {
+            if (tok.was_cancelled(base_idx))
+                return;
+
+            std::size_t pos = adjacent_find_n<ExPolicy>(
+                hpx::get<0>(it.get_iterator_tuple()), part_size);
+            if (pos != part_size)
+            {
+                tok.cancel(base_idx + pos);
+            }
+        }
+
         template <typename Iter>
         struct adjacent_find
           : public detail::algorithm<adjacent_find<Iter>, Iter>
@@ -158,8 +237,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static InIter sequential(
                 ExPolicy, InIter first, InIter last, Pred&& pred, Proj&& proj)
             {
-                return std::adjacent_find(first, last,
-                    util::invoke_projected<Pred, Proj>(pred, proj));
+                return sequential_adjacent_find<ExPolicy>(first, last,
+                    std::forward<Pred>(pred), std::forward<Proj>(proj),
+                    adjacent_find_vectorizable<ExPolicy, InIter, Pred,
+                        Proj>());
             }
 
             template <typename ExPolicy, typename FwdIter, typename Pred,
@@ -170,7 +251,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
                     Pred&& pred, Proj&& proj)
             {
                 typedef hpx::util::zip_iterator<FwdIter, FwdIter> zip_iterator;
-                typedef typename zip_iterator::reference reference;
                 typedef typename std::iterator_traits<FwdIter>::difference_type
                     difference_type;
 
@@ -191,12 +271,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 auto f1 = [pred_projected = std::move(pred_projected), tok](
                               zip_iterator it, std::size_t part_size,
                               std::size_t base_idx) mutable {
-                    util::loop_idx_n(base_idx, it, part_size, tok,
-                        [&pred_projected, &tok](reference t, std::size_t i) {
-                            using hpx::get;
-                            if (pred_projected(get<0>(t), get<1>(t)))
-                                tok.cancel(i);
-                        });
+                    adjacent_find_partition<ExPolicy>(it, part_size, base_idx,
+                        pred_projected, tok,
+                        adjacent_find_vectorizable<ExPolicy, FwdIter, Pred,
+                            Proj>());
                 };
 
                 auto f2 =
@@ -521,7 +521,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 using hpx::get;
                 using hpx::util::make_zip_iterator;
                 typedef util::scan_partitioner<ExPolicy,
-                    util::in_out_result<FwdIter1, FwdIter3>, std::size_t>
+                    util::in_out_result<FwdIter1, FwdIter3>, std::size_t, void,
+                    util::scan_partitioner_single_pass_tag>
                     scan_partitioner_type;
 
                 auto f1 = [pred = std::forward<Pred>(pred),
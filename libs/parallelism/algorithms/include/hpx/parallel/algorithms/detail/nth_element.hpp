@@ -0,0 +1,320 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/modules/async_combinators.hpp>
+#include <hpx/modules/execution.hpp>
+
+#include <hpx/parallel/algorithms/detail/sample_sort.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    /// \cond NOINTERNAL
+
+    // below this number of elements we fall back to std::nth_element
+    static constexpr std::size_t nth_element_limit = 65536ul;
+
+    // minimal number of elements handled by one task in each pass
+    static constexpr std::size_t nth_element_limit_per_task = 65536ul;
+
+    // number of elements sampled for selecting the pivots and the distance
+    // (in sample positions) of the pivots from the estimated position of
+    // the nth element, the latter is about twice the standard deviation of
+    // that estimate
+    static constexpr std::size_t nth_element_sample_size = 16384ul;
+    static constexpr std::size_t nth_element_sample_delta = 256ul;
+
+    // The parallel selection moves the elements through a temporary buffer
+    template <typename Iter>
+    struct is_nth_element_bufferable
+      : std::integral_constant<bool,
+            std::is_default_constructible<
+                typename std::iterator_traits<Iter>::value_type>::value &&
+                std::is_move_assignable<
+                    typename std::iterator_traits<Iter>::value_type>::value>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // number of chunks used to process count elements in parallel
+    template <typename ExPolicy>
+    std::size_t selection_num_chunks(ExPolicy const& policy, std::size_t count)
+    {
+        std::size_t const cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
+
+        return (std::max)(std::size_t(1),
+            (std::min)(cores, count / nth_element_limit_per_task));
+    }
+
+    // run f(chunk, begin, end) for all chunks of [0, count) in parallel
+    template <typename ExPolicy, typename F>
+    void selection_for_each_chunk(ExPolicy const& policy, std::size_t count,
+        std::size_t num_chunks, F&& f)
+    {
+        std::size_t const chunk_size = (count + num_chunks - 1) / num_chunks;
+
+        auto shape = hpx::util::make_iterator_range(
+            hpx::util::make_counting_iterator(std::size_t(0)),
+            hpx::util::make_counting_iterator(num_chunks));
+
+        std::vector<hpx::future<void>> workitems =
+            execution::bulk_async_execute(
+                policy.executor(),
+                [&](std::size_t chunk) {
+                    std::size_t begin = (std::min)(chunk * chunk_size, count);
+                    std::size_t end = (std::min)(begin + chunk_size, count);
+                    f(chunk, begin, end);
+                },
+                shape);
+
+        hpx::wait_all(workitems);
+
+        std::list<std::exception_ptr> errors;
+        util::detail::handle_local_exceptions<ExPolicy>::call(
+            workitems, errors);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Parallel sample based selection
+    ///
+    /// Selects two pivots from a random sample of the elements such that the
+    /// nth element is very likely ordered in between them. All elements are
+    /// classified in parallel with respect to the pivots, then the elements
+    /// of all chunks are scattered in parallel into a temporary buffer such
+    /// that the elements ordered before the lower pivot come first, followed
+    /// by the elements in between the pivots and the elements ordered after
+    /// the upper pivot. This is repeated for the partition holding the nth
+    /// element, which usually is only a few percent of the input, until it
+    /// is small enough to be handled by std::nth_element.
+    template <typename ExPolicy, typename Iter, typename Compare>
+    struct nth_element_helper
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using counts_type = std::array<std::size_t, 3>;
+
+        nth_element_helper(
+            ExPolicy const& policy, Compare& comp, std::size_t count)
+          : policy_(policy)
+          , comp_(comp)
+          , buffer_(new value_type[count])
+          , classes_(new std::uint8_t[count])
+          , gen_(static_cast<std::uint32_t>(count))
+        {
+        }
+
+        // Select the pivots from a sample of the elements in
+        // [first, first + count), n is the position of the nth element.
+        std::pair<Iter, Iter> select_pivots(
+            Iter first, std::size_t count, std::size_t n)
+        {
+            std::size_t const stride = count / nth_element_sample_size;
+            HPX_ASSERT(stride != 0);
+
+            std::vector<Iter> sample;
+            sample.reserve(nth_element_sample_size);
+
+            std::uniform_int_distribution<std::size_t> dist(0, stride - 1);
+            for (std::size_t i = 0; i != nth_element_sample_size; ++i)
+            {
+                sample.push_back(std::next(first, i * stride + dist(gen_)));
+            }
+
+            std::size_t const pos =
+                std::size_t(double(n) / double(count) * sample.size());
+            std::size_t const lo = pos > nth_element_sample_delta ?
+                pos - nth_element_sample_delta :
+                0;
+            std::size_t const hi = (std::min)(
+                pos + nth_element_sample_delta, sample.size() - 1);
+
+            less_ptr_no_null<Iter, Compare> comp(comp_);
+            std::nth_element(sample.begin(), sample.begin() + lo,
+                sample.end(), comp);
+            std::nth_element(sample.begin() + lo + 1, sample.begin() + hi,
+                sample.end(), comp);
+
+            return std::make_pair(sample[lo], sample[hi]);
+        }
+
+        // Partition [first, first + count) into the elements ordered before
+        // lo, the ones in between lo and hi, and the ones ordered after hi.
+        // Returns the sizes of the three partitions.
+        counts_type partition(Iter first, std::size_t count, Iter lo, Iter hi)
+        {
+            std::size_t const num_chunks =
+                selection_num_chunks(policy_, count);
+            std::vector<counts_type> counts(num_chunks);
+
+            // classify the elements and count the elements of each class
+            std::uint8_t* classes = classes_.get();
+            selection_for_each_chunk(policy_, count, num_chunks,
+                [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+                    counts_type c = {{0, 0, 0}};
+                    Iter it = std::next(first, begin);
+                    for (std::size_t i = begin; i != end; ++i, ++it)
+                    {
+                        std::uint8_t cls =
+                            comp_(*it, *lo) ? 0 : (comp_(*hi, *it) ? 2 : 1);
+                        classes[i] = cls;
+                        ++c[cls];
+                    }
+                    counts[chunk] = c;
+                });
+
+            // turn the counts into target offsets, elements of the same class
+            // are placed in the order of the chunks
+            counts_type totals = {{0, 0, 0}};
+            std::size_t offset = 0;
+            for (std::size_t cls = 0; cls != 3; ++cls)
+            {
+                for (counts_type& c : counts)
+                {
+                    std::size_t n = c[cls];
+                    c[cls] = offset;
+                    offset += n;
+                    totals[cls] += n;
+                }
+            }
+
+            // the pivots may be moved from now on
+            value_type* buffer = buffer_.get();
+            selection_for_each_chunk(policy_, count, num_chunks,
+                [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+                    counts_type& c = counts[chunk];
+                    Iter it = std::next(first, begin);
+                    for (std::size_t i = begin; i != end; ++i, ++it)
+                    {
+                        buffer[c[classes[i]]++] = std::move(*it);
+                    }
+                });
+
+            selection_for_each_chunk(policy_, count, num_chunks,
+                [&](std::size_t, std::size_t begin, std::size_t end) {
+                    std::move(buffer + begin, buffer + end,
+                        std::next(first, begin));
+                });
+
+            return totals;
+        }
+
+        void operator()(Iter first, Iter nth, Iter last)
+        {
+            while (std::size_t(last - first) > nth_element_limit)
+            {
+                std::size_t const count = last - first;
+                std::size_t const n = nth - first;
+
+                auto pivots = select_pivots(first, count, n);
+
+                // all elements in between equivalent pivots are equivalent
+                bool const equivalent_pivots =
+                    !comp_(*pivots.first, *pivots.second);
+
+                counts_type sizes =
+                    partition(first, count, pivots.first, pivots.second);
+
+                if (n < sizes[0])
+                {
+                    last = std::next(first, sizes[0]);
+                }
+                else if (n < sizes[0] + sizes[1])
+                {
+                    if (equivalent_pivots)
+                        return;
+
+                    std::advance(first, sizes[0]);
+                    last = std::next(first, sizes[1]);
+                }
+                else
+                {
+                    std::advance(first, sizes[0] + sizes[1]);
+                }
+
+                // make sure we do not loop forever
+                if (std::size_t(last - first) == count)
+                    break;
+            }
+
+            std::nth_element(first, nth, last, comp_);
+        }
+
+        ExPolicy policy_;
+        Compare& comp_;
+        std::unique_ptr<value_type[]> buffer_;
+        std::unique_ptr<std::uint8_t[]> classes_;
+        std::minstd_rand gen_;
+    };
+
+    template <typename ExPolicy, typename Iter, typename Compare>
+    void parallel_nth_element(ExPolicy&&, Iter first, Iter nth, Iter last,
+        Compare& comp, std::false_type)
+    {
+        std::nth_element(first, nth, last, comp);
+    }
+
+    template <typename ExPolicy, typename Iter, typename Compare>
+    void parallel_nth_element(ExPolicy&& policy, Iter first, Iter nth,
+        Iter last, Compare& comp, std::true_type)
+    {
+        using helper_type =
+            nth_element_helper<typename std::decay<ExPolicy>::type, Iter,
+                Compare>;
+
+        helper_type selector(policy, comp, std::size_t(last - first));
+        selector(first, nth, last);
+    }
+
+    /// \param [in] policy  execution policy used to schedule the tasks
+    /// \param [in] first   iterator to the first element
+    /// \param [in] nth     iterator to the element to select
+    /// \param [in] last    iterator to the next element after the last
+    /// \param [in] comp    object used to compare the (projected) elements
+    ///
+    /// The function blocks until the selection has finished, it has to be
+    /// called on an HPX thread.
+    template <typename ExPolicy, typename Iter, typename Compare>
+    void parallel_nth_element(
+        ExPolicy&& policy, Iter first, Iter nth, Iter last, Compare& comp)
+    {
+        std::ptrdiff_t N = last - first;
+        HPX_ASSERT(N >= 0);
+
+        if (nth == last)
+            return;
+
+        if (std::size_t(N) <= nth_element_limit)
+        {
+            std::nth_element(first, nth, last, comp);
+            return;
+        }
+
+        parallel_nth_element(std::forward<ExPolicy>(policy), first, nth, last,
+            comp, is_nth_element_bufferable<Iter>());
+    }
+
+    /// \endcond
+}}}}    // namespace hpx::parallel::v1::detail
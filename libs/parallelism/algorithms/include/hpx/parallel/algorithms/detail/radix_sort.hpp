@@ -0,0 +1,473 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/invoke_result.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/modules/async_combinators.hpp>
+#include <hpx/modules/execution.hpp>
+
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+
+    /// \cond NOINTERNAL
+
+    // below this number of elements we fall back to std::sort
+    static constexpr std::size_t radix_sort_limit = 65536ul;
+
+    // minimal number of elements handled by one task in each pass
+    static constexpr std::size_t radix_sort_limit_per_task = 65536ul;
+
+    // the radix sort processes one byte of the key per pass
+    static constexpr std::size_t radix_sort_digit_bits = 8;
+    static constexpr std::size_t radix_sort_buckets = 1
+        << radix_sort_digit_bits;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Maps arithmetic keys onto unsigned integers of the same size such that
+    // the (unsigned) integer ordering is equivalent to operator<() on the
+    // keys.
+    template <typename T, typename Enable = void>
+    struct radix_key_traits
+    {
+        static constexpr bool is_valid = false;
+    };
+
+    template <typename T>
+    struct radix_key_traits<T,
+        typename std::enable_if<std::is_integral<T>::value &&
+            !std::is_same<T, bool>::value>::type>
+    {
+        static constexpr bool is_valid = true;
+
+        using type = typename std::make_unsigned<T>::type;
+
+        static type call(T key)
+        {
+            // flip the sign bit of signed values
+            return std::is_signed<T>::value ?
+                static_cast<type>(static_cast<type>(key) ^
+                    (type(1) << (sizeof(T) * CHAR_BIT - 1))) :
+                static_cast<type>(key);
+        }
+    };
+
+    template <typename T>
+    struct radix_key_traits<T,
+        typename std::enable_if<std::is_floating_point<T>::value &&
+            std::numeric_limits<T>::is_iec559 &&
+            (sizeof(T) == sizeof(std::uint32_t) ||
+                sizeof(T) == sizeof(std::uint64_t))>::type>
+    {
+        static constexpr bool is_valid = true;
+
+        using type = typename std::conditional<sizeof(T) ==
+                sizeof(std::uint32_t),
+            std::uint32_t, std::uint64_t>::type;
+
+        static type call(T key)
+        {
+            type bits;
+            std::memcpy(&bits, &key, sizeof(T));
+
+            // negative values: flip all bits, positive values: flip sign bit
+            type const sign_bit = type(1) << (sizeof(T) * CHAR_BIT - 1);
+            return (bits & sign_bit) ? type(~bits) : type(bits | sign_bit);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The radix sort can be used if the (projected) key is arithmetic and
+    // the sorted elements can be moved into a temporary buffer.
+    template <typename Iter, typename Proj>
+    struct radix_sort_key
+    {
+        using type = typename std::decay<typename hpx::util::invoke_result<
+            Proj, typename std::iterator_traits<Iter>::reference>::type>::type;
+    };
+
+    // The radix sort can be used if the comparison is operator<() on the
+    // (arithmetic) keys
+    template <typename Compare, typename Key>
+    struct is_radix_sort_compare : std::false_type
+    {
+    };
+
+    template <typename Key>
+    struct is_radix_sort_compare<detail::less, Key>
+      : std::integral_constant<bool, radix_key_traits<Key>::is_valid>
+    {
+    };
+
+    // std::less<T> converts the keys to T before comparing them, which
+    // preserves their order only if T is the key type itself
+    template <typename T, typename Key>
+    struct is_radix_sort_compare<std::less<T>, Key>
+      : std::integral_constant<bool,
+            radix_key_traits<Key>::is_valid &&
+                (std::is_same<T, Key>::value || std::is_void<T>::value)>
+    {
+    };
+
+    template <typename Iter, typename Proj, typename Enable = void>
+    struct is_radix_sortable : std::false_type
+    {
+    };
+
+    template <typename Iter, typename Proj>
+    struct is_radix_sortable<Iter, Proj,
+        typename std::enable_if<radix_key_traits<
+            typename radix_sort_key<Iter, Proj>::type>::is_valid>::type>
+      : std::integral_constant<bool,
+            std::is_nothrow_move_constructible<
+                typename std::iterator_traits<Iter>::value_type>::value &&
+                std::is_move_assignable<typename std::iterator_traits<
+                    Iter>::value_type>::value>
+    {
+    };
+
+    template <typename Iter, typename Compare, typename Proj,
+        typename Enable = void>
+    struct use_radix_sort : std::false_type
+    {
+    };
+
+    template <typename Iter, typename Compare, typename Proj>
+    struct use_radix_sort<Iter, Compare, Proj,
+        typename std::enable_if<is_radix_sortable<Iter,
+            typename std::decay<Proj>::type>::value>::type>
+      : is_radix_sort_compare<typename std::decay<Compare>::type,
+            typename radix_sort_key<Iter,
+                typename std::decay<Proj>::type>::type>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Uninitialized storage for the elements of the sorted sequence. The
+    // elements are move constructed from the sequence only once the first
+    // pass needs the buffer, types which are trivial to construct and to
+    // destroy are not touched at all.
+    template <typename T>
+    class radix_sort_buffer
+    {
+        using needs_construction = std::integral_constant<bool,
+            !std::is_trivially_default_constructible<T>::value ||
+                !std::is_trivially_destructible<T>::value>;
+
+    public:
+        explicit radix_sort_buffer(std::size_t count)
+          : data_(std::allocator<T>().allocate(count))
+          , count_(count)
+          , constructed_(false)
+        {
+        }
+
+        ~radix_sort_buffer()
+        {
+            if (constructed_)
+            {
+                for (std::size_t i = 0; i != count_; ++i)
+                    data_[i].~T();
+            }
+            std::allocator<T>().deallocate(data_, count_);
+        }
+
+        radix_sort_buffer(radix_sort_buffer const&) = delete;
+        radix_sort_buffer& operator=(radix_sort_buffer const&) = delete;
+
+        T* get() const
+        {
+            return data_;
+        }
+
+        bool is_constructed() const
+        {
+            return constructed_ || !needs_construction::value;
+        }
+
+        // move construct the elements [begin, end) from the given sequence
+        template <typename Iter>
+        void construct(Iter first, std::size_t begin, std::size_t end)
+        {
+            for (std::size_t i = begin; i != end; ++i, ++first)
+                ::new (static_cast<void*>(data_ + i)) T(std::move(*first));
+        }
+
+        void set_constructed()
+        {
+            constructed_ = true;
+        }
+
+    private:
+        T* data_;
+        std::size_t count_;
+        bool constructed_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Parallel LSD radix sort
+    ///
+    /// Sorts the elements based on the unsigned integer representation of
+    /// their (projected) keys, one byte per pass. Each pass computes
+    /// per-chunk histograms in parallel, derives the target offsets for each
+    /// (digit, chunk) pair and then scatters the elements of all chunks in
+    /// parallel into a temporary buffer. Passes for which all elements share
+    /// the same digit are skipped.
+    template <typename ExPolicy, typename Iter, typename Proj>
+    struct radix_sort_helper
+    {
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        using key_type = typename radix_sort_key<Iter, Proj>::type;
+        using key_traits = radix_key_traits<key_type>;
+        using ukey_type = typename key_traits::type;
+        using histogram_type = std::array<std::size_t, radix_sort_buckets>;
+
+        radix_sort_helper(ExPolicy const& policy, Proj& proj,
+            std::size_t count, std::size_t num_chunks)
+          : policy_(policy)
+          , proj_(proj)
+          , count_(count)
+          , num_chunks_(num_chunks)
+          , chunk_size_((count + num_chunks - 1) / num_chunks)
+          , histograms_(num_chunks)
+        {
+        }
+
+        template <typename It>
+        ukey_type get_key(It it) const
+        {
+            return key_traits::call(hpx::util::invoke(proj_, *it));
+        }
+
+        static std::size_t get_digit(ukey_type key, std::size_t pass)
+        {
+            return std::size_t(key >> (pass * radix_sort_digit_bits)) &
+                (radix_sort_buckets - 1);
+        }
+
+        // run f(chunk, begin, end) for all chunks in parallel
+        template <typename F>
+        void for_each_chunk(F&& f)
+        {
+            auto shape = hpx::util::make_iterator_range(
+                hpx::util::make_counting_iterator(std::size_t(0)),
+                hpx::util::make_counting_iterator(num_chunks_));
+
+            std::vector<hpx::future<void>> workitems =
+                execution::bulk_async_execute(
+                    policy_.executor(),
+                    [this, &f](std::size_t chunk) {
+                        std::size_t begin = chunk * chunk_size_;
+                        std::size_t end =
+                            (std::min)(begin + chunk_size_, count_);
+                        f(chunk, begin, end);
+                    },
+                    shape);
+
+            hpx::wait_all(workitems);
+
+            std::list<std::exception_ptr> errors;
+            util::detail::handle_local_exceptions<ExPolicy>::call(
+                workitems, errors);
+        }
+
+        // returns false if the pass does not reorder anything
+        template <typename Src>
+        bool compute_offsets(Src src, std::size_t pass)
+        {
+            for_each_chunk(
+                [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+                    histogram_type& h = histograms_[chunk];
+                    h.fill(0);
+                    for (std::size_t i = begin; i != end; ++i)
+                    {
+                        ++h[get_digit(get_key(std::next(src, i)), pass)];
+                    }
+                });
+
+            // turn the histograms into target offsets, element of the same
+            // digit are placed in the order of the chunks
+            std::size_t offset = 0;
+            for (std::size_t digit = 0; digit != radix_sort_buckets; ++digit)
+            {
+                std::size_t digit_count = 0;
+                for (histogram_type& h : histograms_)
+                {
+                    std::size_t n = h[digit];
+                    h[digit] = offset;
+                    offset += n;
+                    digit_count += n;
+                }
+
+                if (digit_count == count_)
+                    return false;    // all elements have the same digit
+            }
+            return true;
+        }
+
+        template <typename Src, typename Dest>
+        void scatter(Src src, Dest dest, std::size_t pass)
+        {
+            for_each_chunk(
+                [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+                    histogram_type& h = histograms_[chunk];
+                    for (std::size_t i = begin; i != end; ++i)
+                    {
+                        Src it = std::next(src, i);
+                        std::size_t digit = get_digit(get_key(it), pass);
+                        *std::next(dest, h[digit]++) = std::move(*it);
+                    }
+                });
+        }
+
+        Iter operator()(Iter first, Iter last)
+        {
+            radix_sort_buffer<value_type> buffer(count_);
+
+            bool in_buffer = false;
+            for (std::size_t pass = 0; pass != sizeof(ukey_type); ++pass)
+            {
+                if (in_buffer)
+                {
+                    if (compute_offsets(buffer.get(), pass))
+                    {
+                        scatter(buffer.get(), first, pass);
+                        in_buffer = false;
+                    }
+                }
+                else if (compute_offsets(first, pass))
+                {
+                    if (!buffer.is_constructed())
+                    {
+                        // the move constructor does not throw
+                        for_each_chunk([&](std::size_t, std::size_t begin,
+                                           std::size_t end) {
+                            buffer.construct(
+                                std::next(first, begin), begin, end);
+                        });
+                        buffer.set_constructed();
+                    }
+                    scatter(first, buffer.get(), pass);
+                    in_buffer = true;
+                }
+            }
+
+            // move the elements back into the input sequence, if needed
+            if (in_buffer)
+            {
+                value_type* src = buffer.get();
+                for_each_chunk(
+                    [&](std::size_t, std::size_t begin, std::size_t end) {
+                        std::move(src + begin, src + end,
+                            std::next(first, begin));
+                    });
+            }
+
+            return last;
+        }
+
+        ExPolicy policy_;
+        Proj& proj_;
+        std::size_t const count_;
+        std::size_t const num_chunks_;
+        std::size_t const chunk_size_;
+        std::vector<histogram_type> histograms_;
+    };
+
+    /// \param [in] policy  execution policy used to schedule the tasks
+    /// \param [in] first   iterator to the first element to sort
+    /// \param [in] last    iterator to the next element after the last
+    /// \param [in] proj    projection giving the (arithmetic) sort key
+    /// \return iterator to the next element after the last
+    template <typename ExPolicy, typename Iter, typename Proj>
+    Iter parallel_radix_sort(
+        ExPolicy&& policy, Iter first, Iter last, Proj proj)
+    {
+        static_assert(is_radix_sortable<Iter, Proj>::value,
+            "radix sort requires an arithmetic sort key and nothrow move "
+            "constructible, move assignable elements");
+
+        std::ptrdiff_t N = last - first;
+        HPX_ASSERT(N >= 0);
+
+        std::size_t count = std::size_t(N);
+        if (count < radix_sort_limit)
+        {
+            std::sort(first, last,
+                util::compare_projected<detail::less, Proj>(
+                    detail::less(), std::move(proj)));
+            return last;
+        }
+
+        std::size_t const cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
+
+        std::size_t num_chunks = (std::max)(std::size_t(1),
+            (std::min)(cores, count / radix_sort_limit_per_task));
+
+        using helper_type =
+            radix_sort_helper<typename std::decay<ExPolicy>::type, Iter, Proj>;
+
+        helper_type sorter(policy, proj, count, num_chunks);
+        return sorter(first, last);
+    }
+
+    /// Runs the radix sort on a separate task
+    ///
+    /// \return future referring to the iterator to the next element after
+    ///         the last
+    template <typename ExPolicy, typename Iter, typename Proj>
+    hpx::future<Iter> parallel_radix_sort_async(
+        ExPolicy&& policy, Iter first, Iter last, Proj proj)
+    {
+        std::ptrdiff_t N = last - first;
+        HPX_ASSERT(N >= 0);
+
+        if (std::size_t(N) < radix_sort_limit)
+        {
+            std::sort(first, last,
+                util::compare_projected<detail::less, Proj>(
+                    detail::less(), std::move(proj)));
+            return hpx::make_ready_future(last);
+        }
+
+        using policy_type = typename std::decay<ExPolicy>::type;
+        return execution::async_execute(policy.executor(),
+            [first, last](policy_type policy, Proj proj) -> Iter {
+                return parallel_radix_sort(
+                    std::move(policy), first, last, std::move(proj));
+            },
+            std::forward<ExPolicy>(policy), std::move(proj));
+    }
+
+    /// \endcond
+}}}}    // namespace hpx::parallel::v1::detail
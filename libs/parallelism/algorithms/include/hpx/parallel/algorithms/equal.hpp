@@ -177,11 +177,13 @@ namespace hpx {
 #include <hpx/iterator_support/range.hpp>
 #include <hpx/iterator_support/traits/is_iterator.hpp>
 
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
 #include <hpx/execution/algorithms/detail/predicates.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/find_loop.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
 #include <hpx/parallel/util/projection_identity.hpp>
@@ -217,6 +219,95 @@ namespace hpx { namespace parallel { inline namespace v1 {
             return first1 == last1 && first2 == last2;
         }
 
+        // The comparisons are vectorized for vector-pack execution policies
+        // if the elements are compared using the default predicate.
+        template <typename ExPolicy, typename Iter1, typename Iter2,
+            typename F, typename Proj1 = util::projection_identity,
+            typename Proj2 = util::projection_identity>
+        struct equal_vectorizable
+          : std::integral_constant<bool,
+                util::find_loop2_vectorizable<ExPolicy, Iter1, Iter2>::value &&
+                    std::is_same<typename std::decay<F>::type,
+                        detail::equal_to>::value &&
+                    std::is_same<typename std::decay<Proj1>::type,
+                        util::projection_identity>::value &&
+                    std::is_same<typename std::decay<Proj2>::type,
+                        util::projection_identity>::value>
+        {
+        };
+
+        template <typename ExPolicy, typename Iter1, typename Iter2>
+        bool equal_n(Iter1 first1, Iter2 first2, std::size_t count)
+        {
+            return util::find_first2_n<ExPolicy>(first1, first2, count,
+                       [](auto const& v1, auto const& v2) {
+                           return !(v1 == v2);
+                       }) == count;
+        }
+
+        template <typename ExPolicy, typename Iter1, typename Sent1,
+            typename Iter2, typename Sent2, typename F, typename Proj1,
+            typename Proj2>
+        bool sequential_equal_binary(Iter1 first1, Sent1 last1, Iter2 first2,
+            Sent2 last2, F&& f, Proj1&& proj1, Proj2&& proj2, std::false_type)
+        {
+            return sequential_equal_binary(first1, last1, first2, last2,
+                std::forward<F>(f), std::forward<Proj1>(proj1),
+                std::forward<Proj2>(proj2));
+        }
+
+        template <typename ExPolicy, typename Iter1, typename Sent1,
+            typename Iter2, typename Sent2, typename F, typename Proj1,
+            typename Proj2>
+        bool sequential_equal_binary(Iter1 first1, Sent1 last1, Iter2 first2,
+            Sent2 last2, F&&, Proj1&&, Proj2&&, std::true_type)
+        {
+            std::size_t count1 = detail::distance(first1, last1);
+            std::size_t count2 = detail::distance(first2, last2);
+
+            return count1 == count2 && equal_n<ExPolicy>(first1, first2, count1);
+        }
+
+        template <typename ExPolicy, typename ZipIter, typename F,
+            typename Proj1, typename Proj2, typename Token>
+        bool equal_partition(ZipIter it, std::size_t part_count, F& f,
+            Proj1& proj1, Proj2& proj2, Token& tok, std::false_type)
+        {
+            typedef typename ZipIter::reference reference;
+
+            // the elements are not loaded into vector packs, thus the
+            // sequential loop is used for all execution policies
+            util::loop_n<hpx::execution::sequenced_policy>(it, part_count, tok,
+                [&f, &proj1, &proj2, &tok](ZipIter const& curr) {
+                    reference t = *curr;
+                    if (!hpx::util::invoke(f,
+                            hpx::util::invoke(proj1, hpx::get<0>(t)),
+                            hpx::util::invoke(proj2, hpx::get<1>(t))))
+                    {
+                        tok.cancel();
+                    }
+                });
+            return !tok.was_cancelled();
+        }
+
+        template <typename ExPolicy, typename ZipIter, typename F,
+            typename Proj1, typename Proj2, typename Token>
+        bool equal_partition(ZipIter it, std::size_t part_count, F&, Proj1&,
+            Proj2&, Token& tok, std::true_type)
+        {
+            if (tok.was_cancelled())
+                return false;
+
+            auto const& iters = it.get_iterator_tuple();
+            if (!equal_n<ExPolicy>(
+                    hpx::get<0>(iters), hpx::get<1>(iters), part_count))
+            {
+                tok.cancel();
+                return false;
+            }
+            return true;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         struct equal_binary : public detail::algorithm<equal_binary, bool>
         {
@@ -231,9 +322,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static bool sequential(ExPolicy, Iter1 first1, Sent1 last1,
                 Iter2 first2, Sent2 last2, F&& f, Proj1&& proj1, Proj2&& proj2)
             {
-                return sequential_equal_binary(first1, last1, first2, last2,
-                    std::forward<F>(f), std::forward<Proj1>(proj1),
-                    std::forward<Proj2>(proj2));
+                return sequential_equal_binary<ExPolicy>(first1, last1, first2,
+                    last2, std::forward<F>(f), std::forward<Proj1>(proj1),
+                    std::forward<Proj2>(proj2),
+                    equal_vectorizable<ExPolicy, Iter1, Iter2, F, Proj1,
+                        Proj2>());
             }
 
             template <typename ExPolicy, typename Iter1, typename Sent1,
@@ -277,7 +370,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 }
 
                 typedef hpx::util::zip_iterator<Iter1, Iter2> zip_iterator;
-                typedef typename zip_iterator::reference reference;
 
                 util::cancellation_token<> tok;
                 auto f1 = [tok, f = std::forward<F>(f),
@@ -285,17 +377,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
                               proj2 = std::forward<Proj2>(proj2)](
                               zip_iterator it,
                               std::size_t part_count) mutable -> bool {
-                    util::loop_n<ExPolicy>(it, part_count, tok,
-                        [&f, &proj1, &proj2, &tok](zip_iterator const& curr) {
-                            reference t = *curr;
-                            if (!hpx::util::invoke(f,
-                                    hpx::util::invoke(proj1, hpx::get<0>(t)),
-                                    hpx::util::invoke(proj2, hpx::get<1>(t))))
-                            {
-                                tok.cancel();
-                            }
-                        });
-                    return !tok.was_cancelled();
+                    return equal_partition<ExPolicy>(it, part_count, f, proj1,
+                        proj2, tok,
+                        equal_vectorizable<ExPolicy, Iter1, Iter2, F, Proj1,
+                            Proj2>());
                 };
 
                 return util::partitioner<ExPolicy, bool>::call(
@@ -309,6 +394,38 @@ namespace hpx { namespace parallel { inline namespace v1 {
                     });
             }
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Iter1, typename Iter2>
+        struct equal_iterators_are_segmented
+          : std::integral_constant<bool,
+                hpx::traits::is_segmented_iterator<Iter1>::value &&
+                    hpx::traits::is_segmented_iterator<Iter2>::value>
+        {
+        };
+
+        // non-segmented implementation
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+            typename F, typename Proj1, typename Proj2>
+        inline typename util::detail::algorithm_result<ExPolicy, bool>::type
+        equal_binary_(ExPolicy&& policy, FwdIter1 first1, FwdIter1 last1,
+            FwdIter2 first2, FwdIter2 last2, F&& f, Proj1&& proj1,
+            Proj2&& proj2, std::false_type)
+        {
+            using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+
+            return equal_binary().call(std::forward<ExPolicy>(policy), is_seq{},
+                first1, last1, first2, last2, std::forward<F>(f),
+                std::forward<Proj1>(proj1), std::forward<Proj2>(proj2));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+            typename F, typename Proj1, typename Proj2>
+        typename util::detail::algorithm_result<ExPolicy, bool>::type
+        equal_binary_(ExPolicy&& policy, FwdIter1 first1, FwdIter1 last1,
+            FwdIter2 first2, FwdIter2 last2, F&& f, Proj1&& proj1,
+            Proj2&& proj2, std::true_type);
         /// \endcond
     }    // namespace detail
 
@@ -336,15 +453,17 @@ namespace hpx { namespace parallel { inline namespace v1 {
         static_assert((hpx::traits::is_forward_iterator<FwdIter2>::value),
             "Requires at least forward iterator.");
 
-        typedef hpx::is_sequenced_execution_policy<ExPolicy> is_seq;
+        using is_segmented =
+            detail::equal_iterators_are_segmented<FwdIter1, FwdIter2>;
 
 #if defined(HPX_GCC_VERSION) && HPX_GCC_VERSION >= 100000
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 #endif
-        return detail::equal_binary().call(std::forward<ExPolicy>(policy),
-            is_seq{}, first1, last1, first2, last2, std::forward<Pred>(op),
-            util::projection_identity{}, util::projection_identity{});
+        return detail::equal_binary_(std::forward<ExPolicy>(policy), first1,
+            last1, first2, last2, std::forward<Pred>(op),
+            util::projection_identity{}, util::projection_identity{},
+            is_segmented{});
 #if defined(HPX_GCC_VERSION) && HPX_GCC_VERSION >= 100000
 #pragma GCC diagnostic pop
 #endif
@@ -354,6 +473,23 @@ namespace hpx { namespace parallel { inline namespace v1 {
     // equal
     namespace detail {
         /// \cond NOINTERNAL
+        template <typename ExPolicy, typename InIter1, typename InIter2,
+            typename F>
+        bool sequential_equal(InIter1 first1, InIter1 last1, InIter2 first2,
+            F&& f, std::false_type)
+        {
+            return std::equal(first1, last1, first2, std::forward<F>(f));
+        }
+
+        template <typename ExPolicy, typename InIter1, typename InIter2,
+            typename F>
+        bool sequential_equal(InIter1 first1, InIter1 last1, InIter2 first2,
+            F&&, std::true_type)
+        {
+            return equal_n<ExPolicy>(
+                first1, first2, std::distance(first1, last1));
+        }
+
         struct equal : public detail::algorithm<equal, bool>
         {
             equal()
@@ -366,7 +502,9 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static bool sequential(
                 ExPolicy, InIter1 first1, InIter1 last1, InIter2 first2, F&& f)
             {
-                return std::equal(first1, last1, first2, std::forward<F>(f));
+                return sequential_equal<ExPolicy>(first1, last1, first2,
+                    std::forward<F>(f),
+                    equal_vectorizable<ExPolicy, InIter1, InIter2, F>());
             }
 
             template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
@@ -387,21 +525,14 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 typedef hpx::util::zip_iterator<FwdIter1, FwdIter2>
                     zip_iterator;
-                typedef typename zip_iterator::reference reference;
 
                 util::cancellation_token<> tok;
                 auto f1 = [f, tok](zip_iterator it,
                               std::size_t part_count) mutable -> bool {
-                    util::loop_n<ExPolicy>(it, part_count, tok,
-                        [&f, &tok](zip_iterator const& curr) {
-                            reference t = *curr;
-                            if (!hpx::util::invoke(
-                                    f, hpx::get<0>(t), hpx::get<1>(t)))
-                            {
-                                tok.cancel();
-                            }
-                        });
-                    return !tok.was_cancelled();
+                    util::projection_identity proj;
+                    return equal_partition<ExPolicy>(it, part_count, f, proj,
+                        proj, tok,
+                        equal_vectorizable<ExPolicy, FwdIter1, FwdIter2, F>());
                 };
 
                 return util::partitioner<ExPolicy, bool>::call(
@@ -415,6 +546,26 @@ namespace hpx { namespace parallel { inline namespace v1 {
                     });
             }
         };
+
+        // non-segmented implementation
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+            typename F>
+        inline typename util::detail::algorithm_result<ExPolicy, bool>::type
+        equal_(ExPolicy&& policy, FwdIter1 first1, FwdIter1 last1,
+            FwdIter2 first2, F&& f, std::false_type)
+        {
+            using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+
+            return equal().call(std::forward<ExPolicy>(policy), is_seq{},
+                first1, last1, first2, std::forward<F>(f));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+            typename F>
+        typename util::detail::algorithm_result<ExPolicy, bool>::type
+        equal_(ExPolicy&& policy, FwdIter1 first1, FwdIter1 last1,
+            FwdIter2 first2, F&& f, std::true_type);
         /// \endcond
     }    // namespace detail
 
@@ -442,15 +593,15 @@ namespace hpx { namespace parallel { inline namespace v1 {
         static_assert((hpx::traits::is_forward_iterator<FwdIter2>::value),
             "Requires at least forward iterator.");
 
-        using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+        using is_segmented =
+            detail::equal_iterators_are_segmented<FwdIter1, FwdIter2>;
 
 #if defined(HPX_GCC_VERSION) && HPX_GCC_VERSION >= 100000
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 #endif
-        return hpx::parallel::v1::detail::equal().call(
-            std::forward<ExPolicy>(policy), is_seq{}, first1, last1, first2,
-            std::forward<Pred>(op));
+        return hpx::parallel::v1::detail::equal_(std::forward<ExPolicy>(policy),
+            first1, last1, first2, std::forward<Pred>(op), is_segmented{});
 #if defined(HPX_GCC_VERSION) && HPX_GCC_VERSION >= 100000
 #pragma GCC diagnostic pop
 #endif
@@ -488,13 +639,14 @@ namespace hpx {
             static_assert((hpx::traits::is_forward_iterator<FwdIter2>::value),
                 "Requires at least forward iterator.");
 
-            using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+            using is_segmented = hpx::parallel::v1::detail::
+                equal_iterators_are_segmented<FwdIter1, FwdIter2>;
 
-            return hpx::parallel::v1::detail::equal_binary().call(
-                std::forward<ExPolicy>(policy), is_seq{}, first1, last1, first2,
-                last2, std::forward<Pred>(op),
+            return hpx::parallel::v1::detail::equal_binary_(
+                std::forward<ExPolicy>(policy), first1, last1, first2, last2,
+                std::forward<Pred>(op),
                 hpx::parallel::util::projection_identity{},
-                hpx::parallel::util::projection_identity{});
+                hpx::parallel::util::projection_identity{}, is_segmented{});
         }
 
         // clang-format off
@@ -515,13 +667,14 @@ namespace hpx {
             static_assert((hpx::traits::is_forward_iterator<FwdIter2>::value),
                 "Requires at least forward iterator.");
 
-            using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+            using is_segmented = hpx::parallel::v1::detail::
+                equal_iterators_are_segmented<FwdIter1, FwdIter2>;
 
-            return hpx::parallel::v1::detail::equal_binary().call(
-                std::forward<ExPolicy>(policy), is_seq{}, first1, last1, first2,
-                last2, hpx::parallel::v1::detail::equal_to{},
+            return hpx::parallel::v1::detail::equal_binary_(
+                std::forward<ExPolicy>(policy), first1, last1, first2, last2,
+                hpx::parallel::v1::detail::equal_to{},
                 hpx::parallel::util::projection_identity{},
-                hpx::parallel::util::projection_identity{});
+                hpx::parallel::util::projection_identity{}, is_segmented{});
         }
 
         // clang-format off
@@ -547,11 +700,12 @@ namespace hpx {
             static_assert((hpx::traits::is_forward_iterator<FwdIter2>::value),
                 "Requires at least forward iterator.");
 
-            using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+            using is_segmented = hpx::parallel::v1::detail::
+                equal_iterators_are_segmented<FwdIter1, FwdIter2>;
 
-            return hpx::parallel::v1::detail::equal().call(
-                std::forward<ExPolicy>(policy), is_seq{}, first1, last1, first2,
-                std::forward<Pred>(op));
+            return hpx::parallel::v1::detail::equal_(
+                std::forward<ExPolicy>(policy), first1, last1, first2,
+                std::forward<Pred>(op), is_segmented{});
         }
 
         // clang-format off
@@ -572,11 +726,12 @@ namespace hpx {
             static_assert((hpx::traits::is_forward_iterator<FwdIter2>::value),
                 "Requires at least forward iterator.");
 
-            using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+            using is_segmented = hpx::parallel::v1::detail::
+                equal_iterators_are_segmented<FwdIter1, FwdIter2>;
 
-            return hpx::parallel::v1::detail::equal().call(
-                std::forward<ExPolicy>(policy), is_seq{}, first1, last1, first2,
-                hpx::parallel::v1::detail::equal_to{});
+            return hpx::parallel::v1::detail::equal_(
+                std::forward<ExPolicy>(policy), first1, last1, first2,
+                hpx::parallel::v1::detail::equal_to{}, is_segmented{});
         }
 
         // clang-format off
@@ -136,7 +136,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
                         });
                 };
 
-                return util::scan_partitioner<ExPolicy, FwdIter2, T>::call(
+                using scan_partitioner_type = util::scan_partitioner<ExPolicy,
+                    FwdIter2, T, void, util::scan_partitioner_single_pass_tag>;
+
+                return scan_partitioner_type::call(
                     std::forward<ExPolicy>(policy),
                     make_zip_iterator(first, dest), count, init,
                     // step 1 performs first part of scan algorithm
@@ -387,6 +387,7 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/find_loop.hpp>
 #include <hpx/parallel/util/invoke_projected.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
@@ -419,6 +420,73 @@ namespace hpx { namespace parallel { inline namespace v1 {
             return first;
         }
 
+        // The comparisons are vectorized for vector-pack execution policies
+        // if the elements are compared directly with a value of their type.
+        template <typename ExPolicy, typename Iter, typename T, typename Proj>
+        struct find_vectorizable
+          : std::integral_constant<bool,
+                util::find_loop_vectorizable<ExPolicy, Iter>::value &&
+                    std::is_same<typename std::decay<Proj>::type,
+                        util::projection_identity>::value &&
+                    std::is_same<T,
+                        typename std::iterator_traits<Iter>::value_type>::value>
+        {
+        };
+
+        template <typename ExPolicy, typename Iter, typename Sent, typename T,
+            typename Proj>
+        constexpr Iter sequential_find(Iter first, Sent last, T const& value,
+            Proj&& proj, std::false_type)
+        {
+            return sequential_find(
+                first, last, value, std::forward<Proj>(proj));
+        }
+
+        template <typename ExPolicy, typename Iter, typename Sent, typename T,
+            typename Proj>
+        Iter sequential_find(
+            Iter first, Sent last, T const& value, Proj&&, std::true_type)
+        {
+            std::size_t count = detail::distance(first, last);
+            return std::next(first,
+                util::find_first_n<ExPolicy>(first, count,
+                    [&value](auto const& v) { return v == value; }));
+        }
+
+        template <typename ExPolicy, typename Iter, typename T, typename Proj,
+            typename Token>
+        void find_partition(Iter it, std::size_t part_size,
+            std::size_t base_idx, T const& value, Proj& proj, Token& tok,
+            std::false_type)
+        {
+            typedef typename std::iterator_traits<Iter>::value_type type;
+
+            util::loop_idx_n(base_idx, it, part_size, tok,
+                [&value, &proj, &tok](type& v, std::size_t i) -> void {
+                    if (hpx::util::invoke(proj, v) == value)
+                    {
+                        tok.cancel(i);
+                    }
+                });
+        }
+
+        template <typename ExPolicy, typename Iter, typename T, typename Proj,
+            typename Token>
+        void find_partition(Iter it, std::size_t part_size,
+            std::size_t base_idx, T const& value, Proj&, Token& tok,
+            std::true_type)
+        {
+            if (tok.was_cancelled(base_idx))
+                return;
+
+            std::size_t pos = util::find_first_n<ExPolicy>(it, part_size,
+                [&value](auto const& v) { return v == value; });
+            if (pos != part_size)
+            {
+                tok.cancel(base_idx + pos);
+            }
+        }
+
         template <typename FwdIter>
         struct find : public detail::algorithm<find<FwdIter>, FwdIter>
         {
@@ -432,8 +500,9 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static constexpr Iter sequential(ExPolicy, Iter first, Sent last,
                 T const& val, Proj&& proj = Proj())
             {
-                return sequential_find(
-                    first, last, val, std::forward<Proj>(proj));
+                return sequential_find<ExPolicy>(first, last, val,
+                    std::forward<Proj>(proj),
+                    find_vectorizable<ExPolicy, Iter, T, Proj>());
             }
 
             template <typename ExPolicy, typename Iter, typename Sent,
@@ -443,7 +512,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 Proj&& proj = Proj())
             {
                 typedef util::detail::algorithm_result<ExPolicy, Iter> result;
-                typedef typename std::iterator_traits<Iter>::value_type type;
                 typedef typename std::iterator_traits<Iter>::difference_type
                     difference_type;
 
@@ -456,13 +524,9 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 auto f1 = [val, proj = std::forward<Proj>(proj), tok](Iter it,
                               std::size_t part_size,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_size, tok,
-                        [&val, &proj, &tok](type& v, std::size_t i) -> void {
-                            if (hpx::util::invoke(proj, v) == val)
-                            {
-                                tok.cancel(i);
-                            }
-                        });
+                    find_partition<ExPolicy>(it, part_size, base_idx, val,
+                        proj, tok,
+                        find_vectorizable<ExPolicy, Iter, T, Proj>());
                 };
 
                 auto f2 =
@@ -19,6 +19,7 @@
 #include <hpx/parallel/algorithms/for_each.hpp>
 #include <hpx/parallel/algorithms/mismatch.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/find_loop.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
@@ -35,6 +36,95 @@ namespace hpx { namespace parallel { inline namespace v1 {
     // lexicographical_compare
     namespace detail {
         /// \cond NOINTERNAL
+
+        // The comparisons are vectorized for vector-pack execution policies
+        // if the elements are compared using the default predicate.
+        template <typename ExPolicy, typename Iter1, typename Iter2,
+            typename Pred>
+        struct lexicographical_compare_vectorizable
+          : std::integral_constant<bool,
+                util::find_loop2_vectorizable<ExPolicy, Iter1, Iter2>::value &&
+                    std::is_same<typename std::decay<Pred>::type,
+                        detail::less>::value>
+        {
+        };
+
+        // Return the offset of the first pair of elements in the given
+        // sequences which are not equivalent.
+        template <typename ExPolicy, typename Iter1, typename Iter2>
+        std::size_t lexicographical_compare_n(
+            Iter1 first1, Iter2 first2, std::size_t count)
+        {
+            return util::find_first2_n<ExPolicy>(first1, first2, count,
+                [](auto const& v1, auto const& v2) {
+                    return v1 < v2 || v2 < v1;
+                });
+        }
+
+        template <typename ExPolicy, typename InIter1, typename InIter2,
+            typename Pred>
+        bool sequential_lexicographical_compare(InIter1 first1, InIter1 last1,
+            InIter2 first2, InIter2 last2, Pred&& pred, std::false_type)
+        {
+            return std::lexicographical_compare(
+                first1, last1, first2, last2, pred);
+        }
+
+        template <typename ExPolicy, typename InIter1, typename InIter2,
+            typename Pred>
+        bool sequential_lexicographical_compare(InIter1 first1, InIter1 last1,
+            InIter2 first2, InIter2 last2, Pred&&, std::true_type)
+        {
+            std::size_t count1 = std::distance(first1, last1);
+            std::size_t count2 = std::distance(first2, last2);
+            std::size_t count = (std::min)(count1, count2);
+
+            std::size_t pos =
+                lexicographical_compare_n<ExPolicy>(first1, first2, count);
+            if (pos != count)
+                return *std::next(first1, pos) < *std::next(first2, pos);
+
+            return count1 < count2;
+        }
+
+        template <typename ExPolicy, typename ZipIter, typename Pred,
+            typename Token>
+        void lexicographical_compare_partition(ZipIter it,
+            std::size_t part_count, std::size_t base_idx, Pred& pred,
+            Token& tok, std::false_type)
+        {
+            typedef typename ZipIter::reference reference;
+
+            util::loop_idx_n(base_idx, it, part_count, tok,
+                [&pred, &tok](reference t, std::size_t i) -> void {
+                    using hpx::get;
+                    using hpx::util::invoke;
+                    if (invoke(pred, get<0>(t), get<1>(t)) ||
+                        invoke(pred, get<1>(t), get<0>(t)))
+                    {
+                        tok.cancel(i);
+                    }
+                });
+        }
+
+        template <typename ExPolicy, typename ZipIter, typename Pred,
+            typename Token>
+        void lexicographical_compare_partition(ZipIter it,
+            std::size_t part_count, std::size_t base_idx, Pred&, Token& tok,
+            std::true_type)
+        {
+            if (tok.was_cancelled(base_idx))
+                return;
+
+            auto const& iters = it.get_iterator_tuple();
+            std::size_t pos = lexicographical_compare_n<ExPolicy>(
+                hpx::get<0>(iters), hpx::get<1>(iters), part_count);
+            if (pos != part_count)
+            {
+                tok.cancel(base_idx + pos);
+            }
+        }
+
         struct lexicographical_compare
           : public detail::algorithm<lexicographical_compare, bool>
         {
@@ -48,8 +138,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static bool sequential(ExPolicy, InIter1 first1, InIter1 last1,
                 InIter2 first2, InIter2 last2, Pred&& pred)
             {
-                return std::lexicographical_compare(
-                    first1, last1, first2, last2, pred);
+                return sequential_lexicographical_compare<ExPolicy>(first1,
+                    last1, first2, last2, std::forward<Pred>(pred),
+                    lexicographical_compare_vectorizable<ExPolicy, InIter1,
+                        InIter2, Pred>());
             }
 
             template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
@@ -60,7 +152,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
             {
                 typedef hpx::util::zip_iterator<FwdIter1, FwdIter2>
                     zip_iterator;
-                typedef typename zip_iterator::reference reference;
 
                 std::size_t count1 = std::distance(first1, last1);
                 std::size_t count2 = std::distance(first2, last2);
@@ -84,16 +175,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 auto f1 = [tok, pred](zip_iterator it, std::size_t part_count,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_count, tok,
-                        [&pred, &tok](reference t, std::size_t i) -> void {
-                            using hpx::get;
-                            using hpx::util::invoke;
-                            if (invoke(pred, get<0>(t), get<1>(t)) ||
-                                invoke(pred, get<1>(t), get<0>(t)))
-                            {
-                                tok.cancel(i);
-                            }
-                        });
+                    lexicographical_compare_partition<ExPolicy>(it, part_count,
+                        base_idx, pred, tok,
+                        lexicographical_compare_vectorizable<ExPolicy,
+                            FwdIter1, FwdIter2, Pred>());
                 };
 
                 auto f2 =
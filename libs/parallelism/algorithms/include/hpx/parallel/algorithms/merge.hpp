@@ -174,6 +174,7 @@ namespace hpx {
 #include <hpx/iterator_support/traits/is_iterator.hpp>
 
 #include <hpx/algorithms/traits/projected.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
 #include <hpx/execution/algorithms/detail/is_negative.hpp>
 #include <hpx/execution/algorithms/detail/predicates.hpp>
 #include <hpx/executors/execution_policy.hpp>
@@ -455,6 +456,44 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 }
             }
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Iter1, typename Iter2, typename Iter3>
+        struct merge_iterators_are_segmented
+          : std::integral_constant<bool,
+                hpx::traits::is_segmented_iterator<Iter1>::value &&
+                    hpx::traits::is_segmented_iterator<Iter2>::value &&
+                    hpx::traits::is_segmented_iterator<Iter3>::value>
+        {
+        };
+
+        // non-segmented implementation
+        template <typename ExPolicy, typename RandIter1, typename RandIter2,
+            typename RandIter3, typename Comp, typename Proj1, typename Proj2>
+        inline typename util::detail::algorithm_result<ExPolicy,
+            util::in_in_out_result<RandIter1, RandIter2, RandIter3>>::type
+        merge_(ExPolicy&& policy, RandIter1 first1, RandIter1 last1,
+            RandIter2 first2, RandIter2 last2, RandIter3 dest, Comp&& comp,
+            Proj1&& proj1, Proj2&& proj2, std::false_type)
+        {
+            using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+            using result_type =
+                util::in_in_out_result<RandIter1, RandIter2, RandIter3>;
+
+            return merge<result_type>().call(std::forward<ExPolicy>(policy),
+                is_seq(), first1, last1, first2, last2, dest,
+                std::forward<Comp>(comp), std::forward<Proj1>(proj1),
+                std::forward<Proj2>(proj2));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename RandIter1, typename RandIter2,
+            typename RandIter3, typename Comp, typename Proj1, typename Proj2>
+        typename util::detail::algorithm_result<ExPolicy,
+            util::in_in_out_result<RandIter1, RandIter2, RandIter3>>::type
+        merge_(ExPolicy&& policy, RandIter1 first1, RandIter1 last1,
+            RandIter2 first2, RandIter2 last2, RandIter3 dest, Comp&& comp,
+            Proj1&& proj1, Proj2&& proj2, std::true_type);
         /// \endcond
     }    // namespace detail
 
@@ -498,18 +537,17 @@ namespace hpx { namespace parallel { inline namespace v1 {
             (hpx::traits::is_random_access_iterator<RandIter3>::value),
             "Requires at least random access iterator.");
 
-        using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
-        using result_type =
-            util::in_in_out_result<RandIter1, RandIter2, RandIter3>;
+        using is_segmented = detail::merge_iterators_are_segmented<RandIter1,
+            RandIter2, RandIter3>;
 
 #if defined(HPX_GCC_VERSION) && HPX_GCC_VERSION >= 100000
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 #endif
-        return detail::merge<result_type>().call(std::forward<ExPolicy>(policy),
-            is_seq(), first1, last1, first2, last2, dest,
-            std::forward<Comp>(comp), std::forward<Proj1>(proj1),
-            std::forward<Proj2>(proj2));
+        return detail::merge_(std::forward<ExPolicy>(policy), first1, last1,
+            first2, last2, dest, std::forward<Comp>(comp),
+            std::forward<Proj1>(proj1), std::forward<Proj2>(proj2),
+            is_segmented());
 #if defined(HPX_GCC_VERSION) && HPX_GCC_VERSION >= 100000
 #pragma GCC diagnostic pop
 #endif
@@ -824,16 +862,16 @@ namespace hpx {
                 (hpx::traits::is_random_access_iterator<RandIter3>::value),
                 "Requires at least random access iterator.");
 
-            using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
-            using result_type = hpx::parallel::util::in_in_out_result<RandIter1,
-                RandIter2, RandIter3>;
+            using is_segmented = hpx::parallel::v1::detail::
+                merge_iterators_are_segmented<RandIter1, RandIter2, RandIter3>;
 
             return hpx::parallel::util::get_third_element(
-                hpx::parallel::v1::detail::merge<result_type>().call(
-                    std::forward<ExPolicy>(policy), is_seq(), first1, last1,
-                    first2, last2, dest, std::forward<Comp>(comp),
+                hpx::parallel::v1::detail::merge_(
+                    std::forward<ExPolicy>(policy), first1, last1, first2,
+                    last2, dest, std::forward<Comp>(comp),
                     hpx::parallel::util::projection_identity(),
-                    hpx::parallel::util::projection_identity()));
+                    hpx::parallel::util::projection_identity(),
+                    is_segmented()));
         }
 
         // clang-format off
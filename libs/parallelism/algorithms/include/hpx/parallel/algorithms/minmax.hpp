@@ -19,12 +19,15 @@
 #include <hpx/parallel/util/tagged_pair.hpp>
 
 #include <hpx/algorithms/traits/projected.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/tagspec.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/find_loop.hpp>
 #include <hpx/parallel/util/loop.hpp>
+#include <hpx/parallel/util/minmax_loop.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
 #include <hpx/parallel/util/projection_identity.hpp>
 
@@ -40,16 +43,30 @@ namespace hpx { namespace parallel { inline namespace v1 {
     // min_element
     namespace detail {
         /// \cond NOINTERNAL
+
+        // The comparisons are vectorized for vector-pack execution policies
+        // if the elements are compared using the default predicate.
+        template <typename ExPolicy, typename Iter, typename F, typename Proj>
+        struct minmax_vectorizable
+          : std::integral_constant<bool,
+                util::find_loop_vectorizable<ExPolicy, Iter>::value &&
+                    std::is_same<typename std::decay<F>::type,
+                        detail::less>::value &&
+                    std::is_same<typename std::decay<Proj>::type,
+                        util::projection_identity>::value>
+        {
+        };
+
         template <typename ExPolicy, typename FwdIter, typename F,
             typename Proj>
-        FwdIter sequential_min_element(ExPolicy&& policy, FwdIter it,
-            std::size_t count, F const& f, Proj const& proj)
+        FwdIter sequential_min_element(ExPolicy&&, FwdIter it,
+            std::size_t count, F const& f, Proj const& proj, std::false_type)
         {
             if (count == 0 || count == 1)
                 return it;
 
             FwdIter smallest = it;
-            util::loop_n<ExPolicy>(++it, count - 1,
+            util::loop_n<hpx::execution::sequenced_policy>(++it, count - 1,
                 [&f, &smallest, &proj](FwdIter const& curr) -> void {
                     if (hpx::util::invoke(f, hpx::util::invoke(proj, *curr),
                             hpx::util::invoke(proj, *smallest)))
@@ -61,6 +78,24 @@ namespace hpx { namespace parallel { inline namespace v1 {
             return smallest;
         }
 
+        template <typename ExPolicy, typename FwdIter, typename F,
+            typename Proj>
+        FwdIter sequential_min_element(ExPolicy&&, FwdIter it,
+            std::size_t count, F const&, Proj const&, std::true_type)
+        {
+            return std::next(it, util::min_element_n<ExPolicy>(it, count));
+        }
+
+        template <typename ExPolicy, typename FwdIter, typename F,
+            typename Proj>
+        FwdIter sequential_min_element(ExPolicy&& policy, FwdIter it,
+            std::size_t count, F const& f, Proj const& proj)
+        {
+            return sequential_min_element(std::forward<ExPolicy>(policy), it,
+                count, f, proj,
+                minmax_vectorizable<ExPolicy, FwdIter, F, Proj>());
+        }
+
         ///////////////////////////////////////////////////////////////////////
         template <typename Iter>
         struct min_element : public detail::algorithm<min_element<Iter>, Iter>
@@ -70,7 +105,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
             template <typename ExPolicy, typename FwdIter, typename F,
                 typename Proj>
             static typename std::iterator_traits<FwdIter>::value_type
-            sequential_minmax_element_ind(ExPolicy&& policy, FwdIter it,
+            sequential_minmax_element_ind(ExPolicy&&, FwdIter it,
                 std::size_t count, F const& f, Proj const& proj)
             {
                 HPX_ASSERT(count != 0);
@@ -80,7 +115,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 typename std::iterator_traits<FwdIter>::value_type smallest =
                     *it;
-                util::loop_n<ExPolicy>(++it, count - 1,
+                util::loop_n<hpx::execution::sequenced_policy>(++it, count - 1,
                     [&f, &smallest, &proj](FwdIter const& curr) -> void {
                         if (hpx::util::invoke(f,
                                 hpx::util::invoke(proj, **curr),
@@ -100,14 +135,33 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
             template <typename ExPolicy, typename FwdIter, typename F,
                 typename Proj>
-            static FwdIter sequential(
-                ExPolicy, FwdIter first, FwdIter last, F&& f, Proj&& proj)
+            static FwdIter sequential(ExPolicy policy, FwdIter first,
+                FwdIter last, F&& f, Proj&& proj)
+            {
+                return sequential(policy, first, last, std::forward<F>(f),
+                    std::forward<Proj>(proj),
+                    minmax_vectorizable<ExPolicy, FwdIter, F, Proj>());
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename F,
+                typename Proj>
+            static FwdIter sequential(ExPolicy, FwdIter first, FwdIter last,
+                F&& f, Proj&& proj, std::false_type)
             {
                 return std::min_element(first, last,
                     util::compare_projected<F, Proj>(
                         std::forward<F>(f), std::forward<Proj>(proj)));
             }
 
+            template <typename ExPolicy, typename FwdIter, typename F,
+                typename Proj>
+            static FwdIter sequential(ExPolicy policy, FwdIter first,
+                FwdIter last, F&& f, Proj&& proj, std::true_type)
+            {
+                return sequential_min_element(policy, first,
+                    std::distance(first, last), f, proj, std::true_type());
+            }
+
             template <typename ExPolicy, typename FwdIter, typename F,
                 typename Proj>
             static
@@ -257,14 +311,14 @@ namespace hpx { namespace parallel { inline namespace v1 {
         /// \cond NOINTERNAL
         template <typename ExPolicy, typename FwdIter, typename F,
             typename Proj>
-        FwdIter sequential_max_element(ExPolicy&& policy, FwdIter it,
-            std::size_t count, F const& f, Proj const& proj)
+        FwdIter sequential_max_element(ExPolicy&&, FwdIter it,
+            std::size_t count, F const& f, Proj const& proj, std::false_type)
         {
             if (count == 0 || count == 1)
                 return it;
 
             FwdIter greatest = it;
-            util::loop_n<ExPolicy>(++it, count - 1,
+            util::loop_n<hpx::execution::sequenced_policy>(++it, count - 1,
                 [&f, &greatest, &proj](FwdIter const& curr) -> void {
                     if (hpx::util::invoke(f, hpx::util::invoke(proj, *greatest),
                             hpx::util::invoke(proj, *curr)))
@@ -276,6 +330,24 @@ namespace hpx { namespace parallel { inline namespace v1 {
             return greatest;
         }
 
+        template <typename ExPolicy, typename FwdIter, typename F,
+            typename Proj>
+        FwdIter sequential_max_element(ExPolicy&&, FwdIter it,
+            std::size_t count, F const&, Proj const&, std::true_type)
+        {
+            return std::next(it, util::max_element_n<ExPolicy>(it, count));
+        }
+
+        template <typename ExPolicy, typename FwdIter, typename F,
+            typename Proj>
+        FwdIter sequential_max_element(ExPolicy&& policy, FwdIter it,
+            std::size_t count, F const& f, Proj const& proj)
+        {
+            return sequential_max_element(std::forward<ExPolicy>(policy), it,
+                count, f, proj,
+                minmax_vectorizable<ExPolicy, FwdIter, F, Proj>());
+        }
+
         ///////////////////////////////////////////////////////////////////////
         template <typename Iter>
         struct max_element : public detail::algorithm<max_element<Iter>, Iter>
@@ -285,7 +357,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
             template <typename ExPolicy, typename FwdIter, typename F,
                 typename Proj>
             static typename std::iterator_traits<FwdIter>::value_type
-            sequential_minmax_element_ind(ExPolicy&& policy, FwdIter it,
+            sequential_minmax_element_ind(ExPolicy&&, FwdIter it,
                 std::size_t count, F const& f, Proj const& proj)
             {
                 HPX_ASSERT(count != 0);
@@ -295,7 +367,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 typename std::iterator_traits<FwdIter>::value_type greatest =
                     *it;
-                util::loop_n<ExPolicy>(++it, count - 1,
+                util::loop_n<hpx::execution::sequenced_policy>(++it, count - 1,
                     [&f, &greatest, &proj](FwdIter const& curr) -> void {
                         if (hpx::util::invoke(f,
                                 hpx::util::invoke(proj, *greatest),
@@ -315,14 +387,33 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
             template <typename ExPolicy, typename FwdIter, typename F,
                 typename Proj>
-            static FwdIter sequential(
-                ExPolicy, FwdIter first, FwdIter last, F&& f, Proj&& proj)
+            static FwdIter sequential(ExPolicy policy, FwdIter first,
+                FwdIter last, F&& f, Proj&& proj)
+            {
+                return sequential(policy, first, last, std::forward<F>(f),
+                    std::forward<Proj>(proj),
+                    minmax_vectorizable<ExPolicy, FwdIter, F, Proj>());
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename F,
+                typename Proj>
+            static FwdIter sequential(ExPolicy, FwdIter first, FwdIter last,
+                F&& f, Proj&& proj, std::false_type)
             {
                 return std::max_element(first, last,
                     util::compare_projected<F, Proj>(
                         std::forward<F>(f), std::forward<Proj>(proj)));
             }
 
+            template <typename ExPolicy, typename FwdIter, typename F,
+                typename Proj>
+            static FwdIter sequential(ExPolicy policy, FwdIter first,
+                FwdIter last, F&& f, Proj&& proj, std::true_type)
+            {
+                return sequential_max_element(policy, first,
+                    std::distance(first, last), f, proj, std::true_type());
+            }
+
             template <typename ExPolicy, typename FwdIter, typename F,
                 typename Proj>
             static
@@ -473,15 +564,16 @@ namespace hpx { namespace parallel { inline namespace v1 {
         /// \cond NOINTERNAL
         template <typename ExPolicy, typename FwdIter, typename F,
             typename Proj>
-        std::pair<FwdIter, FwdIter> sequential_minmax_element(ExPolicy&& policy,
-            FwdIter it, std::size_t count, F const& f, Proj const& proj)
+        std::pair<FwdIter, FwdIter> sequential_minmax_element(ExPolicy&&,
+            FwdIter it, std::size_t count, F const& f, Proj const& proj,
+            std::false_type)
         {
             std::pair<FwdIter, FwdIter> result(it, it);
 
             if (count == 0 || count == 1)
                 return result;
 
-            util::loop_n<ExPolicy>(++it, count - 1,
+            util::loop_n<hpx::execution::sequenced_policy>(++it, count - 1,
                 [&f, &result, &proj](FwdIter const& curr) -> void {
                     if (hpx::util::invoke(f, hpx::util::invoke(proj, *curr),
                             hpx::util::invoke(proj, *result.first)))
@@ -499,6 +591,28 @@ namespace hpx { namespace parallel { inline namespace v1 {
             return result;
         }
 
+        template <typename ExPolicy, typename FwdIter, typename F,
+            typename Proj>
+        std::pair<FwdIter, FwdIter> sequential_minmax_element(ExPolicy&&,
+            FwdIter it, std::size_t count, F const&, Proj const&,
+            std::true_type)
+        {
+            std::pair<std::size_t, std::size_t> result =
+                util::minmax_element_n<ExPolicy>(it, count);
+            return std::make_pair(
+                std::next(it, result.first), std::next(it, result.second));
+        }
+
+        template <typename ExPolicy, typename FwdIter, typename F,
+            typename Proj>
+        std::pair<FwdIter, FwdIter> sequential_minmax_element(ExPolicy&& policy,
+            FwdIter it, std::size_t count, F const& f, Proj const& proj)
+        {
+            return sequential_minmax_element(std::forward<ExPolicy>(policy),
+                it, count, f, proj,
+                minmax_vectorizable<ExPolicy, FwdIter, F, Proj>());
+        }
+
         template <typename Iter>
         struct minmax_element
           : public detail::algorithm<minmax_element<Iter>,
@@ -509,7 +623,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
             template <typename ExPolicy, typename PairIter, typename F,
                 typename Proj>
             static typename std::iterator_traits<PairIter>::value_type
-            sequential_minmax_element_ind(ExPolicy&& policy, PairIter it,
+            sequential_minmax_element_ind(ExPolicy&&, PairIter it,
                 std::size_t count, F const& f, Proj const& proj)
             {
                 HPX_ASSERT(count != 0);
@@ -519,7 +633,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 typename std::iterator_traits<PairIter>::value_type result =
                     *it;
-                util::loop_n<ExPolicy>(++it, count - 1,
+                util::loop_n<hpx::execution::sequenced_policy>(++it, count - 1,
                     [&f, &result, &proj](PairIter const& curr) -> void {
                         if (hpx::util::invoke(f,
                                 hpx::util::invoke(proj, *curr->first),
@@ -546,14 +660,35 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
             template <typename ExPolicy, typename FwdIter, typename F,
                 typename Proj>
-            static std::pair<FwdIter, FwdIter> sequential(
-                ExPolicy, FwdIter first, FwdIter last, F&& f, Proj&& proj)
+            static std::pair<FwdIter, FwdIter> sequential(ExPolicy policy,
+                FwdIter first, FwdIter last, F&& f, Proj&& proj)
+            {
+                return sequential(policy, first, last, std::forward<F>(f),
+                    std::forward<Proj>(proj),
+                    minmax_vectorizable<ExPolicy, FwdIter, F, Proj>());
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename F,
+                typename Proj>
+            static std::pair<FwdIter, FwdIter> sequential(ExPolicy,
+                FwdIter first, FwdIter last, F&& f, Proj&& proj,
+                std::false_type)
             {
                 return std::minmax_element(first, last,
                     util::compare_projected<F, Proj>(
                         std::forward<F>(f), std::forward<Proj>(proj)));
             }
 
+            template <typename ExPolicy, typename FwdIter, typename F,
+                typename Proj>
+            static std::pair<FwdIter, FwdIter> sequential(ExPolicy policy,
+                FwdIter first, FwdIter last, F&& f, Proj&& proj,
+                std::true_type)
+            {
+                return sequential_minmax_element(policy, first,
+                    std::distance(first, last), f, proj, std::true_type());
+            }
+
             template <typename ExPolicy, typename FwdIter, typename F,
                 typename Proj>
             static typename util::detail::algorithm_result<ExPolicy,
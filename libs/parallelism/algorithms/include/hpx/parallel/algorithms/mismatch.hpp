@@ -182,8 +182,10 @@ namespace hpx {
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/find_loop.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
 #include <hpx/parallel/util/result_types.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
 
@@ -215,6 +217,94 @@ namespace hpx { namespace parallel { inline namespace v1 {
             return {first1, first2};
         }
 
+        // The comparisons are vectorized for vector-pack execution policies
+        // if the elements are compared using the default predicate.
+        template <typename ExPolicy, typename Iter1, typename Iter2,
+            typename F, typename Proj1 = util::projection_identity,
+            typename Proj2 = util::projection_identity>
+        struct mismatch_vectorizable
+          : std::integral_constant<bool,
+                util::find_loop2_vectorizable<ExPolicy, Iter1, Iter2>::value &&
+                    std::is_same<typename std::decay<F>::type,
+                        detail::equal_to>::value &&
+                    std::is_same<typename std::decay<Proj1>::type,
+                        util::projection_identity>::value &&
+                    std::is_same<typename std::decay<Proj2>::type,
+                        util::projection_identity>::value>
+        {
+        };
+
+        template <typename ExPolicy, typename Iter1, typename Iter2>
+        std::size_t mismatch_n(Iter1 first1, Iter2 first2, std::size_t count)
+        {
+            return util::find_first2_n<ExPolicy>(first1, first2, count,
+                [](auto const& v1, auto const& v2) { return !(v1 == v2); });
+        }
+
+        template <typename ExPolicy, typename Iter1, typename Sent1,
+            typename Iter2, typename Sent2, typename F, typename Proj1,
+            typename Proj2>
+        util::in_in_result<Iter1, Iter2> sequential_mismatch_binary(
+            Iter1 first1, Sent1 last1, Iter2 first2, Sent2 last2, F&& f,
+            Proj1&& proj1, Proj2&& proj2, std::false_type)
+        {
+            return sequential_mismatch_binary(first1, last1, first2, last2,
+                std::forward<F>(f), std::forward<Proj1>(proj1),
+                std::forward<Proj2>(proj2));
+        }
+
+        template <typename ExPolicy, typename Iter1, typename Sent1,
+            typename Iter2, typename Sent2, typename F, typename Proj1,
+            typename Proj2>
+        util::in_in_result<Iter1, Iter2> sequential_mismatch_binary(
+            Iter1 first1, Sent1 last1, Iter2 first2, Sent2 last2, F&&,
+            Proj1&&, Proj2&&, std::true_type)
+        {
+            std::size_t count1 = detail::distance(first1, last1);
+            std::size_t count2 = detail::distance(first2, last2);
+
+            std::size_t pos = mismatch_n<ExPolicy>(
+                first1, first2, (std::min)(count1, count2));
+            return {std::next(first1, pos), std::next(first2, pos)};
+        }
+
+        template <typename ExPolicy, typename ZipIter, typename F,
+            typename Proj1, typename Proj2, typename Token>
+        void mismatch_partition(ZipIter it, std::size_t part_count,
+            std::size_t base_idx, F& f, Proj1& proj1, Proj2& proj2,
+            Token& tok, std::false_type)
+        {
+            typedef typename ZipIter::reference reference;
+
+            util::loop_idx_n(base_idx, it, part_count, tok,
+                [&f, &proj1, &proj2, &tok](reference t, std::size_t i) {
+                    if (!hpx::util::invoke(f,
+                            hpx::util::invoke(proj1, hpx::get<0>(t)),
+                            hpx::util::invoke(proj2, hpx::get<1>(t))))
+                    {
+                        tok.cancel(i);
+                    }
+                });
+        }
+
+        template <typename ExPolicy, typename ZipIter, typename F,
+            typename Proj1, typename Proj2, typename Token>
+        void mismatch_partition(ZipIter it, std::size_t part_count,
+            std::size_t base_idx, F&, Proj1&, Proj2&, Token& tok,
+            std::true_type)
+        {
+            if (tok.was_cancelled(base_idx))
+                return;
+
+            auto const& iters = it.get_iterator_tuple();
+            std::size_t pos = mismatch_n<ExPolicy>(
+                hpx::get<0>(iters), hpx::get<1>(iters), part_count);
+            if (pos != part_count)
+            {
+                tok.cancel(base_idx + pos);
+            }
+        }
+
         template <typename IterPair>
         struct mismatch_binary
           : public detail::algorithm<mismatch_binary<IterPair>, IterPair>
@@ -231,9 +321,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 Iter1 first1, Sent1 last1, Iter2 first2, Sent2 last2, F&& f,
                 Proj1&& proj1, Proj2&& proj2)
             {
-                return sequential_mismatch_binary(first1, last1, first2, last2,
-                    std::forward<F>(f), std::forward<Proj1>(proj1),
-                    std::forward<Proj2>(proj2));
+                return sequential_mismatch_binary<ExPolicy>(first1, last1,
+                    first2, last2, std::forward<F>(f),
+                    std::forward<Proj1>(proj1), std::forward<Proj2>(proj2),
+                    mismatch_vectorizable<ExPolicy, Iter1, Iter2, F, Proj1,
+                        Proj2>());
             }
 
             template <typename ExPolicy, typename Iter1, typename Sent1,
@@ -273,7 +365,6 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 }
 
                 typedef hpx::util::zip_iterator<Iter1, Iter2> zip_iterator;
-                typedef typename zip_iterator::reference reference;
 
                 util::cancellation_token<std::size_t> tok(count1);
 
@@ -282,15 +373,10 @@ namespace hpx { namespace parallel { inline namespace v1 {
                               proj2 = std::forward<Proj2>(proj2)](
                               zip_iterator it, std::size_t part_count,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_count, tok,
-                        [&f, &proj1, &proj2, &tok](reference t, std::size_t i) {
-                            if (!hpx::util::invoke(f,
-                                    hpx::util::invoke(proj1, hpx::get<0>(t)),
-                                    hpx::util::invoke(proj2, hpx::get<1>(t))))
-                            {
-                                tok.cancel(i);
-                            }
-                        });
+                    mismatch_partition<ExPolicy>(it, part_count, base_idx, f,
+                        proj1, proj2, tok,
+                        mismatch_vectorizable<ExPolicy, Iter1, Iter2, F, Proj1,
+                            Proj2>());
                 };
 
                 auto f2 = [=](std::vector<hpx::future<void>>&&) mutable
@@ -380,6 +466,25 @@ namespace hpx { namespace parallel { inline namespace v1 {
     // mismatch
     namespace detail {
 
+        template <typename ExPolicy, typename InIter1, typename InIter2,
+            typename F>
+        std::pair<InIter1, InIter2> sequential_mismatch(InIter1 first1,
+            InIter1 last1, InIter2 first2, F&& f, std::false_type)
+        {
+            return std::mismatch(first1, last1, first2, std::forward<F>(f));
+        }
+
+        template <typename ExPolicy, typename InIter1, typename InIter2,
+            typename F>
+        std::pair<InIter1, InIter2> sequential_mismatch(InIter1 first1,
+            InIter1 last1, InIter2 first2, F&&, std::true_type)
+        {
+            std::size_t pos = mismatch_n<ExPolicy>(
+                first1, first2, std::distance(first1, last1));
+            return std::make_pair(
+                std::next(first1, pos), std::next(first2, pos));
+        }
+
         template <typename IterPair>
         struct mismatch : public detail::algorithm<mismatch<IterPair>, IterPair>
         {
@@ -393,7 +498,9 @@ namespace hpx { namespace parallel { inline namespace v1 {
             static IterPair sequential(
                 ExPolicy, InIter1 first1, InIter1 last1, InIter2 first2, F&& f)
             {
-                return std::mismatch(first1, last1, first2, std::forward<F>(f));
+                return sequential_mismatch<ExPolicy>(first1, last1, first2,
+                    std::forward<F>(f),
+                    mismatch_vectorizable<ExPolicy, InIter1, InIter2, F>());
             }
 
             template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
@@ -415,21 +522,17 @@ namespace hpx { namespace parallel { inline namespace v1 {
 
                 typedef hpx::util::zip_iterator<FwdIter1, FwdIter2>
                     zip_iterator;
-                typedef typename zip_iterator::reference reference;
 
                 util::cancellation_token<std::size_t> tok(count);
 
                 auto f1 = [tok, f = std::forward<F>(f)](zip_iterator it,
                               std::size_t part_count,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_count, tok,
-                        [&f, &tok](reference t, std::size_t i) {
-                            if (!hpx::util::invoke(
-                                    f, hpx::get<0>(t), hpx::get<1>(t)))
-                            {
-                                tok.cancel(i);
-                            }
-                        });
+                    util::projection_identity proj;
+                    mismatch_partition<ExPolicy>(it, part_count, base_idx, f,
+                        proj, proj, tok,
+                        mismatch_vectorizable<ExPolicy, FwdIter1, FwdIter2,
+                            F>());
                 };
                 auto f2 = [=](std::vector<hpx::future<void>>&&) mutable
                     -> std::pair<FwdIter1, FwdIter2> {
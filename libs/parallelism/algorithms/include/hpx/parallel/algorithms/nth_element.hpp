@@ -0,0 +1,258 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/nth_element.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace hpx {
+    // clang-format off
+
+    /// Rearranges the elements in the range [first, last) such that the
+    /// element pointed at by \a nth is changed to whatever element would
+    /// occur in that position if [first, last) were sorted and all of the
+    /// elements before this new \a nth element are less than or equal to the
+    /// elements after the new \a nth element.
+    ///
+    /// \note Complexity: O(N) comparisons on average, where
+    ///       \a N = distance(first, last).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution of
+    ///                     the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RandomIt    The type of the source iterators used for algorithm.
+    ///                     This iterator must meet the requirements for a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). This defaults to std::less<>.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     of that the algorithm will be applied to.
+    /// \param nth          Refers to the element that will hold the nth
+    ///                     element of the sorted sequence afterwards.
+    /// \param last         Refers to the end of the sequence of elements of
+    ///                     that the algorithm will be applied to.
+    /// \param comp         Refers to the binary predicate which returns true
+    ///                     if the first argument should be treated as less than
+    ///                     the second. The signature of the function should be
+    ///                     equivalent to
+    ///                     \code
+    ///                     bool comp(const Type &a, const Type &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const &, but
+    ///                     the function must not modify the objects passed to
+    ///                     it. The type \a Type must be such that objects of
+    ///                     types \a RandomIt can be dereferenced and then
+    ///                     implicitly converted to Type.
+    ///
+    /// The comparison operations in the parallel \a nth_element algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the calling
+    /// thread.
+    ///
+    /// The comparison operations in the parallel \a nth_element algorithm
+    /// invoked with an execution policy object of type \a parallel_policy
+    /// or \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// The parallel version selects the nth element based on a sample of the
+    /// elements and moves the elements through a temporary buffer of the
+    /// size of the input sequence. It falls back to std::nth_element if the
+    /// value type of \a RandomIt is not default constructible.
+    ///
+    /// \returns  The \a nth_element algorithm returns a \a hpx::future<void>
+    ///           if the execution policy is of type \a sequenced_task_policy
+    ///           or \a parallel_task_policy and returns \a void otherwise.
+    ///
+    template <typename ExPolicy, typename RandomIt,
+        typename Comp = hpx::parallel::v1::detail::less>
+    typename util::detail::algorithm_result<ExPolicy>::type nth_element(
+        ExPolicy&& policy, RandomIt first, RandomIt nth, RandomIt last,
+        Comp&& comp = Comp());
+
+    // clang-format on
+}    // namespace hpx
+
+#else    // DOXYGEN
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+
+#include <hpx/algorithms/traits/projected.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/executors/exception_list.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/nth_element.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // nth_element
+    namespace detail {
+        /// \cond NOINTERNAL
+        template <typename RandomIt>
+        struct nth_element
+          : public detail::algorithm<nth_element<RandomIt>, RandomIt>
+        {
+            nth_element()
+              : nth_element::algorithm("nth_element")
+            {
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static RandomIt sequential(ExPolicy, RandomIt first, RandomIt nth,
+                RandomIt last, Compare&& comp, Proj&& proj)
+            {
+                std::nth_element(first, nth, last,
+                    util::compare_projected<Compare, Proj>(
+                        std::forward<Compare>(comp), std::forward<Proj>(proj)));
+                return last;
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                RandomIt>::type
+            parallel(ExPolicy&& policy, RandomIt first, RandomIt nth,
+                RandomIt last, Compare&& comp, Proj&& proj)
+            {
+                typedef util::detail::algorithm_result<ExPolicy, RandomIt>
+                    algorithm_result;
+
+                try
+                {
+                    util::compare_projected<Compare, Proj> f(
+                        std::forward<Compare>(comp), std::forward<Proj>(proj));
+
+                    parallel_nth_element(policy, first, nth, last, f);
+                    return algorithm_result::get(std::move(last));
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandomIt>::call(
+                            std::current_exception()));
+                }
+            }
+
+            template <typename Compare, typename Proj>
+            static typename util::detail::algorithm_result<
+                hpx::execution::parallel_task_policy, RandomIt>::type
+            parallel(hpx::execution::parallel_task_policy policy,
+                RandomIt first, RandomIt nth, RandomIt last, Compare&& comp,
+                Proj&& proj)
+            {
+                return execution::async_execute(policy.executor(),
+                    [=, comp = std::forward<Compare>(comp),
+                        proj = std::forward<Proj>(proj)]() mutable -> RandomIt {
+                        try
+                        {
+                            util::compare_projected<Compare&, Proj&> f(
+                                comp, proj);
+
+                            parallel_nth_element(policy, first, nth, last, f);
+                            return last;
+                        }
+                        catch (...)
+                        {
+                            // report errors as the synchronous version does
+                            return detail::handle_exception<
+                                hpx::execution::parallel_policy,
+                                RandomIt>::call(std::current_exception());
+                        }
+                    });
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
+
+namespace hpx {
+
+    // CPO for hpx::nth_element
+    HPX_INLINE_CONSTEXPR_VARIABLE struct nth_element_t final
+      : hpx::functional::tag<nth_element_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RandomIt,
+            typename Comp = hpx::parallel::v1::detail::less,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_iterator<RandomIt>::value &&
+                hpx::parallel::traits::is_indirect_callable<ExPolicy, Comp,
+                    hpx::parallel::traits::projected<
+                        hpx::parallel::util::projection_identity, RandomIt>,
+                    hpx::parallel::traits::projected<
+                        hpx::parallel::util::projection_identity, RandomIt>
+                >::value
+            )>
+        // clang-format on
+        friend typename hpx::parallel::util::detail::algorithm_result<
+            ExPolicy>::type
+        tag_invoke(nth_element_t, ExPolicy&& policy, RandomIt first,
+            RandomIt nth, RandomIt last, Comp&& comp = Comp())
+        {
+            static_assert(
+                hpx::traits::is_random_access_iterator<RandomIt>::value,
+                "Requires random access iterator.");
+
+            using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+
+            return hpx::parallel::util::detail::algorithm_result<ExPolicy>::get(
+                hpx::parallel::v1::detail::nth_element<RandomIt>().call(
+                    std::forward<ExPolicy>(policy), is_seq{}, first, nth, last,
+                    std::forward<Comp>(comp),
+                    hpx::parallel::util::projection_identity{}));
+        }
+
+        // clang-format off
+        template <typename RandomIt,
+            typename Comp = hpx::parallel::v1::detail::less,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_iterator<RandomIt>::value &&
+                hpx::parallel::traits::is_indirect_callable<
+                    hpx::execution::sequenced_policy, Comp,
+                    hpx::parallel::traits::projected<
+                        hpx::parallel::util::projection_identity, RandomIt>,
+                    hpx::parallel::traits::projected<
+                        hpx::parallel::util::projection_identity, RandomIt>
+                >::value
+            )>
+        // clang-format on
+        friend void tag_invoke(nth_element_t, RandomIt first, RandomIt nth,
+            RandomIt last, Comp&& comp = Comp())
+        {
+            static_assert(
+                hpx::traits::is_random_access_iterator<RandomIt>::value,
+                "Requires random access iterator.");
+
+            hpx::parallel::v1::detail::nth_element<RandomIt>().call(
+                hpx::execution::seq, std::true_type{}, first, nth, last,
+                std::forward<Comp>(comp),
+                hpx::parallel::util::projection_identity{});
+        }
+    } nth_element{};
+}    // namespace hpx
+
+#endif    // DOXYGEN
@@ -0,0 +1,275 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/partial_sort.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace hpx {
+    // clang-format off
+
+    /// Rearranges the elements such that the range [first, middle) contains
+    /// the sorted middle - first smallest elements in the range
+    /// [first, last). The order of equal elements is not guaranteed to be
+    /// preserved. The order of the remaining elements in the range
+    /// [middle, last) is unspecified.
+    ///
+    /// \note Complexity: O(N + M * log(M)) comparisons on average, where
+    ///       \a N = distance(first, last) and \a M = distance(first, middle).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution of
+    ///                     the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RandomIt    The type of the source iterators used for algorithm.
+    ///                     This iterator must meet the requirements for a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). This defaults to std::less<>.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     of that the algorithm will be applied to.
+    /// \param middle       Refers to the end of the sequence of elements that
+    ///                     will be sorted.
+    /// \param last         Refers to the end of the sequence of elements of
+    ///                     that the algorithm will be applied to.
+    /// \param comp         Refers to the binary predicate which returns true
+    ///                     if the first argument should be treated as less than
+    ///                     the second. The signature of the function should be
+    ///                     equivalent to
+    ///                     \code
+    ///                     bool comp(const Type &a, const Type &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const &, but
+    ///                     the function must not modify the objects passed to
+    ///                     it. The type \a Type must be such that objects of
+    ///                     types \a RandomIt can be dereferenced and then
+    ///                     implicitly converted to Type.
+    ///
+    /// The comparison operations in the parallel \a partial_sort algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the calling
+    /// thread.
+    ///
+    /// The comparison operations in the parallel \a partial_sort algorithm
+    /// invoked with an execution policy object of type \a parallel_policy
+    /// or \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// The parallel version selects the element ending up at \a middle using
+    /// \a nth_element and sorts the elements before it in parallel.
+    ///
+    /// \returns  The \a partial_sort algorithm returns a \a hpx::future<void>
+    ///           if the execution policy is of type \a sequenced_task_policy
+    ///           or \a parallel_task_policy and returns \a void otherwise.
+    ///
+    template <typename ExPolicy, typename RandomIt,
+        typename Comp = hpx::parallel::v1::detail::less>
+    typename util::detail::algorithm_result<ExPolicy>::type partial_sort(
+        ExPolicy&& policy, RandomIt first, RandomIt middle, RandomIt last,
+        Comp&& comp = Comp());
+
+    // clang-format on
+}    // namespace hpx
+
+#else    // DOXYGEN
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+
+#include <hpx/algorithms/traits/projected.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/executors/exception_list.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/nth_element.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // partial_sort
+    namespace detail {
+        /// \cond NOINTERNAL
+
+        // The function blocks until the elements are sorted, it has to be
+        // called on an HPX thread.
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        RandomIt parallel_partial_sort(ExPolicy&& policy, RandomIt first,
+            RandomIt middle, RandomIt last, Compare& comp)
+        {
+            if (first == middle)
+                return last;
+
+            // move the smallest elements to the front, this is a no-op if
+            // middle == last
+            parallel_nth_element(policy, first, middle, last, comp);
+
+            parallel_sort_async(policy, first, middle, comp).get();
+            return last;
+        }
+
+        template <typename RandomIt>
+        struct partial_sort
+          : public detail::algorithm<partial_sort<RandomIt>, RandomIt>
+        {
+            partial_sort()
+              : partial_sort::algorithm("partial_sort")
+            {
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static RandomIt sequential(ExPolicy, RandomIt first,
+                RandomIt middle, RandomIt last, Compare&& comp, Proj&& proj)
+            {
+                std::partial_sort(first, middle, last,
+                    util::compare_projected<Compare, Proj>(
+                        std::forward<Compare>(comp), std::forward<Proj>(proj)));
+                return last;
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                RandomIt>::type
+            parallel(ExPolicy&& policy, RandomIt first, RandomIt middle,
+                RandomIt last, Compare&& comp, Proj&& proj)
+            {
+                typedef util::detail::algorithm_result<ExPolicy, RandomIt>
+                    algorithm_result;
+
+                try
+                {
+                    util::compare_projected<Compare, Proj> f(
+                        std::forward<Compare>(comp), std::forward<Proj>(proj));
+
+                    return algorithm_result::get(
+                        parallel_partial_sort(policy, first, middle, last, f));
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandomIt>::call(
+                            std::current_exception()));
+                }
+            }
+
+            template <typename Compare, typename Proj>
+            static typename util::detail::algorithm_result<
+                hpx::execution::parallel_task_policy, RandomIt>::type
+            parallel(hpx::execution::parallel_task_policy policy,
+                RandomIt first, RandomIt middle, RandomIt last, Compare&& comp,
+                Proj&& proj)
+            {
+                return execution::async_execute(policy.executor(),
+                    [=, comp = std::forward<Compare>(comp),
+                        proj = std::forward<Proj>(proj)]() mutable -> RandomIt {
+                        try
+                        {
+                            util::compare_projected<Compare&, Proj&> f(
+                                comp, proj);
+
+                            return parallel_partial_sort(
+                                policy, first, middle, last, f);
+                        }
+                        catch (...)
+                        {
+                            // report errors as the synchronous version does
+                            return detail::handle_exception<
+                                hpx::execution::parallel_policy,
+                                RandomIt>::call(std::current_exception());
+                        }
+                    });
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
+
+namespace hpx {
+
+    // CPO for hpx::partial_sort
+    HPX_INLINE_CONSTEXPR_VARIABLE struct partial_sort_t final
+      : hpx::functional::tag<partial_sort_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename RandomIt,
+            typename Comp = hpx::parallel::v1::detail::less,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_iterator<RandomIt>::value &&
+                hpx::parallel::traits::is_indirect_callable<ExPolicy, Comp,
+                    hpx::parallel::traits::projected<
+                        hpx::parallel::util::projection_identity, RandomIt>,
+                    hpx::parallel::traits::projected<
+                        hpx::parallel::util::projection_identity, RandomIt>
+                >::value
+            )>
+        // clang-format on
+        friend typename hpx::parallel::util::detail::algorithm_result<
+            ExPolicy>::type
+        tag_invoke(partial_sort_t, ExPolicy&& policy, RandomIt first,
+            RandomIt middle, RandomIt last, Comp&& comp = Comp())
+        {
+            static_assert(
+                hpx::traits::is_random_access_iterator<RandomIt>::value,
+                "Requires random access iterator.");
+
+            using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+
+            return hpx::parallel::util::detail::algorithm_result<ExPolicy>::get(
+                hpx::parallel::v1::detail::partial_sort<RandomIt>().call(
+                    std::forward<ExPolicy>(policy), is_seq{}, first, middle,
+                    last, std::forward<Comp>(comp),
+                    hpx::parallel::util::projection_identity{}));
+        }
+
+        // clang-format off
+        template <typename RandomIt,
+            typename Comp = hpx::parallel::v1::detail::less,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_iterator<RandomIt>::value &&
+                hpx::parallel::traits::is_indirect_callable<
+                    hpx::execution::sequenced_policy, Comp,
+                    hpx::parallel::traits::projected<
+                        hpx::parallel::util::projection_identity, RandomIt>,
+                    hpx::parallel::traits::projected<
+                        hpx::parallel::util::projection_identity, RandomIt>
+                >::value
+            )>
+        // clang-format on
+        friend void tag_invoke(partial_sort_t, RandomIt first, RandomIt middle,
+            RandomIt last, Comp&& comp = Comp())
+        {
+            static_assert(
+                hpx::traits::is_random_access_iterator<RandomIt>::value,
+                "Requires random access iterator.");
+
+            hpx::parallel::v1::detail::partial_sort<RandomIt>().call(
+                hpx::execution::seq, std::true_type{}, first, middle, last,
+                std::forward<Comp>(comp),
+                hpx::parallel::util::projection_identity{});
+        }
+    } partial_sort{};
+}    // namespace hpx
+
+#endif    // DOXYGEN
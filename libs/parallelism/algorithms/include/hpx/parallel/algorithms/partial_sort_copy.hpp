@@ -0,0 +1,460 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/partial_sort_copy.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace hpx {
+    // clang-format off
+
+    /// Sorts some of the elements in the range [first, last) in ascending
+    /// order, storing the result in the range [d_first, d_last). At most
+    /// d_last - d_first of the elements are placed sorted to the range
+    /// [d_first, d_first + n) where n is the number of elements to sort
+    /// (n = min(last - first, d_last - d_first)). The order of equal
+    /// elements is not guaranteed to be preserved.
+    ///
+    /// \note Complexity: O(N * log(min(N, M))) comparisons, where
+    ///       \a N = distance(first, last) and
+    ///       \a M = distance(d_first, d_last).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution of
+    ///                     the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter     The type of the source iterators used for algorithm.
+    ///                     This iterator must meet the requirements for a
+    ///                     forward iterator.
+    /// \tparam RandomIt    The type of the destination iterators used for
+    ///                     algorithm. This iterator must meet the
+    ///                     requirements for a random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). This defaults to std::less<>.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     of that the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements of
+    ///                     that the algorithm will be applied to.
+    /// \param d_first      Refers to the beginning of the destination range.
+    /// \param d_last       Refers to the end of the destination range.
+    /// \param comp         Refers to the binary predicate which returns true
+    ///                     if the first argument should be treated as less than
+    ///                     the second. The signature of the function should be
+    ///                     equivalent to
+    ///                     \code
+    ///                     bool comp(const Type &a, const Type &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const &, but
+    ///                     the function must not modify the objects passed to
+    ///                     it. The type \a Type must be such that objects of
+    ///                     types \a FwdIter and \a RandomIt can be dereferenced
+    ///                     and then implicitly converted to Type.
+    ///
+    /// The comparison operations in the parallel \a partial_sort_copy
+    /// algorithm invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the calling
+    /// thread.
+    ///
+    /// The comparison operations in the parallel \a partial_sort_copy
+    /// algorithm invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are permitted to execute
+    /// in an unordered fashion in unspecified threads, and indeterminately
+    /// sequenced within each thread.
+    ///
+    /// The parallel version collects the smallest n elements of each chunk
+    /// of the input sequence in a temporary buffer, selects the smallest n
+    /// of those using \a nth_element and sorts them in parallel before
+    /// copying them to the destination range. It falls back to the
+    /// sequential algorithm if the value type of \a FwdIter is not default
+    /// constructible.
+    ///
+    /// \returns  The \a partial_sort_copy algorithm returns a
+    ///           \a hpx::future<RandomIt> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a RandomIt otherwise. The iterator returned refers
+    ///           to the element following the last element written.
+    ///
+    template <typename ExPolicy, typename FwdIter, typename RandomIt,
+        typename Comp = hpx::parallel::v1::detail::less>
+    typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+    partial_sort_copy(ExPolicy&& policy, FwdIter first, FwdIter last,
+        RandomIt d_first, RandomIt d_last, Comp&& comp = Comp());
+
+    // clang-format on
+}    // namespace hpx
+
+#else    // DOXYGEN
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+
+#include <hpx/algorithms/traits/projected.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/executors/exception_list.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/nth_element.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // partial_sort_copy
+    namespace detail {
+        /// \cond NOINTERNAL
+
+        // The parallel version collects the candidates in a temporary buffer
+        template <typename Iter>
+        struct is_partial_sort_copy_bufferable
+          : std::integral_constant<bool,
+                std::is_default_constructible<
+                    typename std::iterator_traits<Iter>::value_type>::value &&
+                    std::is_copy_assignable<typename std::iterator_traits<
+                        Iter>::value_type>::value>
+        {
+        };
+
+        template <typename InIter, typename Sent, typename RandomIt,
+            typename Compare, typename Proj1, typename Proj2>
+        util::in_out_result<InIter, RandomIt> sequential_partial_sort_copy(
+            InIter first, Sent last, RandomIt d_first, RandomIt d_last,
+            Compare&& comp, Proj1&& proj1, Proj2&& proj2)
+        {
+            RandomIt d_it = d_first;
+            for (/**/; first != last && d_it != d_last; ++first, ++d_it)
+            {
+                *d_it = *first;
+            }
+
+            if (d_first == d_it)
+            {
+                return util::in_out_result<InIter, RandomIt>{
+                    detail::advance_to_sentinel(first, last), d_it};
+            }
+
+            util::compare_projected<Compare&, Proj2&> heap_comp(comp, proj2);
+            std::make_heap(d_first, d_it, heap_comp);
+
+            // replace the largest element of the heap by any smaller element
+            for (/**/; first != last; ++first)
+            {
+                if (hpx::util::invoke(comp, hpx::util::invoke(proj1, *first),
+                        hpx::util::invoke(proj2, *d_first)))
+                {
+                    std::pop_heap(d_first, d_it, heap_comp);
+                    *std::prev(d_it) = *first;
+                    std::push_heap(d_first, d_it, heap_comp);
+                }
+            }
+
+            std::sort_heap(d_first, d_it, heap_comp);
+            return util::in_out_result<InIter, RandomIt>{first, d_it};
+        }
+
+        // The function blocks until the elements are copied, it has to be
+        // called on an HPX thread.
+        template <typename ExPolicy, typename FwdIter, typename RandomIt,
+            typename Compare>
+        RandomIt parallel_partial_sort_copy(ExPolicy&& policy, FwdIter first,
+            std::size_t count, RandomIt d_first, RandomIt d_last,
+            Compare& comp)
+        {
+            using value_type =
+                typename std::iterator_traits<FwdIter>::value_type;
+
+            std::size_t const n =
+                (std::min)(count, std::size_t(d_last - d_first));
+            if (n == 0)
+                return d_first;
+
+            // every chunk contributes its smallest n elements as candidates
+            std::size_t const num_chunks = selection_num_chunks(policy, count);
+            std::size_t const chunk_size =
+                (count + num_chunks - 1) / num_chunks;
+
+            std::vector<std::size_t> offsets(num_chunks + 1, 0);
+            for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+            {
+                std::size_t begin = (std::min)(chunk * chunk_size, count);
+                std::size_t end = (std::min)(begin + chunk_size, count);
+                offsets[chunk + 1] =
+                    offsets[chunk] + (std::min)(n, end - begin);
+            }
+
+            std::size_t const total = offsets.back();
+            std::unique_ptr<value_type[]> buffer(new value_type[total]);
+            value_type* candidates = buffer.get();
+
+            selection_for_each_chunk(policy, count, num_chunks,
+                [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+                    value_type* heap = candidates + offsets[chunk];
+                    std::size_t const size =
+                        offsets[chunk + 1] - offsets[chunk];
+
+                    FwdIter it = std::next(first, begin);
+                    for (std::size_t i = 0; i != size; ++i, ++it)
+                    {
+                        heap[i] = *it;
+                    }
+
+                    if (begin + size == end)
+                        return;
+
+                    // keep the smallest elements of the chunk in a heap
+                    std::make_heap(heap, heap + size, comp);
+                    for (std::size_t i = begin + size; i != end; ++i, ++it)
+                    {
+                        if (comp(*it, *heap))
+                        {
+                            std::pop_heap(heap, heap + size, comp);
+                            heap[size - 1] = *it;
+                            std::push_heap(heap, heap + size, comp);
+                        }
+                    }
+                });
+
+            // select and sort the smallest n of all candidates
+            parallel_nth_element(
+                policy, candidates, candidates + n, candidates + total, comp);
+            parallel_sort_async(policy, candidates, candidates + n, comp).get();
+
+            selection_for_each_chunk(policy, n,
+                selection_num_chunks(policy, n),
+                [&](std::size_t, std::size_t begin, std::size_t end) {
+                    std::move(candidates + begin, candidates + end,
+                        std::next(d_first, begin));
+                });
+
+            return std::next(d_first, n);
+        }
+
+        template <typename ExPolicy, typename FwdIter, typename Sent,
+            typename RandomIt, typename Compare, typename Proj1,
+            typename Proj2>
+        util::in_out_result<FwdIter, RandomIt> parallel_partial_sort_copy(
+            ExPolicy&&, FwdIter first, Sent last, RandomIt d_first,
+            RandomIt d_last, Compare& comp, Proj1& proj1, Proj2& proj2,
+            std::false_type)
+        {
+            return sequential_partial_sort_copy(
+                first, last, d_first, d_last, comp, proj1, proj2);
+        }
+
+        template <typename ExPolicy, typename FwdIter, typename Sent,
+            typename RandomIt, typename Compare, typename Proj1,
+            typename Proj2>
+        util::in_out_result<FwdIter, RandomIt> parallel_partial_sort_copy(
+            ExPolicy&& policy, FwdIter first, Sent last, RandomIt d_first,
+            RandomIt d_last, Compare& comp, Proj1& proj1, Proj2& proj2,
+            std::true_type)
+        {
+            std::size_t const count = detail::distance(first, last);
+            if (count <= nth_element_limit)
+            {
+                return sequential_partial_sort_copy(
+                    first, last, d_first, d_last, comp, proj1, proj2);
+            }
+
+            // the candidates are compared as elements of the input sequence
+            util::compare_projected<Compare&, Proj1&> f(comp, proj1);
+
+            RandomIt d_end = parallel_partial_sort_copy(
+                policy, first, count, d_first, d_last, f);
+
+            return util::in_out_result<FwdIter, RandomIt>{
+                std::next(first, count), d_end};
+        }
+
+        template <typename FwdIter, typename RandomIt>
+        struct partial_sort_copy
+          : public detail::algorithm<partial_sort_copy<FwdIter, RandomIt>,
+                util::in_out_result<FwdIter, RandomIt>>
+        {
+            partial_sort_copy()
+              : partial_sort_copy::algorithm("partial_sort_copy")
+            {
+            }
+
+            template <typename ExPolicy, typename InIter, typename Sent,
+                typename Compare, typename Proj1, typename Proj2>
+            static util::in_out_result<InIter, RandomIt> sequential(ExPolicy,
+                InIter first, Sent last, RandomIt d_first, RandomIt d_last,
+                Compare&& comp, Proj1&& proj1, Proj2&& proj2)
+            {
+                return sequential_partial_sort_copy(first, last, d_first,
+                    d_last, std::forward<Compare>(comp),
+                    std::forward<Proj1>(proj1), std::forward<Proj2>(proj2));
+            }
+
+            template <typename ExPolicy, typename Sent, typename Compare,
+                typename Proj1, typename Proj2>
+            static typename util::detail::algorithm_result<ExPolicy,
+                util::in_out_result<FwdIter, RandomIt>>::type
+            parallel(ExPolicy&& policy, FwdIter first, Sent last,
+                RandomIt d_first, RandomIt d_last, Compare&& comp,
+                Proj1&& proj1, Proj2&& proj2)
+            {
+                typedef util::detail::algorithm_result<ExPolicy,
+                    util::in_out_result<FwdIter, RandomIt>>
+                    algorithm_result;
+
+                try
+                {
+                    return algorithm_result::get(
+                        parallel_partial_sort_copy(policy, first, last,
+                            d_first, d_last, comp, proj1, proj2,
+                            is_partial_sort_copy_bufferable<FwdIter>()));
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy,
+                            util::in_out_result<FwdIter, RandomIt>>::
+                            call(std::current_exception()));
+                }
+            }
+
+            template <typename Sent, typename Compare, typename Proj1,
+                typename Proj2>
+            static typename util::detail::algorithm_result<
+                hpx::execution::parallel_task_policy,
+                util::in_out_result<FwdIter, RandomIt>>::type
+            parallel(hpx::execution::parallel_task_policy policy,
+                FwdIter first, Sent last, RandomIt d_first, RandomIt d_last,
+                Compare&& comp, Proj1&& proj1, Proj2&& proj2)
+            {
+                using result_type = util::in_out_result<FwdIter, RandomIt>;
+
+                return execution::async_execute(policy.executor(),
+                    [=, comp = std::forward<Compare>(comp),
+                        proj1 = std::forward<Proj1>(proj1),
+                        proj2 = std::forward<Proj2>(
+                            proj2)]() mutable -> result_type {
+                        try
+                        {
+                            return parallel_partial_sort_copy(policy, first,
+                                last, d_first, d_last, comp, proj1, proj2,
+                                is_partial_sort_copy_bufferable<FwdIter>());
+                        }
+                        catch (...)
+                        {
+                            // report errors as the synchronous version does
+                            return detail::handle_exception<
+                                hpx::execution::parallel_policy,
+                                result_type>::call(std::current_exception());
+                        }
+                    });
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
+
+namespace hpx {
+
+    // CPO for hpx::partial_sort_copy
+    HPX_INLINE_CONSTEXPR_VARIABLE struct partial_sort_copy_t final
+      : hpx::functional::tag<partial_sort_copy_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter, typename RandomIt,
+            typename Comp = hpx::parallel::v1::detail::less,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_iterator<FwdIter>::value &&
+                hpx::traits::is_iterator<RandomIt>::value &&
+                hpx::parallel::traits::is_indirect_callable<ExPolicy, Comp,
+                    hpx::parallel::traits::projected<
+                        hpx::parallel::util::projection_identity, FwdIter>,
+                    hpx::parallel::traits::projected<
+                        hpx::parallel::util::projection_identity, RandomIt>
+                >::value
+            )>
+        // clang-format on
+        friend typename hpx::parallel::util::detail::algorithm_result<ExPolicy,
+            RandomIt>::type
+        tag_invoke(partial_sort_copy_t, ExPolicy&& policy, FwdIter first,
+            FwdIter last, RandomIt d_first, RandomIt d_last,
+            Comp&& comp = Comp())
+        {
+            static_assert(hpx::traits::is_forward_iterator<FwdIter>::value,
+                "Requires at least forward iterator.");
+            static_assert(
+                hpx::traits::is_random_access_iterator<RandomIt>::value,
+                "Requires random access iterator.");
+
+            using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+
+            return hpx::parallel::util::get_second_element(
+                hpx::parallel::v1::detail::partial_sort_copy<FwdIter,
+                    RandomIt>()
+                    .call(std::forward<ExPolicy>(policy), is_seq{}, first,
+                        last, d_first, d_last, std::forward<Comp>(comp),
+                        hpx::parallel::util::projection_identity{},
+                        hpx::parallel::util::projection_identity{}));
+        }
+
+        // clang-format off
+        template <typename InIter, typename RandomIt,
+            typename Comp = hpx::parallel::v1::detail::less,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_iterator<InIter>::value &&
+                hpx::traits::is_iterator<RandomIt>::value &&
+                hpx::parallel::traits::is_indirect_callable<
+                    hpx::execution::sequenced_policy, Comp,
+                    hpx::parallel::traits::projected<
+                        hpx::parallel::util::projection_identity, InIter>,
+                    hpx::parallel::traits::projected<
+                        hpx::parallel::util::projection_identity, RandomIt>
+                >::value
+            )>
+        // clang-format on
+        friend RandomIt tag_invoke(partial_sort_copy_t, InIter first,
+            InIter last, RandomIt d_first, RandomIt d_last,
+            Comp&& comp = Comp())
+        {
+            static_assert(hpx::traits::is_input_iterator<InIter>::value,
+                "Requires at least input iterator.");
+            static_assert(
+                hpx::traits::is_random_access_iterator<RandomIt>::value,
+                "Requires random access iterator.");
+
+            return hpx::parallel::util::get_second_element(
+                hpx::parallel::v1::detail::partial_sort_copy<InIter,
+                    RandomIt>()
+                    .call(hpx::execution::seq, std::true_type{}, first, last,
+                        d_first, d_last, std::forward<Comp>(comp),
+                        hpx::parallel::util::projection_identity{},
+                        hpx::parallel::util::projection_identity{}));
+        }
+    } partial_sort_copy{};
+}    // namespace hpx
+
+#endif    // DOXYGEN
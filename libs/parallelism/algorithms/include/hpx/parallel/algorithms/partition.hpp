@@ -1151,7 +1151,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 using hpx::util::make_zip_iterator;
                 using scan_partitioner_type = util::scan_partitioner<ExPolicy,
                     hpx::tuple<FwdIter1, FwdIter2, FwdIter3>,
-                    output_iterator_offset>;
+                    output_iterator_offset, void,
+                    util::scan_partitioner_single_pass_tag>;
 
                 auto f1 = [pred = std::forward<Pred>(pred),
                               proj = std::forward<Proj>(proj)](
@@ -0,0 +1,150 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/radix_sort.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+
+#include <hpx/algorithms/traits/projected.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // radix_sort
+    namespace detail {
+        /// \cond NOINTERNAL
+        template <typename RandomIt>
+        struct radix_sort
+          : public detail::algorithm<radix_sort<RandomIt>, RandomIt>
+        {
+            radix_sort()
+              : radix_sort::algorithm("radix_sort")
+            {
+            }
+
+            template <typename ExPolicy, typename Proj>
+            static RandomIt sequential(
+                ExPolicy&& policy, RandomIt first, RandomIt last, Proj&& proj)
+            {
+                return parallel_radix_sort(std::forward<ExPolicy>(policy),
+                    first, last, std::forward<Proj>(proj));
+            }
+
+            template <typename ExPolicy, typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy,
+                RandomIt>::type
+            parallel(
+                ExPolicy&& policy, RandomIt first, RandomIt last, Proj&& proj)
+            {
+                typedef util::detail::algorithm_result<ExPolicy, RandomIt>
+                    algorithm_result;
+
+                try
+                {
+                    return algorithm_result::get(parallel_radix_sort_async(
+                        std::forward<ExPolicy>(policy), first, last,
+                        std::forward<Proj>(proj)));
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandomIt>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+
+    //-----------------------------------------------------------------------------
+    /// Sorts the elements in the range [first, last) in ascending order of
+    /// their (projected) keys using a least significant digit radix sort. The
+    /// order of equal elements is not guaranteed to be preserved. The keys
+    /// have to be of integral (except bool) or IEEE-754 floating point type,
+    /// the elements are ordered as if compared using operator<().
+    ///
+    /// \note   Complexity: O(N * sizeof(key)), where
+    ///                     N = std::distance(first, last).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator. Its value type has to be
+    ///                     default constructible and move assignable.
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements to compute
+    ///                     the key to sort by.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a radix_sort algorithm returns a
+    ///           \a hpx::future<RandomIt> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a RandomIt
+    ///           otherwise.
+    ///           The algorithm returns an iterator pointing to the first
+    ///           element after the last element in the input sequence.
+    // clang-format off
+    template <typename ExPolicy, typename RandomIt,
+        typename Proj = util::projection_identity,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_iterator<RandomIt>::value &&
+            traits::is_projected<Proj, RandomIt>::value
+        )>
+    // clang-format on
+    typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+    radix_sort(
+        ExPolicy&& policy, RandomIt first, RandomIt last, Proj&& proj = Proj())
+    {
+        static_assert((hpx::traits::is_random_access_iterator<RandomIt>::value),
+            "Requires a random access iterator.");
+        static_assert(detail::is_radix_sortable<RandomIt,
+                          typename std::decay<Proj>::type>::value,
+            "radix_sort requires an arithmetic (projected) key");
+
+        typedef hpx::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        return detail::radix_sort<RandomIt>().call(
+            std::forward<ExPolicy>(policy), is_seq(), first, last,
+            std::forward<Proj>(proj));
+    }
+}}}    // namespace hpx::parallel::v1
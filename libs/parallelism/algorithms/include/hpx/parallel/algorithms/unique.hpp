@@ -14,6 +14,7 @@
 #include <hpx/type_support/unused.hpp>
 
 #include <hpx/algorithms/traits/projected.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
 #include <hpx/execution/algorithms/detail/is_negative.hpp>
 #include <hpx/execution/algorithms/detail/predicates.hpp>
 #include <hpx/executors/execution_policy.hpp>
@@ -209,6 +210,28 @@ namespace hpx { namespace parallel { inline namespace v1 {
                     std::move(f4));
             }
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        // non-segmented implementation
+        template <typename ExPolicy, typename FwdIter, typename Pred,
+            typename Proj>
+        inline typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+        unique_(ExPolicy&& policy, FwdIter first, FwdIter last, Pred&& pred,
+            Proj&& proj, std::false_type)
+        {
+            typedef hpx::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+            return unique<FwdIter>().call(std::forward<ExPolicy>(policy),
+                is_seq(), first, last, std::forward<Pred>(pred),
+                std::forward<Proj>(proj));
+        }
+
+        // forward declare the segmented version of this algorithm
+        template <typename ExPolicy, typename FwdIter, typename Pred,
+            typename Proj>
+        typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+        unique_(ExPolicy&& policy, FwdIter first, FwdIter last, Pred&& pred,
+            Proj&& proj, std::true_type);
         /// \endcond
     }    // namespace detail
 
@@ -294,11 +317,11 @@ namespace hpx { namespace parallel { inline namespace v1 {
         static_assert((hpx::traits::is_forward_iterator<FwdIter>::value),
             "Required at least forward iterator.");
 
-        typedef hpx::is_sequenced_execution_policy<ExPolicy> is_seq;
+        typedef hpx::traits::is_segmented_iterator<FwdIter> is_segmented;
 
-        return detail::unique<FwdIter>().call(std::forward<ExPolicy>(policy),
-            is_seq(), first, last, std::forward<Pred>(pred),
-            std::forward<Proj>(proj));
+        return detail::unique_(std::forward<ExPolicy>(policy), first, last,
+            std::forward<Pred>(pred), std::forward<Proj>(proj),
+            is_segmented());
     }
 
     /////////////////////////////////////////////////////////////////////////////
@@ -413,7 +436,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 using hpx::get;
                 using hpx::util::make_zip_iterator;
                 typedef util::scan_partitioner<ExPolicy,
-                    std::pair<FwdIter1, FwdIter2>, std::size_t>
+                    std::pair<FwdIter1, FwdIter2>, std::size_t, void,
+                    util::scan_partitioner_single_pass_tag>
                     scan_partitioner_type;
 
                 auto f1 = [pred = std::forward<Pred>(pred),
@@ -0,0 +1,241 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/container_algorithms/partial_sort.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace hpx { namespace ranges {
+    // clang-format off
+
+    /// Rearranges the elements such that the range [first, middle) contains
+    /// the sorted middle - first smallest elements in the range
+    /// [first, last). The order of equal elements is not guaranteed to be
+    /// preserved. The order of the remaining elements in the range
+    /// [middle, last) is unspecified.
+    ///
+    /// \note Complexity: O(N + M * log(M)) applications of the comparison and
+    ///       the projection on average, where \a N = distance(first, last)
+    ///       and \a M = distance(first, middle).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution of
+    ///                     the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam Iter        The type of the source iterators used for algorithm.
+    ///                     This iterator must meet the requirements for a
+    ///                     random access iterator.
+    /// \tparam Sent        The type of the end value of the sequence.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). This defaults to hpx::ranges::less.
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     of that the algorithm will be applied to.
+    /// \param middle       Refers to the end of the sequence of elements that
+    ///                     will be sorted.
+    /// \param last         Refers to the end of the sequence of elements of
+    ///                     that the algorithm will be applied to.
+    /// \param comp         Refers to the binary predicate which returns true
+    ///                     if the first argument should be treated as less than
+    ///                     the second.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements before
+    ///                     they are compared.
+    ///
+    /// The comparison operations in the parallel \a partial_sort algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the calling
+    /// thread.
+    ///
+    /// The comparison operations in the parallel \a partial_sort algorithm
+    /// invoked with an execution policy object of type \a parallel_policy
+    /// or \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a partial_sort algorithm returns a \a hpx::future<Iter>
+    ///           if the execution policy is of type \a sequenced_task_policy
+    ///           or \a parallel_task_policy and returns \a Iter otherwise.
+    ///           The iterator returned refers to the end of the sequence.
+    ///
+    template <typename ExPolicy, typename Iter, typename Sent,
+        typename Comp = ranges::less,
+        typename Proj = util::projection_identity>
+    typename util::detail::algorithm_result<ExPolicy, Iter>::type
+    partial_sort(ExPolicy&& policy, Iter first, Iter middle, Sent last,
+        Comp&& comp = Comp(), Proj&& proj = Proj());
+
+    template <typename ExPolicy, typename Rng,
+        typename Comp = ranges::less,
+        typename Proj = util::projection_identity>
+    typename util::detail::algorithm_result<ExPolicy,
+        typename hpx::traits::range_iterator<Rng>::type>::type
+    partial_sort(ExPolicy&& policy, Rng&& rng,
+        typename hpx::traits::range_iterator<Rng>::type middle,
+        Comp&& comp = Comp(), Proj&& proj = Proj());
+
+    // clang-format on
+}}    // namespace hpx::ranges
+
+#else    // DOXYGEN
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/iterator_support/range.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/iterator_support/traits/is_range.hpp>
+#include <hpx/iterator_support/traits/is_sentinel_for.hpp>
+
+#include <hpx/algorithms/traits/projected.hpp>
+#include <hpx/algorithms/traits/projected_range.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
+#include <hpx/parallel/algorithms/partial_sort.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace ranges {
+
+    // CPO for hpx::ranges::partial_sort
+    HPX_INLINE_CONSTEXPR_VARIABLE struct partial_sort_t final
+      : hpx::functional::tag<partial_sort_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename Iter, typename Sent,
+            typename Comp = ranges::less,
+            typename Proj = hpx::parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_sentinel_for<Sent, Iter>::value &&
+                hpx::parallel::traits::is_indirect_callable<ExPolicy, Comp,
+                    hpx::parallel::traits::projected<Proj, Iter>,
+                    hpx::parallel::traits::projected<Proj, Iter>
+                >::value
+            )>
+        // clang-format on
+        friend typename hpx::parallel::util::detail::algorithm_result<ExPolicy,
+            Iter>::type
+        tag_invoke(partial_sort_t, ExPolicy&& policy, Iter first, Iter middle,
+            Sent last, Comp&& comp = Comp(), Proj&& proj = Proj())
+        {
+            static_assert(hpx::traits::is_random_access_iterator<Iter>::value,
+                "Requires random access iterator.");
+
+            using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+
+            return hpx::parallel::v1::detail::partial_sort<Iter>().call(
+                std::forward<ExPolicy>(policy), is_seq{}, first, middle,
+                hpx::parallel::v1::detail::advance_to_sentinel(middle, last),
+                std::forward<Comp>(comp), std::forward<Proj>(proj));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename Rng,
+            typename Comp = ranges::less,
+            typename Proj = hpx::parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_range<Rng>::value &&
+                hpx::parallel::traits::is_indirect_callable<ExPolicy, Comp,
+                    hpx::parallel::traits::projected_range<Proj, Rng>,
+                    hpx::parallel::traits::projected_range<Proj, Rng>
+                >::value
+            )>
+        // clang-format on
+        friend typename hpx::parallel::util::detail::algorithm_result<ExPolicy,
+            typename hpx::traits::range_iterator<Rng>::type>::type
+        tag_invoke(partial_sort_t, ExPolicy&& policy, Rng&& rng,
+            typename hpx::traits::range_iterator<Rng>::type middle,
+            Comp&& comp = Comp(), Proj&& proj = Proj())
+        {
+            using iterator_type =
+                typename hpx::traits::range_iterator<Rng>::type;
+
+            static_assert(
+                hpx::traits::is_random_access_iterator<iterator_type>::value,
+                "Requires random access iterator.");
+
+            using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+
+            return hpx::parallel::v1::detail::partial_sort<iterator_type>()
+                .call(std::forward<ExPolicy>(policy), is_seq{},
+                    hpx::util::begin(rng), middle,
+                    hpx::parallel::v1::detail::advance_to_sentinel(
+                        middle, hpx::util::end(rng)),
+                    std::forward<Comp>(comp), std::forward<Proj>(proj));
+        }
+
+        // clang-format off
+        template <typename Iter, typename Sent,
+            typename Comp = ranges::less,
+            typename Proj = hpx::parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_sentinel_for<Sent, Iter>::value &&
+                hpx::parallel::traits::is_indirect_callable<
+                    hpx::execution::sequenced_policy, Comp,
+                    hpx::parallel::traits::projected<Proj, Iter>,
+                    hpx::parallel::traits::projected<Proj, Iter>
+                >::value
+            )>
+        // clang-format on
+        friend Iter tag_invoke(partial_sort_t, Iter first, Iter middle,
+            Sent last, Comp&& comp = Comp(), Proj&& proj = Proj())
+        {
+            static_assert(hpx::traits::is_random_access_iterator<Iter>::value,
+                "Requires random access iterator.");
+
+            return hpx::parallel::v1::detail::partial_sort<Iter>().call(
+                hpx::execution::seq, std::true_type{}, first, middle,
+                hpx::parallel::v1::detail::advance_to_sentinel(middle, last),
+                std::forward<Comp>(comp), std::forward<Proj>(proj));
+        }
+
+        // clang-format off
+        template <typename Rng,
+            typename Comp = ranges::less,
+            typename Proj = hpx::parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_range<Rng>::value &&
+                hpx::parallel::traits::is_indirect_callable<
+                    hpx::execution::sequenced_policy, Comp,
+                    hpx::parallel::traits::projected_range<Proj, Rng>,
+                    hpx::parallel::traits::projected_range<Proj, Rng>
+                >::value
+            )>
+        // clang-format on
+        friend typename hpx::traits::range_iterator<Rng>::type tag_invoke(
+            partial_sort_t, Rng&& rng,
+            typename hpx::traits::range_iterator<Rng>::type middle,
+            Comp&& comp = Comp(), Proj&& proj = Proj())
+        {
+            using iterator_type =
+                typename hpx::traits::range_iterator<Rng>::type;
+
+            static_assert(
+                hpx::traits::is_random_access_iterator<iterator_type>::value,
+                "Requires random access iterator.");
+
+            return hpx::parallel::v1::detail::partial_sort<iterator_type>()
+                .call(hpx::execution::seq, std::true_type{},
+                    hpx::util::begin(rng), middle,
+                    hpx::parallel::v1::detail::advance_to_sentinel(
+                        middle, hpx::util::end(rng)),
+                    std::forward<Comp>(comp), std::forward<Proj>(proj));
+        }
+    } partial_sort{};
+}}    // namespace hpx::ranges
+
+#endif    // DOXYGEN
@@ -0,0 +1,317 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/container_algorithms/partial_sort_copy.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace hpx { namespace ranges {
+    // clang-format off
+
+    /// Sorts some of the elements in the range [first, last) in ascending
+    /// order, storing the result in the range [d_first, d_last). At most
+    /// d_last - d_first of the elements are placed sorted to the range
+    /// [d_first, d_first + n) where n is the number of elements to sort
+    /// (n = min(last - first, d_last - d_first)). The order of equal
+    /// elements is not guaranteed to be preserved.
+    ///
+    /// \note Complexity: O(N * log(min(N, M))) applications of the
+    ///       comparison and the projections, where
+    ///       \a N = distance(first, last) and
+    ///       \a M = distance(d_first, d_last).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution of
+    ///                     the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter     The type of the source iterators used for algorithm.
+    ///                     This iterator must meet the requirements for a
+    ///                     forward iterator.
+    /// \tparam Sent1       The type of the end value of the source sequence.
+    /// \tparam RandomIt    The type of the destination iterators used for
+    ///                     algorithm. This iterator must meet the
+    ///                     requirements for a random access iterator.
+    /// \tparam Sent2       The type of the end value of the destination
+    ///                     sequence.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). This defaults to hpx::ranges::less.
+    /// \tparam Proj1       The type of an optional projection function applied
+    ///                     to the source elements. This defaults to
+    ///                     \a util::projection_identity
+    /// \tparam Proj2       The type of an optional projection function applied
+    ///                     to the destination elements. This defaults to
+    ///                     \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     of that the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements of
+    ///                     that the algorithm will be applied to.
+    /// \param d_first      Refers to the beginning of the destination range.
+    /// \param d_last       Refers to the end of the destination range.
+    /// \param comp         Refers to the binary predicate which returns true
+    ///                     if the first argument should be treated as less than
+    ///                     the second.
+    /// \param proj1        Specifies the function (or function object) which
+    ///                     will be invoked for each of the source elements
+    ///                     before they are compared.
+    /// \param proj2        Specifies the function (or function object) which
+    ///                     will be invoked for each of the destination
+    ///                     elements before they are compared.
+    ///
+    /// The comparison operations in the parallel \a partial_sort_copy
+    /// algorithm invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the calling
+    /// thread.
+    ///
+    /// The comparison operations in the parallel \a partial_sort_copy
+    /// algorithm invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are permitted to execute
+    /// in an unordered fashion in unspecified threads, and indeterminately
+    /// sequenced within each thread.
+    ///
+    /// The parallel version compares the elements before they are copied to
+    /// the destination range only, it does not invoke \a proj2.
+    ///
+    /// \returns  The \a partial_sort_copy algorithm returns a
+    ///           \a hpx::future<partial_sort_copy_result<FwdIter, RandomIt>>
+    ///           if the execution policy is of type \a sequenced_task_policy
+    ///           or \a parallel_task_policy and returns
+    ///           \a partial_sort_copy_result<FwdIter, RandomIt> otherwise.
+    ///           The result holds the end of the source sequence and the
+    ///           iterator to the element following the last element
+    ///           written.
+    ///
+    template <typename ExPolicy, typename FwdIter, typename Sent1,
+        typename RandomIt, typename Sent2, typename Comp = ranges::less,
+        typename Proj1 = util::projection_identity,
+        typename Proj2 = util::projection_identity>
+    typename util::detail::algorithm_result<ExPolicy,
+        partial_sort_copy_result<FwdIter, RandomIt>>::type
+    partial_sort_copy(ExPolicy&& policy, FwdIter first, Sent1 last,
+        RandomIt d_first, Sent2 d_last, Comp&& comp = Comp(),
+        Proj1&& proj1 = Proj1(), Proj2&& proj2 = Proj2());
+
+    template <typename ExPolicy, typename Rng1, typename Rng2,
+        typename Comp = ranges::less,
+        typename Proj1 = util::projection_identity,
+        typename Proj2 = util::projection_identity>
+    typename util::detail::algorithm_result<ExPolicy,
+        partial_sort_copy_result<
+            typename hpx::traits::range_iterator<Rng1>::type,
+            typename hpx::traits::range_iterator<Rng2>::type>>::type
+    partial_sort_copy(ExPolicy&& policy, Rng1&& rng1, Rng2&& rng2,
+        Comp&& comp = Comp(), Proj1&& proj1 = Proj1(),
+        Proj2&& proj2 = Proj2());
+
+    // clang-format on
+}}    // namespace hpx::ranges
+
+#else    // DOXYGEN
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/iterator_support/range.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/iterator_support/traits/is_range.hpp>
+#include <hpx/iterator_support/traits/is_sentinel_for.hpp>
+
+#include <hpx/algorithms/traits/projected.hpp>
+#include <hpx/algorithms/traits/projected_range.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
+#include <hpx/parallel/algorithms/partial_sort_copy.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace ranges {
+
+    template <typename I, typename O>
+    using partial_sort_copy_result = parallel::util::in_out_result<I, O>;
+
+    // CPO for hpx::ranges::partial_sort_copy
+    HPX_INLINE_CONSTEXPR_VARIABLE struct partial_sort_copy_t final
+      : hpx::functional::tag<partial_sort_copy_t>
+    {
+    private:
+        // clang-format off
+        template <typename ExPolicy, typename FwdIter, typename Sent1,
+            typename RandomIt, typename Sent2, typename Comp = ranges::less,
+            typename Proj1 = hpx::parallel::util::projection_identity,
+            typename Proj2 = hpx::parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_sentinel_for<Sent1, FwdIter>::value &&
+                hpx::traits::is_sentinel_for<Sent2, RandomIt>::value &&
+                hpx::parallel::traits::is_indirect_callable<ExPolicy, Comp,
+                    hpx::parallel::traits::projected<Proj1, FwdIter>,
+                    hpx::parallel::traits::projected<Proj2, RandomIt>
+                >::value
+            )>
+        // clang-format on
+        friend typename hpx::parallel::util::detail::algorithm_result<ExPolicy,
+            partial_sort_copy_result<FwdIter, RandomIt>>::type
+        tag_invoke(partial_sort_copy_t, ExPolicy&& policy, FwdIter first,
+            Sent1 last, RandomIt d_first, Sent2 d_last, Comp&& comp = Comp(),
+            Proj1&& proj1 = Proj1(), Proj2&& proj2 = Proj2())
+        {
+            static_assert(hpx::traits::is_forward_iterator<FwdIter>::value,
+                "Requires at least forward iterator.");
+            static_assert(
+                hpx::traits::is_random_access_iterator<RandomIt>::value,
+                "Requires random access iterator.");
+
+            using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+
+            return hpx::parallel::v1::detail::partial_sort_copy<FwdIter,
+                RandomIt>()
+                .call(std::forward<ExPolicy>(policy), is_seq{}, first, last,
+                    d_first,
+                    hpx::parallel::v1::detail::advance_to_sentinel(
+                        d_first, d_last),
+                    std::forward<Comp>(comp), std::forward<Proj1>(proj1),
+                    std::forward<Proj2>(proj2));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename Rng1, typename Rng2,
+            typename Comp = ranges::less,
+            typename Proj1 = hpx::parallel::util::projection_identity,
+            typename Proj2 = hpx::parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy<ExPolicy>::value &&
+                hpx::traits::is_range<Rng1>::value &&
+                hpx::traits::is_range<Rng2>::value &&
+                hpx::parallel::traits::is_indirect_callable<ExPolicy, Comp,
+                    hpx::parallel::traits::projected_range<Proj1, Rng1>,
+                    hpx::parallel::traits::projected_range<Proj2, Rng2>
+                >::value
+            )>
+        // clang-format on
+        friend typename hpx::parallel::util::detail::algorithm_result<ExPolicy,
+            partial_sort_copy_result<
+                typename hpx::traits::range_iterator<Rng1>::type,
+                typename hpx::traits::range_iterator<Rng2>::type>>::type
+        tag_invoke(partial_sort_copy_t, ExPolicy&& policy, Rng1&& rng1,
+            Rng2&& rng2, Comp&& comp = Comp(), Proj1&& proj1 = Proj1(),
+            Proj2&& proj2 = Proj2())
+        {
+            using iterator_type1 =
+                typename hpx::traits::range_iterator<Rng1>::type;
+            using iterator_type2 =
+                typename hpx::traits::range_iterator<Rng2>::type;
+
+            static_assert(
+                hpx::traits::is_forward_iterator<iterator_type1>::value,
+                "Requires at least forward iterator.");
+            static_assert(
+                hpx::traits::is_random_access_iterator<iterator_type2>::value,
+                "Requires random access iterator.");
+
+            using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+
+            return hpx::parallel::v1::detail::partial_sort_copy<iterator_type1,
+                iterator_type2>()
+                .call(std::forward<ExPolicy>(policy), is_seq{},
+                    hpx::util::begin(rng1), hpx::util::end(rng1),
+                    hpx::util::begin(rng2),
+                    hpx::parallel::v1::detail::advance_to_sentinel(
+                        hpx::util::begin(rng2), hpx::util::end(rng2)),
+                    std::forward<Comp>(comp), std::forward<Proj1>(proj1),
+                    std::forward<Proj2>(proj2));
+        }
+
+        // clang-format off
+        template <typename InIter, typename Sent1, typename RandomIt,
+            typename Sent2, typename Comp = ranges::less,
+            typename Proj1 = hpx::parallel::util::projection_identity,
+            typename Proj2 = hpx::parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_sentinel_for<Sent1, InIter>::value &&
+                hpx::traits::is_sentinel_for<Sent2, RandomIt>::value &&
+                hpx::parallel::traits::is_indirect_callable<
+                    hpx::execution::sequenced_policy, Comp,
+                    hpx::parallel::traits::projected<Proj1, InIter>,
+                    hpx::parallel::traits::projected<Proj2, RandomIt>
+                >::value
+            )>
+        // clang-format on
+        friend partial_sort_copy_result<InIter, RandomIt> tag_invoke(
+            partial_sort_copy_t, InIter first, Sent1 last, RandomIt d_first,
+            Sent2 d_last, Comp&& comp = Comp(), Proj1&& proj1 = Proj1(),
+            Proj2&& proj2 = Proj2())
+        {
+            static_assert(hpx::traits::is_input_iterator<InIter>::value,
+                "Requires at least input iterator.");
+            static_assert(
+                hpx::traits::is_random_access_iterator<RandomIt>::value,
+                "Requires random access iterator.");
+
+            return hpx::parallel::v1::detail::partial_sort_copy<InIter,
+                RandomIt>()
+                .call(hpx::execution::seq, std::true_type{}, first, last,
+                    d_first,
+                    hpx::parallel::v1::detail::advance_to_sentinel(
+                        d_first, d_last),
+                    std::forward<Comp>(comp), std::forward<Proj1>(proj1),
+                    std::forward<Proj2>(proj2));
+        }
+
+        // clang-format off
+        template <typename Rng1, typename Rng2,
+            typename Comp = ranges::less,
+            typename Proj1 = hpx::parallel::util::projection_identity,
+            typename Proj2 = hpx::parallel::util::projection_identity,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_range<Rng1>::value &&
+                hpx::traits::is_range<Rng2>::value &&
+                hpx::parallel::traits::is_indirect_callable<
+                    hpx::execution::sequenced_policy, Comp,
+                    hpx::parallel::traits::projected_range<Proj1, Rng1>,
+                    hpx::parallel::traits::projected_range<Proj2, Rng2>
+                >::value
+            )>
+        // clang-format on
+        friend partial_sort_copy_result<
+            typename hpx::traits::range_iterator<Rng1>::type,
+            typename hpx::traits::range_iterator<Rng2>::type>
+        tag_invoke(partial_sort_copy_t, Rng1&& rng1, Rng2&& rng2,
+            Comp&& comp = Comp(), Proj1&& proj1 = Proj1(),
+            Proj2&& proj2 = Proj2())
+        {
+            using iterator_type1 =
+                typename hpx::traits::range_iterator<Rng1>::type;
+            using iterator_type2 =
+                typename hpx::traits::range_iterator<Rng2>::type;
+
+            static_assert(
+                hpx::traits::is_input_iterator<iterator_type1>::value,
+                "Requires at least input iterator.");
+            static_assert(
+                hpx::traits::is_random_access_iterator<iterator_type2>::value,
+                "Requires random access iterator.");
+
+            return hpx::parallel::v1::detail::partial_sort_copy<iterator_type1,
+                iterator_type2>()
+                .call(hpx::execution::seq, std::true_type{},
+                    hpx::util::begin(rng1), hpx::util::end(rng1),
+                    hpx::util::begin(rng2),
+                    hpx::parallel::v1::detail::advance_to_sentinel(
+                        hpx::util::begin(rng2), hpx::util::end(rng2)),
+                    std::forward<Comp>(comp), std::forward<Proj1>(proj1),
+                    std::forward<Proj2>(proj2));
+        }
+    } partial_sort_copy{};
+}}    // namespace hpx::ranges
+
+#endif    // DOXYGEN
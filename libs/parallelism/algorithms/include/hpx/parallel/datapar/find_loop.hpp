@@ -0,0 +1,299 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/vector_pack_find.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/util/find_loop.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { namespace util {
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter>
+    struct find_loop_vectorizable<ExPolicy, Iter,
+        typename std::enable_if<
+            hpx::is_vectorpack_execution_policy<ExPolicy>::value>::type>
+      : std::integral_constant<bool,
+            detail::iterator_datapar_compatible<Iter>::value &&
+                !std::is_same<typename std::iterator_traits<Iter>::value_type,
+                    bool>::value>
+    {
+    };
+
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        // Return the number of elements preceding the first position in
+        // [data, data + count) which is suitably aligned for loading a
+        // vector pack.
+        template <typename T>
+        HPX_FORCEINLINE std::size_t datapar_unaligned_prefix(
+            T const* data, std::size_t count)
+        {
+            std::size_t prefix = 0;
+            while (prefix != count && is_data_aligned(data + prefix))
+            {
+                ++prefix;
+            }
+            return prefix;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Helper class to find the first element for which the given
+        // function returns true. All vector packs are aligned, the elements
+        // before the first and after the last vector pack are handled one
+        // by one.
+        template <typename Iter, typename Enable = void>
+        struct datapar_find_first_n
+        {
+            template <typename InIter, typename F>
+            HPX_HOST_DEVICE HPX_FORCEINLINE static std::size_t call(
+                InIter first, std::size_t count, F&& f)
+            {
+                for (std::size_t i = 0; i != count; (void) ++i, ++first)
+                {
+                    if (f(*first))
+                        return i;
+                }
+                return count;
+            }
+        };
+
+        template <typename Iter>
+        struct datapar_find_first_n<Iter,
+            typename std::enable_if<
+                iterator_datapar_compatible<Iter>::value>::type>
+        {
+            typedef typename std::iterator_traits<Iter>::value_type value_type;
+            typedef typename traits::vector_pack_type<value_type>::type V;
+
+            template <typename InIter, typename F>
+            HPX_HOST_DEVICE HPX_FORCEINLINE static std::size_t call(
+                InIter first, std::size_t count, F&& f)
+            {
+                if (count == 0)
+                    return count;
+
+                static std::size_t constexpr size =
+                    traits::vector_pack_size<V>::value;
+
+                value_type const* data = std::addressof(*first);
+                std::size_t const prefix =
+                    datapar_unaligned_prefix(data, count);
+                std::size_t const last_pack =
+                    prefix + (count - prefix) / size * size;
+
+                std::size_t i = 0;
+                for (/**/; i != prefix; ++i)
+                {
+                    if (f(data[i]))
+                        return i;
+                }
+
+                for (/**/; i != last_pack; i += size)
+                {
+                    int pos = traits::find_first_set(
+                        f(traits::vector_pack_load<V, value_type>::aligned(
+                            data + i)));
+                    if (pos != -1)
+                        return i + pos;
+                }
+
+                for (/**/; i != count; ++i)
+                {
+                    if (f(data[i]))
+                        return i;
+                }
+                return count;
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Helper class to find the last element for which the given function
+        // returns true.
+        template <typename Iter, typename Enable = void>
+        struct datapar_find_last_n
+        {
+            template <typename InIter, typename F>
+            HPX_HOST_DEVICE HPX_FORCEINLINE static std::size_t call(
+                InIter first, std::size_t count, F&& f)
+            {
+                std::size_t result = count;
+                for (std::size_t i = 0; i != count; (void) ++i, ++first)
+                {
+                    if (f(*first))
+                        result = i;
+                }
+                return result;
+            }
+        };
+
+        template <typename Iter>
+        struct datapar_find_last_n<Iter,
+            typename std::enable_if<
+                iterator_datapar_compatible<Iter>::value>::type>
+        {
+            typedef typename std::iterator_traits<Iter>::value_type value_type;
+            typedef typename traits::vector_pack_type<value_type>::type V;
+
+            template <typename InIter, typename F>
+            HPX_HOST_DEVICE HPX_FORCEINLINE static std::size_t call(
+                InIter first, std::size_t count, F&& f)
+            {
+                if (count == 0)
+                    return count;
+
+                static std::size_t constexpr size =
+                    traits::vector_pack_size<V>::value;
+
+                value_type const* data = std::addressof(*first);
+                std::size_t const prefix =
+                    datapar_unaligned_prefix(data, count);
+                std::size_t const last_pack =
+                    prefix + (count - prefix) / size * size;
+
+                std::size_t i = count;
+                for (/**/; i != last_pack; --i)
+                {
+                    if (f(data[i - 1]))
+                        return i - 1;
+                }
+
+                for (/**/; i != prefix; i -= size)
+                {
+                    int pos = traits::find_last_set(
+                        f(traits::vector_pack_load<V, value_type>::aligned(
+                            data + i - size)));
+                    if (pos != -1)
+                        return i - size + pos;
+                }
+
+                for (/**/; i != 0; --i)
+                {
+                    if (f(data[i - 1]))
+                        return i - 1;
+                }
+                return count;
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Helper class to find the first pair of corresponding elements of
+        // two sequences for which the given function returns true. The
+        // vector packs of the first sequence are aligned, the ones of the
+        // second sequence are loaded unaligned.
+        template <typename Iter1, typename Iter2, typename Enable = void>
+        struct datapar_find_first2_n
+        {
+            template <typename InIter1, typename InIter2, typename F>
+            HPX_HOST_DEVICE HPX_FORCEINLINE static std::size_t call(
+                InIter1 first1, InIter2 first2, std::size_t count, F&& f)
+            {
+                for (std::size_t i = 0; i != count;
+                     (void) ++i, ++first1, ++first2)
+                {
+                    if (f(*first1, *first2))
+                        return i;
+                }
+                return count;
+            }
+        };
+
+        template <typename Iter1, typename Iter2>
+        struct datapar_find_first2_n<Iter1, Iter2,
+            typename std::enable_if<
+                iterators_datapar_compatible<Iter1, Iter2>::value &&
+                iterator_datapar_compatible<Iter1>::value &&
+                iterator_datapar_compatible<Iter2>::value>::type>
+        {
+            typedef typename std::iterator_traits<Iter1>::value_type
+                value1_type;
+            typedef typename std::iterator_traits<Iter2>::value_type
+                value2_type;
+
+            typedef typename traits::vector_pack_type<value1_type>::type V1;
+            typedef typename traits::vector_pack_type<value2_type>::type V2;
+
+            template <typename InIter1, typename InIter2, typename F>
+            HPX_HOST_DEVICE HPX_FORCEINLINE static std::size_t call(
+                InIter1 first1, InIter2 first2, std::size_t count, F&& f)
+            {
+                if (count == 0)
+                    return count;
+
+                static std::size_t constexpr size =
+                    traits::vector_pack_size<V1>::value;
+
+                value1_type const* data1 = std::addressof(*first1);
+                value2_type const* data2 = std::addressof(*first2);
+                std::size_t const prefix =
+                    datapar_unaligned_prefix(data1, count);
+                std::size_t const last_pack =
+                    prefix + (count - prefix) / size * size;
+
+                std::size_t i = 0;
+                for (/**/; i != prefix; ++i)
+                {
+                    if (f(data1[i], data2[i]))
+                        return i;
+                }
+
+                for (/**/; i != last_pack; i += size)
+                {
+                    int pos = traits::find_first_set(
+                        f(traits::vector_pack_load<V1, value1_type>::aligned(
+                              data1 + i),
+                            traits::vector_pack_load<V2,
+                                value2_type>::unaligned(data2 + i)));
+                    if (pos != -1)
+                        return i + pos;
+                }
+
+                for (/**/; i != count; ++i)
+                {
+                    if (f(data1[i], data2[i]))
+                        return i;
+                }
+                return count;
+            }
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+        std::size_t>::type
+    find_first_n(Iter first, std::size_t count, F&& f)
+    {
+        return detail::datapar_find_first_n<Iter>::call(
+            first, count, std::forward<F>(f));
+    }
+
+    template <typename ExPolicy, typename Iter1, typename Iter2, typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+        std::size_t>::type
+    find_first2_n(Iter1 first1, Iter2 first2, std::size_t count, F&& f)
+    {
+        return detail::datapar_find_first2_n<Iter1, Iter2>::call(
+            first1, first2, count, std::forward<F>(f));
+    }
+}}}    // namespace hpx::parallel::util
+
+#endif
@@ -15,6 +15,7 @@
 #include <hpx/execution/traits/vector_pack_load_store.hpp>
 #include <hpx/execution/traits/vector_pack_type.hpp>
 #include <hpx/executors/datapar/execution_policy_fwd.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
 #include <hpx/parallel/datapar/iterator_helpers.hpp>
 #include <hpx/parallel/util/loop.hpp>
 
@@ -95,7 +96,7 @@ namespace hpx { namespace parallel { namespace util {
             typename std::enable_if<
                 iterator_datapar_compatible<Iter>::value>::type>
         {
-            template <typename Iter_>
+            template <typename Iter_, typename Sent_>
             static bool call(Iter_ const& first, Sent_ const& last)
             {
                 typedef
@@ -103,7 +104,7 @@ namespace hpx { namespace parallel { namespace util {
                 typedef typename traits::vector_pack_type<value_type>::type V;
 
                 return traits::vector_pack_size<V>::value <=
-                    (std::size_t) detail::distance(first, last);
+                    (std::size_t) parallel::v1::detail::distance(first, last);
             }
         };
 
@@ -117,7 +118,7 @@ namespace hpx { namespace parallel { namespace util {
             typedef typename std::iterator_traits<iterator_type>::value_type
                 value_type;
 
-            typedef typename traits::vector_pack_type<value_type> V;
+            typedef typename traits::vector_pack_type<value_type>::type V;
 
             template <typename Begin, typename End, typename F>
             HPX_HOST_DEVICE HPX_FORCEINLINE static typename std::enable_if<
@@ -315,17 +316,10 @@ namespace hpx { namespace parallel { namespace util {
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    template <typename Begin, typename End, typename F>
-    HPX_HOST_DEVICE HPX_FORCEINLINE Begin loop(
-        parallel::execution::datapar_policy, Begin begin, End end, F&& f)
-    {
-        return detail::datapar_loop<Begin>::call(
-            begin, end, std::forward<F>(f));
-    }
-
-    template <typename Begin, typename End, typename F>
-    HPX_HOST_DEVICE HPX_FORCEINLINE Begin loop(
-        parallel::execution::datapar_task_policy, Begin begin, End end, F&& f)
+    template <typename ExPolicy, typename Begin, typename End, typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value, Begin>::type
+    loop(ExPolicy&&, Begin begin, End end, F&& f)
     {
         return detail::datapar_loop<Begin>::call(
             begin, end, std::forward<F>(f));
@@ -0,0 +1,217 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// make inspect happy: hpxinspect:nominmax
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/execution/traits/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/vector_pack_find.hpp>
+#include <hpx/execution/traits/vector_pack_load_store.hpp>
+#include <hpx/execution/traits/vector_pack_select.hpp>
+#include <hpx/execution/traits/vector_pack_type.hpp>
+#include <hpx/parallel/datapar/find_loop.hpp>
+#include <hpx/parallel/datapar/iterator_helpers.hpp>
+#include <hpx/parallel/util/minmax_loop.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { namespace util {
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        // Helper class to find the smallest and largest elements. The values
+        // are determined using a vectorized reduction first, their positions
+        // are located using a vectorized search afterwards.
+        template <typename Iter, typename Enable = void>
+        struct datapar_minmax_loop
+        {
+            template <typename InIter>
+            static std::size_t min_element(InIter first, std::size_t count)
+            {
+                return detail::min_element_n(first, count);
+            }
+
+            template <typename InIter>
+            static std::size_t max_element(InIter first, std::size_t count)
+            {
+                return detail::max_element_n(first, count);
+            }
+
+            template <typename InIter>
+            static std::pair<std::size_t, std::size_t> minmax_element(
+                InIter first, std::size_t count)
+            {
+                return detail::minmax_element_n(first, count);
+            }
+        };
+
+        template <typename Iter>
+        struct datapar_minmax_loop<Iter,
+            typename std::enable_if<
+                iterator_datapar_compatible<Iter>::value>::type>
+        {
+            typedef typename std::iterator_traits<Iter>::value_type value_type;
+            typedef typename traits::vector_pack_type<value_type>::type V;
+
+            // Determine the smallest and the largest value. This fails if the
+            // sequence is too short to be vectorized or if it contains
+            // elements which are not equal to themselves (NaNs), as the
+            // result of the scalar algorithms depends on the order of
+            // comparisons in this case.
+            static bool reduce(value_type const* data, std::size_t count,
+                value_type& smallest, value_type& largest)
+            {
+                static std::size_t constexpr size =
+                    traits::vector_pack_size<V>::value;
+
+                std::size_t const prefix =
+                    datapar_unaligned_prefix(data, count);
+                std::size_t const last_pack =
+                    prefix + (count - prefix) / size * size;
+
+                if (last_pack == prefix)
+                    return false;
+
+                smallest = largest = data[0];
+                for (std::size_t i = 0; i != prefix; ++i)
+                {
+                    value_type const& value = data[i];
+                    if (!(value == value))
+                        return false;
+                    if (value < smallest)
+                        smallest = value;
+                    if (largest < value)
+                        largest = value;
+                }
+                for (std::size_t i = last_pack; i != count; ++i)
+                {
+                    value_type const& value = data[i];
+                    if (!(value == value))
+                        return false;
+                    if (value < smallest)
+                        smallest = value;
+                    if (largest < value)
+                        largest = value;
+                }
+
+                V smallest_v =
+                    traits::vector_pack_load<V, value_type>::aligned(
+                        data + prefix);
+                V largest_v = smallest_v;
+                auto valid = smallest_v == smallest_v;
+
+                for (std::size_t i = prefix + size; i != last_pack; i += size)
+                {
+                    V value =
+                        traits::vector_pack_load<V, value_type>::aligned(
+                            data + i);
+
+                    smallest_v =
+                        traits::select(value < smallest_v, value, smallest_v);
+                    largest_v =
+                        traits::select(largest_v < value, value, largest_v);
+                    valid = valid && value == value;
+                }
+
+                if (traits::find_first_set(!valid) != -1)
+                    return false;
+
+                for (std::size_t i = 0; i != size; ++i)
+                {
+                    if (smallest_v[i] < smallest)
+                        smallest = smallest_v[i];
+                    if (largest < largest_v[i])
+                        largest = largest_v[i];
+                }
+                return true;
+            }
+
+            template <typename InIter>
+            static std::size_t min_element(InIter first, std::size_t count)
+            {
+                value_type smallest, largest;
+                if (count == 0 ||
+                    !reduce(std::addressof(*first), count, smallest, largest))
+                {
+                    return detail::min_element_n(first, count);
+                }
+
+                return datapar_find_first_n<Iter>::call(first, count,
+                    [&smallest](auto const& v) { return v == smallest; });
+            }
+
+            template <typename InIter>
+            static std::size_t max_element(InIter first, std::size_t count)
+            {
+                value_type smallest, largest;
+                if (count == 0 ||
+                    !reduce(std::addressof(*first), count, smallest, largest))
+                {
+                    return detail::max_element_n(first, count);
+                }
+
+                return datapar_find_first_n<Iter>::call(first, count,
+                    [&largest](auto const& v) { return v == largest; });
+            }
+
+            template <typename InIter>
+            static std::pair<std::size_t, std::size_t> minmax_element(
+                InIter first, std::size_t count)
+            {
+                value_type smallest, largest;
+                if (count == 0 ||
+                    !reduce(std::addressof(*first), count, smallest, largest))
+                {
+                    return detail::minmax_element_n(first, count);
+                }
+
+                return std::make_pair(
+                    datapar_find_first_n<Iter>::call(first, count,
+                        [&smallest](auto const& v) { return v == smallest; }),
+                    datapar_find_last_n<Iter>::call(first, count,
+                        [&largest](auto const& v) { return v == largest; }));
+            }
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+        std::size_t>::type
+    min_element_n(Iter first, std::size_t count)
+    {
+        return detail::datapar_minmax_loop<Iter>::min_element(first, count);
+    }
+
+    template <typename ExPolicy, typename Iter>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+        std::size_t>::type
+    max_element_n(Iter first, std::size_t count)
+    {
+        return detail::datapar_minmax_loop<Iter>::max_element(first, count);
+    }
+
+    template <typename ExPolicy, typename Iter>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+        std::pair<std::size_t, std::size_t>>::type
+    minmax_element_n(Iter first, std::size_t count)
+    {
+        return detail::datapar_minmax_loop<Iter>::minmax_element(first, count);
+    }
+}}}    // namespace hpx::parallel::util
+
+#endif
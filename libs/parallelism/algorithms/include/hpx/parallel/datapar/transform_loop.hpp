@@ -78,7 +78,7 @@ namespace hpx { namespace parallel { namespace util {
                 std::pair<InIter, OutIter>>::type
             call(InIter first, std::size_t count, OutIter dest, F&& f)
             {
-                return util::transform_loop_n<sequenced_policy>(
+                return util::detail::transform_loop_n<InIter>::call(
                     first, count, dest, std::forward<F>(f));
             }
         };
@@ -102,8 +102,7 @@ namespace hpx { namespace parallel { namespace util {
                 std::pair<InIter, OutIter>>::type
             call(InIter first, InIter last, OutIter dest, F&& f)
             {
-                return util::transform_loop_n<
-                    parallel::execution::datapar_policy>(first,
+                return datapar_transform_loop_n<InIter>::call(first,
                     std::distance(first, last), dest, std::forward<F>(f));
             }
 
@@ -115,8 +114,8 @@ namespace hpx { namespace parallel { namespace util {
                 std::pair<InIter, OutIter>>::type
             call(InIter first, InIter last, OutIter dest, F&& f)
             {
-                return util::transform_loop(
-                    seq, first, last, dest, std::forward<F>(f));
+                return util::detail::transform_loop<InIter>::call(
+                    first, last, dest, std::forward<F>(f));
             }
         };
 
@@ -179,8 +178,9 @@ namespace hpx { namespace parallel { namespace util {
             call(InIter1 first1, std::size_t count, InIter2 first2,
                 OutIter dest, F&& f)
             {
-                return util::transform_binary_loop_n<sequenced_policy>(
-                    first1, count, first2, dest, std::forward<F>(f));
+                return util::detail::transform_binary_loop_n<InIter1,
+                    InIter2>::call(first1, count, first2, dest,
+                    std::forward<F>(f));
             }
         };
 
@@ -214,10 +214,9 @@ namespace hpx { namespace parallel { namespace util {
             call(InIter1 first1, InIter1 last1, InIter2 first2, OutIter dest,
                 F&& f)
             {
-                return util::transform_binary_loop_n<
-                    parallel::execution::datapar_policy>(first1,
-                    std::distance(first1, last1), first2, dest,
-                    std::forward<F>(f));
+                return datapar_transform_binary_loop_n<InIter1,
+                    InIter2>::call(first1, std::distance(first1, last1),
+                    first2, dest, std::forward<F>(f));
             }
 
             template <typename InIter1, typename InIter2, typename OutIter,
@@ -232,8 +231,9 @@ namespace hpx { namespace parallel { namespace util {
             call(InIter1 first1, InIter1 last1, InIter2 first2, OutIter dest,
                 F&& f)
             {
-                return util::transform_binary_loop<sequenced_policy>(
-                    first1, last1, first2, dest, std::forward<F>(f));
+                return util::detail::transform_binary_loop<InIter1,
+                    InIter2>::call(first1, last1, first2, dest,
+                    std::forward<F>(f));
             }
 
             template <typename InIter1, typename InIter2, typename OutIter,
@@ -251,9 +251,9 @@ namespace hpx { namespace parallel { namespace util {
                 std::size_t count = (std::min)(
                     std::distance(first1, last1), std::distance(first2, last2));
 
-                return util::transform_binary_loop_n<
-                    parallel::execution::datapar_policy>(
-                    first1, count, first2, dest, std::forward<F>(f));
+                return datapar_transform_binary_loop_n<InIter1,
+                    InIter2>::call(first1, count, first2, dest,
+                    std::forward<F>(f));
             }
 
             template <typename InIter1, typename InIter2, typename OutIter,
@@ -268,8 +268,9 @@ namespace hpx { namespace parallel { namespace util {
             call(InIter1 first1, InIter1 last1, InIter2 first2, InIter2 last2,
                 OutIter dest, F&& f)
             {
-                return util::transform_binary_loop<sequenced_policy>(
-                    first1, last1, first2, last2, dest, std::forward<F>(f));
+                return util::detail::transform_binary_loop<InIter1,
+                    InIter2>::call(first1, last1, first2, last2, dest,
+                    std::forward<F>(f));
             }
         };
     }    // namespace detail
@@ -286,19 +287,11 @@ namespace hpx { namespace parallel { namespace util {
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    template <typename Iter, typename OutIter, typename F>
-    HPX_HOST_DEVICE HPX_FORCEINLINE std::pair<Iter, OutIter> transform_loop(
-        parallel::execution::datapar_policy, Iter it, Iter end, OutIter dest,
-        F&& f)
-    {
-        return detail::datapar_transform_loop<Iter>::call(
-            it, end, dest, std::forward<F>(f));
-    }
-
-    template <typename Iter, typename OutIter, typename F>
-    HPX_HOST_DEVICE HPX_FORCEINLINE std::pair<Iter, OutIter> transform_loop(
-        parallel::execution::datapar_task_policy, Iter it, Iter end,
-        OutIter dest, F&& f)
+    template <typename ExPolicy, typename Iter, typename OutIter, typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+        std::pair<Iter, OutIter>>::type
+    transform_loop(ExPolicy&&, Iter it, Iter end, OutIter dest, F&& f)
     {
         return detail::datapar_transform_loop<Iter>::call(
             it, end, dest, std::forward<F>(f));
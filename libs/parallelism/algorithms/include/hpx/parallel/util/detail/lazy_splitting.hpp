@@ -0,0 +1,277 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_combinators/when_all.hpp>
+#include <hpx/datastructures/optional.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <hpx/execution/algorithms/detail/is_negative.hpp>
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { namespace util { namespace detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // The outcome of executing one block of iterations
+    template <typename Result>
+    struct lazy_splitting_block_result
+    {
+        template <typename F, typename... Ts>
+        void invoke(F& f, Ts&&... ts)
+        {
+            value_.emplace(f(std::forward<Ts>(ts)...));
+        }
+
+        Result get()
+        {
+            if (error_)
+                std::rethrow_exception(error_);
+            return std::move(*value_);
+        }
+
+        hpx::util::optional<Result> value_;
+        std::exception_ptr error_;
+    };
+
+    template <>
+    struct lazy_splitting_block_result<void>
+    {
+        template <typename F, typename... Ts>
+        void invoke(F& f, Ts&&... ts)
+        {
+            f(std::forward<Ts>(ts)...);
+        }
+
+        void get()
+        {
+            if (error_)
+                std::rethrow_exception(error_);
+        }
+
+        std::exception_ptr error_;
+    };
+
+    // The range of blocks which is currently owned by one of the workers
+    struct lazy_splitting_range
+    {
+        hpx::lcos::local::spinlock mtx_;
+        std::size_t begin_ = 0;
+        std::size_t end_ = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The iterations are divided into blocks of equal size. Each worker
+    // executes the blocks of its range one by one. Once a worker's range is
+    // exhausted, it splits the remaining range of another worker in half and
+    // takes over the second half. Ranges are split only if there is a worker
+    // running out of work.
+    template <typename Result, typename FwdIter, typename F>
+    struct lazy_splitting_state
+    {
+        template <typename F_>
+        lazy_splitting_state(F_&& f, FwdIter first, std::size_t count,
+            std::size_t chunk_size, std::size_t num_blocks,
+            std::size_t num_workers)
+          : results_(num_blocks)
+          , f_(std::forward<F_>(f))
+          , count_(count)
+          , chunk_size_(chunk_size)
+          , ranges_(num_workers)
+        {
+            firsts_.reserve(num_blocks);
+            for (std::size_t i = 0; i != num_blocks; ++i)
+            {
+                firsts_.push_back(first);
+                if (i != num_blocks - 1)
+                    first = parallel::v1::detail::next(first, chunk_size);
+            }
+
+            // initially, each worker owns an equal share of the blocks
+            for (std::size_t i = 0; i != num_workers; ++i)
+            {
+                ranges_[i].begin_ = i * num_blocks / num_workers;
+                ranges_[i].end_ = (i + 1) * num_blocks / num_workers;
+            }
+        }
+
+        template <typename WithIndex>
+        void run(std::size_t worker, WithIndex with_index)
+        {
+            // the function is copied for each worker, the same way as it is
+            // copied for each chunk when scheduling them separately
+            typename std::decay<F>::type f(f_);
+
+            lazy_splitting_range& own = ranges_[worker];
+            while (true)
+            {
+                std::size_t block = 0;
+                bool has_block = false;
+                {
+                    std::lock_guard<hpx::lcos::local::spinlock> l(own.mtx_);
+                    if (own.begin_ != own.end_)
+                    {
+                        block = own.begin_++;
+                        has_block = true;
+                    }
+                }
+
+                if (has_block)
+                {
+                    execute(f, block, with_index);
+                }
+                else if (!steal(worker))
+                {
+                    break;
+                }
+            }
+        }
+
+        std::vector<FwdIter> firsts_;
+        std::vector<lazy_splitting_block_result<Result>> results_;
+
+    private:
+        template <typename F_>
+        void execute(F_& f, std::size_t block, std::false_type)
+        {
+            std::size_t const base_idx = block * chunk_size_;
+            try
+            {
+                results_[block].invoke(f, firsts_[block],
+                    (std::min)(chunk_size_, count_ - base_idx));
+            }
+            catch (...)
+            {
+                results_[block].error_ = std::current_exception();
+            }
+        }
+
+        template <typename F_>
+        void execute(F_& f, std::size_t block, std::true_type)
+        {
+            std::size_t const base_idx = block * chunk_size_;
+            try
+            {
+                results_[block].invoke(f, firsts_[block],
+                    (std::min)(chunk_size_, count_ - base_idx), base_idx);
+            }
+            catch (...)
+            {
+                results_[block].error_ = std::current_exception();
+            }
+        }
+
+        // Take over the second half of the remaining range of the first
+        // worker which has at least two blocks left.
+        bool steal(std::size_t worker)
+        {
+            std::size_t const num_workers = ranges_.size();
+            for (std::size_t i = 1; i != num_workers; ++i)
+            {
+                lazy_splitting_range& victim =
+                    ranges_[(worker + i) % num_workers];
+
+                std::size_t begin = 0, end = 0;
+                {
+                    std::lock_guard<hpx::lcos::local::spinlock> l(victim.mtx_);
+
+                    std::size_t const remaining = victim.end_ - victim.begin_;
+                    if (remaining < 2)
+                        continue;
+
+                    begin = victim.end_ - remaining / 2;
+                    end = victim.end_;
+                    victim.end_ = begin;
+                }
+
+                lazy_splitting_range& own = ranges_[worker];
+                std::lock_guard<hpx::lcos::local::spinlock> l(own.mtx_);
+                own.begin_ = begin;
+                own.end_ = end;
+                return true;
+            }
+            return false;
+        }
+
+        typename std::decay<F>::type f_;
+        std::size_t count_;
+        std::size_t chunk_size_;
+        std::vector<lazy_splitting_range> ranges_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Execute the given function on [first, first + count) using lazy binary
+    // splitting. The returned futures represent the results of the blocks
+    // in the order of the iterations they cover. The function is invoked
+    // with the base index of each block if WithIndex is std::true_type.
+    template <typename Result, typename ExPolicy, typename FwdIter,
+        typename Stride, typename F, typename WithIndex>
+    std::vector<hpx::future<Result>> lazy_splitting_partition(ExPolicy&& policy,
+        FwdIter first, std::size_t count, Stride s, F&& f, WithIndex)
+    {
+        std::size_t const cores = execution::processing_units_count(
+            policy.parameters(), policy.executor());
+
+        std::size_t chunk_size = execution::get_chunk_size(policy.parameters(),
+            policy.executor(), [](std::size_t) { return 0; }, cores, count);
+
+        if (chunk_size == 0)
+        {
+            chunk_size = (std::max)(std::size_t(1), (count + cores - 1) / cores);
+        }
+
+        Stride stride = parallel::v1::detail::abs(s);
+        if (stride != 1)
+        {
+            chunk_size = (std::max)(std::size_t(stride),
+                ((chunk_size + stride) / stride - 1) * stride);
+        }
+
+        std::size_t const num_blocks = (count + chunk_size - 1) / chunk_size;
+        std::size_t const num_workers = (std::min)(cores, num_blocks);
+
+        using state_type = lazy_splitting_state<Result, FwdIter, F>;
+        std::shared_ptr<state_type> state =
+            std::make_shared<state_type>(std::forward<F>(f), first, count,
+                chunk_size, num_blocks, num_workers);
+
+        std::vector<std::size_t> shape(num_workers);
+        std::iota(shape.begin(), shape.end(), std::size_t(0));
+
+        auto workers = execution::bulk_async_execute(
+            policy.executor(),
+            [state](std::size_t worker) { state->run(worker, WithIndex()); },
+            std::move(shape));
+
+        auto done = hpx::when_all(std::move(workers)).share();
+
+        std::vector<hpx::future<Result>> workitems;
+        workitems.reserve(num_blocks);
+        for (std::size_t i = 0; i != num_blocks; ++i)
+        {
+            workitems.push_back(done.then(hpx::launch::sync,
+                [state, i](auto&&) -> Result {
+                    return state->results_[i].get();
+                }));
+        }
+        return workitems;
+    }
+}}}}    // namespace hpx::parallel::util::detail
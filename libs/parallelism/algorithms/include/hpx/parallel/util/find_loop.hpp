@@ -0,0 +1,76 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace hpx { namespace parallel { namespace util {
+    ///////////////////////////////////////////////////////////////////////////
+    // The loops below are vectorized for vector-pack execution policies if
+    // the elements of the sequence can be loaded into vector packs. In this
+    // case the given functions are invoked with single elements and with
+    // vector packs (and have to return a mask for those). Algorithms use this
+    // trait to decide whether their comparisons can be vectorized.
+    template <typename ExPolicy, typename Iter, typename Enable = void>
+    struct find_loop_vectorizable : std::false_type
+    {
+    };
+
+    template <typename ExPolicy, typename Iter1, typename Iter2>
+    struct find_loop2_vectorizable
+      : std::integral_constant<bool,
+            find_loop_vectorizable<ExPolicy, Iter1>::value &&
+                find_loop_vectorizable<ExPolicy, Iter2>::value &&
+                std::is_same<
+                    typename std::iterator_traits<Iter1>::value_type,
+                    typename std::iterator_traits<Iter2>::value_type>::value>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Return the offset of the first element in [first, first + count) for
+    // which the given function returns true, or count if there is no such
+    // element.
+    template <typename ExPolicy, typename Iter, typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        !hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+        std::size_t>::type
+    find_first_n(Iter first, std::size_t count, F&& f)
+    {
+        for (std::size_t i = 0; i != count; (void) ++i, ++first)
+        {
+            if (f(*first))
+                return i;
+        }
+        return count;
+    }
+
+    // Same as above, the function is invoked with the corresponding elements
+    // of both sequences.
+    template <typename ExPolicy, typename Iter1, typename Iter2, typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        !hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+        std::size_t>::type
+    find_first2_n(Iter1 first1, Iter2 first2, std::size_t count, F&& f)
+    {
+        for (std::size_t i = 0; i != count; (void) ++i, ++first1, ++first2)
+        {
+            if (f(*first1, *first2))
+                return i;
+        }
+        return count;
+    }
+}}}    // namespace hpx::parallel::util
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/parallel/datapar/find_loop.hpp>
+#endif
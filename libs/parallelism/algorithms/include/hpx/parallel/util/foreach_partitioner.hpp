@@ -21,6 +21,7 @@
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
 #include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/detail/lazy_splitting.hpp>
 #include <hpx/parallel/util/detail/partitioner_iteration.hpp>
 #include <hpx/parallel/util/detail/scoped_executor_parameters.hpp>
 #include <hpx/parallel/util/detail/select_partitioner.hpp>
@@ -41,7 +42,7 @@ namespace hpx { namespace parallel { namespace util {
             typename F>
         std::pair<std::vector<hpx::future<Result>>,
             std::vector<hpx::future<Result>>>
-        foreach_partition(
+        foreach_partition(std::false_type /*has_lazy_splitting*/,
             ExPolicy&& policy, FwdIter first, std::size_t count, F&& f)
         {
             // estimate a chunk size based on number of cores used
@@ -63,6 +64,37 @@ namespace hpx { namespace parallel { namespace util {
             return std::make_pair(std::move(inititems), std::move(workitems));
         }
 
+        template <typename Result, typename ExPolicy, typename FwdIter,
+            typename F>
+        std::pair<std::vector<hpx::future<Result>>,
+            std::vector<hpx::future<Result>>>
+        foreach_partition(std::true_type /*has_lazy_splitting*/,
+            ExPolicy&& policy, FwdIter first, std::size_t count, F&& f)
+        {
+            return std::make_pair(std::vector<hpx::future<Result>>(),
+                detail::lazy_splitting_partition<Result>(
+                    std::forward<ExPolicy>(policy), first, count, 1,
+                    std::forward<F>(f), std::true_type{}));
+        }
+
+        template <typename Result, typename ExPolicy, typename FwdIter,
+            typename F>
+        std::pair<std::vector<hpx::future<Result>>,
+            std::vector<hpx::future<Result>>>
+        foreach_partition(
+            ExPolicy&& policy, FwdIter first, std::size_t count, F&& f)
+        {
+            using parameters_type =
+                typename std::decay<ExPolicy>::type::executor_parameters_type;
+            using has_lazy_splitting =
+                typename execution::extract_has_lazy_splitting<
+                    parameters_type>::type;
+
+            return detail::foreach_partition<Result>(has_lazy_splitting{},
+                std::forward<ExPolicy>(policy), first, count,
+                std::forward<F>(f));
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // The static partitioner simply spawns one chunk of iterations for
         // each available core.
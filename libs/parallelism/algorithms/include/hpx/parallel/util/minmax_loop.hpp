@@ -0,0 +1,115 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// make inspect happy: hpxinspect:nominmax
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/traits/is_execution_policy.hpp>
+#include <hpx/parallel/util/find_loop.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { namespace util {
+    ///////////////////////////////////////////////////////////////////////////
+    // The loops below compare the elements using operator<, they return the
+    // offsets of the selected elements relative to first.
+    namespace detail {
+        // first smallest element
+        template <typename Iter>
+        std::size_t min_element_n(Iter first, std::size_t count)
+        {
+            std::size_t smallest = 0;
+            Iter smallest_it = first;
+            for (std::size_t i = 1; i < count; ++i)
+            {
+                if (*++first < *smallest_it)
+                {
+                    smallest = i;
+                    smallest_it = first;
+                }
+            }
+            return smallest;
+        }
+
+        // first largest element
+        template <typename Iter>
+        std::size_t max_element_n(Iter first, std::size_t count)
+        {
+            std::size_t largest = 0;
+            Iter largest_it = first;
+            for (std::size_t i = 1; i < count; ++i)
+            {
+                if (*largest_it < *++first)
+                {
+                    largest = i;
+                    largest_it = first;
+                }
+            }
+            return largest;
+        }
+
+        // first smallest and last largest element
+        template <typename Iter>
+        std::pair<std::size_t, std::size_t> minmax_element_n(
+            Iter first, std::size_t count)
+        {
+            std::pair<std::size_t, std::size_t> result(0, 0);
+            Iter smallest_it = first;
+            Iter largest_it = first;
+            for (std::size_t i = 1; i < count; ++i)
+            {
+                ++first;
+                if (*first < *smallest_it)
+                {
+                    result.first = i;
+                    smallest_it = first;
+                }
+                if (!(*first < *largest_it))
+                {
+                    result.second = i;
+                    largest_it = first;
+                }
+            }
+            return result;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        !hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+        std::size_t>::type
+    min_element_n(Iter first, std::size_t count)
+    {
+        return detail::min_element_n(first, count);
+    }
+
+    template <typename ExPolicy, typename Iter>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        !hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+        std::size_t>::type
+    max_element_n(Iter first, std::size_t count)
+    {
+        return detail::max_element_n(first, count);
+    }
+
+    template <typename ExPolicy, typename Iter>
+    HPX_HOST_DEVICE HPX_FORCEINLINE typename std::enable_if<
+        !hpx::is_vectorpack_execution_policy<ExPolicy>::value,
+        std::pair<std::size_t, std::size_t>>::type
+    minmax_element_n(Iter first, std::size_t count)
+    {
+        return detail::minmax_element_n(first, count);
+    }
+}}}    // namespace hpx::parallel::util
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/parallel/datapar/minmax_loop.hpp>
+#endif
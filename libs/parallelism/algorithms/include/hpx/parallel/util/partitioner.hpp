@@ -22,6 +22,7 @@
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
 #include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/detail/lazy_splitting.hpp>
 #include <hpx/parallel/util/detail/partitioner_iteration.hpp>
 #include <hpx/parallel/util/detail/scoped_executor_parameters.hpp>
 #include <hpx/parallel/util/detail/select_partitioner.hpp>
@@ -42,7 +43,8 @@ namespace hpx { namespace parallel { namespace util {
         template <typename Result, typename ExPolicy, typename FwdIter,
             typename F>
         std::vector<hpx::future<Result>> partition(
-            ExPolicy&& policy, FwdIter first, std::size_t count, F&& f)
+            std::false_type /*has_lazy_splitting*/, ExPolicy&& policy,
+            FwdIter first, std::size_t count, F&& f)
         {
             // estimate a chunk size based on number of cores used
             using parameters_type =
@@ -71,9 +73,37 @@ namespace hpx { namespace parallel { namespace util {
             return inititems;
         }
 
+        template <typename Result, typename ExPolicy, typename FwdIter,
+            typename F>
+        std::vector<hpx::future<Result>> partition(
+            std::true_type /*has_lazy_splitting*/, ExPolicy&& policy,
+            FwdIter first, std::size_t count, F&& f)
+        {
+            return detail::lazy_splitting_partition<Result>(
+                std::forward<ExPolicy>(policy), first, count, 1,
+                std::forward<F>(f), std::false_type{});
+        }
+
+        template <typename Result, typename ExPolicy, typename FwdIter,
+            typename F>
+        std::vector<hpx::future<Result>> partition(
+            ExPolicy&& policy, FwdIter first, std::size_t count, F&& f)
+        {
+            using parameters_type =
+                typename std::decay<ExPolicy>::type::executor_parameters_type;
+            using has_lazy_splitting =
+                typename execution::extract_has_lazy_splitting<
+                    parameters_type>::type;
+
+            return detail::partition<Result>(has_lazy_splitting{},
+                std::forward<ExPolicy>(policy), first, count,
+                std::forward<F>(f));
+        }
+
         template <typename Result, typename ExPolicy, typename FwdIter,
             typename Stride, typename F>
-        std::vector<hpx::future<Result>> partition_with_index(ExPolicy&& policy,
+        std::vector<hpx::future<Result>> partition_with_index(
+            std::false_type /*has_lazy_splitting*/, ExPolicy&& policy,
             FwdIter first, std::size_t count, Stride stride, F&& f)
         {
             // estimate a chunk size based on number of cores used
@@ -103,6 +133,33 @@ namespace hpx { namespace parallel { namespace util {
             return inititems;
         }
 
+        template <typename Result, typename ExPolicy, typename FwdIter,
+            typename Stride, typename F>
+        std::vector<hpx::future<Result>> partition_with_index(
+            std::true_type /*has_lazy_splitting*/, ExPolicy&& policy,
+            FwdIter first, std::size_t count, Stride stride, F&& f)
+        {
+            return detail::lazy_splitting_partition<Result>(
+                std::forward<ExPolicy>(policy), first, count, stride,
+                std::forward<F>(f), std::true_type{});
+        }
+
+        template <typename Result, typename ExPolicy, typename FwdIter,
+            typename Stride, typename F>
+        std::vector<hpx::future<Result>> partition_with_index(ExPolicy&& policy,
+            FwdIter first, std::size_t count, Stride stride, F&& f)
+        {
+            using parameters_type =
+                typename std::decay<ExPolicy>::type::executor_parameters_type;
+            using has_lazy_splitting =
+                typename execution::extract_has_lazy_splitting<
+                    parameters_type>::type;
+
+            return detail::partition_with_index<Result>(has_lazy_splitting{},
+                std::forward<ExPolicy>(policy), first, count, stride,
+                std::forward<F>(f));
+        }
+
         template <typename Result, typename ExPolicy, typename FwdIter,
             typename Data, typename F>
         // requires is_container<Data>
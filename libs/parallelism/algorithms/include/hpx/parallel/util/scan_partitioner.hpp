@@ -11,6 +11,9 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/datastructures/optional.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
 #include <hpx/modules/errors.hpp>
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
 #include <hpx/async_local/dataflow.hpp>
@@ -26,8 +29,10 @@
 #include <hpx/parallel/util/detail/select_partitioner.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <exception>
+#include <iterator>
 #include <list>
 #include <memory>
 #include <type_traits>
@@ -43,8 +48,55 @@ namespace hpx { namespace parallel { namespace util {
     {
     };
 
+    // The single pass scan partitioner reads the input sequence only once.
+    // Each chunk is handed to step 3 directly after its prefix was determined
+    // by looking back at the results published by the chunks to its left
+    // (decoupled look-back). Step 3 can therefore operate on the data while
+    // it is still cached. This requires random access iterators, the normal
+    // scan partitioner is used otherwise.
+    struct scan_partitioner_single_pass_tag
+    {
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        // The state published by each chunk of the single pass scan. The
+        // aggregate is the result of step 1 for the chunk itself, the prefix
+        // is the accumulated result of all chunks up to and including this
+        // one.
+        template <typename Result1>
+        struct scan_chunk_state
+        {
+            enum status_type
+            {
+                status_none = 0,
+                status_aggregate = 1,
+                status_prefix = 2,
+                status_error = 3
+            };
+
+            std::atomic<int> status{status_none};
+            hpx::util::optional<Result1> aggregate;
+            hpx::util::optional<Result1> prefix;
+            std::exception_ptr error;
+        };
+
+        template <typename Result2, typename F, typename... Ts>
+        hpx::future<Result2> invoke_scan_step3(
+            std::false_type, F&& f, Ts&&... ts)
+        {
+            return hpx::make_ready_future(f(std::forward<Ts>(ts)...));
+        }
+
+        template <typename Result2, typename F, typename... Ts>
+        hpx::future<Result2> invoke_scan_step3(
+            std::true_type, F&& f, Ts&&... ts)
+        {
+            f(std::forward<Ts>(ts)...);
+            return hpx::make_ready_future();
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // The static partitioner simply spawns one chunk of iterations for
         // each available core.
@@ -281,6 +333,19 @@ namespace hpx { namespace parallel { namespace util {
 #endif
             }
 
+            template <typename ExPolicy_, typename FwdIter, typename T,
+                typename F1, typename F2, typename F3, typename F4>
+            static R call(scan_partitioner_single_pass_tag, ExPolicy_ policy,
+                FwdIter first, std::size_t count, T&& init, F1&& f1, F2&& f2,
+                F3&& f3, F4&& f4)
+            {
+                return call_single_pass(
+                    hpx::traits::is_random_access_iterator<FwdIter>(),
+                    std::move(policy), first, count, std::forward<T>(init),
+                    std::forward<F1>(f1), std::forward<F2>(f2),
+                    std::forward<F3>(f3), std::forward<F4>(f4));
+            }
+
             template <typename ExPolicy_, typename FwdIter, typename T,
                 typename F1, typename F2, typename F3, typename F4>
             static R call(ExPolicy_&& policy, FwdIter first, std::size_t count,
@@ -293,6 +358,240 @@ namespace hpx { namespace parallel { namespace util {
             }
 
         private:
+            // the number of bytes of the input sequence a chunk of the
+            // single pass scan should cover to remain in cache
+            static constexpr std::size_t single_pass_chunk_bytes = 64 * 1024;
+
+            template <typename ExPolicy_, typename FwdIter, typename T,
+                typename F1, typename F2, typename F3, typename F4>
+            static R call_single_pass(std::false_type, ExPolicy_&& policy,
+                FwdIter first, std::size_t count, T&& init, F1&& f1, F2&& f2,
+                F3&& f3, F4&& f4)
+            {
+                return call(scan_partitioner_normal_tag{},
+                    std::forward<ExPolicy_>(policy), first, count,
+                    std::forward<T>(init), std::forward<F1>(f1),
+                    std::forward<F2>(f2), std::forward<F3>(f3),
+                    std::forward<F4>(f4));
+            }
+
+            template <typename ExPolicy_, typename FwdIter, typename T,
+                typename F1, typename F2, typename F3, typename F4>
+            static R call_single_pass(std::true_type, ExPolicy_&& policy,
+                FwdIter first, std::size_t count, T&& init, F1&& f1, F2&& f2,
+                F3&& f3, F4&& f4)
+            {
+#if defined(HPX_COMPUTE_DEVICE_CODE)
+                HPX_ASSERT(false);
+                return R();
+#else
+                // inform parameter traits
+                scoped_executor_parameters scoped_params(
+                    policy.parameters(), policy.executor());
+
+                HPX_ASSERT(count > 0);
+
+                std::size_t const cores = execution::processing_units_count(
+                    policy.parameters(), policy.executor());
+                std::size_t const chunk_size =
+                    get_single_pass_chunk_size<FwdIter>(policy, cores, count);
+                std::size_t const num_chunks =
+                    (count + chunk_size - 1) / chunk_size;
+
+                std::vector<scan_chunk_state<Result1>> states(num_chunks);
+                std::vector<hpx::future<Result2>> finalitems(num_chunks);
+                std::atomic<std::size_t> next_chunk(0);
+
+                Result1 const init_value(std::forward<T>(init));
+
+                // Chunks are claimed in order, thus all chunks a worker may
+                // have to wait for are being processed already.
+                auto worker = [&]() -> void {
+                    for (std::size_t chunk = next_chunk++; chunk < num_chunks;
+                         chunk = next_chunk++)
+                    {
+                        std::size_t const base = chunk * chunk_size;
+                        finalitems[chunk] = process_chunk(states, chunk,
+                            std::next(first, base),
+                            (std::min)(chunk_size, count - base), init_value,
+                            f1, f2, f3);
+                    }
+                };
+
+                std::vector<hpx::future<void>> tasks;
+                std::list<std::exception_ptr> errors;
+                try
+                {
+                    std::size_t const num_tasks =
+                        (std::min)(cores, num_chunks) - 1;
+
+                    tasks.reserve(num_tasks);
+                    for (std::size_t i = 0; i != num_tasks; ++i)
+                    {
+                        tasks.push_back(execution::async_execute(
+                            policy.executor(), worker));
+                    }
+
+                    scoped_params.mark_end_of_scheduling();
+                }
+                catch (...)
+                {
+                    handle_local_exceptions::call(
+                        std::current_exception(), errors);
+                }
+
+                // the calling thread participates, this also guarantees
+                // that all chunks are processed even if no task could be
+                // created
+                worker();
+
+                hpx::wait_all(tasks);
+                handle_local_exceptions::call(tasks, errors);
+
+                std::vector<hpx::shared_future<Result1>> workitems;
+                workitems.reserve(num_chunks + 1);
+                workitems.push_back(hpx::make_ready_future(init_value));
+                for (auto& state : states)
+                {
+                    if (state.status.load(std::memory_order_relaxed) ==
+                        scan_chunk_state<Result1>::status_prefix)
+                    {
+                        workitems.push_back(
+                            hpx::make_ready_future(std::move(*state.prefix)));
+                    }
+                    else
+                    {
+                        workitems.push_back(
+                            hpx::make_exceptional_future<Result1>(
+                                state.error));
+                    }
+                }
+
+                return reduce(std::move(workitems), std::move(finalitems),
+                    std::move(errors), std::forward<F4>(f4));
+#endif
+            }
+
+            // Use chunks which are small enough to stay in cache between
+            // step 1 and step 3, but not larger than requested by the
+            // executor parameters.
+            template <typename FwdIter, typename ExPolicy_>
+            static std::size_t get_single_pass_chunk_size(
+                ExPolicy_& policy, std::size_t cores, std::size_t count)
+            {
+                std::size_t max_chunks = execution::maximal_number_of_chunks(
+                    policy.parameters(), policy.executor(), cores, count);
+
+                std::size_t chunk_size = execution::get_chunk_size(
+                    policy.parameters(), policy.executor(),
+                    [](std::size_t) { return 0; }, cores, count);
+
+                // make sure, chunk size and max_chunks are consistent
+                adjust_chunk_size_and_max_chunks(
+                    cores, count, max_chunks, chunk_size);
+
+                std::size_t const cached_chunk_size = (std::max)(
+                    single_pass_chunk_bytes /
+                        sizeof(
+                            typename std::iterator_traits<FwdIter>::value_type),
+                    std::size_t(1));
+
+                return (std::max)(
+                    (std::min)(chunk_size, cached_chunk_size), std::size_t(1));
+            }
+
+            // Run step 1 and step 3 for the given chunk. The prefix of the
+            // chunk is accumulated from the aggregates of the chunks to its
+            // left until a chunk is found which has published its prefix
+            // already.
+            template <typename FwdIter, typename F1, typename F2,
+                typename F3>
+            static hpx::future<Result2> process_chunk(
+                std::vector<scan_chunk_state<Result1>>& states,
+                std::size_t chunk, FwdIter it, std::size_t size,
+                Result1 const& init, F1& f1, F2& f2, F3& f3)
+            {
+                using state_type = scan_chunk_state<Result1>;
+                state_type& state = states[chunk];
+
+                hpx::util::optional<Result1> prefix;
+                hpx::util::optional<Result1> aggregate;
+                try
+                {
+                    // the functions are copied for each chunk, the same way
+                    // as they are copied when scheduling them separately
+                    typename std::decay<F2>::type op(f2);
+                    aggregate.emplace(
+                        typename std::decay<F1>::type(f1)(it, size));
+
+                    if (chunk == 0)
+                    {
+                        prefix.emplace(init);
+                    }
+                    else
+                    {
+                        state.aggregate.emplace(*aggregate);
+                        state.status.store(state_type::status_aggregate,
+                            std::memory_order_release);
+
+                        for (std::size_t i = chunk; i-- != 0; /**/)
+                        {
+                            state_type& pred = states[i];
+
+                            int status;
+                            hpx::util::yield_while([&]() {
+                                status =
+                                    pred.status.load(std::memory_order_acquire);
+                                return status == state_type::status_none;
+                            });
+
+                            if (status == state_type::status_error)
+                            {
+                                std::rethrow_exception(pred.error);
+                            }
+
+                            Result1 const& value =
+                                status == state_type::status_prefix ?
+                                *pred.prefix :
+                                *pred.aggregate;
+
+                            if (prefix)
+                                prefix.emplace(op(value, *prefix));
+                            else
+                                prefix.emplace(value);
+
+                            if (status == state_type::status_prefix)
+                                break;
+                        }
+                    }
+
+                    state.prefix.emplace(op(*prefix, *aggregate));
+                    state.status.store(
+                        state_type::status_prefix, std::memory_order_release);
+                }
+                catch (...)
+                {
+                    state.error = std::current_exception();
+                    state.status.store(
+                        state_type::status_error, std::memory_order_release);
+                    return hpx::make_exceptional_future<Result2>(state.error);
+                }
+
+                try
+                {
+                    return invoke_scan_step3<Result2>(
+                        std::is_void<Result2>(),
+                        typename std::decay<F3>::type(f3), it, size,
+                        hpx::make_ready_future(std::move(*prefix)).share(),
+                        hpx::make_ready_future(std::move(*aggregate)).share());
+                }
+                catch (...)
+                {
+                    return hpx::make_exceptional_future<Result2>(
+                        std::current_exception());
+                }
+            }
+
             template <typename F>
             static R reduce(
                 std::vector<hpx::shared_future<Result1>>&& workitems,
@@ -0,0 +1,212 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///////////////////////////////////////////////////////////////////////////////
+
+// Compares the parallel selection algorithms (nth_element, partial_sort, and
+// partial_sort_copy) with their sequential counterparts from the standard
+// library and with sorting the whole sequence.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_copy.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <hpx/modules/program_options.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+
+std::vector<std::uint64_t> make_data(std::size_t size)
+{
+    std::mt19937_64 gen(seed);
+    std::uniform_int_distribution<std::uint64_t> dist;
+
+    std::vector<std::uint64_t> v(size);
+    for (auto& val : v)
+        val = dist(gen);
+    return v;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename F>
+double run_benchmark(int test_count, std::vector<std::uint64_t> const& org,
+    std::vector<std::uint64_t>& v, F&& f)
+{
+    std::uint64_t time = std::uint64_t(0);
+
+    for (int i = 0; i < test_count; ++i)
+    {
+        // Restore [first, last) with original data.
+        hpx::copy(hpx::execution::par, org.begin(), org.end(), v.begin());
+
+        std::uint64_t elapsed = hpx::chrono::high_resolution_clock::now();
+        f(v);
+        time += hpx::chrono::high_resolution_clock::now() - elapsed;
+    }
+
+    return (time * 1e-9) / test_count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void run_benchmark(std::size_t vector_size, std::size_t k, int test_count)
+{
+    using namespace hpx::execution;
+
+    std::cout << "* Preparing Benchmark..." << std::endl;
+
+    std::vector<std::uint64_t> const org = make_data(vector_size);
+    std::vector<std::uint64_t> v(vector_size);
+    std::vector<std::uint64_t> d(k);
+
+    std::vector<std::uint64_t> sorted = org;
+    std::sort(sorted.begin(), sorted.end());
+
+    using vector_type = std::vector<std::uint64_t>;
+
+    std::cout << "* Running Benchmark..." << std::endl;
+    std::cout << "--- run_nth_element_benchmark_std ---" << std::endl;
+    double time_nth_std =
+        run_benchmark(test_count, org, v, [&](vector_type& v) {
+            std::nth_element(v.begin(), v.begin() + k, v.end());
+        });
+
+    std::cout << "--- run_nth_element_benchmark_par ---" << std::endl;
+    double time_nth_par =
+        run_benchmark(test_count, org, v, [&](vector_type& v) {
+            hpx::nth_element(par, v.begin(), v.begin() + k, v.end());
+            HPX_TEST(k == vector_size || v[k] == sorted[k]);
+        });
+
+    std::cout << "--- run_partial_sort_benchmark_std ---" << std::endl;
+    double time_partial_std =
+        run_benchmark(test_count, org, v, [&](vector_type& v) {
+            std::partial_sort(v.begin(), v.begin() + k, v.end());
+        });
+
+    std::cout << "--- run_partial_sort_benchmark_par ---" << std::endl;
+    double time_partial_par =
+        run_benchmark(test_count, org, v, [&](vector_type& v) {
+            hpx::partial_sort(par, v.begin(), v.begin() + k, v.end());
+            HPX_TEST(std::equal(v.begin(), v.begin() + k, sorted.begin()));
+        });
+
+    std::cout << "--- run_partial_sort_copy_benchmark_std ---" << std::endl;
+    double time_copy_std =
+        run_benchmark(test_count, org, v, [&](vector_type& v) {
+            std::partial_sort_copy(v.begin(), v.end(), d.begin(), d.end());
+        });
+
+    std::cout << "--- run_partial_sort_copy_benchmark_par ---" << std::endl;
+    double time_copy_par =
+        run_benchmark(test_count, org, v, [&](vector_type& v) {
+            hpx::partial_sort_copy(
+                par, v.begin(), v.end(), d.begin(), d.end());
+            HPX_TEST(std::equal(d.begin(), d.end(), sorted.begin()));
+        });
+
+    std::cout << "--- run_sort_benchmark_par ---" << std::endl;
+    double time_sort_par =
+        run_benchmark(test_count, org, v, [](vector_type& v) {
+            hpx::sort(par, v.begin(), v.end());
+        });
+
+    std::cout << "\n-------------- Benchmark Result --------------"
+              << std::endl;
+    auto fmt = "{1} ({2}) : {3}(sec)";
+    hpx::util::format_to(std::cout, fmt, "nth_element", "std", time_nth_std)
+        << std::endl;
+    hpx::util::format_to(std::cout, fmt, "nth_element", "par", time_nth_par)
+        << std::endl;
+    hpx::util::format_to(
+        std::cout, fmt, "partial_sort", "std", time_partial_std)
+        << std::endl;
+    hpx::util::format_to(
+        std::cout, fmt, "partial_sort", "par", time_partial_par)
+        << std::endl;
+    hpx::util::format_to(
+        std::cout, fmt, "partial_sort_copy", "std", time_copy_std)
+        << std::endl;
+    hpx::util::format_to(
+        std::cout, fmt, "partial_sort_copy", "par", time_copy_par)
+        << std::endl;
+    hpx::util::format_to(std::cout, fmt, "sort", "par", time_sort_par)
+        << std::endl;
+    std::cout << "----------------------------------------------" << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    // pull values from cmd
+    std::size_t vector_size = vm["vector_size"].as<std::size_t>();
+    std::size_t k = vm["k"].as<std::size_t>();
+    int test_count = vm["test_count"].as<int>();
+
+    if (k > vector_size)
+        k = vector_size;
+
+    std::size_t const os_threads = hpx::get_os_thread_count();
+
+    std::cout << "-------------- Benchmark Config --------------" << std::endl;
+    std::cout << "seed         : " << seed << std::endl;
+    std::cout << "vector_size  : " << vector_size << std::endl;
+    std::cout << "k            : " << k << std::endl;
+    std::cout << "test_count   : " << test_count << std::endl;
+    std::cout << "os threads   : " << os_threads << std::endl;
+    std::cout << "----------------------------------------------\n"
+              << std::endl;
+
+    run_benchmark(vector_size, k, test_count);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("vector_size",
+            hpx::program_options::value<std::size_t>()->default_value(10000000),
+            "size of vector (default: 10000000)")
+        ("k",
+            hpx::program_options::value<std::size_t>()->default_value(100000),
+            "number of elements to select/sort (default: 100000)")
+        ("test_count",
+            hpx::program_options::value<int>()->default_value(10),
+            "number of tests to be averaged (default: 10)")
+        ("seed,s", hpx::program_options::value<unsigned int>(),
+            "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    // initialize program
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,275 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///////////////////////////////////////////////////////////////////////////////
+
+// Compares the radix sort used by hpx::parallel::sort for arithmetic keys
+// with the comparison based sort (quick sort), the parallel stable sort
+// (sample sort/spin sort), and std::sort.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_copy.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/parallel/algorithms/radix_sort.hpp>
+
+#include <hpx/modules/program_options.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, std::vector<T>>::type
+make_data(std::size_t size)
+{
+    std::mt19937_64 gen(seed);
+    std::uniform_int_distribution<T> dist(
+        (std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+
+    std::vector<T> v(size);
+    for (auto& val : v)
+        val = dist(gen);
+    return v;
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, std::vector<T>>::type
+make_data(std::size_t size)
+{
+    std::mt19937_64 gen(seed);
+    std::uniform_real_distribution<T> dist(T(-1e6), T(1e6));
+
+    std::vector<T> v(size);
+    for (auto& val : v)
+        val = dist(gen);
+    return v;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename F>
+double run_sort_benchmark(
+    int test_count, std::vector<T> const& org, std::vector<T>& v, F&& f)
+{
+    std::uint64_t time = std::uint64_t(0);
+
+    for (int i = 0; i < test_count; ++i)
+    {
+        // Restore [first, last) with original data.
+        hpx::copy(hpx::execution::par, org.begin(), org.end(), v.begin());
+
+        std::uint64_t elapsed = hpx::chrono::high_resolution_clock::now();
+        f(v);
+        time += hpx::chrono::high_resolution_clock::now() - elapsed;
+
+        HPX_TEST(std::is_sorted(v.begin(), v.end()));
+    }
+
+    return (time * 1e-9) / test_count;
+}
+
+#if defined(HPX_HAVE_TUPLE_RVALUE_SWAP)
+template <typename T>
+double run_sort_by_key_benchmark(int test_count, std::vector<T> const& org,
+    std::vector<T>& keys, bool radix)
+{
+    std::uint64_t time = std::uint64_t(0);
+    std::vector<std::uint32_t> values(keys.size());
+
+    for (int i = 0; i < test_count; ++i)
+    {
+        hpx::copy(hpx::execution::par, org.begin(), org.end(), keys.begin());
+
+        std::uint64_t elapsed = hpx::chrono::high_resolution_clock::now();
+        if (radix)
+        {
+            hpx::parallel::sort_by_key(hpx::execution::par, keys.begin(),
+                keys.end(), values.begin());
+        }
+        else
+        {
+            // user supplied comparison functions disable the radix sort
+            hpx::parallel::sort_by_key(hpx::execution::par, keys.begin(),
+                keys.end(), values.begin(), [](T lhs, T rhs) {
+                    return lhs < rhs;
+                });
+        }
+        time += hpx::chrono::high_resolution_clock::now() - elapsed;
+
+        HPX_TEST(std::is_sorted(keys.begin(), keys.end()));
+    }
+
+    return (time * 1e-9) / test_count;
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void run_benchmark(std::size_t vector_size, int test_count)
+{
+    using namespace hpx::execution;
+
+    std::cout << "* Preparing Benchmark..." << std::endl;
+
+    std::vector<T> const org = make_data<T>(vector_size);
+    std::vector<T> v(vector_size);
+
+    // any comparison function other than std::less disables the radix sort
+    auto comp = [](T lhs, T rhs) { return lhs < rhs; };
+
+    std::cout << "* Running Benchmark..." << std::endl;
+    std::cout << "--- run_sort_benchmark_std ---" << std::endl;
+    double time_std = run_sort_benchmark(test_count, org, v,
+        [](std::vector<T>& v) { std::sort(v.begin(), v.end()); });
+
+    std::cout << "--- run_sort_benchmark_quick_sort ---" << std::endl;
+    double time_quick = run_sort_benchmark(
+        test_count, org, v, [&](std::vector<T>& v) {
+            hpx::parallel::sort(par, v.begin(), v.end(), comp);
+        });
+
+    std::cout << "--- run_sort_benchmark_sample_sort ---" << std::endl;
+    double time_sample = run_sort_benchmark(
+        test_count, org, v, [](std::vector<T>& v) {
+            hpx::parallel::stable_sort(par, v.begin(), v.end());
+        });
+
+    std::cout << "--- run_sort_benchmark_radix_sort ---" << std::endl;
+    double time_radix =
+        run_sort_benchmark(test_count, org, v, [](std::vector<T>& v) {
+            hpx::parallel::sort(par, v.begin(), v.end());
+        });
+
+    std::cout << "--- run_sort_benchmark_radix_sort_par_unseq ---"
+              << std::endl;
+    double time_radix_unseq =
+        run_sort_benchmark(test_count, org, v, [](std::vector<T>& v) {
+            hpx::parallel::radix_sort(par_unseq, v.begin(), v.end());
+        });
+
+#if defined(HPX_HAVE_TUPLE_RVALUE_SWAP)
+    std::cout << "--- run_sort_by_key_benchmark_quick_sort ---" << std::endl;
+    double time_by_key_quick =
+        run_sort_by_key_benchmark(test_count, org, v, false);
+
+    std::cout << "--- run_sort_by_key_benchmark_radix_sort ---" << std::endl;
+    double time_by_key_radix =
+        run_sort_by_key_benchmark(test_count, org, v, true);
+#endif
+
+    std::cout << "\n-------------- Benchmark Result --------------"
+              << std::endl;
+    auto fmt = "sort ({1}) : {2}(sec)";
+    hpx::util::format_to(std::cout, fmt, "std", time_std) << std::endl;
+    hpx::util::format_to(std::cout, fmt, "quick_sort", time_quick)
+        << std::endl;
+    hpx::util::format_to(std::cout, fmt, "sample_sort", time_sample)
+        << std::endl;
+    hpx::util::format_to(std::cout, fmt, "radix_sort", time_radix)
+        << std::endl;
+    hpx::util::format_to(std::cout, fmt, "radix_sort par_unseq",
+        time_radix_unseq)
+        << std::endl;
+#if defined(HPX_HAVE_TUPLE_RVALUE_SWAP)
+    hpx::util::format_to(std::cout, fmt, "sort_by_key quick_sort",
+        time_by_key_quick)
+        << std::endl;
+    hpx::util::format_to(std::cout, fmt, "sort_by_key radix_sort",
+        time_by_key_radix)
+        << std::endl;
+#endif
+    std::cout << "----------------------------------------------" << std::endl;
+}
+
+void run_benchmark(
+    std::size_t vector_size, int test_count, std::string const& data_type)
+{
+    if (data_type == "uint32")
+        run_benchmark<std::uint32_t>(vector_size, test_count);
+    else if (data_type == "int32")
+        run_benchmark<std::int32_t>(vector_size, test_count);
+    else if (data_type == "int64")
+        run_benchmark<std::int64_t>(vector_size, test_count);
+    else if (data_type == "float")
+        run_benchmark<float>(vector_size, test_count);
+    else if (data_type == "double")
+        run_benchmark<double>(vector_size, test_count);
+    else    // uint64
+        run_benchmark<std::uint64_t>(vector_size, test_count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    // pull values from cmd
+    std::size_t vector_size = vm["vector_size"].as<std::size_t>();
+    int test_count = vm["test_count"].as<int>();
+    std::string data_type = vm["data_type"].as<std::string>();
+
+    std::size_t const os_threads = hpx::get_os_thread_count();
+
+    std::cout << "-------------- Benchmark Config --------------" << std::endl;
+    std::cout << "seed         : " << seed << std::endl;
+    std::cout << "vector_size  : " << vector_size << std::endl;
+    std::cout << "data_type    : " << data_type << std::endl;
+    std::cout << "test_count   : " << test_count << std::endl;
+    std::cout << "os threads   : " << os_threads << std::endl;
+    std::cout << "----------------------------------------------\n"
+              << std::endl;
+
+    run_benchmark(vector_size, test_count, data_type);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("vector_size",
+            hpx::program_options::value<std::size_t>()->default_value(10000000),
+            "size of vector (default: 10000000)")
+        ("data_type",
+            hpx::program_options::value<std::string>()->default_value("uint64"),
+            "the type of the sorted keys "
+            "(uint32/uint64/int32/int64/float/double)")
+        ("test_count",
+            hpx::program_options::value<int>()->default_value(10),
+            "number of tests to be averaged (default: 10)")
+        ("seed,s", hpx::program_options::value<unsigned int>(),
+            "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    // initialize program
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,320 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////
+int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// the parallel selection is used for more than 65536 elements only, use
+// smaller array sizes for debug tests
+#if defined(HPX_DEBUG)
+#define HPX_NTH_ELEMENT_TEST_SIZE (1 << 17)
+#else
+#define HPX_NTH_ELEMENT_TEST_SIZE (1 << 20)
+#endif
+
+///////////////////////////////////////////////////////////////////////////
+// the values contain duplicates
+std::vector<std::size_t> make_data(std::size_t size)
+{
+    std::uniform_int_distribution<std::size_t> dist(0, size / 4);
+
+    std::vector<std::size_t> c(size);
+    std::generate(std::begin(c), std::end(c), [&]() { return dist(gen); });
+    return c;
+}
+
+template <typename Comp>
+void verify_nth_element(std::vector<std::size_t> const& c,
+    std::vector<std::size_t> const& sorted, std::size_t n, Comp comp)
+{
+    HPX_TEST_EQ(c[n], sorted[n]);
+    HPX_TEST(std::none_of(std::begin(c), std::begin(c) + n,
+        [&](std::size_t v) { return comp(c[n], v); }));
+    HPX_TEST(std::none_of(std::begin(c) + n + 1, std::end(c),
+        [&](std::size_t v) { return comp(v, c[n]); }));
+}
+
+///////////////////////////////////////////////////////////////////////////
+template <typename IteratorTag>
+void test_nth_element(IteratorTag, std::size_t size)
+{
+    typedef std::vector<std::size_t>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<std::size_t> c = make_data(size);
+    std::vector<std::size_t> sorted = c;
+    std::sort(std::begin(sorted), std::end(sorted));
+
+    for (std::size_t n : {std::size_t(0), size / 3, size - 1})
+    {
+        hpx::nth_element(iterator(std::begin(c)),
+            iterator(std::begin(c) + n), iterator(std::end(c)));
+        verify_nth_element(c, sorted, n, std::less<std::size_t>());
+    }
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_nth_element(ExPolicy&& policy, IteratorTag, std::size_t size)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    typedef std::vector<std::size_t>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<std::size_t> c = make_data(size);
+    std::vector<std::size_t> sorted = c;
+    std::sort(std::begin(sorted), std::end(sorted));
+
+    for (std::size_t n : {std::size_t(0), size / 3, size - 1})
+    {
+        hpx::nth_element(policy, iterator(std::begin(c)),
+            iterator(std::begin(c) + n), iterator(std::end(c)));
+        verify_nth_element(c, sorted, n, std::less<std::size_t>());
+    }
+
+    // use a custom comparison
+    std::sort(std::begin(sorted), std::end(sorted), std::greater<>());
+
+    std::size_t const n = size / 2;
+    hpx::nth_element(policy, iterator(std::begin(c)),
+        iterator(std::begin(c) + n), iterator(std::end(c)),
+        std::greater<std::size_t>());
+    verify_nth_element(c, sorted, n, std::greater<std::size_t>());
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_nth_element_async(ExPolicy&& p, IteratorTag, std::size_t size)
+{
+    typedef std::vector<std::size_t>::iterator base_iterator;
+    typedef test::test_iterator<base_iterator, IteratorTag> iterator;
+
+    std::vector<std::size_t> c = make_data(size);
+    std::vector<std::size_t> sorted = c;
+    std::sort(std::begin(sorted), std::end(sorted));
+
+    std::size_t const n = size / 3;
+    hpx::future<void> f = hpx::nth_element(p, iterator(std::begin(c)),
+        iterator(std::begin(c) + n), iterator(std::end(c)));
+    f.wait();
+
+    verify_nth_element(c, sorted, n, std::less<std::size_t>());
+}
+
+template <typename IteratorTag>
+void test_nth_element()
+{
+    using namespace hpx::execution;
+
+    for (std::size_t size : {std::size_t(1), std::size_t(10007),
+             std::size_t(HPX_NTH_ELEMENT_TEST_SIZE)})
+    {
+        test_nth_element(IteratorTag(), size);
+
+        test_nth_element(seq, IteratorTag(), size);
+        test_nth_element(par, IteratorTag(), size);
+        test_nth_element(par_unseq, IteratorTag(), size);
+
+        test_nth_element_async(seq(task), IteratorTag(), size);
+        test_nth_element_async(par(task), IteratorTag(), size);
+    }
+}
+
+void nth_element_test()
+{
+    test_nth_element<std::random_access_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_nth_element_exception(ExPolicy&& policy, IteratorTag)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    typedef std::vector<std::size_t>::iterator base_iterator;
+    typedef test::decorated_iterator<base_iterator, IteratorTag>
+        decorated_iterator;
+
+    std::vector<std::size_t> c = make_data(HPX_NTH_ELEMENT_TEST_SIZE);
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::nth_element(policy,
+            decorated_iterator(
+                std::begin(c), []() { throw std::runtime_error("test"); }),
+            decorated_iterator(std::begin(c) + c.size() / 2),
+            decorated_iterator(std::end(c)));
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& e)
+    {
+        caught_exception = true;
+        test::test_num_exceptions<ExPolicy, IteratorTag>::call(policy, e);
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+template <typename ExPolicy, typename IteratorTag>
+void test_nth_element_exception_async(ExPolicy&& p, IteratorTag)
+{
+    typedef std::vector<std::size_t>::iterator base_iterator;
+    typedef test::decorated_iterator<base_iterator, IteratorTag>
+        decorated_iterator;
+
+    std::vector<std::size_t> c = make_data(HPX_NTH_ELEMENT_TEST_SIZE);
+
+    bool caught_exception = false;
+    bool returned_from_algorithm = false;
+    try
+    {
+        hpx::future<void> f = hpx::nth_element(p,
+            decorated_iterator(
+                std::begin(c), []() { throw std::runtime_error("test"); }),
+            decorated_iterator(std::begin(c) + c.size() / 2),
+            decorated_iterator(std::end(c)));
+        returned_from_algorithm = true;
+        f.get();
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& e)
+    {
+        caught_exception = true;
+        test::test_num_exceptions<ExPolicy, IteratorTag>::call(p, e);
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+    HPX_TEST(returned_from_algorithm);
+}
+
+template <typename IteratorTag>
+void test_nth_element_exception()
+{
+    using namespace hpx::execution;
+
+    // If the execution policy object is of type vector_execution_policy,
+    // std::terminate shall be called. therefore we do not test exceptions
+    // with a vector execution policy
+    test_nth_element_exception(seq, IteratorTag());
+    test_nth_element_exception(par, IteratorTag());
+
+    test_nth_element_exception_async(seq(task), IteratorTag());
+    test_nth_element_exception_async(par(task), IteratorTag());
+}
+
+void nth_element_exception_test()
+{
+    test_nth_element_exception<std::random_access_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename IteratorTag>
+void test_nth_element_bad_alloc(ExPolicy&& policy, IteratorTag)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    typedef std::vector<std::size_t>::iterator base_iterator;
+    typedef test::decorated_iterator<base_iterator, IteratorTag>
+        decorated_iterator;
+
+    std::vector<std::size_t> c = make_data(HPX_NTH_ELEMENT_TEST_SIZE);
+
+    bool caught_bad_alloc = false;
+    try
+    {
+        hpx::nth_element(policy,
+            decorated_iterator(std::begin(c), []() { throw std::bad_alloc(); }),
+            decorated_iterator(std::begin(c) + c.size() / 2),
+            decorated_iterator(std::end(c)));
+        HPX_TEST(false);
+    }
+    catch (std::bad_alloc const&)
+    {
+        caught_bad_alloc = true;
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_bad_alloc);
+}
+
+template <typename IteratorTag>
+void test_nth_element_bad_alloc()
+{
+    using namespace hpx::execution;
+
+    test_nth_element_bad_alloc(seq, IteratorTag());
+    test_nth_element_bad_alloc(par, IteratorTag());
+}
+
+void nth_element_bad_alloc_test()
+{
+    test_nth_element_bad_alloc<std::random_access_iterator_tag>();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    nth_element_test();
+    nth_element_exception_test();
+    nth_element_bad_alloc_test();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv), 0,
+        "HPX main exited with a non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,250 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/radix_sort.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// use smaller array sizes for debug tests
+#if defined(HPX_DEBUG)
+#define HPX_RADIX_SORT_TEST_SIZE (1 << 17)
+#else
+#define HPX_RADIX_SORT_TEST_SIZE (1 << 20)
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, std::vector<T>>::type
+make_data(std::size_t size)
+{
+    std::uniform_int_distribution<T> dist(
+        (std::numeric_limits<T>::min)(), (std::numeric_limits<T>::max)());
+
+    std::vector<T> v(size);
+    for (auto& val : v)
+        val = dist(gen);
+    return v;
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, std::vector<T>>::type
+make_data(std::size_t size)
+{
+    std::uniform_real_distribution<T> dist(T(-1e6), T(1e6));
+
+    std::vector<T> v(size);
+    for (auto& val : v)
+        val = dist(gen);
+
+    if (size > 4)
+    {
+        v[0] = T(0);
+        v[1] = T(-0.0);
+        v[2] = (std::numeric_limits<T>::max)();
+        v[3] = std::numeric_limits<T>::lowest();
+    }
+    return v;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename T>
+void test_radix_sort(ExPolicy&& policy, T, std::size_t size)
+{
+    std::vector<T> c = make_data<T>(size);
+    std::vector<T> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<T> d = c;
+
+    // explicit radix sort
+    auto result = hpx::parallel::radix_sort(policy, c.begin(), c.end());
+    HPX_TEST(result == c.end());
+    HPX_TEST(c == expected);
+
+    // automatically selected by sort
+    hpx::parallel::sort(policy, d.begin(), d.end());
+    HPX_TEST(d == expected);
+}
+
+template <typename ExPolicy, typename T>
+void test_radix_sort_async(ExPolicy&& policy, T, std::size_t size)
+{
+    std::vector<T> c = make_data<T>(size);
+    std::vector<T> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<T> d = c;
+
+    auto f = hpx::parallel::radix_sort(policy, c.begin(), c.end());
+    HPX_TEST(f.get() == c.end());
+    HPX_TEST(c == expected);
+
+    auto g = hpx::parallel::sort(policy, d.begin(), d.end());
+    HPX_TEST(g.get() == d.end());
+    HPX_TEST(d == expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+struct element
+{
+    std::int32_t key;
+    std::size_t payload;
+};
+
+template <typename ExPolicy>
+void test_radix_sort_proj(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<std::int32_t> keys = make_data<std::int32_t>(size);
+
+    std::vector<element> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+        c[i] = element{keys[i], std::size_t(keys[i]) * 3};
+
+    hpx::parallel::radix_sort(
+        policy, c.begin(), c.end(), [](element const& e) { return e.key; });
+
+    std::sort(keys.begin(), keys.end());
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        HPX_TEST_EQ(c[i].key, keys[i]);
+        HPX_TEST_EQ(c[i].payload, std::size_t(keys[i]) * 3);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// std::less<user_type> has to use the comparison based sort
+struct user_type
+{
+    std::int32_t key;
+
+    friend bool operator<(user_type const& lhs, user_type const& rhs)
+    {
+        // reverse order, which the radix sort would not know about
+        return rhs.key < lhs.key;
+    }
+};
+
+static_assert(!hpx::parallel::v1::detail::use_radix_sort<
+                  std::vector<user_type>::iterator, std::less<user_type>,
+                  hpx::parallel::util::projection_identity>::value,
+    "std::less<user_type> should not use the radix sort");
+
+static_assert(!hpx::parallel::v1::detail::use_radix_sort<
+                  std::vector<std::int32_t>::iterator, std::less<double>,
+                  hpx::parallel::util::projection_identity>::value,
+    "std::less<double> should not use the radix sort for integral keys");
+
+static_assert(hpx::parallel::v1::detail::use_radix_sort<
+                  std::vector<std::int32_t>::iterator, std::less<std::int32_t>,
+                  hpx::parallel::util::projection_identity>::value,
+    "std::less<std::int32_t> should use the radix sort");
+
+template <typename ExPolicy>
+void test_sort_user_type(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<std::int32_t> keys = make_data<std::int32_t>(size);
+
+    std::vector<user_type> c(size);
+    for (std::size_t i = 0; i != size; ++i)
+        c[i] = user_type{keys[i]};
+
+    hpx::parallel::sort(policy, c.begin(), c.end(), std::less<user_type>());
+
+    std::sort(keys.begin(), keys.end(), std::greater<std::int32_t>());
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        HPX_TEST_EQ(c[i].key, keys[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void test_radix_sort(T val)
+{
+    using namespace hpx::execution;
+
+    for (std::size_t size : {std::size_t(0), std::size_t(1), std::size_t(1000),
+             std::size_t(HPX_RADIX_SORT_TEST_SIZE)})
+    {
+        test_radix_sort(seq, val, size);
+        test_radix_sort(par, val, size);
+        test_radix_sort(par_unseq, val, size);
+
+        test_radix_sort_async(seq(task), val, size);
+        test_radix_sort_async(par(task), val, size);
+    }
+}
+
+void radix_sort_test()
+{
+    using namespace hpx::execution;
+
+    test_radix_sort(std::uint16_t());
+    test_radix_sort(std::int16_t());
+    test_radix_sort(std::uint32_t());
+    test_radix_sort(std::int32_t());
+    test_radix_sort(std::uint64_t());
+    test_radix_sort(std::int64_t());
+    test_radix_sort(float());
+    test_radix_sort(double());
+
+    test_radix_sort_proj(seq, HPX_RADIX_SORT_TEST_SIZE);
+    test_radix_sort_proj(par, HPX_RADIX_SORT_TEST_SIZE);
+    test_radix_sort_proj(par_unseq, HPX_RADIX_SORT_TEST_SIZE);
+
+    test_sort_user_type(seq, HPX_RADIX_SORT_TEST_SIZE);
+    test_sort_user_type(par, HPX_RADIX_SORT_TEST_SIZE);
+    test_sort_user_type(par_unseq, HPX_RADIX_SORT_TEST_SIZE);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    radix_sort_test();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
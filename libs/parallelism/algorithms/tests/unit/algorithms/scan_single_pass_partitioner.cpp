@@ -0,0 +1,216 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The parallel scans over random access iterators use the single-pass
+// (decoupled look-back) mode of the scan_partitioner. Verify the results for
+// an associative but non-commutative operation, which detects chunks being
+// combined in the wrong order, using many chunks and a partial last chunk.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_executor_parameters.hpp>
+#include <hpx/include/parallel_scan.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+// 2x2 matrices of unsigned integers, multiplication (modulo 2^64) is
+// associative but not commutative
+struct matrix
+{
+    std::uint64_t a = 1, b = 0, c = 0, d = 1;
+
+    friend bool operator==(matrix const& lhs, matrix const& rhs)
+    {
+        return lhs.a == rhs.a && lhs.b == rhs.b && lhs.c == rhs.c &&
+            lhs.d == rhs.d;
+    }
+};
+
+struct multiply
+{
+    matrix operator()(matrix const& lhs, matrix const& rhs) const
+    {
+        matrix m;
+        m.a = lhs.a * rhs.a + lhs.b * rhs.c;
+        m.b = lhs.a * rhs.b + lhs.b * rhs.d;
+        m.c = lhs.c * rhs.a + lhs.d * rhs.c;
+        m.d = lhs.c * rhs.b + lhs.d * rhs.d;
+        return m;
+    }
+};
+
+std::vector<matrix> make_data(std::size_t size)
+{
+    std::uniform_int_distribution<std::uint64_t> dist(0, 7);
+
+    std::vector<matrix> v(size);
+    for (matrix& m : v)
+    {
+        m.a = dist(gen);
+        m.b = dist(gen);
+        m.c = dist(gen);
+        m.d = dist(gen);
+    }
+    return v;
+}
+
+matrix make_init()
+{
+    matrix m;
+    m.a = 3;
+    m.b = 1;
+    m.c = 4;
+    m.d = 1;
+    return m;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_inclusive_scan(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<matrix> c = make_data(size);
+    std::vector<matrix> d(size);
+    std::vector<matrix> e(size);
+
+    hpx::parallel::inclusive_scan(
+        policy, std::begin(c), std::end(c), std::begin(d), multiply());
+
+    std::partial_sum(std::begin(c), std::end(c), std::begin(e), multiply());
+    HPX_TEST(d == e);
+
+    // with an initial value, which is not the identity
+    matrix const init = make_init();
+    hpx::parallel::inclusive_scan(
+        policy, std::begin(c), std::end(c), std::begin(d), multiply(), init);
+
+    if (size != 0)
+    {
+        c[0] = multiply()(init, c[0]);
+    }
+    std::partial_sum(std::begin(c), std::end(c), std::begin(e), multiply());
+    HPX_TEST(d == e);
+}
+
+template <typename ExPolicy>
+void test_exclusive_scan(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<matrix> c = make_data(size);
+    std::vector<matrix> d(size);
+
+    matrix const init = make_init();
+    hpx::parallel::exclusive_scan(
+        policy, std::begin(c), std::end(c), std::begin(d), init, multiply());
+
+    // the exclusive scan is the inclusive scan of [init, c[0], ... c[n-2]]
+    std::vector<matrix> e(size);
+    if (size != 0)
+    {
+        std::vector<matrix> shifted(size);
+        shifted[0] = init;
+        std::copy(std::begin(c), std::prev(std::end(c)),
+            std::next(std::begin(shifted)));
+
+        std::partial_sum(std::begin(shifted), std::end(shifted),
+            std::begin(e), multiply());
+    }
+    HPX_TEST(d == e);
+}
+
+template <typename ExPolicy>
+void test_scan_async(ExPolicy&& policy, std::size_t size)
+{
+    std::vector<matrix> c = make_data(size);
+    std::vector<matrix> d(size);
+    std::vector<matrix> e(size);
+
+    auto f = hpx::parallel::inclusive_scan(
+        policy, std::begin(c), std::end(c), std::begin(d), multiply());
+    f.wait();
+
+    std::partial_sum(std::begin(c), std::end(c), std::begin(e), multiply());
+    HPX_TEST(d == e);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_scan_single_pass(ExPolicy&& policy, std::size_t size)
+{
+    test_inclusive_scan(policy, size);
+    test_exclusive_scan(policy, size);
+}
+
+void scan_single_pass_partitioner_test()
+{
+    using namespace hpx::execution;
+
+    // most combinations give many chunks and a partial last chunk
+    std::size_t const sizes[] = {1, 2, 1001, 10007};
+    std::size_t const chunk_sizes[] = {1, 3, 64, 1000};
+
+    for (std::size_t size : sizes)
+    {
+        for (std::size_t chunk_size : chunk_sizes)
+        {
+            static_chunk_size cs(chunk_size);
+
+            test_scan_single_pass(par.with(cs), size);
+            test_scan_async(par(task).with(cs), size);
+        }
+    }
+
+    // the default chunking splits larger sequences into chunks which are
+    // small enough to stay in cache
+    test_scan_single_pass(par, 100003);
+    test_scan_single_pass(par_unseq, 100003);
+    test_scan_async(par(task), 100003);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    scan_single_pass_partitioner_test();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,189 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////
+int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// the parallel version is used for more than 65536 elements only
+#if defined(HPX_DEBUG)
+#define HPX_PARTIAL_SORT_COPY_TEST_SIZE (1 << 17)
+#else
+#define HPX_PARTIAL_SORT_COPY_TEST_SIZE (1 << 20)
+#endif
+
+struct element
+{
+    std::size_t key;
+    std::size_t payload;
+};
+
+std::vector<element> make_data(std::size_t size)
+{
+    std::uniform_int_distribution<std::size_t> dist(0, size / 4);
+
+    std::vector<element> c(size);
+    std::size_t payload = 0;
+    for (element& e : c)
+    {
+        e.key = dist(gen);
+        e.payload = payload++;
+    }
+    return c;
+}
+
+// the destination sizes used for a source of the given size
+std::vector<std::size_t> destination_sizes(std::size_t size)
+{
+    return std::vector<std::size_t>{0, 1, size / 100 + 1, size, size + 10};
+}
+
+template <typename Result>
+void verify_partial_sort_copy(std::vector<element> const& c,
+    std::vector<element>& d, std::vector<std::size_t> const& sorted,
+    Result const& result)
+{
+    std::size_t const count = (std::min)(d.size(), c.size());
+
+    HPX_TEST(result.in == std::end(c));
+    HPX_TEST(result.out == std::begin(d) + count);
+    for (std::size_t i = 0; i != count; ++i)
+        HPX_TEST_EQ(d[i].key, sorted[i]);
+}
+
+std::vector<std::size_t> sorted_keys(std::vector<element> const& c)
+{
+    std::vector<std::size_t> keys;
+    keys.reserve(c.size());
+    for (element const& e : c)
+        keys.push_back(e.key);
+    std::sort(std::begin(keys), std::end(keys));
+    return keys;
+}
+
+///////////////////////////////////////////////////////////////////////////
+void test_partial_sort_copy(std::size_t size)
+{
+    std::vector<element> const c = make_data(size);
+    std::vector<std::size_t> const sorted = sorted_keys(c);
+
+    for (std::size_t n : destination_sizes(size))
+    {
+        std::vector<element> d(n);
+        auto result = hpx::ranges::partial_sort_copy(
+            c, d, hpx::ranges::less(), &element::key, &element::key);
+        verify_partial_sort_copy(c, d, sorted, result);
+
+        std::vector<element> d2(n);
+        auto result2 = hpx::ranges::partial_sort_copy(std::begin(c),
+            std::end(c), std::begin(d2), std::end(d2), hpx::ranges::less(),
+            &element::key, &element::key);
+        verify_partial_sort_copy(c, d2, sorted, result2);
+    }
+}
+
+template <typename ExPolicy>
+void test_partial_sort_copy(ExPolicy&& policy, std::size_t size)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    std::vector<element> const c = make_data(size);
+    std::vector<std::size_t> sorted = sorted_keys(c);
+
+    for (std::size_t n : destination_sizes(size))
+    {
+        std::vector<element> d(n);
+        auto result = hpx::ranges::partial_sort_copy(
+            policy, c, d, hpx::ranges::less(), &element::key, &element::key);
+        verify_partial_sort_copy(c, d, sorted, result);
+    }
+
+    // use a custom comparison
+    std::sort(std::begin(sorted), std::end(sorted), std::greater<>());
+
+    std::vector<element> d(size / 2);
+    auto result = hpx::ranges::partial_sort_copy(policy, std::begin(c),
+        std::end(c), std::begin(d), std::end(d), std::greater<std::size_t>(),
+        &element::key, &element::key);
+    verify_partial_sort_copy(c, d, sorted, result);
+}
+
+template <typename ExPolicy>
+void test_partial_sort_copy_async(ExPolicy&& p, std::size_t size)
+{
+    std::vector<element> const c = make_data(size);
+    std::vector<std::size_t> const sorted = sorted_keys(c);
+
+    std::vector<element> d(size / 3);
+    auto f = hpx::ranges::partial_sort_copy(
+        p, c, d, hpx::ranges::less(), &element::key, &element::key);
+
+    verify_partial_sort_copy(c, d, sorted, f.get());
+}
+
+void partial_sort_copy_test()
+{
+    using namespace hpx::execution;
+
+    for (std::size_t size :
+        {std::size_t(10007), std::size_t(HPX_PARTIAL_SORT_COPY_TEST_SIZE)})
+    {
+        test_partial_sort_copy(size);
+
+        test_partial_sort_copy(seq, size);
+        test_partial_sort_copy(par, size);
+        test_partial_sort_copy(par_unseq, size);
+
+        test_partial_sort_copy_async(seq(task), size);
+        test_partial_sort_copy_async(par(task), size);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    partial_sort_copy_test();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv), 0,
+        "HPX main exited with a non-zero status");
+
+    return hpx::util::report_errors();
+}
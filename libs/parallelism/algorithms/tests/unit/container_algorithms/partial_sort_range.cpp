@@ -0,0 +1,185 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "test_utils.hpp"
+
+///////////////////////////////////////////////////////////////////////////
+int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// the parallel version is used for more than 65536 elements only
+#if defined(HPX_DEBUG)
+#define HPX_PARTIAL_SORT_TEST_SIZE (1 << 17)
+#else
+#define HPX_PARTIAL_SORT_TEST_SIZE (1 << 20)
+#endif
+
+struct element
+{
+    std::size_t key;
+    std::size_t payload;
+};
+
+std::vector<element> make_data(std::size_t size)
+{
+    std::uniform_int_distribution<std::size_t> dist(0, size / 4);
+
+    std::vector<element> c(size);
+    std::size_t payload = 0;
+    for (element& e : c)
+    {
+        e.key = dist(gen);
+        e.payload = payload++;
+    }
+    return c;
+}
+
+template <typename Comp>
+void verify_partial_sort(std::vector<element> const& c,
+    std::vector<std::size_t> const& sorted, std::size_t n, Comp comp)
+{
+    for (std::size_t i = 0; i != n; ++i)
+        HPX_TEST_EQ(c[i].key, sorted[i]);
+    if (n != 0)
+    {
+        HPX_TEST(std::none_of(std::begin(c) + n, std::end(c),
+            [&](element const& e) { return comp(e.key, c[n - 1].key); }));
+    }
+}
+
+std::vector<std::size_t> sorted_keys(std::vector<element> const& c)
+{
+    std::vector<std::size_t> keys;
+    keys.reserve(c.size());
+    for (element const& e : c)
+        keys.push_back(e.key);
+    std::sort(std::begin(keys), std::end(keys));
+    return keys;
+}
+
+///////////////////////////////////////////////////////////////////////////
+void test_partial_sort(std::size_t size)
+{
+    std::vector<element> c = make_data(size);
+    std::vector<std::size_t> sorted = sorted_keys(c);
+
+    std::size_t const n = size / 3;
+    auto result = hpx::ranges::partial_sort(
+        c, std::begin(c) + n, hpx::ranges::less(), &element::key);
+    HPX_TEST(result == std::end(c));
+    verify_partial_sort(c, sorted, n, std::less<std::size_t>());
+
+    c = make_data(size);
+    sorted = sorted_keys(c);
+
+    result = hpx::ranges::partial_sort(std::begin(c), std::begin(c) + n,
+        std::end(c), hpx::ranges::less(), &element::key);
+    HPX_TEST(result == std::end(c));
+    verify_partial_sort(c, sorted, n, std::less<std::size_t>());
+}
+
+template <typename ExPolicy>
+void test_partial_sort(ExPolicy&& policy, std::size_t size)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    std::vector<element> c = make_data(size);
+    std::vector<std::size_t> sorted = sorted_keys(c);
+
+    for (std::size_t n : {std::size_t(0), size / 100, size / 3})
+    {
+        auto result = hpx::ranges::partial_sort(policy, c, std::begin(c) + n,
+            hpx::ranges::less(), &element::key);
+        HPX_TEST(result == std::end(c));
+        verify_partial_sort(c, sorted, n, std::less<std::size_t>());
+    }
+
+    // use a custom comparison
+    std::sort(std::begin(sorted), std::end(sorted), std::greater<>());
+
+    std::size_t const n = size / 2;
+    auto result = hpx::ranges::partial_sort(policy, std::begin(c),
+        std::begin(c) + n, std::end(c), std::greater<std::size_t>(),
+        &element::key);
+    HPX_TEST(result == std::end(c));
+    verify_partial_sort(c, sorted, n, std::greater<std::size_t>());
+}
+
+template <typename ExPolicy>
+void test_partial_sort_async(ExPolicy&& p, std::size_t size)
+{
+    std::vector<element> c = make_data(size);
+    std::vector<std::size_t> sorted = sorted_keys(c);
+
+    std::size_t const n = size / 3;
+    auto f = hpx::ranges::partial_sort(
+        p, c, std::begin(c) + n, hpx::ranges::less(), &element::key);
+    HPX_TEST(f.get() == std::end(c));
+
+    verify_partial_sort(c, sorted, n, std::less<std::size_t>());
+}
+
+void partial_sort_test()
+{
+    using namespace hpx::execution;
+
+    for (std::size_t size :
+        {std::size_t(10007), std::size_t(HPX_PARTIAL_SORT_TEST_SIZE)})
+    {
+        test_partial_sort(size);
+
+        test_partial_sort(seq, size);
+        test_partial_sort(par, size);
+        test_partial_sort(par_unseq, size);
+
+        test_partial_sort_async(seq(task), size);
+        test_partial_sort_async(par(task), size);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    partial_sort_test();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv), 0,
+        "HPX main exited with a non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,124 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/datapar.hpp>
+#include <hpx/include/parallel_adjacent_find.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////
+std::mt19937 gen;
+
+template <typename ExPolicy, typename T>
+void test_adjacent_find(ExPolicy&& policy, T)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    // no two adjacent elements are equal
+    std::vector<T> c(10007);
+    for (std::size_t i = 0; i != c.size(); ++i)
+        c[i] = T(i % 100);
+
+    auto index = hpx::adjacent_find(policy, std::begin(c), std::end(c));
+    HPX_TEST(index == std::end(c));
+
+    std::uniform_int_distribution<std::size_t> pos_dis(0, c.size() - 2);
+    std::vector<std::size_t> positions = {
+        0, 1, 7, 16, c.size() - 3, c.size() - 2, pos_dis(gen)};
+
+    for (std::size_t pos : positions)
+    {
+        T old_value = c[pos + 1];
+        c[pos + 1] = c[pos];
+
+        // the search starts at unaligned positions as well
+        for (std::size_t offset = 0; offset != 3 && offset <= pos; ++offset)
+        {
+            index = hpx::adjacent_find(
+                policy, std::begin(c) + offset, std::end(c));
+            HPX_TEST(index == std::begin(c) + pos);
+        }
+
+        c[pos + 1] = old_value;
+    }
+}
+
+template <typename ExPolicy, typename T>
+void test_adjacent_find_async(ExPolicy&& policy, T)
+{
+    std::vector<T> c(10007);
+    for (std::size_t i = 0; i != c.size(); ++i)
+        c[i] = T(i % 100);
+
+    std::size_t pos = c.size() / 2 + 1;
+    c[pos + 1] = c[pos];
+
+    auto f = hpx::adjacent_find(policy, std::begin(c), std::end(c));
+    HPX_TEST(f.get() == std::begin(c) + pos);
+}
+
+template <typename T>
+void test_adjacent_find()
+{
+    using namespace hpx::execution;
+
+    test_adjacent_find(dataseq, T());
+    test_adjacent_find(datapar, T());
+
+    test_adjacent_find_async(dataseq(task), T());
+    test_adjacent_find_async(datapar(task), T());
+}
+
+void adjacent_find_test()
+{
+    test_adjacent_find<int>();
+    test_adjacent_find<float>();
+    test_adjacent_find<double>();
+    test_adjacent_find<char>();
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    adjacent_find_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -14,6 +14,8 @@
 
 #include "../algorithms/count_tests.hpp"
 
+namespace execution = hpx::execution;
+
 ////////////////////////////////////////////////////////////////////////////
 template <typename IteratorTag>
 void test_count()
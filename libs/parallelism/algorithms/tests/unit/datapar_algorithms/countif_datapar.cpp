@@ -14,6 +14,8 @@
 
 #include "../algorithms/countif_tests.hpp"
 
+namespace execution = hpx::execution;
+
 ////////////////////////////////////////////////////////////////////////////
 template <typename IteratorTag>
 void test_count_if()
@@ -0,0 +1,133 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/datapar.hpp>
+#include <hpx/include/parallel_find.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////
+std::mt19937 gen;
+
+template <typename ExPolicy, typename T>
+void test_find(ExPolicy&& policy, T)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    std::uniform_int_distribution<int> dis(2, 101);
+
+    std::vector<T> c(10007);
+    for (auto& v : c)
+        v = T(dis(gen));
+
+    // test all positions close to the beginning and the end of the sequence
+    // as well as a random one in between
+    std::uniform_int_distribution<std::size_t> pos_dis(0, c.size() - 1);
+    std::vector<std::size_t> positions = {0, 1, 2, 3, 5, 7, 8, 15, 16, 17,
+        c.size() - 17, c.size() - 2, c.size() - 1, pos_dis(gen)};
+
+    for (std::size_t pos : positions)
+    {
+        c[pos] = T(1);
+
+        // the search starts at unaligned positions as well
+        for (std::size_t offset = 0; offset != 3 && offset <= pos; ++offset)
+        {
+            auto index =
+                hpx::find(policy, std::begin(c) + offset, std::end(c), T(1));
+            HPX_TEST(index == std::begin(c) + pos);
+        }
+
+        c[pos] = T(2);
+    }
+
+    auto index = hpx::find(policy, std::begin(c), std::end(c), T(1));
+    HPX_TEST(index == std::end(c));
+
+    index = hpx::find(policy, std::begin(c), std::begin(c), T(2));
+    HPX_TEST(index == std::begin(c));
+}
+
+template <typename ExPolicy, typename T>
+void test_find_async(ExPolicy&& policy, T)
+{
+    std::uniform_int_distribution<int> dis(2, 101);
+
+    std::vector<T> c(10007);
+    for (auto& v : c)
+        v = T(dis(gen));
+
+    std::size_t pos = c.size() / 2 + 1;
+    c[pos] = T(1);
+
+    auto f = hpx::find(policy, std::begin(c), std::end(c), T(1));
+    f.wait();
+
+    HPX_TEST(f.get() == std::begin(c) + pos);
+}
+
+template <typename T>
+void test_find()
+{
+    using namespace hpx::execution;
+
+    test_find(dataseq, T());
+    test_find(datapar, T());
+
+    test_find_async(dataseq(task), T());
+    test_find_async(datapar(task), T());
+}
+
+void find_test()
+{
+    test_find<int>();
+    test_find<float>();
+    test_find<double>();
+    test_find<char>();
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    find_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -21,6 +21,8 @@
 
 #include "../algorithms/test_utils.hpp"
 
+namespace execution = hpx::execution;
+
 ///////////////////////////////////////////////////////////////////////////////
 struct set_42
 {
@@ -51,10 +53,7 @@ void for_each_zipiter_test(ExPolicy&& policy, IteratorTag)
     auto end = hpx::util::make_zip_iterator(
         iterator(std::end(c)), iterator(std::end(d)));
 
-    auto result =
-        hpx::for_each(std::forward<ExPolicy>(policy), begin, end, set_42());
-
-    HPX_TEST_EQ(result, end);
+    hpx::for_each(std::forward<ExPolicy>(policy), begin, end, set_42());
 
     // verify values
     std::size_t count = 0;
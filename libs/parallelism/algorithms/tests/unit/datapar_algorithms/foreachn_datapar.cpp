@@ -15,6 +15,8 @@
 
 #include "../algorithms/foreach_tests.hpp"
 
+namespace execution = hpx::execution;
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename IteratorTag>
 void test_for_each_n()
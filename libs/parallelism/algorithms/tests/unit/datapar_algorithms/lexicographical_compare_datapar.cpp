@@ -0,0 +1,136 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/datapar.hpp>
+#include <hpx/include/parallel_lexicographical_compare.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////
+std::mt19937 gen;
+
+template <typename ExPolicy, typename T>
+void test_lexicographical_compare(ExPolicy&& policy, T)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    std::uniform_int_distribution<int> dis(0, 100);
+
+    std::vector<T> c1(10007);
+    for (auto& v : c1)
+        v = T(dis(gen));
+
+    // the second sequence is offset relative to the first one to make sure
+    // the elements of both sequences are not aligned in the same way
+    std::vector<T> c2(c1.size() + 1);
+    std::copy(std::begin(c1), std::end(c1), std::begin(c2) + 1);
+
+    auto first2 = std::begin(c2) + 1;
+
+    // equal sequences and prefixes
+    HPX_TEST(!hpx::parallel::lexicographical_compare(
+        policy, std::begin(c1), std::end(c1), first2, std::end(c2)));
+    HPX_TEST(hpx::parallel::lexicographical_compare(
+        policy, std::begin(c1), std::end(c1) - 1, first2, std::end(c2)));
+    HPX_TEST(!hpx::parallel::lexicographical_compare(
+        policy, std::begin(c1), std::end(c1), first2, std::end(c2) - 1));
+
+    std::uniform_int_distribution<std::size_t> pos_dis(0, c1.size() - 1);
+    std::vector<std::size_t> positions = {
+        0, 1, 7, 16, c1.size() - 2, c1.size() - 1, pos_dis(gen)};
+
+    for (std::size_t pos : positions)
+    {
+        ++c2[pos + 1];
+
+        HPX_TEST(hpx::parallel::lexicographical_compare(
+            policy, std::begin(c1), std::end(c1), first2, std::end(c2)));
+        HPX_TEST(!hpx::parallel::lexicographical_compare(
+            policy, first2, std::end(c2), std::begin(c1), std::end(c1)));
+
+        --c2[pos + 1];
+    }
+}
+
+template <typename ExPolicy, typename T>
+void test_lexicographical_compare_async(ExPolicy&& policy, T)
+{
+    std::uniform_int_distribution<int> dis(0, 100);
+
+    std::vector<T> c1(10007);
+    for (auto& v : c1)
+        v = T(dis(gen));
+
+    std::vector<T> c2 = c1;
+    --c2[c2.size() / 2];
+
+    auto f = hpx::parallel::lexicographical_compare(
+        policy, std::begin(c1), std::end(c1), std::begin(c2), std::end(c2));
+    HPX_TEST(!f.get());
+}
+
+template <typename T>
+void test_lexicographical_compare()
+{
+    using namespace hpx::execution;
+
+    test_lexicographical_compare(dataseq, T());
+    test_lexicographical_compare(datapar, T());
+
+    test_lexicographical_compare_async(dataseq(task), T());
+    test_lexicographical_compare_async(datapar(task), T());
+}
+
+void lexicographical_compare_test()
+{
+    test_lexicographical_compare<int>();
+    test_lexicographical_compare<float>();
+    test_lexicographical_compare<double>();
+    test_lexicographical_compare<char>();
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    lexicographical_compare_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,140 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/datapar.hpp>
+#include <hpx/include/parallel_minmax.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////
+std::mt19937 gen;
+
+template <typename ExPolicy, typename T>
+void test_minmax_element(ExPolicy&& policy, T)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    // the sequence contains duplicates of its smallest and largest elements
+    std::uniform_int_distribution<int> dis(0, 100);
+
+    std::vector<T> c(10007);
+    for (auto& v : c)
+        v = T(dis(gen));
+
+    // the algorithms start at unaligned positions as well
+    for (std::size_t offset = 0; offset != 3; ++offset)
+    {
+        auto first = std::begin(c) + offset;
+
+        HPX_TEST(hpx::parallel::min_element(policy, first, std::end(c)) ==
+            std::min_element(first, std::end(c)));
+        HPX_TEST(hpx::parallel::max_element(policy, first, std::end(c)) ==
+            std::max_element(first, std::end(c)));
+
+        auto r = hpx::parallel::minmax_element(policy, first, std::end(c));
+        auto ref = std::minmax_element(first, std::end(c));
+        HPX_TEST(r.first == ref.first);
+        HPX_TEST(r.second == ref.second);
+    }
+
+    // short sequences
+    for (std::size_t count = 0; count != 20; ++count)
+    {
+        auto first = std::begin(c) + 1;
+        auto last = first + count;
+
+        HPX_TEST(hpx::parallel::min_element(policy, first, last) ==
+            std::min_element(first, last));
+        HPX_TEST(hpx::parallel::max_element(policy, first, last) ==
+            std::max_element(first, last));
+    }
+}
+
+template <typename ExPolicy, typename T>
+void test_minmax_element_async(ExPolicy&& policy, T)
+{
+    std::uniform_int_distribution<int> dis(0, 100);
+
+    std::vector<T> c(10007);
+    for (auto& v : c)
+        v = T(dis(gen));
+
+    auto f1 = hpx::parallel::min_element(policy, std::begin(c), std::end(c));
+    HPX_TEST(f1.get() == std::min_element(std::begin(c), std::end(c)));
+
+    auto f2 = hpx::parallel::max_element(policy, std::begin(c), std::end(c));
+    HPX_TEST(f2.get() == std::max_element(std::begin(c), std::end(c)));
+
+    auto f3 =
+        hpx::parallel::minmax_element(policy, std::begin(c), std::end(c));
+    auto r = f3.get();
+    auto ref = std::minmax_element(std::begin(c), std::end(c));
+    HPX_TEST(r.first == ref.first);
+    HPX_TEST(r.second == ref.second);
+}
+
+template <typename T>
+void test_minmax_element()
+{
+    using namespace hpx::execution;
+
+    test_minmax_element(dataseq, T());
+    test_minmax_element(datapar, T());
+
+    test_minmax_element_async(dataseq(task), T());
+    test_minmax_element_async(datapar(task), T());
+}
+
+void minmax_element_test()
+{
+    test_minmax_element<int>();
+    test_minmax_element<float>();
+    test_minmax_element<double>();
+    test_minmax_element<char>();
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    minmax_element_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
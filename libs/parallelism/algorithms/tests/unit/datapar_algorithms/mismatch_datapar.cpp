@@ -0,0 +1,141 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/datapar.hpp>
+#include <hpx/include/parallel_mismatch.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////
+std::mt19937 gen;
+
+template <typename ExPolicy, typename T>
+void test_mismatch(ExPolicy&& policy, T)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    std::uniform_int_distribution<int> dis(0, 100);
+
+    std::vector<T> c1(10007);
+    for (auto& v : c1)
+        v = T(dis(gen));
+
+    // the second sequence is offset relative to the first one to make sure
+    // the elements of both sequences are not aligned in the same way
+    std::vector<T> c2(c1.size() + 1);
+    std::copy(std::begin(c1), std::end(c1), std::begin(c2) + 1);
+
+    auto result = hpx::mismatch(
+        policy, std::begin(c1), std::end(c1), std::begin(c2) + 1);
+    HPX_TEST(result.first == std::end(c1));
+    HPX_TEST(result.second == std::end(c2));
+
+    std::uniform_int_distribution<std::size_t> pos_dis(0, c1.size() - 1);
+    std::vector<std::size_t> positions = {
+        0, 1, 7, 16, c1.size() - 2, c1.size() - 1, pos_dis(gen)};
+
+    for (std::size_t pos : positions)
+    {
+        ++c2[pos + 1];
+
+        result = hpx::mismatch(
+            policy, std::begin(c1), std::end(c1), std::begin(c2) + 1);
+        HPX_TEST(result.first == std::begin(c1) + pos);
+        HPX_TEST(result.second == std::begin(c2) + pos + 1);
+
+        result = hpx::mismatch(policy, std::begin(c1), std::end(c1),
+            std::begin(c2) + 1, std::end(c2));
+        HPX_TEST(result.first == std::begin(c1) + pos);
+        HPX_TEST(result.second == std::begin(c2) + pos + 1);
+
+        --c2[pos + 1];
+    }
+}
+
+template <typename ExPolicy, typename T>
+void test_mismatch_async(ExPolicy&& policy, T)
+{
+    std::uniform_int_distribution<int> dis(0, 100);
+
+    std::vector<T> c1(10007);
+    for (auto& v : c1)
+        v = T(dis(gen));
+
+    std::vector<T> c2 = c1;
+
+    std::size_t pos = c1.size() / 2 + 1;
+    ++c2[pos];
+
+    auto f = hpx::mismatch(policy, std::begin(c1), std::end(c1),
+        std::begin(c2), std::end(c2));
+
+    auto result = f.get();
+    HPX_TEST(result.first == std::begin(c1) + pos);
+    HPX_TEST(result.second == std::begin(c2) + pos);
+}
+
+template <typename T>
+void test_mismatch()
+{
+    using namespace hpx::execution;
+
+    test_mismatch(dataseq, T());
+    test_mismatch(datapar, T());
+
+    test_mismatch_async(dataseq(task), T());
+    test_mismatch_async(datapar(task), T());
+}
+
+void mismatch_test()
+{
+    test_mismatch<int>();
+    test_mismatch<float>();
+    test_mismatch<double>();
+    test_mismatch<char>();
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    mismatch_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -14,6 +14,8 @@
 
 #include "../algorithms/transform_tests.hpp"
 
+namespace execution = hpx::execution;
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename IteratorTag>
 void test_transform()
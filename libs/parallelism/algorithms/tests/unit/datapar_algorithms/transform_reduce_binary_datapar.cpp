@@ -14,6 +14,8 @@
 
 #include "../algorithms/transform_reduce_binary_tests.hpp"
 
+namespace execution = hpx::execution;
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename IteratorTag>
 void test_transform_reduce_binary()
@@ -0,0 +1,37 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace execution { namespace detail {
+    /// \cond NOINTERNAL
+    // Process-wide statistics about the decisions made by all instances of
+    // adaptive_chunk_size, these are exposed as performance counters.
+    struct adaptive_chunk_size_counters
+    {
+        // number of loop invocations a chunk size was selected for
+        std::atomic<std::int64_t> invocations_{0};
+        // number of distinct call sites (and core counts) tuned so far
+        std::atomic<std::int64_t> call_sites_{0};
+        // number of invocations which probed a chunk size other than the
+        // currently preferred one
+        std::atomic<std::int64_t> explorations_{0};
+        // number of times the preferred chunk size of a call site changed
+        std::atomic<std::int64_t> adjustments_{0};
+        // the chunk size selected most recently
+        std::atomic<std::int64_t> chunk_size_{0};
+    };
+
+    HPX_PARALLELISM_EXPORT adaptive_chunk_size_counters&
+    get_adaptive_chunk_size_counters();
+    /// \endcond
+}}}    // namespace hpx::execution::detail
@@ -0,0 +1,330 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/adaptive_chunk_size.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/detail/adaptive_chunk_size_counters.hpp>
+#include <hpx/execution/traits/is_executor_parameters.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace execution {
+    namespace detail {
+        /// \cond NOINTERNAL
+        // The statistics shared by all copies of an adaptive_chunk_size
+        // executor parameters object.
+        struct adaptive_chunk_size_state
+        {
+            // Candidate i divides the iterations into (cores << i) chunks.
+            static constexpr std::size_t num_candidates = 8;
+
+            // The statistics collected for one call site
+            struct call_site
+            {
+                // smoothed execution time per iteration for each of the
+                // candidates (nanoseconds), zero if not measured yet
+                double time_per_iteration_[num_candidates] = {};
+                std::size_t current_ = 0;    // preferred candidate
+                std::size_t invocations_ = 0;
+                bool explored_ = false;
+                bool probe_up_ = false;
+            };
+
+            using key_type = std::pair<std::type_index, std::size_t>;
+
+            hpx::lcos::local::spinlock mtx_;
+            std::map<key_type, call_site> call_sites_;
+
+            // the measurement currently in flight
+            call_site* pending_ = nullptr;
+            std::size_t pending_candidate_ = 0;
+            std::size_t pending_count_ = 0;
+            std::uint64_t pending_start_ = 0;
+
+            // number of algorithms currently executing with this object
+            std::size_t active_ = 0;
+            bool overlapping_ = false;
+        };
+        /// \endcond
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into pieces and then assigned to threads.
+    /// The number of loop iterations combined is tuned based on feedback
+    /// from earlier invocations of the same loop. Statistics are kept
+    /// separately for each call site (identified by the type of the loop
+    /// body) and for each number of cores used. Initially, every call site
+    /// measures the overall execution time for 1, 2, 4, ... 128 chunks per
+    /// core, and then settles on the fastest of those. Afterwards, one of
+    /// the two neighboring chunk sizes of the preferred one is probed
+    /// regularly, which allows following slow changes in the cost of the
+    /// loop body, as they are common for iterative solvers.
+    ///
+    /// \note Copies of an \a adaptive_chunk_size object share their
+    ///       statistics. Measurements of algorithms which overlap in time
+    ///       while using the same object are discarded.
+    ///
+    /// \note The decisions made by all objects of this type are exposed
+    ///       through the performance counters
+    ///       /parallel/adaptive-chunk-size/count/invocations,
+    ///       /parallel/adaptive-chunk-size/count/call-sites,
+    ///       /parallel/adaptive-chunk-size/count/explorations,
+    ///       /parallel/adaptive-chunk-size/count/adjustments, and
+    ///       /parallel/adaptive-chunk-size/chunk-size.
+    ///
+    struct adaptive_chunk_size
+    {
+        /// Construct an \a adaptive_chunk_size executor parameters object
+        ///
+        /// \param probe_interval [in] The number of invocations of the same
+        ///                     call site after which a chunk size different
+        ///                     from the currently preferred one is measured
+        ///                     again. The default is 16.
+        ///
+        explicit adaptive_chunk_size(std::size_t probe_interval = 16)
+          : state_(std::make_shared<detail::adaptive_chunk_size_state>())
+          , probe_interval_((std::max)(probe_interval, std::size_t(1)))
+        {
+        }
+
+        /// \cond NOINTERNAL
+        // Select a chunk size based on the statistics of the call site.
+        template <typename Executor, typename F>
+        std::size_t get_chunk_size(
+            Executor&, F&&, std::size_t cores, std::size_t count) const
+        {
+            if (count == 0)
+            {
+                return (count + cores - 1) / cores;
+            }
+
+            detail::adaptive_chunk_size_counters& counters =
+                detail::get_adaptive_chunk_size_counters();
+
+            std::size_t candidate = 0;
+            {
+                std::lock_guard<hpx::lcos::local::spinlock> l(state_->mtx_);
+
+                auto it = state_->call_sites_.find(
+                    std::make_pair(std::type_index(typeid(F)), cores));
+                if (it == state_->call_sites_.end())
+                {
+                    it = state_->call_sites_
+                             .emplace(
+                                 std::make_pair(
+                                     std::type_index(typeid(F)), cores),
+                                 detail::adaptive_chunk_size_state::call_site())
+                             .first;
+                    ++counters.call_sites_;
+                }
+
+                detail::adaptive_chunk_size_state::call_site& site =
+                    it->second;
+
+                if (state_->active_ == 0)
+                {
+                    // not executed as part of an algorithm, nothing can be
+                    // measured
+                    candidate = site.current_;
+                }
+                else if (state_->pending_ == &site)
+                {
+                    // the same algorithm asks again
+                    candidate = state_->pending_candidate_;
+                }
+                else if (state_->pending_ != nullptr)
+                {
+                    // another call site is being measured already
+                    state_->overlapping_ = true;
+                    candidate = site.current_;
+                }
+                else
+                {
+                    candidate = select_candidate(site);
+                    if (candidate != site.current_)
+                        ++counters.explorations_;
+
+                    state_->pending_ = &site;
+                    state_->pending_candidate_ = candidate;
+                    state_->pending_count_ = count;
+                    state_->pending_start_ =
+                        hpx::chrono::high_resolution_clock::now();
+                }
+            }
+
+            std::size_t const num_chunks = cores << candidate;
+            std::size_t const chunk_size = (std::max)(
+                std::size_t(1), (count + num_chunks - 1) / num_chunks);
+
+            ++counters.invocations_;
+            counters.chunk_size_ = static_cast<std::int64_t>(chunk_size);
+
+            return chunk_size;
+        }
+
+        template <typename Executor>
+        void mark_begin_execution(Executor&&) const
+        {
+            std::lock_guard<hpx::lcos::local::spinlock> l(state_->mtx_);
+            if (++state_->active_ != 1)
+                state_->overlapping_ = true;
+        }
+
+        template <typename Executor>
+        void mark_end_execution(Executor&&) const
+        {
+            std::uint64_t const now = hpx::chrono::high_resolution_clock::now();
+
+            std::lock_guard<hpx::lcos::local::spinlock> l(state_->mtx_);
+            if (state_->active_ == 0 || --state_->active_ != 0)
+                return;
+
+            if (state_->pending_ != nullptr && !state_->overlapping_)
+            {
+                double const elapsed = double(
+                    (std::max)(now - state_->pending_start_, std::uint64_t(1)));
+                record(*state_->pending_, state_->pending_candidate_,
+                    elapsed / double(state_->pending_count_));
+            }
+
+            state_->pending_ = nullptr;
+            state_->overlapping_ = false;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        using call_site = detail::adaptive_chunk_size_state::call_site;
+
+        static constexpr std::size_t num_candidates =
+            detail::adaptive_chunk_size_state::num_candidates;
+
+        // Smoothing factor applied to new measurements
+        static constexpr double smoothing = 0.25;
+
+        std::size_t select_candidate(call_site& site) const
+        {
+            ++site.invocations_;
+
+            // measure each of the candidates once
+            if (!site.explored_)
+            {
+                for (std::size_t i = 0; i != num_candidates; ++i)
+                {
+                    if (site.time_per_iteration_[i] == 0)
+                        return i;
+                }
+            }
+
+            // probe the neighbors of the preferred candidate, alternating
+            // between the smaller and the larger chunk size
+            if (site.invocations_ % probe_interval_ == 0)
+            {
+                site.probe_up_ = !site.probe_up_;
+                if (site.current_ == 0 ||
+                    (site.probe_up_ && site.current_ + 1 != num_candidates))
+                {
+                    return site.current_ + 1;
+                }
+                return site.current_ - 1;
+            }
+
+            return site.current_;
+        }
+
+        static void record(
+            call_site& site, std::size_t candidate, double time_per_iteration)
+        {
+            double& t = site.time_per_iteration_[candidate];
+            t = (t == 0) ? time_per_iteration :
+                           t + smoothing * (time_per_iteration - t);
+
+            std::size_t best = site.current_;
+            if (!site.explored_)
+            {
+                // select the fastest candidate once all were measured
+                for (std::size_t i = 0; i != num_candidates; ++i)
+                {
+                    if (site.time_per_iteration_[i] == 0)
+                        return;
+                    if (site.time_per_iteration_[i] <
+                        site.time_per_iteration_[best])
+                    {
+                        best = i;
+                    }
+                }
+                site.explored_ = true;
+            }
+            else
+            {
+                // move towards a faster neighbor of the preferred candidate
+                if (site.current_ != 0 &&
+                    site.time_per_iteration_[site.current_ - 1] <
+                        site.time_per_iteration_[best])
+                {
+                    best = site.current_ - 1;
+                }
+                if (site.current_ + 1 != num_candidates &&
+                    site.time_per_iteration_[site.current_ + 1] <
+                        site.time_per_iteration_[best])
+                {
+                    best = site.current_ + 1;
+                }
+            }
+
+            if (best != site.current_)
+            {
+                site.current_ = best;
+                ++detail::get_adaptive_chunk_size_counters().adjustments_;
+            }
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, const unsigned int /* version */)
+        {
+            // the collected statistics are local to each process
+            ar& probe_interval_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::shared_ptr<detail::adaptive_chunk_size_state> state_;
+        std::size_t probe_interval_;
+        /// \endcond
+    };
+}}    // namespace hpx::execution
+
+namespace hpx { namespace parallel { namespace execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<hpx::execution::adaptive_chunk_size>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}}}    // namespace hpx::parallel::execution
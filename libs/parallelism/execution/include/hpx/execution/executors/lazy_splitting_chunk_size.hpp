@@ -0,0 +1,93 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/lazy_splitting_chunk_size.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/traits/is_executor_parameters.hpp>
+#include <hpx/serialization/serialize.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+namespace hpx { namespace execution {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into blocks of \a chunk_size iterations.
+    /// Initially, each core is assigned a contiguous range of these blocks,
+    /// which it works on one block at a time. A core which has run out of
+    /// work splits the range of blocks remaining for another core in half and
+    /// takes over the second half (lazy binary splitting). Ranges are split
+    /// only if there are idle cores, which balances irregular workloads
+    /// without the overhead of scheduling each block separately. If
+    /// \a chunk_size is not specified (or zero), the loop is divided into 16
+    /// blocks per core.
+    ///
+    /// \note The results of the blocks are combined in the order of the
+    ///       iterations they cover, independently of the core they were
+    ///       executed on.
+    ///
+    struct lazy_splitting_chunk_size
+    {
+        /// Construct a \a lazy_splitting_chunk_size executor parameters
+        /// object
+        ///
+        /// \param chunk_size   [in] The optional chunk size to use as the
+        ///                     number of loop iterations to execute before
+        ///                     checking for requests to split the range
+        ///                     again. The default chunk size is 0, which
+        ///                     creates 16 blocks per core.
+        ///
+        constexpr explicit lazy_splitting_chunk_size(std::size_t chunk_size = 0)
+          : chunk_size_(chunk_size)
+        {
+        }
+
+        /// \cond NOINTERNAL
+        // This executor parameters type requests for the iterations to be
+        // distributed on demand instead of scheduling all chunks up front.
+        typedef std::true_type has_lazy_splitting;
+
+        template <typename Executor, typename F>
+        constexpr std::size_t get_chunk_size(
+            Executor&, F&&, std::size_t cores, std::size_t num_tasks) const
+        {
+            return chunk_size_ != 0 ?
+                chunk_size_ :
+                (std::max)(std::size_t(1),
+                    (num_tasks + 16 * cores - 1) / (16 * cores));
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, const unsigned int version)
+        {
+            ar& chunk_size_;
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::size_t chunk_size_;
+        /// \endcond
+    };
+}}    // namespace hpx::execution
+
+namespace hpx { namespace parallel { namespace execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<hpx::execution::lazy_splitting_chunk_size>
+      : std::true_type
+    {
+    };
+    /// \endcond
+}}}    // namespace hpx::parallel::execution
@@ -0,0 +1,29 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_STD_EXPERIMENTAL_SIMD)
+
+#include <experimental/simd>
+
+namespace hpx { namespace parallel { namespace traits {
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE std::experimental::simd<T, Abi> select(
+        typename std::experimental::simd<T, Abi>::mask_type const& mask,
+        std::experimental::simd<T, Abi> const& value1,
+        std::experimental::simd<T, Abi> const& value2)
+    {
+        std::experimental::simd<T, Abi> result = value2;
+        std::experimental::where(mask, result) = value1;
+        return result;
+    }
+}}}    // namespace hpx::parallel::traits
+
+#endif
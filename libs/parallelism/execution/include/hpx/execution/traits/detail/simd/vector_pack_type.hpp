@@ -0,0 +1,86 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_STD_EXPERIMENTAL_SIMD)
+
+#include <cstddef>
+#include <type_traits>
+
+#include <experimental/simd>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { namespace traits {
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        // std::experimental::simd supports all arithmetic types except bool
+        template <typename T>
+        struct is_vectorizable
+          : std::integral_constant<bool,
+                std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>
+        {
+        };
+
+        // The nested type is not defined for types which can't be
+        // vectorized, which allows to use vector_pack_type in SFINAE
+        // contexts.
+        template <typename T, std::size_t N, typename Abi,
+            typename Enable = void>
+        struct vector_pack_type
+        {
+        };
+
+        template <typename T, std::size_t N, typename Abi>
+        struct vector_pack_type<T, N, Abi,
+            typename std::enable_if<is_vectorizable<T>::value &&
+                (N > 1)>::type>
+        {
+            static_assert(std::is_void<Abi>::value,
+                "specifying both, N and an Abi is not allowed");
+
+            typedef std::experimental::simd<T,
+                std::experimental::simd_abi::fixed_size<N>>
+                type;
+        };
+
+        template <typename T, typename Abi>
+        struct vector_pack_type<T, 0, Abi,
+            typename std::enable_if<is_vectorizable<T>::value>::type>
+        {
+            typedef typename std::conditional<std::is_void<Abi>::value,
+                std::experimental::simd_abi::native<T>, Abi>::type abi_type;
+
+            typedef std::experimental::simd<T, abi_type> type;
+        };
+
+        template <typename T, typename Abi>
+        struct vector_pack_type<T, 1, Abi,
+            typename std::enable_if<is_vectorizable<T>::value>::type>
+        {
+            typedef std::experimental::simd<T,
+                std::experimental::simd_abi::scalar>
+                type;
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, std::size_t N, typename Abi>
+    struct vector_pack_type : detail::vector_pack_type<T, N, Abi>
+    {
+    };
+
+    // don't wrap types twice
+    template <typename T, std::size_t N, typename Abi1, typename Abi2>
+    struct vector_pack_type<std::experimental::simd<T, Abi1>, N, Abi2>
+    {
+        typedef std::experimental::simd<T, Abi1> type;
+    };
+}}}    // namespace hpx::parallel::traits
+
+#endif
@@ -0,0 +1,49 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_VC)
+
+#include <Vc/global.h>
+
+#if defined(Vc_IS_VERSION_1) && Vc_IS_VERSION_1
+
+#include <Vc/Vc>
+
+namespace hpx { namespace parallel { namespace traits {
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Vc::Vector<T, Abi> select(
+        typename Vc::Vector<T, Abi>::MaskType const& mask,
+        Vc::Vector<T, Abi> const& value1, Vc::Vector<T, Abi> const& value2)
+    {
+        return Vc::iif(mask, value1, value2);
+    }
+}}}    // namespace hpx::parallel::traits
+
+#else
+
+#include <Vc/datapar>
+
+namespace hpx { namespace parallel { namespace traits {
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE Vc::datapar<T, Abi> select(
+        typename Vc::datapar<T, Abi>::mask_type const& mask,
+        Vc::datapar<T, Abi> const& value1, Vc::datapar<T, Abi> const& value2)
+    {
+        Vc::datapar<T, Abi> result = value2;
+        Vc::where(mask, result) = value1;
+        return result;
+    }
+}}}    // namespace hpx::parallel::traits
+
+#endif    // Vc_IS_VERSION_1
+
+#endif
@@ -63,6 +63,32 @@ namespace hpx { namespace parallel { namespace execution {
         using type = typename Parameters::has_variable_chunk_size;
     };
 
+    ///////////////////////////////////////////////////////////////////////
+    // If a parameters type exposes 'has_lazy_splitting' aliased to
+    // std::true_type it is assumed that the loop iterations should be
+    // distributed on demand by splitting the ranges assigned to the cores
+    // whenever a core runs out of work.
+    template <typename Parameters, typename Enable = void>
+    struct extract_has_lazy_splitting
+    {
+        // by default, assume all chunks are scheduled up front
+        using type = std::false_type;
+    };
+
+    template <typename Parameters>
+    struct extract_has_lazy_splitting<Parameters,
+        typename hpx::util::always_void<
+            typename Parameters::has_lazy_splitting>::type>
+    {
+        using type = typename Parameters::has_lazy_splitting;
+    };
+
+    template <typename Parameters>
+    struct extract_has_lazy_splitting<::std::reference_wrapper<Parameters>>
+      : extract_has_lazy_splitting<Parameters>
+    {
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     namespace detail {
         /// \cond NOINTERNAL
@@ -70,6 +70,7 @@ namespace hpx { namespace parallel { namespace traits {
 
 #if !defined(__CUDACC__)
 #include <hpx/execution/traits/detail/vc/vector_pack_alignment_size.hpp>
+#include <hpx/execution/traits/detail/simd/vector_pack_alignment_size.hpp>
 #endif
 
 #endif
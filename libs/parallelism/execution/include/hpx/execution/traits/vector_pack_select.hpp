@@ -0,0 +1,30 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { namespace traits {
+    // Return an object holding the elements of the first argument where the
+    // mask is set and the elements of the second argument otherwise.
+    template <typename T>
+    HPX_HOST_DEVICE HPX_FORCEINLINE T select(
+        bool mask, T const& value1, T const& value2)
+    {
+        return mask ? value1 : value2;
+    }
+}}}    // namespace hpx::parallel::traits
+
+#if defined(HPX_HAVE_DATAPAR)
+
+#if !defined(__CUDACC__)
+#include <hpx/execution/traits/detail/vc/vector_pack_select.hpp>
+#include <hpx/execution/traits/detail/simd/vector_pack_select.hpp>
+#endif
+
+#endif
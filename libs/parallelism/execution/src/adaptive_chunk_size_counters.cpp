@@ -0,0 +1,17 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/execution/detail/adaptive_chunk_size_counters.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace execution { namespace detail {
+    adaptive_chunk_size_counters& get_adaptive_chunk_size_counters()
+    {
+        static adaptive_chunk_size_counters counters;
+        return counters;
+    }
+}}}    // namespace hpx::execution::detail
@@ -13,6 +13,8 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iostream>
 #include <iterator>
@@ -131,6 +133,82 @@ void test_persistent_auto_chunk_size()
     }
 }
 
+void test_lazy_splitting_chunk_size()
+{
+    {
+        hpx::execution::lazy_splitting_chunk_size lscs;
+        parameters_test(lscs);
+    }
+
+    {
+        hpx::execution::lazy_splitting_chunk_size lscs(100);
+        parameters_test(lscs);
+    }
+
+    // the results of the blocks have to be combined in order
+    {
+        std::vector<std::string> c(10007);
+        std::generate(c.begin(), c.end(),
+            []() { return std::string(1, char('a' + std::rand() % 26)); });
+
+        std::string expected =
+            std::accumulate(c.begin(), c.end(), std::string());
+        std::string result =
+            hpx::reduce(hpx::execution::par.with(
+                            hpx::execution::lazy_splitting_chunk_size(3)),
+                c.begin(), c.end(), std::string());
+        HPX_TEST(result == expected);
+    }
+
+    // strided loops touch each visited element exactly once
+    {
+        std::vector<int> c(10007, 0);
+        hpx::for_loop_strided(hpx::execution::par.with(
+                                  hpx::execution::lazy_splitting_chunk_size(5)),
+            std::size_t(0), c.size(), 3, [&c](std::size_t i) { ++c[i]; });
+
+        for (std::size_t i = 0; i != c.size(); ++i)
+        {
+            HPX_TEST_EQ(c[i], i % 3 == 0 ? 1 : 0);
+        }
+    }
+}
+
+void test_adaptive_chunk_size()
+{
+    {
+        hpx::execution::adaptive_chunk_size acs;
+        parameters_test(acs);
+    }
+
+    {
+        hpx::execution::adaptive_chunk_size acs(1);
+        parameters_test(acs);
+    }
+
+    // repeated invocations of the same loop explore different chunk sizes
+    {
+        hpx::execution::detail::adaptive_chunk_size_counters& counters =
+            hpx::execution::detail::get_adaptive_chunk_size_counters();
+        std::int64_t const invocations = counters.invocations_;
+        std::int64_t const call_sites = counters.call_sites_;
+
+        hpx::execution::adaptive_chunk_size acs(2);
+        auto policy = hpx::execution::par.with(acs);
+
+        std::vector<int> c(10007, 0);
+        for (int i = 0; i != 100; ++i)
+        {
+            hpx::for_each(policy, c.begin(), c.end(), [](int& v) { ++v; });
+        }
+
+        HPX_TEST_EQ(std::count(c.begin(), c.end(), 100),
+            static_cast<std::ptrdiff_t>(c.size()));
+        HPX_TEST_LTE(invocations + 100, std::int64_t(counters.invocations_));
+        HPX_TEST_LT(call_sites, std::int64_t(counters.call_sites_));
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 struct timer_hooks_parameters
 {
@@ -188,6 +266,8 @@ int hpx_main(hpx::program_options::variables_map& vm)
     test_guided_chunk_size();
     test_auto_chunk_size();
     test_persistent_auto_chunk_size();
+    test_lazy_splitting_chunk_size();
+    test_adaptive_chunk_size();
 
     test_combined_hooks();
 
@@ -12,6 +12,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/datastructures/tuple.hpp>
 #include <hpx/execution/algorithms/detail/predicates.hpp>
 #include <hpx/execution/detail/async_launch_policy_dispatch.hpp>
 #include <hpx/execution/detail/post_policy_dispatch.hpp>
@@ -20,8 +21,10 @@
 #include <hpx/futures/future.hpp>
 #include <hpx/futures/traits/future_traits.hpp>
 #include <hpx/iterator_support/range.hpp>
+#include <hpx/iterator_support/traits/is_contiguous_iterator.hpp>
 #include <hpx/pack_traversal/unwrap.hpp>
 #include <hpx/synchronization/latch.hpp>
+#include <hpx/threading_base/numa_schedule_hint.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
@@ -30,17 +33,68 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <iterator>
+#include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
 namespace hpx { namespace parallel { namespace execution { namespace detail {
+    ///////////////////////////////////////////////////////////////////////////
+    // An explicit schedule hint given to the executor is used for all chunks,
+    // otherwise chunks are scheduled using the given fallback hint.
+    template <typename T>
+    threads::thread_schedule_hint get_chunk_schedule_hint(T const&,
+        threads::thread_schedule_hint schedulehint,
+        threads::thread_schedule_hint fallback)
+    {
+        return schedulehint.mode != threads::thread_schedule_hint_mode_none ?
+            schedulehint :
+            fallback;
+    }
+
+    // The parallel algorithms describe their chunks as tuples of an iterator
+    // referring to the first element and the number of elements. If the
+    // elements are stored in memory and no explicit schedule hint was given
+    // to the executor, the chunk is placed on the NUMA domain its data is
+    // located on.
+    template <typename Iter, typename... Ts>
+    typename std::enable_if<
+        std::is_lvalue_reference<
+            typename std::iterator_traits<Iter>::reference>::value,
+        threads::thread_schedule_hint>::type
+    get_chunk_schedule_hint(hpx::tuple<Iter, std::size_t, Ts...> const& chunk,
+        threads::thread_schedule_hint schedulehint,
+        threads::thread_schedule_hint fallback)
+    {
+        if (schedulehint.mode != threads::thread_schedule_hint_mode_none)
+        {
+            return schedulehint;
+        }
+
+        std::size_t const count = hpx::get<1>(chunk);
+        if (count == 0 || !threads::has_multiple_numa_domains())
+        {
+            return fallback;
+        }
+
+        // only contiguous iterators are known to refer to the whole range of
+        // memory, otherwise the first element is used to place the chunk
+        using value_type = typename std::iterator_traits<Iter>::value_type;
+        std::size_t const size = sizeof(value_type) *
+            (hpx::traits::is_contiguous_iterator<Iter>::value ? count : 1);
+
+        return threads::get_numa_schedule_hint(
+            std::addressof(*hpx::get<0>(chunk)), size, fallback);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
     template <typename F, typename S, typename... Ts>
     std::vector<
         hpx::future<typename detail::bulk_function_result<F, S, Ts...>::type>>
     hierarchical_bulk_async_execute_helper(threads::thread_pool_base* pool,
         threads::thread_priority priority, threads::thread_stacksize stacksize,
-        threads::thread_schedule_hint, std::size_t first_thread,
+        threads::thread_schedule_hint schedulehint, std::size_t first_thread,
         std::size_t num_threads, std::size_t hierarchical_threshold,
         launch policy, F&& f, S const& shape, Ts&&... ts)
     {
@@ -73,7 +127,7 @@ namespace hpx { namespace parallel { namespace execution { namespace detail {
             {
                 detail::post_policy_dispatch<decltype(policy)>::call(policy,
                     desc, pool, priority, threads::thread_stacksize_small, hint,
-                    [&, hint, part_begin, part_end, part_size, f,
+                    [&, schedulehint, hint, part_begin, part_end, part_size, f,
                         it]() mutable {
                         for (std::size_t part_i = part_begin; part_i < part_end;
                              ++part_i)
@@ -81,7 +135,10 @@ namespace hpx { namespace parallel { namespace execution { namespace detail {
                             results[part_i] =
                                 hpx::detail::async_launch_policy_dispatch<
                                     decltype(policy)>::call(policy, pool,
-                                    priority, stacksize, hint, f, *it, ts...);
+                                    priority, stacksize,
+                                    get_chunk_schedule_hint(
+                                        *it, schedulehint, hint),
+                                    f, *it, ts...);
                             ++it;
                         }
                         l.count_down(part_size);
@@ -97,7 +154,8 @@ namespace hpx { namespace parallel { namespace execution { namespace detail {
                     results[part_i] =
                         hpx::detail::async_launch_policy_dispatch<decltype(
                             policy)>::call(policy, pool, priority, stacksize,
-                            hint, f, *it, ts...);
+                            get_chunk_schedule_hint(*it, schedulehint, hint),
+                            f, *it, ts...);
                     ++it;
                 }
                 l.count_down(part_size);
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/allocator_support/thread_local_slab_allocator.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/coroutines/detail/get_stack_pointer.hpp>
@@ -32,6 +33,7 @@
 #include <exception>
 #include <memory>
 #include <mutex>
+#include <new>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -78,6 +80,35 @@ namespace hpx { namespace lcos { namespace detail {
 
         virtual ~future_data_refcnt_base();
 
+        // Shared states (including the continuations and the tasks deriving
+        // from future_data) are allocated using the per-thread slab
+        // allocator, avoiding the global allocator for the (short-lived)
+        // shared states created by async, then, and dataflow.
+        HPX_NODISCARD static void* operator new(std::size_t size)
+        {
+            return util::slab_allocate(size);
+        }
+
+        static void operator delete(void* p) noexcept
+        {
+            util::slab_deallocate(p);
+        }
+
+#if defined(HPX_HAVE_CXX17_ALIGNED_NEW)
+        // over-aligned shared states use the global allocator
+        HPX_NODISCARD static void* operator new(
+            std::size_t size, std::align_val_t alignment)
+        {
+            return ::operator new(size, alignment);
+        }
+
+        static void operator delete(
+            void* p, std::align_val_t alignment) noexcept
+        {
+            ::operator delete(p, alignment);
+        }
+#endif
+
         virtual void set_on_completed(completed_callback_type) = 0;
 
         virtual bool requires_delete()
@@ -0,0 +1,165 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that shared states allocated by the per-thread slab allocator may be
+// released on arbitrary threads and that the allocator can be switched on and
+// off while shared states are alive.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/allocator_support/thread_local_slab_allocator.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+constexpr std::size_t num_futures = 10000;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_allocate_deallocate()
+{
+    std::vector<std::pair<void*, std::size_t>> blocks;
+    for (std::size_t size : {0, 1, 31, 32, 33, 100, 512, 1024, 1025, 4096})
+    {
+        void* p = hpx::util::slab_allocate(size);
+        HPX_TEST(p != nullptr);
+        HPX_TEST_EQ(
+            reinterpret_cast<std::uintptr_t>(p) % 16, std::uintptr_t(0));
+
+        // the memory has to be usable
+        std::fill_n(static_cast<char*>(p), size, char(size));
+        blocks.emplace_back(p, size);
+    }
+
+    for (auto const& b : blocks)
+    {
+        char const* p = static_cast<char const*>(b.first);
+        for (std::size_t i = 0; i != b.second; ++i)
+        {
+            HPX_TEST_EQ(p[i], char(b.second));
+        }
+        hpx::util::slab_deallocate(b.first);
+    }
+
+    // releasing memory on a different (non-HPX) thread
+    std::vector<void*> remote;
+    for (std::size_t i = 0; i != 1000; ++i)
+    {
+        remote.push_back(hpx::util::slab_allocate(64));
+    }
+
+    std::thread t([&remote]() {
+        for (void* p : remote)
+        {
+            hpx::util::slab_deallocate(p);
+        }
+    });
+    t.join();
+
+    // the remotely released blocks are reused by this thread
+    for (void*& p : remote)
+    {
+        p = hpx::util::slab_allocate(64);
+    }
+    HPX_TEST(hpx::util::get_slab_remote_free_count(false) != 0);
+
+    for (void* p : remote)
+    {
+        hpx::util::slab_deallocate(p);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_futures_released_remotely()
+{
+    hpx::util::get_slab_allocation_count(true);
+
+    // create the futures on one thread, let them be made ready and released
+    // on arbitrary other threads
+    std::vector<hpx::future<std::size_t>> futures;
+    futures.reserve(num_futures);
+    for (std::size_t i = 0; i != num_futures; ++i)
+    {
+        futures.push_back(hpx::async([i]() { return i; }).then(
+            [](hpx::future<std::size_t>&& f) { return f.get() + 1; }));
+    }
+
+    std::vector<hpx::future<std::size_t>> results;
+    results.reserve(num_futures);
+    for (auto& f : futures)
+    {
+        results.push_back(hpx::async(
+            [](hpx::future<std::size_t>&& f) { return f.get(); },
+            std::move(f)));
+    }
+
+    for (std::size_t i = 0; i != num_futures; ++i)
+    {
+        HPX_TEST_EQ(results[i].get(), i + 1);
+    }
+
+    if (hpx::util::slab_allocator_enabled())
+    {
+        HPX_TEST(hpx::util::get_slab_allocation_count(false) >=
+            std::int64_t(num_futures));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_switch_allocator()
+{
+    // shared states allocated with either setting may be released after the
+    // allocator was switched
+    hpx::util::enable_slab_allocator(true);
+    hpx::lcos::local::promise<int> p1;
+    hpx::future<int> f1 = p1.get_future();
+
+    hpx::util::enable_slab_allocator(false);
+    hpx::util::get_slab_fallback_allocation_count(true);
+
+    hpx::lcos::local::promise<int> p2;
+    hpx::future<int> f2 = p2.get_future();
+    HPX_TEST(hpx::util::get_slab_fallback_allocation_count(false) != 0);
+
+    test_futures_released_remotely();
+
+    hpx::util::enable_slab_allocator(true);
+
+    p1.set_value(1);
+    p2.set_value(2);
+    HPX_TEST_EQ(f1.get(), 1);
+    HPX_TEST_EQ(f2.get(), 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    HPX_TEST(hpx::util::slab_allocator_enabled());
+
+    test_allocate_deallocate();
+    test_futures_released_remotely();
+    test_switch_allocator();
+
+    HPX_TEST(hpx::util::get_slab_reserved_size() != 0);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // We force this test to use several threads by default.
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all", "hpx.lcos.use_slab_allocator=1"};
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
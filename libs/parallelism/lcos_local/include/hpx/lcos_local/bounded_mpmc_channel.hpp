@@ -0,0 +1,501 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//  The lock-free ring buffer is based on the bounded MPMC queue by Dmitry
+//  Vyukov: http://www.1024cores.net/home/lock-free-algorithms/queues/
+//  bounded-mpmc-queue
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/promise.hpp>
+#include <hpx/modules/concurrency.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/synchronization/detail/condition_variable.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace lcos { namespace local {
+
+    ////////////////////////////////////////////////////////////////////////////
+    // A bounded channel supporting multiple producers and multiple consumers.
+    // The items are stored in a lock-free ring buffer in which every cell
+    // carries a sequence number telling whether it is ready to be written or
+    // to be read, producers and consumers synchronize on the cells only.
+    //
+    // In contrast to bounded_channel, get() and set() do not fail if the
+    // channel is empty (full) but suspend the calling thread until an item
+    // (a free cell) becomes available. The lock protecting the waiting
+    // threads and the pending asynchronous operations is acquired only if
+    // there actually is somebody waiting, the common case of neither the
+    // producers nor the consumers having to wait is lock-free.
+    template <typename T>
+    class bounded_mpmc_channel
+    {
+    private:
+        using mutex_type = lcos::local::spinlock;
+
+        struct cell
+        {
+            std::atomic<std::size_t> sequence_;
+            T data_;
+        };
+
+        static std::size_t round_up_capacity(std::size_t size) noexcept
+        {
+            std::size_t capacity = 2;
+            while (capacity < size)
+            {
+                capacity *= 2;
+            }
+            return capacity;
+        }
+
+    public:
+        HPX_NON_COPYABLE(bounded_mpmc_channel);
+
+    public:
+        // The capacity of the channel is the given size rounded up to the
+        // next power of two.
+        explicit bounded_mpmc_channel(std::size_t size)
+          : mask_(round_up_capacity(size) - 1)
+          , buffer_(new cell[mask_ + 1])
+          , get_waiters_(0)
+          , set_waiters_(0)
+          , closed_(false)
+        {
+            HPX_ASSERT(size != 0);
+
+            for (std::size_t i = 0; i != mask_ + 1; ++i)
+            {
+                buffer_[i].sequence_.store(i, std::memory_order_relaxed);
+            }
+
+            enqueue_pos_.data_.store(0, std::memory_order_relaxed);
+            dequeue_pos_.data_.store(0, std::memory_order_relaxed);
+        }
+
+        // Retrieve an item if one is available, never blocks.
+        bool try_get(T& val)
+        {
+            if (!dequeue(val))
+            {
+                return false;
+            }
+            if (has_waiters(set_waiters_))
+            {
+                process_waiters();
+            }
+            return true;
+        }
+
+        // Store the item if there is a free cell, never blocks. The given
+        // value is left untouched if the channel is full or closed.
+        bool try_set(T&& val)
+        {
+            if (closed_.load(std::memory_order_relaxed) || !enqueue(val))
+            {
+                return false;
+            }
+            if (has_waiters(get_waiters_))
+            {
+                process_waiters();
+            }
+            return true;
+        }
+
+        // Retrieve an item, suspends the calling thread while the channel is
+        // empty. Returns false if the channel is empty and was closed.
+        bool get(T& val)
+        {
+            while (!try_get(val))
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+
+                // announce the waiting thread before looking at the buffer
+                // again, any producer storing an item from now on will
+                // acquire the lock and wake us up
+                ++get_waiters_;
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                if (dequeue(val))
+                {
+                    --get_waiters_;
+                    l.unlock();
+
+                    if (has_waiters(set_waiters_))
+                    {
+                        process_waiters();
+                    }
+                    return true;
+                }
+
+                if (closed_.load(std::memory_order_relaxed))
+                {
+                    --get_waiters_;
+                    return false;
+                }
+
+                get_cond_.wait(l, "bounded_mpmc_channel::get");
+                --get_waiters_;
+            }
+            return true;
+        }
+
+        // Store an item, suspends the calling thread while the channel is
+        // full. Returns false if the channel was closed, in which case the
+        // given value is left untouched.
+        bool set(T&& val)
+        {
+            while (!try_set(std::move(val)))
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+
+                ++set_waiters_;
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                if (closed_.load(std::memory_order_relaxed))
+                {
+                    --set_waiters_;
+                    return false;
+                }
+
+                if (enqueue(val))
+                {
+                    --set_waiters_;
+                    l.unlock();
+
+                    if (has_waiters(get_waiters_))
+                    {
+                        process_waiters();
+                    }
+                    return true;
+                }
+
+                set_cond_.wait(l, "bounded_mpmc_channel::set");
+                --set_waiters_;
+            }
+            return true;
+        }
+
+        // Retrieve an item asynchronously. The returned future becomes ready
+        // as soon as an item is available, it holds an exception if the
+        // channel is empty and was closed.
+        hpx::future<T> async_get()
+        {
+            T val;
+            if (try_get(val))
+            {
+                return hpx::make_ready_future(std::move(val));
+            }
+
+            std::unique_lock<mutex_type> l(mtx_);
+
+            ++get_waiters_;
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if (dequeue(val))
+            {
+                --get_waiters_;
+                l.unlock();
+
+                if (has_waiters(set_waiters_))
+                {
+                    process_waiters();
+                }
+                return hpx::make_ready_future(std::move(val));
+            }
+
+            if (closed_.load(std::memory_order_relaxed))
+            {
+                --get_waiters_;
+                l.unlock();
+
+                return hpx::make_exceptional_future<T>(
+                    HPX_GET_EXCEPTION(hpx::invalid_status,
+                        "hpx::lcos::local::bounded_mpmc_channel::async_get",
+                        "this channel is empty and was closed"));
+            }
+
+            // the promise stays accounted for in get_waiters_ until it was
+            // fulfilled
+            get_promises_.emplace_back();
+            return get_promises_.back().get_future();
+        }
+
+        // Store an item asynchronously. The returned future becomes ready as
+        // soon as the item was placed into the channel, it holds an
+        // exception if the channel was closed before.
+        hpx::future<void> async_set(T val)
+        {
+            if (try_set(std::move(val)))
+            {
+                return hpx::make_ready_future();
+            }
+
+            std::unique_lock<mutex_type> l(mtx_);
+
+            ++set_waiters_;
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if (closed_.load(std::memory_order_relaxed))
+            {
+                --set_waiters_;
+                l.unlock();
+
+                return hpx::make_exceptional_future<void>(
+                    HPX_GET_EXCEPTION(hpx::invalid_status,
+                        "hpx::lcos::local::bounded_mpmc_channel::async_set",
+                        "attempting to write to a closed channel"));
+            }
+
+            if (enqueue(val))
+            {
+                --set_waiters_;
+                l.unlock();
+
+                if (has_waiters(get_waiters_))
+                {
+                    process_waiters();
+                }
+                return hpx::make_ready_future();
+            }
+
+            set_promises_.emplace_back(std::move(val), promise<void>());
+            return set_promises_.back().second.get_future();
+        }
+
+        // Close the channel. All threads waiting for the channel are woken
+        // up and all pending asynchronous operations fail. Items already
+        // stored in the channel can still be retrieved. Returns the number
+        // of pending asynchronous operations which were cancelled.
+        std::size_t close()
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+
+            if (closed_.load(std::memory_order_relaxed))
+            {
+                l.unlock();
+                HPX_THROW_EXCEPTION(hpx::invalid_status,
+                    "hpx::lcos::local::bounded_mpmc_channel::close",
+                    "attempting to close an already closed channel");
+            }
+            closed_.store(true, std::memory_order_relaxed);
+
+            std::deque<promise<T>> get_promises = std::move(get_promises_);
+            std::deque<std::pair<T, promise<void>>> set_promises =
+                std::move(set_promises_);
+            get_promises_.clear();
+            set_promises_.clear();
+
+            get_waiters_ -= get_promises.size();
+            set_waiters_ -= set_promises.size();
+
+            get_cond_.notify_all(std::move(l));
+
+            l = std::unique_lock<mutex_type>(mtx_);
+            set_cond_.notify_all(std::move(l));
+
+            for (auto& p : get_promises)
+            {
+                p.set_exception(HPX_GET_EXCEPTION(hpx::invalid_status,
+                    "hpx::lcos::local::bounded_mpmc_channel::close",
+                    "this channel was closed while waiting for an item"));
+            }
+            for (auto& p : set_promises)
+            {
+                p.second.set_exception(HPX_GET_EXCEPTION(hpx::invalid_status,
+                    "hpx::lcos::local::bounded_mpmc_channel::close",
+                    "this channel was closed before the item could be "
+                    "stored"));
+            }
+
+            return get_promises.size() + set_promises.size();
+        }
+
+        std::size_t capacity() const noexcept
+        {
+            return mask_ + 1;
+        }
+
+    private:
+        // Both the producers and the consumers announce that they are about
+        // to wait before looking at the buffer for the last time, while the
+        // other side looks at the number of waiting threads only after it has
+        // modified the buffer. The full fence on both sides guarantees that
+        // at least one of them sees the modification of the other.
+        static bool has_waiters(std::atomic<std::size_t> const& waiters)
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            return waiters.load(std::memory_order_relaxed) != 0;
+        }
+
+        // The value is moved into the buffer only if a free cell was found
+        bool enqueue(T& val)
+        {
+            cell* c = nullptr;
+            std::size_t pos = enqueue_pos_.data_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                c = &buffer_[pos & mask_];
+                std::size_t seq = c->sequence_.load(std::memory_order_acquire);
+                std::intptr_t diff =
+                    static_cast<std::intptr_t>(seq) -
+                    static_cast<std::intptr_t>(pos);
+                if (diff == 0)
+                {
+                    if (enqueue_pos_.data_.compare_exchange_weak(
+                            pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;    // the channel is full
+                }
+                else
+                {
+                    pos = enqueue_pos_.data_.load(std::memory_order_relaxed);
+                }
+            }
+
+            c->data_ = std::move(val);
+            c->sequence_.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool dequeue(T& val)
+        {
+            cell* c = nullptr;
+            std::size_t pos = dequeue_pos_.data_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                c = &buffer_[pos & mask_];
+                std::size_t seq = c->sequence_.load(std::memory_order_acquire);
+                std::intptr_t diff =
+                    static_cast<std::intptr_t>(seq) -
+                    static_cast<std::intptr_t>(pos + 1);
+                if (diff == 0)
+                {
+                    if (dequeue_pos_.data_.compare_exchange_weak(
+                            pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;    // the channel is empty
+                }
+                else
+                {
+                    pos = dequeue_pos_.data_.load(std::memory_order_relaxed);
+                }
+            }
+
+            val = std::move(c->data_);
+            c->sequence_.store(pos + mask_ + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Serve the pending asynchronous operations as far as possible and
+        // wake up the suspended threads. Serving a pending get frees a cell
+        // which may allow to serve a pending set and vice versa, both are
+        // handled until no more progress can be made. The promises are
+        // fulfilled after the lock was released as this may run
+        // continuations.
+        void process_waiters()
+        {
+            std::vector<std::pair<promise<T>, T>> gets;
+            std::vector<promise<void>> sets;
+
+            std::unique_lock<mutex_type> l(mtx_);
+
+            bool progress = true;
+            while (progress)
+            {
+                progress = false;
+
+                T val;
+                while (!get_promises_.empty() && dequeue(val))
+                {
+                    gets.emplace_back(
+                        std::move(get_promises_.front()), std::move(val));
+                    get_promises_.pop_front();
+                    --get_waiters_;
+                    progress = true;
+                }
+
+                while (!set_promises_.empty() &&
+                    enqueue(set_promises_.front().first))
+                {
+                    sets.push_back(std::move(set_promises_.front().second));
+                    set_promises_.pop_front();
+                    --set_waiters_;
+                    progress = true;
+                }
+            }
+
+            // a thread woken up without being able to make progress simply
+            // suspends again
+            if (!get_cond_.empty(l))
+            {
+                get_cond_.notify_one(std::move(l));
+                l = std::unique_lock<mutex_type>(mtx_);
+            }
+            if (!set_cond_.empty(l))
+            {
+                set_cond_.notify_one(std::move(l));
+            }
+            else
+            {
+                l.unlock();
+            }
+
+            for (auto& p : gets)
+            {
+                p.first.set_value(std::move(p.second));
+            }
+            for (auto& p : sets)
+            {
+                p.set_value();
+            }
+        }
+
+    private:
+        // keep the positions of the producers and of the consumers in
+        // separate cache lines
+        hpx::util::cache_aligned_data<std::atomic<std::size_t>> enqueue_pos_;
+        hpx::util::cache_aligned_data<std::atomic<std::size_t>> dequeue_pos_;
+
+        std::size_t mask_;
+        std::unique_ptr<cell[]> buffer_;
+
+        // the number of suspended threads and pending asynchronous operations
+        std::atomic<std::size_t> get_waiters_;
+        std::atomic<std::size_t> set_waiters_;
+
+        std::atomic<bool> closed_;
+
+        mutex_type mtx_;
+        detail::condition_variable get_cond_;
+        detail::condition_variable set_cond_;
+        std::deque<promise<T>> get_promises_;
+        std::deque<std::pair<T, promise<void>>> set_promises_;
+    };
+}}}    // namespace hpx::lcos::local
@@ -0,0 +1,203 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares the throughput of the bounded_mpmc_channel with the one of the
+// existing channels for an increasing number of producers and consumers.
+// Each configuration moves the same total number of items through the
+// channel, every producer and every consumer runs on its own HPX thread.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos_local.hpp>
+#include <hpx/lcos_local/bounded_mpmc_channel.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/synchronization/channel_mpmc.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct data
+{
+    data() = default;
+
+    explicit data(std::size_t d)
+    {
+        data_[0] = d;
+    }
+
+    std::size_t data_[8];
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// The bounded_mpmc_channel suspends the producers (consumers) while the
+// channel is full (empty)
+struct bounded_mpmc
+{
+    explicit bounded_mpmc(std::size_t size)
+      : c_(size)
+    {
+    }
+
+    void set(data&& d)
+    {
+        c_.set(std::move(d));
+    }
+
+    data get()
+    {
+        data d;
+        c_.get(d);
+        return d;
+    }
+
+    hpx::lcos::local::bounded_mpmc_channel<data> c_;
+};
+
+// The channel_mpmc fails if the channel is full (empty), the producers and
+// consumers have to poll
+struct spinlock_mpmc
+{
+    explicit spinlock_mpmc(std::size_t size)
+      : c_(size)
+    {
+    }
+
+    void set(data&& d)
+    {
+        while (!c_.set(std::move(d)))    // NOLINT
+        {
+            hpx::this_thread::yield();
+        }
+    }
+
+    data get()
+    {
+        data d;
+        while (!c_.get(&d))
+        {
+            hpx::this_thread::yield();
+        }
+        return d;
+    }
+
+    hpx::lcos::local::channel_mpmc<data> c_;
+};
+
+// The unbounded channel never blocks the producers
+struct unbounded
+{
+    explicit unbounded(std::size_t)
+    {
+    }
+
+    void set(data&& d)
+    {
+        c_.set(std::move(d));
+    }
+
+    data get()
+    {
+        return c_.get(hpx::launch::sync);
+    }
+
+    hpx::lcos::local::channel<data> c_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Channel>
+void produce(Channel& c, std::size_t count)
+{
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        c.set(data{i});
+    }
+}
+
+template <typename Channel>
+void consume(Channel& c, std::size_t count)
+{
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        c.get();
+    }
+}
+
+// Return the number of items per second moved through the channel
+template <typename Channel>
+double measure(std::size_t num_threads, std::size_t num_items,
+    std::size_t channel_size)
+{
+    Channel c(channel_size);
+    std::size_t const count = num_items / num_threads;
+
+    hpx::chrono::high_resolution_timer t;
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(2 * num_threads);
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        futures.push_back(hpx::async(&consume<Channel>, std::ref(c), count));
+        futures.push_back(hpx::async(&produce<Channel>, std::ref(c), count));
+    }
+    hpx::wait_all(futures);
+
+    return double(count * num_threads) / t.elapsed();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const num_items = vm["items"].as<std::size_t>();
+    std::size_t const channel_size = vm["channel-size"].as<std::size_t>();
+    std::size_t const max_threads = vm["max-producers"].as<std::size_t>();
+
+    hpx::util::format_to(std::cout, "{1:>10} {2:>20} {3:>20} {4:>20}\n",
+        "producers", "bounded_mpmc [op/s]", "channel_mpmc [op/s]",
+        "channel [op/s]");
+
+    for (std::size_t n = 1; n <= max_threads; n *= 2)
+    {
+        double const bounded =
+            measure<bounded_mpmc>(n, num_items, channel_size);
+        double const spinlock =
+            measure<spinlock_mpmc>(n, num_items, channel_size);
+        double const unlimited =
+            measure<unbounded>(n, num_items, channel_size);
+
+        hpx::util::format_to(std::cout,
+            "{1:>10} {2:>20.0f} {3:>20.0f} {4:>20.0f}\n", n, bounded,
+            spinlock, unlimited);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::program_options::options_description cmdline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("items",
+         hpx::program_options::value<std::size_t>()->default_value(1000000),
+         "the number of items moved through the channel per measurement "
+         "(default: 1000000)")
+        ("channel-size",
+         hpx::program_options::value<std::size_t>()->default_value(1024),
+         "the capacity of the bounded channels (default: 1024)")
+        ("max-producers",
+         hpx::program_options::value<std::size_t>()->default_value(64),
+         "the largest number of producers and consumers (default: 64)")
+        ;
+    // clang-format on
+
+    return hpx::init(cmdline, argc, argv);
+}
@@ -0,0 +1,228 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/lcos_local/bounded_mpmc_channel.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+using channel_type = hpx::lcos::local::bounded_mpmc_channel<std::size_t>;
+
+///////////////////////////////////////////////////////////////////////////////
+void try_get_set()
+{
+    channel_type c(3);
+    HPX_TEST_EQ(c.capacity(), std::size_t(4));
+
+    std::size_t val = 0;
+    HPX_TEST(!c.try_get(val));
+
+    for (std::size_t i = 0; i != c.capacity(); ++i)
+    {
+        HPX_TEST(c.try_set(std::size_t(i)));
+    }
+    HPX_TEST(!c.try_set(std::size_t(42)));
+
+    for (std::size_t i = 0; i != c.capacity(); ++i)
+    {
+        HPX_TEST(c.try_get(val));
+        HPX_TEST_EQ(val, i);
+    }
+    HPX_TEST(!c.try_get(val));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void produce(channel_type& c, std::size_t first, std::size_t count)
+{
+    for (std::size_t i = first; i != first + count; ++i)
+    {
+        HPX_TEST(c.set(std::size_t(i)));
+    }
+}
+
+std::uint64_t consume(channel_type& c, std::size_t count)
+{
+    std::uint64_t sum = 0;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        std::size_t val = 0;
+        HPX_TEST(c.get(val));
+        sum += val;
+    }
+    return sum;
+}
+
+void blocking_get_set(std::size_t num_producers, std::size_t num_consumers)
+{
+    // the channel is much smaller than the number of items, which forces
+    // both producers and consumers to suspend
+    constexpr std::size_t num_items = 10000;
+    channel_type c(8);
+
+    std::vector<hpx::future<std::uint64_t>> consumers;
+    for (std::size_t i = 0; i != num_consumers; ++i)
+    {
+        consumers.push_back(
+            hpx::async(&consume, std::ref(c), num_items / num_consumers));
+    }
+
+    std::vector<hpx::future<void>> producers;
+    for (std::size_t i = 0; i != num_producers; ++i)
+    {
+        std::size_t const count = num_items / num_producers;
+        producers.push_back(
+            hpx::async(&produce, std::ref(c), i * count, count));
+    }
+
+    hpx::wait_all(producers);
+
+    std::uint64_t sum = 0;
+    for (auto& f : consumers)
+    {
+        sum += f.get();
+    }
+    HPX_TEST_EQ(sum, std::uint64_t(num_items * (num_items - 1) / 2));
+
+    std::size_t val = 0;
+    HPX_TEST(!c.try_get(val));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void async_get_set()
+{
+    channel_type c(2);
+
+    // pending gets are served in order as soon as items become available
+    hpx::future<std::size_t> f1 = c.async_get();
+    hpx::future<std::size_t> f2 = c.async_get();
+    HPX_TEST(!f1.is_ready());
+    HPX_TEST(!f2.is_ready());
+
+    HPX_TEST(c.set(std::size_t(1)));
+    HPX_TEST_EQ(f1.get(), std::size_t(1));
+    HPX_TEST(!f2.is_ready());
+
+    HPX_TEST(c.try_set(std::size_t(2)));
+    HPX_TEST_EQ(f2.get(), std::size_t(2));
+
+    // pending sets are served as soon as cells become available
+    std::vector<hpx::future<void>> sets;
+    for (std::size_t i = 0; i != 2 * c.capacity(); ++i)
+    {
+        sets.push_back(c.async_set(i));
+    }
+    for (std::size_t i = 0; i != c.capacity(); ++i)
+    {
+        HPX_TEST(sets[i].is_ready());
+        HPX_TEST(!sets[i + c.capacity()].is_ready());
+    }
+
+    for (std::size_t i = 0; i != 2 * c.capacity(); ++i)
+    {
+        std::size_t val = 0;
+        HPX_TEST(c.get(val));
+        HPX_TEST_EQ(val, i);
+    }
+    hpx::wait_all(sets);
+
+    // a blocked consumer is woken up by an asynchronous producer
+    hpx::future<std::size_t> f3 = hpx::async([&c]() {
+        std::size_t val = 0;
+        HPX_TEST(c.get(val));
+        return val;
+    });
+    c.async_set(std::size_t(42)).get();
+    HPX_TEST_EQ(f3.get(), std::size_t(42));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void close_channel()
+{
+    channel_type c(2);
+
+    HPX_TEST(c.set(std::size_t(1)));
+    HPX_TEST(c.set(std::size_t(2)));
+
+    // this set is pending as the channel is full
+    hpx::future<void> f = c.async_set(std::size_t(3));
+    HPX_TEST(!f.is_ready());
+
+    HPX_TEST_EQ(c.close(), std::size_t(1));
+    HPX_TEST(f.has_exception());
+
+    bool caught_exception = false;
+    try
+    {
+        c.close();
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    // no more items can be stored, the remaining items can still be read
+    HPX_TEST(!c.try_set(std::size_t(4)));
+    HPX_TEST(!c.set(std::size_t(4)));
+    HPX_TEST(c.async_set(std::size_t(4)).has_exception());
+
+    std::size_t val = 0;
+    HPX_TEST(c.get(val));
+    HPX_TEST_EQ(val, std::size_t(1));
+    HPX_TEST_EQ(c.async_get().get(), std::size_t(2));
+
+    HPX_TEST(!c.get(val));
+    HPX_TEST(c.async_get().has_exception());
+}
+
+void close_wakes_waiting_threads()
+{
+    channel_type c(2);
+
+    std::vector<hpx::future<bool>> getters;
+    for (int i = 0; i != 4; ++i)
+    {
+        getters.push_back(hpx::async([&c]() {
+            std::size_t val = 0;
+            return c.get(val);
+        }));
+    }
+    hpx::future<std::size_t> pending = c.async_get();
+
+    c.close();
+
+    for (auto& f : getters)
+    {
+        HPX_TEST(!f.get());
+    }
+    HPX_TEST(pending.has_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    try_get_set();
+
+    blocking_get_set(1, 1);
+    blocking_get_set(4, 1);
+    blocking_get_set(1, 4);
+    blocking_get_set(8, 8);
+
+    async_get_set();
+
+    close_channel();
+    close_wakes_waiting_threads();
+
+    return hpx::util::report_errors();
+}
@@ -25,6 +25,7 @@
 
 #include <boost/accumulators/accumulators.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -43,6 +44,8 @@ namespace hpx { namespace traits
     //      ...
     //      num_messages = 50
     //      interval = 100
+    //      adaptive = 0
+    //      latency_budget = 100
     //
     template <>
     struct plugin_config_data<hpx::plugins::parcel::coalescing_message_handler>
@@ -51,7 +54,9 @@ namespace hpx { namespace traits
         {
             return "num_messages = 50\n"
                    "interval = 100\n"
-                   "allow_background_flush = 1";
+                   "allow_background_flush = 1\n"
+                   "adaptive = 0\n"
+                   "latency_budget = 100";
         }
     };
 }}
@@ -87,6 +92,20 @@ namespace hpx { namespace plugins { namespace parcel
                 "1");
             return !value.empty() && value[0] != '0';
         }
+
+        bool get_adaptive()
+        {
+            std::string value = hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.adaptive", "0");
+            return !value.empty() && value[0] != '0';
+        }
+
+        std::size_t get_latency_budget(std::size_t latency_budget)
+        {
+            return hpx::util::from_string<std::size_t>(hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.latency_budget",
+                latency_budget));
+        }
     }
 
     void coalescing_message_handler::update_num_messages()
@@ -102,6 +121,54 @@ namespace hpx { namespace plugins { namespace parcel
         interval_ = detail::get_interval(interval_);
     }
 
+    void coalescing_message_handler::update_adaptive()
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        adaptive_ = detail::get_adaptive();
+    }
+
+    void coalescing_message_handler::update_latency_budget()
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        latency_budget_ = detail::get_latency_budget(latency_budget_);
+    }
+
+    void coalescing_message_handler::update_adaptive_parameters(
+        std::int64_t time_since_last_parcel)
+    {
+        // Track the time between parcels using an exponentially weighted
+        // moving average. Idle phases are accounted for with no more than
+        // the latency budget, allowing to react quickly to a new burst of
+        // parcels.
+        double const latency_budget = double(latency_budget_) * 1000.0;
+        double const time_between_parcels =
+            (std::min)(double(time_since_last_parcel), latency_budget);
+
+        average_time_between_parcels_ +=
+            (time_between_parcels - average_time_between_parcels_) / 8.0;
+
+        // coalesce as many parcels as are expected to arrive during the
+        // latency budget
+        std::size_t num_parcels = num_coalesced_parcels_;
+        if (average_time_between_parcels_ >= 1.0)
+        {
+            double const expected =
+                latency_budget / average_time_between_parcels_;
+            if (expected < double(num_parcels))
+                num_parcels = std::size_t(expected);
+        }
+        adaptive_num_coalesced_parcels_ =
+            (std::max)(num_parcels, std::size_t(1));
+
+        // flush the buffer once the expected time for collecting all of the
+        // parcels has passed, but never wait longer than the latency budget
+        double const interval = (std::min)(latency_budget,
+            double(adaptive_num_coalesced_parcels_) *
+                average_time_between_parcels_);
+        adaptive_interval_ =
+            (std::max)(std::size_t(interval / 1000.0), std::size_t(1));
+    }
+
     coalescing_message_handler::coalescing_message_handler(
             char const* action_name, parcelset::parcelport* pp, std::size_t num,
             std::size_t interval)
@@ -116,6 +183,11 @@ namespace hpx { namespace plugins { namespace parcel
         stopped_(false),
         allow_background_flush_(detail::get_background_flush()),
         action_name_(action_name),
+        adaptive_(detail::get_adaptive()),
+        latency_budget_(detail::get_latency_budget(100)),
+        average_time_between_parcels_(double(latency_budget_) * 1000.0),
+        adaptive_num_coalesced_parcels_(1),
+        adaptive_interval_(latency_budget_),
         num_parcels_(0), reset_num_parcels_(0),
             reset_num_parcels_per_message_parcels_(0),
         num_messages_(0), reset_num_messages_(0),
@@ -145,6 +217,13 @@ namespace hpx { namespace plugins { namespace parcel
         set_config_entry_callback(
             "hpx.plugins.coalescing_message_handler.interval",
             util::bind(&coalescing_message_handler::update_interval, this));
+        set_config_entry_callback(
+            "hpx.plugins.coalescing_message_handler.adaptive",
+            util::bind(&coalescing_message_handler::update_adaptive, this));
+        set_config_entry_callback(
+            "hpx.plugins.coalescing_message_handler.latency_budget",
+            util::bind(
+                &coalescing_message_handler::update_latency_budget, this));
     }
 
     void coalescing_message_handler::put_parcel(
@@ -163,14 +242,30 @@ namespace hpx { namespace plugins { namespace parcel
         if (time_between_parcels_)
             (*time_between_parcels_)(time_since_last_parcel);
 
+        std::size_t num_coalesced_parcels = num_coalesced_parcels_;
         std::chrono::microseconds interval(interval_);
 
-        // just send parcel if the coalescing was stopped or the buffer is
-        // empty and time since last parcel is larger than coalescing interval.
-        if (stopped_ ||
-            (buffer_.empty() &&
-                std::chrono::nanoseconds(time_since_last_parcel) > interval
-           ))
+        bool send_directly = false;
+        if (adaptive_)
+        {
+            update_adaptive_parameters(time_since_last_parcel);
+            num_coalesced_parcels = adaptive_num_coalesced_parcels_;
+            interval = std::chrono::microseconds(adaptive_interval_);
+
+            // don't delay parcels if not enough parcels are expected to
+            // arrive during the latency budget
+            send_directly = buffer_.empty() && num_coalesced_parcels <= 1;
+        }
+        else
+        {
+            // send parcel if the buffer is empty and time since last parcel
+            // is larger than coalescing interval.
+            send_directly = buffer_.empty() &&
+                std::chrono::nanoseconds(time_since_last_parcel) > interval;
+        }
+
+        // just send parcel if the coalescing was stopped
+        if (stopped_ || send_directly)
         {
             ++num_messages_;
             l.unlock();
@@ -183,6 +278,13 @@ namespace hpx { namespace plugins { namespace parcel
         detail::message_buffer::message_buffer_append_state s =
             buffer_.append(dest, std::move(p), std::move(f));
 
+        // in adaptive mode the buffer may be sent before it is full
+        if (s != detail::message_buffer::buffer_now_full &&
+            buffer_.size() >= num_coalesced_parcels)
+        {
+            s = detail::message_buffer::buffer_now_full;
+        }
+
         switch(s) {
         case detail::message_buffer::first_message:
             HPX_FALLTHROUGH;
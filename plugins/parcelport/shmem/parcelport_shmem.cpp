@@ -0,0 +1,332 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+
+#include <hpx/plugins/parcelport_factory.hpp>
+#include <hpx/command_line_handling/command_line_handling.hpp>
+
+// parcelport
+#include <hpx/runtime/parcelset/locality.hpp>
+#include <hpx/runtime/parcelset/parcelport_impl.hpp>
+
+#include <hpx/plugins/parcelport/shmem/channels.hpp>
+#include <hpx/plugins/parcelport/shmem/locality.hpp>
+#include <hpx/plugins/parcelport/shmem/message_region.hpp>
+#include <hpx/plugins/parcelport/shmem/receiver.hpp>
+#include <hpx/plugins/parcelport/shmem/sender.hpp>
+
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/runtime_configuration/runtime_configuration.hpp>
+#include <hpx/util/get_entry_as.hpp>
+
+#include <boost/asio/ip/host_name.hpp>
+
+#include <unistd.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx
+{
+    bool is_starting();
+}
+
+namespace hpx { namespace parcelset
+{
+    namespace policies { namespace shmem
+    {
+        class HPX_EXPORT parcelport;
+    }}
+
+    template <>
+    struct connection_handler_traits<policies::shmem::parcelport>
+    {
+        typedef policies::shmem::sender_connection connection_type;
+        typedef std::false_type send_early_parcel;
+        typedef std::true_type  do_background_work;
+        typedef std::false_type send_immediate_parcels;
+
+        static const char * type()
+        {
+            return "shmem";
+        }
+
+        static const char * pool_name()
+        {
+            return "parcel-pool-shmem";
+        }
+
+        static const char * pool_name_postfix()
+        {
+            return "-shmem";
+        }
+    };
+
+    namespace policies { namespace shmem
+    {
+        void add_connection(sender * s, std::shared_ptr<sender_connection> const &ptr)
+        {
+            s->add(ptr);
+        }
+
+        // The shared memory parcelport is used for sending parcels to
+        // localities running on the same node only. Each locality owns a set
+        // of receive channels (single producer, single consumer ring buffers)
+        // which are claimed by the sending connections of the other
+        // localities, and a message region large messages and zero-copy
+        // chunks are placed in by this locality for the receivers to refer
+        // to them in place.
+        class HPX_EXPORT parcelport
+          : public parcelport_impl<parcelport>
+        {
+            typedef parcelport_impl<parcelport> base_type;
+
+            static parcelset::locality here()
+            {
+                boost::system::error_code ec;
+                std::string node = boost::asio::ip::host_name(ec);
+
+                std::random_device rd;
+                return parcelset::locality(locality(node,
+                    static_cast<std::uint32_t>(::getpid()),
+                    static_cast<std::uint32_t>(rd())));
+            }
+
+            static std::uint32_t num_channels(
+                util::runtime_configuration const& ini)
+            {
+                return hpx::util::get_entry_as<std::uint32_t>(
+                    ini, "hpx.parcel.shmem.channels", 64);
+            }
+
+            static std::uint32_t channel_size(
+                util::runtime_configuration const& ini)
+            {
+                return hpx::util::get_entry_as<std::uint32_t>(
+                    ini, "hpx.parcel.shmem.channel_size", 256 * 1024);
+            }
+
+            static std::size_t region_size(
+                util::runtime_configuration const& ini)
+            {
+                return hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.shmem.region_size", 16 * 1024 * 1024);
+            }
+
+        public:
+            parcelport(util::runtime_configuration const& ini,
+                threads::policies::callback_notifier const& notifier)
+              : base_type(ini, here(), notifier)
+              , stopped_(false)
+              , sender_(here_.get<locality>(), region_)
+              , receiver_(*this)
+            {
+                // Create the receive channels and the message region of this
+                // locality. If the shared memory objects can't be created the
+                // parcelport does not publish a valid endpoint, all other
+                // localities will use a different parcelport instead.
+                error_code ec(lightweight);
+
+                locality const& l = here_.get<locality>();
+                inbox_ = channels::create(
+                    l.name(), num_channels(ini), channel_size(ini), ec);
+                if (!ec)
+                {
+                    region_.create(l.name(), region_size(ini), ec);
+                }
+
+                if (ec)
+                {
+                    LPT_(warning)
+                        << "shmem::parcelport: disabling the shared memory "
+                           "parcelport: "
+                        << ec.get_message();
+
+                    inbox_ = channels();
+                    region_.destroy();
+                    here_ = parcelset::locality(locality());
+                    return;
+                }
+
+                receiver_.run(inbox_);
+            }
+
+            ~parcelport()
+            {
+                sender_.clear();
+                receiver_.clear();
+            }
+
+            /// Start the handling of connections.
+            bool do_run()
+            {
+                for(std::size_t i = 0; i != io_service_pool_.size(); ++i)
+                {
+                    io_service_pool_.get_io_service(int(i)).post(
+                        hpx::util::bind(
+                            &parcelport::io_service_work, this
+                        )
+                    );
+                }
+                return true;
+            }
+
+            /// Stop the handling of connections.
+            void do_stop()
+            {
+                while(do_background_work(0, parcelport_background_mode_all))
+                {
+                    if(threads::get_self_ptr())
+                        hpx::this_thread::suspend(hpx::threads::pending,
+                            "shmem::parcelport::do_stop");
+                }
+                stopped_ = true;
+            }
+
+            /// Only localities running on the same node can be reached
+            bool can_connect(parcelset::locality const& dest,
+                bool use_alternative_parcelport) override
+            {
+                return inbox_ &&
+                    dest.get<locality>().node() ==
+                        here_.get<locality>().node();
+            }
+
+            /// Return the name of this locality
+            std::string get_locality_name() const override
+            {
+                return boost::asio::ip::host_name();
+            }
+
+            std::shared_ptr<sender_connection> create_connection(
+                parcelset::locality const& l, error_code& ec)
+            {
+                return sender_.create_connection(l, this, ec);
+            }
+
+            parcelset::locality agas_locality(
+                util::runtime_configuration const & ini) const override
+            {
+                // this parcelport can't be used for bootstrapping
+                return parcelset::locality(locality());
+            }
+
+            parcelset::locality create_locality() const override
+            {
+                return parcelset::locality(locality());
+            }
+
+            bool background_work(
+                std::size_t num_thread, parcelport_background_mode mode)
+            {
+                if (stopped_)
+                    return false;
+
+                bool has_work = false;
+                if (mode & parcelport_background_mode_send)
+                {
+                    has_work = sender_.background_work();
+                }
+                if (mode & parcelport_background_mode_receive)
+                {
+                    has_work = receiver_.background_work(num_thread) ||
+                        has_work;
+                }
+                return has_work;
+            }
+
+        private:
+            std::atomic<bool> stopped_;
+
+            channels inbox_;
+            message_region region_;
+
+            sender sender_;
+            receiver<parcelport> receiver_;
+
+            void io_service_work()
+            {
+                std::size_t k = 0;
+                // We only execute work on the IO service while HPX is starting
+                while(hpx::is_starting())
+                {
+                    bool has_work = sender_.background_work();
+                    has_work = receiver_.background_work(-1) || has_work;
+                    if(has_work)
+                    {
+                        k = 0;
+                    }
+                    else
+                    {
+                        ++k;
+                        util::detail::yield_k(k,
+                            "hpx::parcelset::policies::shmem::parcelport::"
+                                "io_service_work");
+                    }
+                }
+            }
+        };
+    }}
+}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+namespace hpx { namespace traits
+{
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.parcel.shmem]
+    //      ...
+    //      priority = 1000
+    //
+    // The priority is higher than the one of all other parcelports, which
+    // makes the shared memory parcelport the preferred one for all
+    // destinations it can connect to (localities on the same node).
+    template <>
+    struct plugin_config_data<hpx::parcelset::policies::shmem::parcelport>
+    {
+        static char const* priority()
+        {
+            return "1000";
+        }
+
+        static void init(int *argc, char ***argv, util::command_line_handling &cfg)
+        {
+        }
+
+        static void destroy() {}
+
+        static char const* call()
+        {
+            return
+                "channels = ${HPX_PARCELPORT_SHMEM_CHANNELS:64}\n"
+                "channel_size = ${HPX_PARCELPORT_SHMEM_CHANNEL_SIZE:262144}\n"
+                "region_size = ${HPX_PARCELPORT_SHMEM_REGION_SIZE:16777216}\n"
+                ;
+        }
+    };
+}}
+
+HPX_REGISTER_PARCELPORT(
+    hpx::parcelset::policies::shmem::parcelport,
+    shmem);
+
+#endif
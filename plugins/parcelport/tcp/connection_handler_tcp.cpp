@@ -16,7 +16,9 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/functional/bind.hpp>
 #include <hpx/futures/future.hpp>
+#include <hpx/modules/logging.hpp>
 #include <hpx/plugins/parcelport/tcp/connection_handler.hpp>
+#include <hpx/plugins/parcelport/tcp/io_uring_service.hpp>
 #include <hpx/plugins/parcelport/tcp/receiver.hpp>
 #include <hpx/plugins/parcelport/tcp/sender.hpp>
 #include <hpx/runtime/parcelset/locality.hpp>
@@ -72,6 +74,27 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
                 "this parcelport was instantiated to represent an unexpected "
                 "locality type: " + std::string(here_.type()));
         }
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        if (hpx::util::get_entry_as<int>(ini, "hpx.parcel.tcp.io_uring", 1))
+        {
+            io_uring_.reset(new io_uring_service(io_service_pool_,
+                hpx::util::get_entry_as<std::uint32_t>(
+                    ini, "hpx.parcel.tcp.io_uring_entries", 256),
+                hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.tcp.io_uring_buffers", 256),
+                hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.tcp.io_uring_buffer_size", 4096)));
+
+            // fall back to Boost.Asio if io_uring is not supported
+            if (!*io_uring_)
+            {
+                LPT_(info) << "tcp::connection_handler: io_uring is not "
+                              "available, using Boost.Asio instead";
+                io_uring_.reset();
+            }
+        }
+#endif
     }
 
     connection_handler::~connection_handler()
@@ -79,6 +102,15 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         HPX_ASSERT(acceptor_ == nullptr);
     }
 
+    io_uring_service* connection_handler::get_io_uring() const
+    {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        return io_uring_.get();
+#else
+        return nullptr;
+#endif
+    }
+
     bool connection_handler::do_run()
     {
         using boost::asio::ip::tcp;
@@ -96,7 +128,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
         {
             try {
                 std::shared_ptr<receiver> receiver_conn(
-                    new receiver(io_service, get_max_inbound_message_size(), *this));
+                    new receiver(io_service, get_max_inbound_message_size(),
+                        *this, get_io_uring()));
 
                 tcp::endpoint ep = *it;
                 acceptor_->open(ep.protocol());
@@ -145,6 +178,12 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
             delete acceptor_;
             acceptor_ = nullptr;
         }
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        if (io_uring_)
+        {
+            io_uring_->stop();
+        }
+#endif
     }
 
     std::shared_ptr<sender> connection_handler::create_connection(
@@ -154,7 +193,8 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
         // The parcel gets serialized inside the connection constructor, no
         // need to keep the original parcel alive after this call returned.
-        std::shared_ptr<sender> sender_connection(new sender(io_service, l, this));
+        std::shared_ptr<sender> sender_connection(
+            new sender(io_service, l, this, get_io_uring()));
 
         // Connect to the target locality, retry if needed
         boost::system::error_code error = boost::asio::error::try_again;
@@ -288,7 +328,7 @@ namespace hpx { namespace parcelset { namespace policies { namespace tcp
 
             boost::asio::io_service& io_service = io_service_pool_.get_io_service();
             receiver_conn.reset(new receiver(io_service, get_max_inbound_message_size(),
-                *this));
+                *this, get_io_uring()));
             acceptor_->async_accept(receiver_conn->socket(),
                 util::bind(&connection_handler::handle_accept,
                     this,
@@ -0,0 +1,609 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_TCP) &&        \
+    defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+#include <hpx/plugins/parcelport/tcp/io_uring_service.hpp>
+
+#include <boost/asio/error.hpp>
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parcelset { namespace policies { namespace tcp
+{
+    namespace
+    {
+        int io_uring_setup(unsigned entries, io_uring_params* p)
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_setup, entries, p));
+        }
+
+        int io_uring_enter(int fd, unsigned to_submit, unsigned min_complete,
+            unsigned flags)
+        {
+            return static_cast<int>(::syscall(__NR_io_uring_enter, fd,
+                to_submit, min_complete, flags, nullptr, 0));
+        }
+
+        int io_uring_register(
+            int fd, unsigned opcode, void const* arg, unsigned nr_args)
+        {
+            return static_cast<int>(
+                ::syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+        }
+
+        // the ring indices are shared with the kernel
+        unsigned load_acquire(unsigned const* p)
+        {
+            return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+        }
+
+        void store_release(unsigned* p, unsigned value)
+        {
+            __atomic_store_n(p, value, __ATOMIC_RELEASE);
+        }
+
+        template <typename T>
+        T* at_offset(void* base, std::uint32_t offset)
+        {
+            return reinterpret_cast<T*>(static_cast<char*>(base) + offset);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct io_uring_service::operation
+    {
+        explicit operation(std::uint8_t opcode, int fd = -1)
+          : opcode_(opcode)
+          , fd_(fd)
+          , first_(0)
+          , msg_()
+          , buffer_index_(-1)
+          , buffer_(nullptr)
+          , size_(0)
+          , transferred_(0)
+        {
+        }
+
+        bool is_read() const
+        {
+            return opcode_ == IORING_OP_READ_FIXED ||
+                opcode_ == IORING_OP_RECVMSG;
+        }
+
+        // account for the given number of bytes having been transferred
+        void consume(std::size_t bytes)
+        {
+            transferred_ += bytes;
+            if (buffer_index_ != -1)
+                return;
+
+            while (bytes != 0 && first_ != iov_.size())
+            {
+                iovec& v = iov_[first_];
+                if (bytes < v.iov_len)
+                {
+                    v.iov_base = static_cast<char*>(v.iov_base) + bytes;
+                    v.iov_len -= bytes;
+                    break;
+                }
+                bytes -= v.iov_len;
+                ++first_;
+            }
+        }
+
+        std::uint8_t opcode_;
+        int fd_;
+
+        // the data still to be transferred (sendmsg/recvmsg)
+        std::vector<iovec> iov_;
+        std::size_t first_;
+        msghdr msg_;
+
+        // the registered buffer used (read/write fixed), the received data
+        // is copied to the target buffers after completion
+        int buffer_index_;
+        char* buffer_;
+        std::vector<boost::asio::mutable_buffer> targets_;
+
+        std::size_t size_;
+        std::size_t transferred_;
+
+        handler_type handler_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    io_uring_service::io_uring_service(util::io_service_pool& pool,
+        std::uint32_t entries, std::size_t num_buffers,
+        std::size_t buffer_size)
+      : pool_(pool)
+      , ring_fd_(-1)
+      , stopped_(false)
+      , sq_ring_(MAP_FAILED)
+      , cq_ring_(MAP_FAILED)
+      , sq_ring_size_(0)
+      , cq_ring_size_(0)
+      , sq_head_(nullptr)
+      , sq_tail_(nullptr)
+      , sq_mask_(0)
+      , sq_entries_(0)
+      , sq_array_(nullptr)
+      , sqes_(static_cast<io_uring_sqe*>(MAP_FAILED))
+      , cq_head_(nullptr)
+      , cq_tail_(nullptr)
+      , cq_mask_(0)
+      , cqes_(nullptr)
+      , submitting_(false)
+      , buffer_size_(0)
+      , stop_op_(new operation(IORING_OP_NOP))
+    {
+        if (!setup_ring(entries))
+            return;
+
+        setup_buffers(num_buffers, buffer_size);
+
+        reaper_ = std::thread(&io_uring_service::run, this);
+    }
+
+    io_uring_service::~io_uring_service()
+    {
+        stop();
+
+        if (sqes_ != MAP_FAILED)
+            ::munmap(sqes_, sq_entries_ * sizeof(io_uring_sqe));
+        if (cq_ring_ != MAP_FAILED && cq_ring_ != sq_ring_)
+            ::munmap(cq_ring_, cq_ring_size_);
+        if (sq_ring_ != MAP_FAILED)
+            ::munmap(sq_ring_, sq_ring_size_);
+        if (ring_fd_ != -1)
+            ::close(ring_fd_);
+    }
+
+    bool io_uring_service::setup_ring(std::uint32_t entries)
+    {
+        io_uring_params p;
+        std::memset(&p, 0, sizeof(p));
+
+        int fd = io_uring_setup(entries, &p);
+        if (fd < 0)
+            return false;
+
+        // without this feature completions may get lost if the completion
+        // queue overflows
+        if (!(p.features & IORING_FEAT_NODROP))
+        {
+            ::close(fd);
+            return false;
+        }
+
+        // Without internal polling the kernel completes reads from (and
+        // writes to) non-blocking sockets which are not ready with -EAGAIN
+        // instead of waiting for them, and retrying those operations would
+        // spin. Fall back to the asio based implementation in this case
+        // (kernels older than V5.7).
+#if defined(IORING_FEAT_FAST_POLL)
+        if (!(p.features & IORING_FEAT_FAST_POLL))
+        {
+            ::close(fd);
+            return false;
+        }
+#else
+        ::close(fd);
+        return false;
+#endif
+
+        sq_ring_size_ = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+        cq_ring_size_ = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+
+        bool const single_mmap = (p.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (single_mmap)
+        {
+            sq_ring_size_ = cq_ring_size_ =
+                (std::max)(sq_ring_size_, cq_ring_size_);
+        }
+
+        sq_ring_ = ::mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+        if (sq_ring_ == MAP_FAILED)
+        {
+            ::close(fd);
+            return false;
+        }
+
+        if (single_mmap)
+        {
+            cq_ring_ = sq_ring_;
+        }
+        else
+        {
+            cq_ring_ = ::mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+            if (cq_ring_ == MAP_FAILED)
+            {
+                ::close(fd);
+                return false;
+            }
+        }
+
+        sq_entries_ = p.sq_entries;
+        sqes_ = static_cast<io_uring_sqe*>(::mmap(nullptr,
+            p.sq_entries * sizeof(io_uring_sqe), PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES));
+        if (sqes_ == MAP_FAILED)
+        {
+            ::close(fd);
+            return false;
+        }
+
+        sq_head_ = at_offset<unsigned>(sq_ring_, p.sq_off.head);
+        sq_tail_ = at_offset<unsigned>(sq_ring_, p.sq_off.tail);
+        sq_mask_ = *at_offset<unsigned>(sq_ring_, p.sq_off.ring_mask);
+        sq_array_ = at_offset<unsigned>(sq_ring_, p.sq_off.array);
+
+        cq_head_ = at_offset<unsigned>(cq_ring_, p.cq_off.head);
+        cq_tail_ = at_offset<unsigned>(cq_ring_, p.cq_off.tail);
+        cq_mask_ = *at_offset<unsigned>(cq_ring_, p.cq_off.ring_mask);
+        cqes_ = at_offset<io_uring_cqe>(cq_ring_, p.cq_off.cqes);
+
+        ring_fd_ = fd;
+        return true;
+    }
+
+    // Register the buffers used for small messages. The kernel pins the
+    // buffers once instead of for every operation. If the buffers can't be
+    // registered (for instance because of the locked memory limit) all
+    // messages are sent and received using the regular operations.
+    void io_uring_service::setup_buffers(
+        std::size_t num_buffers, std::size_t buffer_size)
+    {
+        if (num_buffers == 0 || buffer_size == 0)
+            return;
+
+        std::unique_ptr<char[]> buffers(new char[num_buffers * buffer_size]);
+
+        std::vector<iovec> iov(num_buffers);
+        for (std::size_t i = 0; i != num_buffers; ++i)
+        {
+            iov[i].iov_base = buffers.get() + i * buffer_size;
+            iov[i].iov_len = buffer_size;
+        }
+
+        if (io_uring_register(ring_fd_, IORING_REGISTER_BUFFERS, iov.data(),
+                static_cast<unsigned>(num_buffers)) != 0)
+        {
+            return;
+        }
+
+        buffers_ = std::move(buffers);
+        buffer_size_ = buffer_size;
+
+        free_buffers_.reserve(num_buffers);
+        for (std::size_t i = num_buffers; i != 0; --i)
+        {
+            free_buffers_.push_back(static_cast<int>(i - 1));
+        }
+    }
+
+    int io_uring_service::acquire_buffer()
+    {
+        std::lock_guard<mutex_type> l(buffers_mtx_);
+        if (free_buffers_.empty())
+            return -1;
+
+        int const index = free_buffers_.back();
+        free_buffers_.pop_back();
+        return index;
+    }
+
+    void io_uring_service::release_buffer(int index)
+    {
+        std::lock_guard<mutex_type> l(buffers_mtx_);
+        free_buffers_.push_back(index);
+    }
+
+    void io_uring_service::stop()
+    {
+        if (!reaper_.joinable())
+            return;
+
+        stopped_ = true;
+
+        // the completion of the no-op makes the reaper exit
+        submit(stop_op_.get());
+        reaper_.join();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void io_uring_service::async_write(int fd,
+        std::vector<boost::asio::const_buffer> const& buffers,
+        handler_type&& handler)
+    {
+        std::unique_ptr<operation> op(new operation(IORING_OP_SENDMSG, fd));
+        op->handler_ = std::move(handler);
+
+        for (boost::asio::const_buffer const& b : buffers)
+        {
+            op->size_ += b.size();
+        }
+
+        if (stopped_)
+        {
+            post(op.release(), boost::asio::error::operation_aborted);
+            return;
+        }
+
+        // small messages are gathered into a registered buffer
+        if (op->size_ <= buffer_size_ &&
+            (op->buffer_index_ = acquire_buffer()) != -1)
+        {
+            op->opcode_ = IORING_OP_WRITE_FIXED;
+            op->buffer_ = buffers_.get() + op->buffer_index_ * buffer_size_;
+
+            char* data = op->buffer_;
+            for (boost::asio::const_buffer const& b : buffers)
+            {
+                std::memcpy(data, b.data(), b.size());
+                data += b.size();
+            }
+        }
+        else
+        {
+            op->iov_.reserve(buffers.size());
+            for (boost::asio::const_buffer const& b : buffers)
+            {
+                op->iov_.push_back(
+                    iovec{const_cast<void*>(b.data()), b.size()});
+            }
+        }
+
+        submit(op.release());
+    }
+
+    void io_uring_service::async_read(int fd,
+        std::vector<boost::asio::mutable_buffer> const& buffers,
+        handler_type&& handler)
+    {
+        std::unique_ptr<operation> op(new operation(IORING_OP_RECVMSG, fd));
+        op->handler_ = std::move(handler);
+
+        for (boost::asio::mutable_buffer const& b : buffers)
+        {
+            op->size_ += b.size();
+        }
+
+        if (stopped_)
+        {
+            post(op.release(), boost::asio::error::operation_aborted);
+            return;
+        }
+
+        // small messages are received into a registered buffer
+        if (op->size_ <= buffer_size_ &&
+            (op->buffer_index_ = acquire_buffer()) != -1)
+        {
+            op->opcode_ = IORING_OP_READ_FIXED;
+            op->buffer_ = buffers_.get() + op->buffer_index_ * buffer_size_;
+            op->targets_ = buffers;
+        }
+        else
+        {
+            op->iov_.reserve(buffers.size());
+            for (boost::asio::mutable_buffer const& b : buffers)
+            {
+                op->iov_.push_back(iovec{b.data(), b.size()});
+            }
+        }
+
+        submit(op.release());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void io_uring_service::submit(operation* op)
+    {
+        {
+            std::lock_guard<mutex_type> l(sq_mtx_);
+            waiting_.push_back(op);
+        }
+        flush();
+    }
+
+    // Move the waiting operations to the submission queue and hand them to
+    // the kernel. Operations queued by other threads while a batch is being
+    // submitted are picked up by the submitting thread. Operations not
+    // fitting into the (full) submission queue stay queued until the reaper
+    // has made progress.
+    void io_uring_service::flush()
+    {
+        std::unique_lock<mutex_type> l(sq_mtx_);
+        if (submitting_)
+            return;
+        submitting_ = true;
+
+        while (!waiting_.empty())
+        {
+            // only the submitting thread modifies the tail of the queue
+            unsigned tail = *sq_tail_;
+            unsigned const head = load_acquire(sq_head_);
+            if (tail - head == sq_entries_)
+                break;
+
+            while (!waiting_.empty() && tail - head != sq_entries_)
+            {
+                unsigned const index = tail & sq_mask_;
+                prepare(sqes_[index], waiting_.front());
+                sq_array_[index] = index;
+                waiting_.pop_front();
+                ++tail;
+            }
+            store_release(sq_tail_, tail);
+
+            l.unlock();
+            io_uring_enter(ring_fd_, unsubmitted(), 0, 0);
+            l.lock();
+        }
+
+        submitting_ = false;
+    }
+
+    // the number of entries in the submission queue not consumed by the
+    // kernel yet
+    unsigned io_uring_service::unsubmitted() const
+    {
+        return load_acquire(sq_tail_) - load_acquire(sq_head_);
+    }
+
+    void io_uring_service::prepare(io_uring_sqe& sqe, operation* op)
+    {
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = op->opcode_;
+        sqe.fd = op->fd_;
+        sqe.user_data = reinterpret_cast<std::uint64_t>(op);
+
+        switch (op->opcode_)
+        {
+        case IORING_OP_WRITE_FIXED:
+            HPX_FALLTHROUGH;
+        case IORING_OP_READ_FIXED:
+            sqe.addr =
+                reinterpret_cast<std::uint64_t>(op->buffer_ + op->transferred_);
+            sqe.len = static_cast<std::uint32_t>(op->size_ - op->transferred_);
+            sqe.buf_index = static_cast<std::uint16_t>(op->buffer_index_);
+            break;
+
+        case IORING_OP_SENDMSG:
+            HPX_FALLTHROUGH;
+        case IORING_OP_RECVMSG:
+            op->msg_.msg_iov = op->iov_.data() + op->first_;
+            op->msg_.msg_iovlen = op->iov_.size() - op->first_;
+            sqe.addr = reinterpret_cast<std::uint64_t>(&op->msg_);
+            sqe.len = 1;
+            sqe.msg_flags =
+                op->opcode_ == IORING_OP_SENDMSG ? MSG_NOSIGNAL : 0;
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void io_uring_service::complete(operation* op, int result)
+    {
+        // retry operations which did not make any progress, the kernel
+        // waits for the socket to become ready (see setup_ring)
+        if (result == -EAGAIN || result == -EINTR)
+        {
+            submit(op);
+            return;
+        }
+
+        boost::system::error_code ec;
+        if (result < 0)
+        {
+            ec = boost::system::error_code(
+                -result, boost::system::system_category());
+        }
+        else if (result == 0 && op->is_read() && op->size_ != 0)
+        {
+            ec = boost::asio::error::eof;
+        }
+        else
+        {
+            // issue the remaining part of partially completed operations
+            op->consume(static_cast<std::size_t>(result));
+            if (op->transferred_ != op->size_)
+            {
+                submit(op);
+                return;
+            }
+
+            if (op->opcode_ == IORING_OP_READ_FIXED)
+            {
+                char const* data = op->buffer_;
+                for (boost::asio::mutable_buffer const& b : op->targets_)
+                {
+                    std::memcpy(b.data(), data, b.size());
+                    data += b.size();
+                }
+            }
+        }
+
+        post(op, ec);
+    }
+
+    // The handlers are invoked on the threads of the io_service pool, just
+    // like the handlers of the Boost.Asio operations
+    void io_uring_service::post(
+        operation* op, boost::system::error_code const& ec)
+    {
+        if (op->buffer_index_ != -1)
+        {
+            release_buffer(op->buffer_index_);
+            op->buffer_index_ = -1;
+        }
+
+        pool_.get_io_service().post([op, ec]() {
+            std::unique_ptr<operation> p(op);
+            p->handler_(ec, p->transferred_);
+        });
+    }
+
+    void io_uring_service::run()
+    {
+        bool done = false;
+        while (!done)
+        {
+            flush();
+
+            unsigned head = *cq_head_;
+            unsigned const tail = load_acquire(cq_tail_);
+
+            if (head == tail)
+            {
+                // this submits the entries left over by failed submissions
+                io_uring_enter(
+                    ring_fd_, unsubmitted(), 1, IORING_ENTER_GETEVENTS);
+                continue;
+            }
+
+            for (/**/; head != tail; ++head)
+            {
+                io_uring_cqe const& cqe = cqes_[head & cq_mask_];
+                operation* op = reinterpret_cast<operation*>(cqe.user_data);
+                int const result = cqe.res;
+
+                // release the entry before the operation might be resubmitted
+                store_release(cq_head_, head + 1);
+
+                if (op == stop_op_.get())
+                {
+                    done = true;
+                    continue;
+                }
+                complete(op, result);
+            }
+        }
+    }
+}}}}
+
+#endif
@@ -39,7 +39,17 @@ namespace hpx { namespace traits
 
         static char const* call()
         {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            return
+                "io_uring = ${HPX_PARCEL_TCP_IO_URING:1}\n"
+                "io_uring_entries = ${HPX_PARCEL_TCP_IO_URING_ENTRIES:256}\n"
+                "io_uring_buffers = ${HPX_PARCEL_TCP_IO_URING_BUFFERS:256}\n"
+                "io_uring_buffer_size = "
+                    "${HPX_PARCEL_TCP_IO_URING_BUFFER_SIZE:4096}\n"
+                ;
+#else
             return "";
+#endif
         }
     };
 }}
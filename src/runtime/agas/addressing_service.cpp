@@ -64,6 +64,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -104,6 +105,11 @@ namespace hpx { namespace agas
             return size.get_lsb();
         }
 
+        naming::gid_type const& get_last_gid() const
+        {
+            return key_.second;
+        }
+
         friend bool operator<(
             gva_cache_key const& lhs, gva_cache_key const& rhs)
         {
@@ -137,12 +143,75 @@ namespace hpx { namespace agas
         }
     }; // }}}
 
+namespace detail
+{
+    // Consecutive GIDs are grouped into blocks of this many (log2) entries,
+    // all of which are stored in the same cache shard. This keeps most of
+    // the cached ranges confined to a single shard.
+    constexpr std::uint64_t gva_cache_block_bits = 8;
+
+    inline std::uint64_t gva_cache_block(naming::gid_type const& gid)
+    {
+        // mix the MSB to spread the GIDs of different localities over the
+        // shards, consecutive blocks are assigned to consecutive shards
+        return (gid.get_msb() * 0x9e3779b97f4a7c15ull) +
+            (gid.get_lsb() >> gva_cache_block_bits);
+    }
+}
+
+addressing_service::gva_cache_shard& addressing_service::get_cache_shard(
+    naming::gid_type const& gid) const
+{
+    std::size_t const num_shards = gva_cache_shards_.size();
+    if (num_shards == 1)
+        return *gva_cache_shards_[0];
+
+    return *gva_cache_shards_[detail::gva_cache_block(gid) % num_shards];
+}
+
+// Invoke the given function for all shards a given cache key may be stored
+// in. A key covering a range of GIDs is stored in all shards the range is
+// mapped onto.
+template <typename F>
+void addressing_service::for_each_cache_shard(
+    gva_cache_key const& key, F&& f) const
+{
+    std::size_t const num_shards = gva_cache_shards_.size();
+
+    naming::gid_type const& first = key.get_gid();
+    naming::gid_type const& last = key.get_last_gid();
+
+    std::uint64_t blocks = num_shards;
+    if (first.get_msb() == last.get_msb())
+    {
+        blocks = ((last.get_lsb() >> detail::gva_cache_block_bits) -
+            (first.get_lsb() >> detail::gva_cache_block_bits)) + 1;
+    }
+
+    if (blocks >= num_shards)
+    {
+        for (auto& shard : gva_cache_shards_)
+            f(*shard);
+        return;
+    }
+
+    std::uint64_t const block = detail::gva_cache_block(first);
+    for (std::uint64_t i = 0; i != blocks; ++i)
+        f(*gva_cache_shards_[(block + i) % num_shards]);
+}
+
+template <typename F>
+void addressing_service::for_each_cache_shard(F&& f) const
+{
+    for (auto& shard : gva_cache_shards_)
+        f(*shard);
+}
+
 addressing_service::addressing_service(
     util::runtime_configuration const& ini_
   , runtime_mode runtime_type_
     )
-  : gva_cache_(new gva_cache_type)
-  , console_cache_(naming::invalid_locality_id)
+  : console_cache_(naming::invalid_locality_id)
   , max_refcnt_requests_(ini_.get_agas_max_pending_refcnt_requests())
   , refcnt_requests_count_(0)
   , enable_refcnt_caching_(true)
@@ -156,8 +225,25 @@ addressing_service::addressing_service(
   , state_(state_starting)
   , locality_()
 {
+    std::size_t const num_shards = caching_ ? ini_.get_agas_cache_shards() : 1;
+
+    gva_cache_shards_.reserve(num_shards);
+    for (std::size_t i = 0; i != num_shards; ++i)
+    {
+        gva_cache_shards_.emplace_back(new gva_cache_shard_type);
+        gva_cache_shards_.back()->cache_ = std::make_shared<gva_cache_type>();
+    }
+
     if (caching_)
-        gva_cache_->reserve(ini_.get_agas_local_cache_size());
+    {
+        // the overall cache size is evenly distributed over all shards
+        std::size_t shard_size = ini_.get_agas_local_cache_size();
+        if (shard_size != std::size_t(~0x0ul))
+            shard_size = (shard_size + num_shards - 1) / num_shards;
+
+        for (auto& shard : gva_cache_shards_)
+            shard->cache_->reserve(shard_size);
+    }
 }
 
 #if defined(HPX_HAVE_NETWORKING)
@@ -385,8 +471,18 @@ void addressing_service::adjust_local_cache_size(std::size_t cache_size)
     // create the hierarchy based on the topology
     if (caching_)
     {
-        std::size_t previous = gva_cache_->size();
-            gva_cache_->reserve(cache_size);
+        // the overall cache size is evenly distributed over all shards
+        std::size_t const num_shards = gva_cache_shards_.size();
+        std::size_t shard_size = cache_size;
+        if (cache_size != std::size_t(~0x0ul))
+            shard_size = (cache_size + num_shards - 1) / num_shards;
+
+        std::size_t previous = 0;
+        for_each_cache_shard([&](gva_cache_shard& shard) {
+            std::lock_guard<mutex_type> lock(shard.mtx_);
+            previous += shard.cache_->size();
+            shard.cache_->reserve(shard_size);
+        });
 
         LAGAS_(info) << hpx::util::format(
             "addressing_service::adjust_local_cache_size, previous size: {1}, "
@@ -1954,9 +2050,11 @@ void addressing_service::update_cache_entry(
 
         const gva_cache_key key(gid, count);
 
-        {
-            std::unique_lock<mutex_type> lock(gva_cache_mtx_);
-            if (!gva_cache_->update_if(key, g, check_for_collisions))
+        bool corrupted = false;
+        for_each_cache_shard(key, [&](gva_cache_shard& shard) {
+            std::lock_guard<mutex_type> lock(shard.mtx_);
+            if (!corrupted &&
+                !shard.cache_->update_if(key, g, check_for_collisions))
             {
                 if (LAGAS_ENABLED(warning))
                 {
@@ -1964,13 +2062,10 @@ void addressing_service::update_cache_entry(
                     addressing_service::gva_cache_key idbase;
                     addressing_service::gva_cache_type::entry_type e;
 
-                    if (!gva_cache_->get_entry(key, idbase, e))
+                    if (!shard.cache_->get_entry(key, idbase, e))
                     {
                         // This is impossible under sane conditions.
-                        lock.unlock();
-                        HPX_THROWS_IF(ec, invalid_data
-                          , "addressing_service::update_cache_entry"
-                          , "data corruption or lock error occurred in cache");
+                        corrupted = true;
                         return;
                     }
 
@@ -1981,6 +2076,14 @@ void addressing_service::update_cache_entry(
                         gid, count, idbase.get_gid(), idbase.get_count());
                 }
             }
+        });
+
+        if (corrupted)
+        {
+            HPX_THROWS_IF(ec, invalid_data
+              , "addressing_service::update_cache_entry"
+              , "data corruption or lock error occurred in cache");
+            return;
         }
 
         if (&ec != &throws)
@@ -2006,8 +2109,10 @@ bool addressing_service::get_cache_entry(
     gva_cache_key k(gid);
     gva_cache_key idbase_key;
 
-    std::unique_lock<mutex_type> lock(gva_cache_mtx_);
-    if(gva_cache_->get_entry(k, idbase_key, gva))
+    gva_cache_shard& shard = get_cache_shard(k.get_gid());
+
+    std::unique_lock<mutex_type> lock(shard.mtx_);
+    if(shard.cache_->get_entry(k, idbase_key, gva))
     {
         const std::uint64_t id_msb =
             naming::detail::strip_internal_bits_from_gid(gid.get_msb());
@@ -2043,9 +2148,10 @@ void addressing_service::clear_cache(
     try {
         LAGAS_(warning) << "addressing_service::clear_cache, clearing cache";
 
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-
-        gva_cache_->clear();
+        for_each_cache_shard([](gva_cache_shard& shard) {
+            std::lock_guard<mutex_type> lock(shard.mtx_);
+            shard.cache_->clear();
+        });
 
         if (&ec != &throws)
             ec = make_success_code();
@@ -2090,13 +2196,14 @@ void addressing_service::remove_cache_entry(
     try {
         LAGAS_(warning) << "addressing_service::remove_cache_entry";
 
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-
-        gva_cache_->erase(
-            [&gid](std::pair<gva_cache_key, gva> const& p)
-            {
-                return gid == p.first.get_gid();
-            });
+        for_each_cache_shard([&gid](gva_cache_shard& shard) {
+            std::lock_guard<mutex_type> lock(shard.mtx_);
+            shard.cache_->erase(
+                [&gid](std::pair<gva_cache_key, gva> const& p)
+                {
+                    return gid == p.first.get_gid();
+                });
+        });
 
         if (&ec != &throws)
             ec = make_success_code();
@@ -2241,81 +2348,144 @@ namespace detail
 // Helper functions to access the current cache statistics
 std::uint64_t addressing_service::get_cache_entries(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->size();
+    if (gva_cache_shards_.size() == 1)
+    {
+        gva_cache_shard& shard = *gva_cache_shards_[0];
+        std::lock_guard<mutex_type> lock(shard.mtx_);
+        return shard.cache_->size();
+    }
+
+    // a cached range of GIDs is stored in all shards it overlaps, count
+    // every range only once
+    std::set<std::pair<naming::gid_type, naming::gid_type>> entries;
+    for_each_cache_shard([&](gva_cache_shard& shard) {
+        std::lock_guard<mutex_type> lock(shard.mtx_);
+        shard.cache_->for_each_key([&](gva_cache_key const& key) {
+            entries.emplace(key.get_gid(), key.get_last_gid());
+        });
+    });
+    return entries.size();
 }
 
 std::uint64_t addressing_service::get_cache_hits(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().hits(reset);
+    std::uint64_t result = 0;
+    for_each_cache_shard([&](gva_cache_shard& shard) {
+        std::lock_guard<mutex_type> lock(shard.mtx_);
+        result += shard.cache_->get_statistics().hits(reset);
+    });
+    return result;
 }
 
 std::uint64_t addressing_service::get_cache_misses(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().misses(reset);
+    std::uint64_t result = 0;
+    for_each_cache_shard([&](gva_cache_shard& shard) {
+        std::lock_guard<mutex_type> lock(shard.mtx_);
+        result += shard.cache_->get_statistics().misses(reset);
+    });
+    return result;
 }
 
 std::uint64_t addressing_service::get_cache_evictions(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().evictions(reset);
+    std::uint64_t result = 0;
+    for_each_cache_shard([&](gva_cache_shard& shard) {
+        std::lock_guard<mutex_type> lock(shard.mtx_);
+        result += shard.cache_->get_statistics().evictions(reset);
+    });
+    return result;
 }
 
 std::uint64_t addressing_service::get_cache_insertions(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().insertions(reset);
+    std::uint64_t result = 0;
+    for_each_cache_shard([&](gva_cache_shard& shard) {
+        std::lock_guard<mutex_type> lock(shard.mtx_);
+        result += shard.cache_->get_statistics().insertions(reset);
+    });
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 std::uint64_t addressing_service::get_cache_get_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_get_entry_count(reset);
+    std::uint64_t result = 0;
+    for_each_cache_shard([&](gva_cache_shard& shard) {
+        std::lock_guard<mutex_type> lock(shard.mtx_);
+        result += shard.cache_->get_statistics().get_get_entry_count(reset);
+    });
+    return result;
 }
 
 std::uint64_t addressing_service::get_cache_insertion_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_insert_entry_count(reset);
+    std::uint64_t result = 0;
+    for_each_cache_shard([&](gva_cache_shard& shard) {
+        std::lock_guard<mutex_type> lock(shard.mtx_);
+        result += shard.cache_->get_statistics().get_insert_entry_count(reset);
+    });
+    return result;
 }
 
 std::uint64_t addressing_service::get_cache_update_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_update_entry_count(reset);
+    std::uint64_t result = 0;
+    for_each_cache_shard([&](gva_cache_shard& shard) {
+        std::lock_guard<mutex_type> lock(shard.mtx_);
+        result += shard.cache_->get_statistics().get_update_entry_count(reset);
+    });
+    return result;
 }
 
 std::uint64_t addressing_service::get_cache_erase_entry_count(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_erase_entry_count(reset);
+    std::uint64_t result = 0;
+    for_each_cache_shard([&](gva_cache_shard& shard) {
+        std::lock_guard<mutex_type> lock(shard.mtx_);
+        result += shard.cache_->get_statistics().get_erase_entry_count(reset);
+    });
+    return result;
 }
 
 std::uint64_t addressing_service::get_cache_get_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_get_entry_time(reset);
+    std::uint64_t result = 0;
+    for_each_cache_shard([&](gva_cache_shard& shard) {
+        std::lock_guard<mutex_type> lock(shard.mtx_);
+        result += shard.cache_->get_statistics().get_get_entry_time(reset);
+    });
+    return result;
 }
 
 std::uint64_t addressing_service::get_cache_insertion_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_insert_entry_time(reset);
+    std::uint64_t result = 0;
+    for_each_cache_shard([&](gva_cache_shard& shard) {
+        std::lock_guard<mutex_type> lock(shard.mtx_);
+        result += shard.cache_->get_statistics().get_insert_entry_time(reset);
+    });
+    return result;
 }
 
 std::uint64_t addressing_service::get_cache_update_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_update_entry_time(reset);
+    std::uint64_t result = 0;
+    for_each_cache_shard([&](gva_cache_shard& shard) {
+        std::lock_guard<mutex_type> lock(shard.mtx_);
+        result += shard.cache_->get_statistics().get_update_entry_time(reset);
+    });
+    return result;
 }
 
 std::uint64_t addressing_service::get_cache_erase_entry_time(bool reset)
 {
-    std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-    return gva_cache_->get_statistics().get_erase_entry_time(reset);
+    std::uint64_t result = 0;
+    for_each_cache_shard([&](gva_cache_shard& shard) {
+        std::lock_guard<mutex_type> lock(shard.mtx_);
+        result += shard.cache_->get_statistics().get_erase_entry_time(reset);
+    });
+    return result;
 }
 
 /// Install performance counter types exposing properties from the local cache.
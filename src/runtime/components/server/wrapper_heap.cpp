@@ -206,6 +206,67 @@ namespace hpx { namespace components { namespace detail
         HPX_UNUSED(p);
 #endif
 
+#if defined(HPX_DEBUG)
+        free_count_ += count;
+#endif
+        free_size_ += count;
+
+        // release the pool if this one was the last allocated item
+        test_release(l);
+    }
+
+    std::size_t wrapper_heap::alloc_some(void** result, std::size_t count)
+    {
+        util::itt::heap_allocate heap_allocate(
+            heap_alloc_function_, result, count * parameters_.element_size,
+            HPX_WRAPPER_HEAP_INITIALIZED_MEMORY);
+
+        scoped_lock l(mtx_);
+
+        if (nullptr == pool_)
+            return 0;
+
+        std::size_t const total_num_bytes =
+            parameters_.capacity * parameters_.element_size;
+        if (first_free_ >= pool_ + total_num_bytes)
+            return 0;
+
+        std::size_t const available = static_cast<std::size_t>(
+            pool_ + total_num_bytes - first_free_) / parameters_.element_size;
+        if (count > available)
+            count = available;
+        if (count == 0)
+            return 0;
+
+#if defined(HPX_DEBUG)
+        alloc_count_ += count;
+#endif
+
+        void* p = first_free_;
+        first_free_ = first_free_ + count * parameters_.element_size;
+
+        HPX_ASSERT(free_size_ >= count);
+        free_size_ -= count;
+
+#if HPX_DEBUG_WRAPPER_HEAP != 0
+        // init memory blocks
+        debug::fill_bytes(p, initial_value, count * parameters_.element_size);
+#endif
+
+        *result = p;
+        return count;
+    }
+
+    void wrapper_heap::free_some(std::size_t count)
+    {
+        util::itt::heap_internal_access hia; HPX_UNUSED(hia);
+
+        // the elements are not known, they can't be checked for having been
+        // allocated before (HPX_DEBUG_WRAPPER_HEAP)
+        scoped_lock l(mtx_);
+
+        HPX_ASSERT(free_size_ + count <= parameters_.capacity);
+
 #if defined(HPX_DEBUG)
         free_count_ += count;
 #endif
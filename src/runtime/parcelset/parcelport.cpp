@@ -41,6 +41,7 @@ namespace hpx { namespace parcelset
         max_outbound_message_size_(ini.get_max_outbound_message_size()),
         allow_array_optimizations_(true),
         allow_zero_copy_optimizations_(true),
+        allow_zero_copy_receive_optimizations_(true),
         async_serialization_(false),
         priority_(hpx::util::get_entry_as<int>(ini,
             "hpx.parcel." + type + ".priority", 0)),
@@ -54,6 +55,7 @@ namespace hpx { namespace parcelset
         {
             allow_array_optimizations_ = false;
             allow_zero_copy_optimizations_ = false;
+            allow_zero_copy_receive_optimizations_ = false;
         }
         else
         {
@@ -61,6 +63,12 @@ namespace hpx { namespace parcelset
                     ini, key + ".zero_copy_optimization", 1) == 0)
             {
                 allow_zero_copy_optimizations_ = false;
+                allow_zero_copy_receive_optimizations_ = false;
+            }
+            else if (hpx::util::get_entry_as<int>(ini,
+                         key + ".zero_copy_receive_optimization", 1) == 0)
+            {
+                allow_zero_copy_receive_optimizations_ = false;
             }
         }
 
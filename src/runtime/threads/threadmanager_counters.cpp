@@ -21,6 +21,11 @@
 #include <hpx/runtime/threads/threadmanager_counters.hpp>
 #include <hpx/schedulers/maintain_queue_wait_times.hpp>
 
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__)
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#endif
+
 #include <cstddef>
 #include <cstdint>
 #include <utility>
@@ -361,6 +366,18 @@ namespace hpx { namespace threads {
             return naming::invalid_gid;
         }
 
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__)
+        ///////////////////////////////////////////////////////////////////////////
+        // stack pool counter creation function
+        naming::gid_type stack_pool_counter_creator(std::int64_t (*f)(bool),
+            performance_counters::counter_info const& info, error_code& ec)
+        {
+            return performance_counters::locality_raw_counter_creator(
+                info, f, ec);
+        }
+#endif
+
         ///////////////////////////////////////////////////////////////////////////
         // thread counts counter creation function
 #if defined(HPX_HAVE_COROUTINE_COUNTERS)
@@ -458,6 +475,39 @@ namespace hpx { namespace threads {
                 &performance_counters::locality_pool_thread_counter_discoverer,
                 "ns"},
 #endif
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+            // parked worker threads (scheduler mode enable_idle_parking)
+            {"/threads/time/parked",
+                performance_counters::counter_elapsed_time,
+                "returns the cumulative time worker threads were parked while "
+                "being idle",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threadmanager::get_idle_park_time,
+                    &thread_pool_base::get_idle_park_time),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                "ns"},
+            {"/threads/idle-park-rate",
+                performance_counters::counter_average_count,
+                "returns the ratio of the time worker threads were parked and "
+                "the overall time for the referenced object",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threadmanager::get_idle_park_rate,
+                    &thread_pool_base::get_idle_park_rate),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                "0.01%"},
+            {"/threads/time/average-wake-latency",
+                performance_counters::counter_average_timer,
+                "returns the average time between scheduling new work and a "
+                "parked worker thread resuming execution",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threadmanager::get_average_wake_latency,
+                    &thread_pool_base::get_average_wake_latency),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                "ns"},
+#endif
 #ifdef HPX_HAVE_THREAD_IDLE_RATES
             // idle rate
             {"/threads/idle-rate", performance_counters::counter_average_count,
@@ -727,6 +777,35 @@ namespace hpx { namespace threads {
                 HPX_PERFORMANCE_COUNTER_V1, counts_creator,
                 &detail::locality_allocator_counter_discoverer, ""},
 #endif
+#if defined(__linux) || defined(linux) || defined(__linux__) ||                \
+    defined(__FreeBSD__)
+            {   "/threads/count/stack-pool-hits",
+                performance_counters::counter_monotonically_increasing,
+                "returns the total number of thread stacks taken from the "
+                "pool of unused stacks for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::stack_pool_counter_creator,
+                    &coroutines::detail::posix::get_stack_pool_hit_count),
+                &performance_counters::locality_counter_discoverer, ""},
+            {   "/threads/count/stack-pool-misses",
+                performance_counters::counter_monotonically_increasing,
+                "returns the total number of thread stacks which had to be "
+                "newly allocated as the pool of unused stacks was empty for "
+                "the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::stack_pool_counter_creator,
+                    &coroutines::detail::posix::get_stack_pool_miss_count),
+                &performance_counters::locality_counter_discoverer, ""},
+            {   "/threads/stack-pool/reserved-size",
+                performance_counters::counter_raw,
+                "returns the current amount of address space reserved by "
+                "the pool of unused thread stacks for the referenced "
+                "locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::stack_pool_counter_creator,
+                    &coroutines::detail::posix::get_stack_pool_reserved_size),
+                &performance_counters::locality_counter_discoverer, "bytes"},
+#endif
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
             {   "/threads/count/pending-misses",
                 performance_counters::counter_monotonically_increasing,
@@ -794,6 +873,28 @@ namespace hpx { namespace threads {
                     &thread_pool_base::get_num_stolen_to_staged),
                 &performance_counters::locality_pool_thread_counter_discoverer,
                 ""},
+            {   "/threads/count/stolen-cross-domain",
+                performance_counters::counter_monotonically_increasing,
+                "returns the overall number of HPX-threads and task "
+                "descriptions stolen from a different NUMA domain for the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threadmanager::get_num_stolen_cross_domain,
+                    &thread_pool_base::get_num_stolen_cross_domain),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
+            {   "/threads/count/remote-memory-executions",
+                performance_counters::counter_monotonically_increasing,
+                "returns the overall number of HPX-threads placed on a NUMA "
+                "domain (using a NUMA schedule hint) which were executed on a "
+                "different NUMA domain for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threadmanager::get_num_remote_memory_executions,
+                    &thread_pool_base::get_num_remote_memory_executions),
+                &performance_counters::locality_pool_thread_counter_discoverer,
+                ""},
 #endif
             // scheduler utilization
             {   "/scheduler/utilization/instantaneous",
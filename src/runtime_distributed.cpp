@@ -17,6 +17,7 @@
 #include <hpx/command_line_handling/command_line_handling.hpp>
 #include <hpx/coroutines/coroutine.hpp>
 #include <hpx/datastructures/tuple.hpp>
+#include <hpx/execution/detail/adaptive_chunk_size_counters.hpp>
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/functional/bind.hpp>
 #include <hpx/functional/function.hpp>
@@ -62,6 +63,7 @@
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/timing/high_resolution_clock.hpp>
 #include <hpx/util/from_string.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/util/query_counters.hpp>
 #include <hpx/version.hpp>
 
@@ -1326,6 +1328,55 @@ namespace hpx {
         performance_counters::install_counter_types(arithmetic_counter_types,
             sizeof(arithmetic_counter_types) /
                 sizeof(arithmetic_counter_types[0]));
+
+        // counters exposing the decisions of execution::adaptive_chunk_size
+        execution::detail::adaptive_chunk_size_counters& adaptive_counters =
+            execution::detail::get_adaptive_chunk_size_counters();
+
+        performance_counters::install_counter_type(
+            "/parallel/adaptive-chunk-size/count/invocations",
+            [&adaptive_counters](bool reset) {
+                return util::get_and_reset_value(
+                    adaptive_counters.invocations_, reset);
+            },
+            "returns the number of parallel algorithm invocations a chunk "
+            "size was selected for by adaptive_chunk_size",
+            "", performance_counters::counter_monotonically_increasing);
+        performance_counters::install_counter_type(
+            "/parallel/adaptive-chunk-size/count/call-sites",
+            [&adaptive_counters](bool reset) {
+                return util::get_and_reset_value(
+                    adaptive_counters.call_sites_, reset);
+            },
+            "returns the number of distinct call sites (and core counts) "
+            "adaptive_chunk_size has collected statistics for",
+            "", performance_counters::counter_monotonically_increasing);
+        performance_counters::install_counter_type(
+            "/parallel/adaptive-chunk-size/count/explorations",
+            [&adaptive_counters](bool reset) {
+                return util::get_and_reset_value(
+                    adaptive_counters.explorations_, reset);
+            },
+            "returns the number of invocations for which adaptive_chunk_size "
+            "probed a chunk size other than the preferred one",
+            "", performance_counters::counter_monotonically_increasing);
+        performance_counters::install_counter_type(
+            "/parallel/adaptive-chunk-size/count/adjustments",
+            [&adaptive_counters](bool reset) {
+                return util::get_and_reset_value(
+                    adaptive_counters.adjustments_, reset);
+            },
+            "returns the number of times adaptive_chunk_size changed the "
+            "preferred chunk size of a call site",
+            "", performance_counters::counter_monotonically_increasing);
+        performance_counters::install_counter_type(
+            "/parallel/adaptive-chunk-size/chunk-size",
+            [&adaptive_counters](bool) -> std::int64_t {
+                return adaptive_counters.chunk_size_.load();
+            },
+            "returns the chunk size most recently selected by "
+            "adaptive_chunk_size",
+            "", performance_counters::counter_raw);
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -10,6 +10,8 @@
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/format.hpp>
+#include <hpx/runtime_configuration/runtime_configuration.hpp>
+#include <hpx/runtime_local/runtime_local.hpp>
 #include <hpx/state.hpp>
 #include <hpx/util/one_size_heap_list.hpp>
 #if defined(HPX_DEBUG)
@@ -18,8 +20,11 @@
 #include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/threading_base/register_thread.hpp>
 #include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/util/get_entry_as.hpp>
 #include <hpx/util/wrapper_heap_base.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <list>
 #include <memory>
@@ -27,6 +32,35 @@
 #include <string>
 
 namespace hpx { namespace util {
+    ///////////////////////////////////////////////////////////////////////////
+    bool one_size_heap_list::thread_cache::add_pending(void* p)
+    {
+        for (std::size_t i = 0; i != num_pending_heaps_; ++i)
+        {
+            if (pending_[i].heap_->did_alloc(p))
+            {
+                ++pending_[i].count_;
+                ++num_pending_;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool one_size_heap_list::thread_cache::add_pending(
+        std::shared_ptr<util::wrapper_heap_base> const& heap)
+    {
+        if (num_pending_heaps_ == max_pending_heaps)
+            return false;
+
+        pending_[num_pending_heaps_].heap_ = heap;
+        pending_[num_pending_heaps_].count_ = 1;
+        ++num_pending_heaps_;
+        ++num_pending_;
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
     one_size_heap_list::~one_size_heap_list() noexcept
     {
 #if defined(HPX_DEBUG)
@@ -46,6 +80,21 @@ namespace hpx { namespace util {
 
     void* one_size_heap_list::alloc(std::size_t count)
     {
+        if (count == 1)
+        {
+            if (thread_cache* cache = get_cache())
+            {
+                if (cache->next_ != cache->end_)
+                {
+                    void* p = cache->next_;
+                    cache->next_ += parameters_.element_size;
+                    cache->used_ = true;
+                    return p;
+                }
+                return refill_cache();
+            }
+        }
+
         unique_lock_type guard(mtx_);
 
         if (HPX_UNLIKELY(0 == count))
@@ -158,6 +207,14 @@ namespace hpx { namespace util {
 
     void one_size_heap_list::free(void* p, std::size_t count)
     {
+        if (count == 1 && nullptr != p &&
+            threads::threadmanager_is(state_running) &&
+            nullptr != get_cache())
+        {
+            free_cached(p);
+            return;
+        }
+
         unique_lock_type ul(mtx_);
 
         if (nullptr == p || !threads::threadmanager_is(state_running))
@@ -214,6 +271,270 @@ namespace hpx { namespace util {
         return false;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t one_size_heap_list::alloc_some(void** p, std::size_t count,
+        std::shared_ptr<util::wrapper_heap_base>& heap)
+    {
+        unique_lock_type guard(mtx_);
+
+        for (auto const& h : heap_list_)
+        {
+            std::size_t allocated = 0;
+
+            {
+                util::unlock_guard<unique_lock_type> ul(guard);
+                allocated = h->alloc_some(p, count);
+            }
+
+            if (allocated != 0)
+            {
+#if defined(HPX_DEBUG)
+                alloc_count_ += allocated;
+                if (alloc_count_ - free_count_ > max_alloc_count_)
+                    max_alloc_count_ = alloc_count_ - free_count_;
+#endif
+                heap = h;
+                return allocated;
+            }
+        }
+
+        // Create new heap.
+#if defined(HPX_DEBUG)
+        heap_list_.push_front(
+            create_heap_(class_name_.c_str(), heap_count_ + 1, parameters_));
+#else
+        heap_list_.push_front(
+            create_heap_(class_name_.c_str(), 0, parameters_));
+#endif
+
+        std::shared_ptr<util::wrapper_heap_base> h = heap_list_.front();
+        std::size_t allocated = 0;
+
+        {
+            util::unlock_guard<unique_lock_type> ul(guard);
+            allocated = h->alloc_some(p, count);
+        }
+
+        if (HPX_UNLIKELY(allocated == 0 || nullptr == *p))
+        {
+            // out of memory
+            guard.unlock();
+            HPX_THROW_EXCEPTION(out_of_memory, name() + "::alloc_some",
+                hpx::util::format(
+                    "new heap failed to allocate {1} objects", count));
+        }
+
+#if defined(HPX_DEBUG)
+        alloc_count_ += allocated;
+        ++heap_count_;
+
+        LOSH_(info) << hpx::util::format(
+            "{1}::alloc_some: creating new heap[{2}], size is now {3}", name(),
+            heap_count_, heap_list_.size());
+#endif
+
+        heap = std::move(h);
+        return allocated;
+    }
+
+    std::shared_ptr<util::wrapper_heap_base> one_size_heap_list::find_heap(
+        void* p)
+    {
+        // most likely the element was allocated by this thread recently
+        if (thread_cache* cache = get_cache())
+        {
+            std::shared_ptr<util::wrapper_heap_base> heap = cache->heap_;
+            if (heap && heap->did_alloc(p))
+                return heap;
+        }
+
+        unique_lock_type ul(mtx_);
+        for (typename list_type::value_type const& heap : heap_list_)
+        {
+            bool did_allocate = false;
+
+            {
+                util::unlock_guard<unique_lock_type> ull(ul);
+                did_allocate = heap->did_alloc(p);
+            }
+
+            if (did_allocate)
+                return heap;
+        }
+        return nullptr;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The per-thread caches are used by HPX threads only. A cache is accessed
+    // by the threads running on the corresponding worker thread exclusively,
+    // no synchronization is needed as long as the accessing thread is not
+    // suspended. All operations which may suspend (everything touching the
+    // heap list or a heap) are performed without referring to the cache,
+    // the cache is looked up again afterwards as the thread may have been
+    // moved to a different worker thread in the meantime.
+    one_size_heap_list::thread_cache* one_size_heap_list::get_cache()
+    {
+        std::size_t num_caches = num_caches_.load(std::memory_order_acquire);
+        if (HPX_UNLIKELY(num_caches == caches_uninitialized))
+        {
+            num_caches = init_caches();
+        }
+
+        if (num_caches == 0 || nullptr == threads::get_self_ptr())
+            return nullptr;
+
+        std::size_t const num_thread = hpx::get_worker_thread_num();
+        if (num_thread >= num_caches)
+            return nullptr;
+
+        return &caches_[num_thread].data_;
+    }
+
+    std::size_t one_size_heap_list::init_caches()
+    {
+        runtime* rt = get_runtime_ptr();
+        if (nullptr == rt)
+            return 0;    // try again later
+
+        unique_lock_type l(mtx_);
+
+        std::size_t num_caches = num_caches_.load(std::memory_order_relaxed);
+        if (num_caches != caches_uninitialized)
+            return num_caches;
+
+        util::runtime_configuration const& cfg = rt->get_config();
+
+        // a cache holding a single element would not help
+        cache_size_ = util::get_entry_as<std::size_t>(
+            cfg, "hpx.components.heap_cache_size", 32);
+        if (cache_size_ > parameters_.capacity)
+            cache_size_ = parameters_.capacity;
+
+        num_caches = 0;
+        if (cache_size_ > 1)
+        {
+            num_caches = cfg.get_os_thread_count();
+            caches_.reset(new util::cache_aligned_data<thread_cache>[
+                num_caches]);
+        }
+
+        num_caches_.store(num_caches, std::memory_order_release);
+        return num_caches;
+    }
+
+    void* one_size_heap_list::refill_cache()
+    {
+        void* p = nullptr;
+        std::shared_ptr<util::wrapper_heap_base> heap;
+        std::size_t const count = alloc_some(&p, cache_size_, heap);
+
+        if (count > 1)
+        {
+            char* next = static_cast<char*>(p) + parameters_.element_size;
+            char* end = static_cast<char*>(p) + count * parameters_.element_size;
+
+            thread_cache* cache = get_cache();
+            if (nullptr != cache && cache->next_ == cache->end_)
+            {
+                // the elements remaining in the cache are exhausted, they
+                // can't hold up the release of their heap anymore
+                cache->heap_ = std::move(heap);
+                cache->next_ = next;
+                cache->end_ = end;
+                cache->used_ = true;
+            }
+            else
+            {
+                // some other thread has refilled the cache in the meantime,
+                // give the additional elements back (they are not reused)
+                heap->free_some(count - 1);
+#if defined(HPX_DEBUG)
+                std::lock_guard<mutex_type> l(mtx_);
+                free_count_ += count - 1;
+#endif
+            }
+        }
+        return p;
+    }
+
+    void one_size_heap_list::free_cached(void* p)
+    {
+        thread_cache* cache = get_cache();
+        HPX_ASSERT(nullptr != cache);
+
+        if (!cache->add_pending(p))
+        {
+            // the freed element does not belong to any of the heaps this
+            // thread has pending frees for
+            std::shared_ptr<util::wrapper_heap_base> heap = find_heap(p);
+            if (!heap)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter, name() + "::free",
+                    hpx::util::format(
+                        "pointer {1} was not allocated by this {2}", p,
+                        name()));
+            }
+            cache = get_cache();
+
+            while (!cache->add_pending(heap))
+            {
+                flush_cache(*cache);
+                cache = get_cache();
+            }
+        }
+
+        if (cache->num_pending_ >= thread_cache::flush_threshold)
+        {
+            flush_cache(*cache);
+        }
+    }
+
+    // Report the pending frees to the heaps. The reserved elements are given
+    // back as well if none of them was used since the last flush, which
+    // allows for the heap to be released if this thread does not allocate
+    // anymore.
+    void one_size_heap_list::flush_cache(thread_cache& cache)
+    {
+        thread_cache::pending_free pending[thread_cache::max_pending_heaps];
+        std::size_t const num_pending_heaps = cache.num_pending_heaps_;
+        for (std::size_t i = 0; i != num_pending_heaps; ++i)
+        {
+            pending[i] = std::move(cache.pending_[i]);
+        }
+        cache.num_pending_heaps_ = 0;
+        cache.num_pending_ = 0;
+
+        std::shared_ptr<util::wrapper_heap_base> reserved_heap;
+        std::size_t reserved = 0;
+        if (!cache.used_ && cache.next_ != cache.end_)
+        {
+            reserved = static_cast<std::size_t>(cache.end_ - cache.next_) /
+                parameters_.element_size;
+            reserved_heap = std::move(cache.heap_);
+            cache.next_ = cache.end_ = nullptr;
+        }
+        cache.used_ = false;
+
+        // the cache must not be referred to anymore from here on
+        std::size_t freed = reserved;
+        for (std::size_t i = 0; i != num_pending_heaps; ++i)
+        {
+            pending[i].heap_->free_some(pending[i].count_);
+            freed += pending[i].count_;
+        }
+        if (reserved != 0)
+        {
+            reserved_heap->free_some(reserved);
+        }
+
+#if defined(HPX_DEBUG)
+        std::lock_guard<mutex_type> l(mtx_);
+        free_count_ += freed;
+#else
+        HPX_UNUSED(freed);
+#endif
+    }
+
     std::string one_size_heap_list::name() const
     {
         if (class_name_.empty())
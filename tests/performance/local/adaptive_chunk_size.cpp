@@ -0,0 +1,171 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark demonstrates how adaptive_chunk_size converges towards the
+// best chunk size for a loop which is executed many times, as it is common
+// for iterative solvers. The cost of the loop body changes slowly over the
+// iterations. The execution times are compared to the ones measured for the
+// same loop using the default chunking. The chunk size selected by
+// adaptive_chunk_size is queried through the performance counters exposing
+// its decisions.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_executor_parameters.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/iostream.hpp>
+
+#include "worker_timed.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+std::uint64_t measure(ExPolicy&& policy, std::vector<std::uint64_t> const& data,
+    std::uint64_t delay)
+{
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    hpx::for_each(policy, data.begin(), data.end(),
+        [delay](std::uint64_t) { worker_timed(delay); });
+
+    return hpx::chrono::high_resolution_clock::now() - start;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t vector_size = vm["vector_size"].as<std::size_t>();
+    std::size_t iterations = vm["iterations"].as<std::size_t>();
+    std::size_t report_interval = vm["report_interval"].as<std::size_t>();
+    std::uint64_t delay = vm["delay"].as<std::uint64_t>();
+    std::uint64_t final_delay = vm["final_delay"].as<std::uint64_t>();
+    bool csv_output = vm.count("csv_output") != 0;
+
+    // verify that input is within domain of program
+    if (iterations == 0 || report_interval == 0)
+    {
+        hpx::cout << "iterations and report_interval cannot be zero...\n"
+                  << hpx::flush;
+        return hpx::finalize();
+    }
+    else if (vector_size == 0)
+    {
+        hpx::cout << "vector_size cannot be zero...\n" << hpx::flush;
+        return hpx::finalize();
+    }
+
+    std::vector<std::uint64_t> data(vector_size, 0);
+
+    hpx::performance_counters::performance_counter chunk_size_counter(
+        "/parallel{locality#0/total}/adaptive-chunk-size/chunk-size");
+    hpx::performance_counters::performance_counter adjustments_counter(
+        "/parallel{locality#0/total}/adaptive-chunk-size/count/adjustments");
+
+    // all invocations below share the statistics of this object
+    hpx::execution::adaptive_chunk_size acs;
+    auto adaptive_policy = hpx::execution::par.with(acs);
+
+    if (csv_output)
+    {
+        hpx::cout << "iteration,delay[ns],default[s],adaptive[s],chunk_size,"
+                     "adjustments\n"
+                  << hpx::flush;
+    }
+
+    std::uint64_t default_time = 0, adaptive_time = 0;
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        // the cost of the loop body drifts linearly over the iterations
+        std::uint64_t const current_delay = std::uint64_t(double(delay) +
+            (double(final_delay) - double(delay)) * double(i) /
+                double(iterations));
+
+        default_time += measure(hpx::execution::par, data, current_delay);
+        adaptive_time += measure(adaptive_policy, data, current_delay);
+
+        if ((i + 1) % report_interval == 0)
+        {
+            std::int64_t chunk_size =
+                chunk_size_counter.get_value<std::int64_t>(hpx::launch::sync);
+            std::int64_t adjustments =
+                adjustments_counter.get_value<std::int64_t>(hpx::launch::sync);
+
+            double const default_avg =
+                default_time / 1e9 / double(report_interval);
+            double const adaptive_avg =
+                adaptive_time / 1e9 / double(report_interval);
+
+            if (csv_output)
+            {
+                hpx::cout << (i + 1) << "," << current_delay << ","
+                          << default_avg << "," << adaptive_avg << ","
+                          << chunk_size << "," << adjustments << "\n"
+                          << hpx::flush;
+            }
+            else
+            {
+                hpx::cout << "iteration " << (i + 1) << " (delay "
+                          << current_delay << "ns): default " << default_avg
+                          << "s, adaptive " << adaptive_avg
+                          << "s, chunk size " << chunk_size << ", adjustments "
+                          << adjustments << "\n"
+                          << hpx::flush;
+            }
+
+            default_time = 0;
+            adaptive_time = 0;
+        }
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    //initialize program
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("vector_size"
+        , hpx::program_options::value<std::size_t>()->default_value(100000)
+        , "number of loop iterations (default: 100000)")
+
+        ("iterations"
+        , hpx::program_options::value<std::size_t>()->default_value(2000)
+        , "number of times the loop is executed (default: 2000)")
+
+        ("report_interval"
+        , hpx::program_options::value<std::size_t>()->default_value(50)
+        , "number of executions to average for each line of output "
+          "(default: 50)")
+
+        ("delay"
+        , hpx::program_options::value<std::uint64_t>()->default_value(10)
+        , "initial time in nanoseconds spent on each element (default: 10)")
+
+        ("final_delay"
+        , hpx::program_options::value<std::uint64_t>()->default_value(1000)
+        , "time in nanoseconds spent on each element at the end of the run "
+          "(default: 1000)")
+
+        ("csv_output"
+        , "print results in csv format")
+        ;
+    // clang-format on
+
+    return hpx::init(cmdline, argc, argv, cfg);
+}
@@ -0,0 +1,141 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the throughput of concurrent lookups in the AGAS
+// address resolution cache (as used by resolve_cached). Run it with
+// different values for --hpx:ini=hpx.agas.local_cache_shards=<N> to compare
+// the contention behavior of the sharded cache.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/runtime/agas/addressing_service.hpp>
+
+#include <hpx/modules/program_options.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Create GIDs which look like they were created on a remote locality (the
+// cache is not used for locally managed GIDs).
+std::vector<hpx::naming::gid_type> populate_cache(
+    std::size_t num_entries, std::uint64_t range)
+{
+    hpx::naming::resolver_client& agas = hpx::naming::get_agas_client();
+
+    std::uint32_t remote_locality = hpx::get_locality_id() + 1;
+    hpx::naming::gid_type locality =
+        hpx::naming::get_gid_from_locality_id(remote_locality);
+    std::uint32_t ct = hpx::components::component_invalid;
+
+    std::vector<hpx::naming::gid_type> gids;
+    gids.reserve(num_entries);
+
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        hpx::naming::gid_type gid = hpx::naming::replace_locality_id(
+            hpx::detail::get_next_id(range), remote_locality);
+
+        agas.update_cache_entry(
+            gid, hpx::agas::gva(locality, ct, range, std::uint64_t(0), 0));
+
+        for (std::uint64_t j = 0; j != range; ++j)
+            gids.push_back(gid + j);
+    }
+
+    return gids;
+}
+
+std::uint64_t lookup(std::vector<hpx::naming::gid_type> const& gids,
+    std::size_t num_lookups, std::size_t seed)
+{
+    hpx::naming::resolver_client& agas = hpx::naming::get_agas_client();
+
+    std::mt19937 gen(static_cast<std::uint32_t>(seed));
+    std::uniform_int_distribution<std::size_t> dist(0, gids.size() - 1);
+
+    std::uint64_t hits = 0;
+    for (std::size_t i = 0; i != num_lookups; ++i)
+    {
+        hpx::agas::gva g;
+        hpx::naming::gid_type idbase;
+        if (agas.get_cache_entry(gids[dist(gen)], g, idbase))
+            ++hits;
+    }
+    return hits;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t num_entries = vm["num_entries"].as<std::size_t>();
+    std::size_t num_lookups = vm["num_lookups"].as<std::size_t>();
+    std::uint64_t range = vm["range"].as<std::uint64_t>();
+    std::size_t num_tasks = vm["tasks"].as<std::size_t>();
+    if (num_tasks == 0)
+        num_tasks = hpx::get_os_thread_count();
+
+    std::vector<hpx::naming::gid_type> gids =
+        populate_cache(num_entries, range);
+
+    hpx::chrono::high_resolution_timer t;
+
+    std::vector<hpx::future<std::uint64_t>> results;
+    results.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        results.push_back(hpx::async(&lookup, std::cref(gids), num_lookups, i));
+    }
+
+    std::uint64_t hits = 0;
+    for (auto&& f : results)
+        hits += f.get();
+
+    double elapsed = t.elapsed();
+
+    std::cout << "shards: "
+              << hpx::get_config_entry("hpx.agas.local_cache_shards", "1")
+              << ", tasks: " << num_tasks << ", lookups: "
+              << num_tasks * num_lookups << ", hits: " << hits
+              << ", time: " << elapsed << " [s], lookups/s: "
+              << (num_tasks * num_lookups) / elapsed << std::endl;
+
+    hpx::util::print_cdash_timing("AGASCacheConcurrency", elapsed);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("num_entries,n", value<std::size_t>()->default_value(1000),
+         "number of entries (ranges) to insert into the cache "
+         "(default: 1000)")
+        ("range", value<std::uint64_t>()->default_value(1),
+         "number of GIDs covered by each of the cache entries (default: 1)")
+        ("num_lookups", value<std::size_t>()->default_value(100000),
+         "number of cache lookups performed by each task "
+         "(default: 100000)")
+        ("tasks", value<std::size_t>()->default_value(0),
+         "number of concurrent tasks (default: number of worker threads)")
+        ;
+    // clang-format on
+
+    // Initialize and run HPX
+    return hpx::init(desc_commandline, argc, argv);
+}
@@ -0,0 +1,135 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the throughput of creating and destroying (managed) component
+// instances on the local locality from a number of concurrently running
+// tasks. Run it with different values for hpx.components.heap_cache_size to
+// compare the per-thread caches of the component heaps with the shared heap
+// list:
+//
+//      component_create_destroy --hpx:ini=hpx.components.heap_cache_size=0
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::size_t> live_instances(0);
+
+struct test_server
+  : hpx::components::managed_component_base<test_server>
+{
+    test_server()
+    {
+        ++live_instances;
+    }
+
+    ~test_server()
+    {
+        --live_instances;
+    }
+};
+
+typedef hpx::components::managed_component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server);
+
+///////////////////////////////////////////////////////////////////////////////
+void create_destroy(std::size_t count, std::size_t batch)
+{
+    hpx::id_type const here = hpx::find_here();
+
+    std::vector<hpx::id_type> ids;
+    ids.reserve(batch);
+
+    for (std::size_t i = 0; i < count; i += batch)
+    {
+        for (std::size_t j = i; j != count && j != i + batch; ++j)
+        {
+            ids.push_back(hpx::new_<test_server>(here).get());
+        }
+
+        // releasing the last reference destroys the instances
+        ids.clear();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const instances = vm["instances"].as<std::size_t>();
+    std::size_t const batch = vm["batch"].as<std::size_t>();
+    std::size_t tasks = vm["tasks"].as<std::size_t>();
+    if (tasks == 0)
+    {
+        tasks = hpx::get_os_thread_count();
+    }
+
+    std::size_t const count = instances / tasks;
+
+    hpx::chrono::high_resolution_timer t;
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(tasks);
+    for (std::size_t i = 0; i != tasks; ++i)
+    {
+        futures.push_back(hpx::async(&create_destroy, count, batch));
+    }
+    hpx::wait_all(futures);
+
+    double const create_time = t.elapsed();
+
+    // the instances are destroyed asynchronously
+    while (live_instances.load() != 0)
+    {
+        hpx::this_thread::yield();
+    }
+
+    double const total_time = t.elapsed();
+
+    std::string const cache_size =
+        hpx::get_config_entry("hpx.components.heap_cache_size", "32");
+
+    hpx::util::format_to(std::cout,
+        "heap cache size: {1}, tasks: {2}, instances: {3}\n"
+        "created: {4:.0f} [instances/s], created and destroyed: {5:.0f} "
+        "[instances/s]\n",
+        cache_size, tasks, count * tasks, double(count * tasks) / create_time,
+        double(count * tasks) / total_time);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::program_options::options_description cmdline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("instances",
+         hpx::program_options::value<std::size_t>()->default_value(1000000),
+         "the overall number of instances to create (default: 1000000)")
+        ("batch",
+         hpx::program_options::value<std::size_t>()->default_value(100),
+         "the number of instances alive at the same time per task "
+         "(default: 100)")
+        ("tasks",
+         hpx::program_options::value<std::size_t>()->default_value(0),
+         "the number of concurrently running tasks (default: number of "
+         "worker threads)")
+        ;
+    // clang-format on
+
+    return hpx::init(cmdline, argc, argv);
+}
@@ -0,0 +1,235 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the execution times of for_each, transform, and
+// transform_reduce (inner product) on float and double arrays when run using
+// the par and the (vectorizing) datapar execution policies.
+
+#include <hpx/chrono.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/datapar.hpp>
+#include <hpx/include/parallel_for_each.hpp>
+#include <hpx/include/parallel_transform.hpp>
+#include <hpx/include/parallel_transform_reduce.hpp>
+#include <hpx/iostream.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+int test_count = 100;
+bool csv_output = false;
+
+///////////////////////////////////////////////////////////////////////////////
+// All function objects are generic as the datapar execution policy invokes
+// them with vector packs instead of single elements.
+template <typename T>
+struct scale_add
+{
+    T factor_;
+
+    template <typename V>
+    void operator()(V& v) const
+    {
+        v = v * factor_ + factor_;
+    }
+};
+
+template <typename T>
+struct scale
+{
+    T factor_;
+
+    template <typename V>
+    V operator()(V const& v) const
+    {
+        return v * factor_;
+    }
+};
+
+struct plus
+{
+    template <typename T1, typename T2>
+    auto operator()(T1&& t1, T2&& t2) const -> decltype(t1 + t2)
+    {
+        return t1 + t2;
+    }
+};
+
+struct multiplies
+{
+    template <typename T1, typename T2>
+    auto operator()(T1&& t1, T2&& t2) const -> decltype(t1 * t2)
+    {
+        return t1 * t2;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy, typename T>
+std::uint64_t measure_for_each(ExPolicy&& policy, std::vector<T>& data)
+{
+    std::uint64_t time = 0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+        hpx::for_each(policy, std::begin(data), std::end(data),
+            scale_add<T>{T(0.5)});
+        time += hpx::chrono::high_resolution_clock::now() - start;
+    }
+    return time / test_count;
+}
+
+template <typename ExPolicy, typename T>
+std::uint64_t measure_transform(
+    ExPolicy&& policy, std::vector<T> const& data, std::vector<T>& result)
+{
+    std::uint64_t time = 0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+        hpx::transform(policy, std::begin(data), std::end(data),
+            std::begin(result), scale<T>{T(2)});
+        time += hpx::chrono::high_resolution_clock::now() - start;
+    }
+    return time / test_count;
+}
+
+template <typename ExPolicy, typename T>
+std::uint64_t measure_transform_reduce(
+    ExPolicy&& policy, std::vector<T> const& data1, std::vector<T> const& data2)
+{
+    std::uint64_t time = 0;
+    T result = T(0);
+    for (int i = 0; i != test_count; ++i)
+    {
+        std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+        result += hpx::transform_reduce(policy, std::begin(data1),
+            std::end(data1), std::begin(data2), T(0), ::multiplies(),
+            ::plus());
+        time += hpx::chrono::high_resolution_clock::now() - start;
+    }
+
+    // make sure the result is used
+    if (result == T(-1))
+        hpx::cout << result << "\n";
+
+    return time / test_count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void print_result(char const* algorithm, char const* type, std::uint64_t par,
+    std::uint64_t datapar)
+{
+    double const speedup = double(par) / double(datapar);
+    if (csv_output)
+    {
+        hpx::cout << algorithm << "," << type << "," << par / 1e9 << ","
+                  << datapar / 1e9 << "," << speedup << "\n"
+                  << hpx::flush;
+    }
+    else
+    {
+        hpx::cout << algorithm << "<" << type << ">: par " << par / 1e9
+                  << "s, datapar " << datapar / 1e9 << "s, speedup "
+                  << speedup << "\n"
+                  << hpx::flush;
+    }
+}
+
+template <typename T>
+void run_benchmarks(
+    char const* type, std::size_t vector_size, std::mt19937& gen)
+{
+    std::uniform_real_distribution<T> dist(T(0), T(1));
+
+    std::vector<T> data1(vector_size), data2(vector_size), result(vector_size);
+    for (std::size_t i = 0; i != vector_size; ++i)
+    {
+        data1[i] = dist(gen);
+        data2[i] = dist(gen);
+    }
+
+    using hpx::execution::datapar;
+    using hpx::execution::par;
+
+    // warm up the runtime and the caches
+    measure_for_each(par, result);
+
+    print_result("for_each", type, measure_for_each(par, result),
+        measure_for_each(datapar, result));
+    print_result("transform", type, measure_transform(par, data1, result),
+        measure_transform(datapar, data1, result));
+    print_result("transform_reduce", type,
+        measure_transform_reduce(par, data1, data2),
+        measure_transform_reduce(datapar, data1, data2));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t vector_size = vm["vector_size"].as<std::size_t>();
+    test_count = vm["test_count"].as<int>();
+    csv_output = vm.count("csv_output") != 0;
+
+    unsigned int seed = vm["seed"].as<unsigned int>();
+    std::mt19937 gen(seed);
+
+    // verify that input is within domain of program
+    if (test_count <= 0)
+    {
+        hpx::cout << "test_count cannot be zero or negative...\n" << hpx::flush;
+    }
+    else
+    {
+        if (csv_output)
+        {
+            hpx::cout << "algorithm,type,par[s],datapar[s],speedup\n"
+                      << hpx::flush;
+        }
+
+        run_benchmarks<float>("float", vector_size, gen);
+        run_benchmarks<double>("double", vector_size, gen);
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    //initialize program
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("vector_size"
+        , hpx::program_options::value<std::size_t>()->default_value(1048576)
+        , "size of the arrays (default: 1048576)")
+
+        ("test_count"
+        , hpx::program_options::value<int>()->default_value(100)
+        , "number of tests to be averaged (default: 100)")
+
+        ("seed"
+        , hpx::program_options::value<unsigned int>()->default_value(0)
+        , "seed for the random number generator (default: 0)")
+
+        ("csv_output"
+        , "print results in csv format")
+        ;
+    // clang-format on
+
+    return hpx::init(cmdline, argc, argv, cfg);
+}
@@ -0,0 +1,237 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the execution times of the searching and comparing
+// algorithms (find, count, equal, mismatch, adjacent_find,
+// lexicographical_compare, and min/max_element) on arrays of arithmetic types
+// when run using the seq/par and the (vectorizing) dataseq/datapar execution
+// policies. All sequences are searched completely, i.e. no early exit is
+// possible.
+
+// make inspect happy: hpxinspect:nominmax
+
+#include <hpx/chrono.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/datapar.hpp>
+#include <hpx/include/parallel_adjacent_find.hpp>
+#include <hpx/include/parallel_count.hpp>
+#include <hpx/include/parallel_equal.hpp>
+#include <hpx/include/parallel_find.hpp>
+#include <hpx/include/parallel_lexicographical_compare.hpp>
+#include <hpx/include/parallel_minmax.hpp>
+#include <hpx/include/parallel_mismatch.hpp>
+#include <hpx/iostream.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+int test_count = 100;
+bool csv_output = false;
+
+// the results of all invocations are accumulated here to make sure that the
+// compiler does not optimize them away
+std::size_t checksum = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename F>
+std::uint64_t measure(F&& f)
+{
+    std::uint64_t time = 0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+        checksum += f();
+        time += hpx::chrono::high_resolution_clock::now() - start;
+    }
+    return time / test_count;
+}
+
+// The sequences are passed as non-const references, as some of the
+// parallel algorithms require mutable iterators.
+template <typename ExPolicy, typename T>
+void measure_algorithms(ExPolicy&& policy, std::vector<T>& data1,
+    std::vector<T>& data2, std::vector<std::uint64_t>& times)
+{
+    auto first1 = std::begin(data1);
+    auto last1 = std::end(data1);
+    auto first2 = std::begin(data2);
+    auto last2 = std::end(data2);
+
+    times.push_back(measure([&]() -> std::size_t {
+        return std::distance(first1, hpx::find(policy, first1, last1, T(0)));
+    }));
+    times.push_back(measure([&]() -> std::size_t {
+        return hpx::count(policy, first1, last1, T(1));
+    }));
+    times.push_back(measure([&]() -> std::size_t {
+        return hpx::equal(policy, first1, last1, first2, last2);
+    }));
+    times.push_back(measure([&]() -> std::size_t {
+        return std::distance(
+            first1, hpx::mismatch(policy, first1, last1, first2, last2).first);
+    }));
+    times.push_back(measure([&]() -> std::size_t {
+        return std::distance(
+            first1, hpx::adjacent_find(policy, first1, last1));
+    }));
+    times.push_back(measure([&]() -> std::size_t {
+        return hpx::parallel::lexicographical_compare(
+            policy, first1, last1, first2, last2);
+    }));
+    times.push_back(measure([&]() -> std::size_t {
+        return std::distance(
+            first1, hpx::parallel::min_element(policy, first1, last1));
+    }));
+    times.push_back(measure([&]() -> std::size_t {
+        return std::distance(
+            first1, hpx::parallel::max_element(policy, first1, last1));
+    }));
+    times.push_back(measure([&]() -> std::size_t {
+        return std::distance(
+            first1, hpx::parallel::minmax_element(policy, first1, last1).first);
+    }));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+char const* const algorithms[] = {"find", "count", "equal", "mismatch",
+    "adjacent_find", "lexicographical_compare", "min_element", "max_element",
+    "minmax_element"};
+
+void print_result(char const* algorithm, char const* type, char const* policy,
+    std::uint64_t scalar, std::uint64_t vectorized)
+{
+    double const speedup = double(scalar) / double(vectorized);
+    if (csv_output)
+    {
+        hpx::cout << algorithm << "," << type << "," << policy << ","
+                  << scalar / 1e9 << "," << vectorized / 1e9 << "," << speedup
+                  << "\n"
+                  << hpx::flush;
+    }
+    else
+    {
+        hpx::cout << algorithm << "<" << type << ">, " << policy << ": "
+                  << scalar / 1e9 << "s, data" << policy << " "
+                  << vectorized / 1e9 << "s, speedup " << speedup << "\n"
+                  << hpx::flush;
+    }
+}
+
+void print_results(char const* type, char const* policy,
+    std::vector<std::uint64_t> const& scalar,
+    std::vector<std::uint64_t> const& vectorized)
+{
+    for (std::size_t i = 0; i != scalar.size(); ++i)
+    {
+        print_result(algorithms[i], type, policy, scalar[i], vectorized[i]);
+    }
+}
+
+template <typename T>
+void run_benchmarks(
+    char const* type, std::size_t vector_size, std::mt19937& gen)
+{
+    // Neither sequence contains zeros or equal adjacent elements, both
+    // sequences are equal.
+    std::uniform_int_distribution<int> dist(1, 100);
+
+    std::vector<T> data1(vector_size);
+    for (std::size_t i = 0; i != vector_size; ++i)
+    {
+        T value = T(dist(gen));
+        data1[i] = (i != 0 && value == data1[i - 1]) ? T(value + 1) : value;
+    }
+    std::vector<T> data2 = data1;
+
+    using hpx::execution::datapar;
+    using hpx::execution::dataseq;
+    using hpx::execution::par;
+    using hpx::execution::seq;
+
+    std::vector<std::uint64_t> seq_times, dataseq_times;
+    measure_algorithms(seq, data1, data2, seq_times);
+    measure_algorithms(dataseq, data1, data2, dataseq_times);
+    print_results(type, "seq", seq_times, dataseq_times);
+
+    std::vector<std::uint64_t> par_times, datapar_times;
+    measure_algorithms(par, data1, data2, par_times);
+    measure_algorithms(datapar, data1, data2, datapar_times);
+    print_results(type, "par", par_times, datapar_times);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t vector_size = vm["vector_size"].as<std::size_t>();
+    test_count = vm["test_count"].as<int>();
+    csv_output = vm.count("csv_output") != 0;
+
+    unsigned int seed = vm["seed"].as<unsigned int>();
+    std::mt19937 gen(seed);
+
+    // verify that input is within domain of program
+    if (test_count <= 0)
+    {
+        hpx::cout << "test_count cannot be zero or negative...\n" << hpx::flush;
+    }
+    else
+    {
+        if (csv_output)
+        {
+            hpx::cout << "algorithm,type,policy,scalar[s],vectorized[s],"
+                         "speedup\n"
+                      << hpx::flush;
+        }
+
+        run_benchmarks<float>("float", vector_size, gen);
+        run_benchmarks<double>("double", vector_size, gen);
+        run_benchmarks<std::int32_t>("int32", vector_size, gen);
+        run_benchmarks<std::int16_t>("int16", vector_size, gen);
+
+        // make sure the results are used
+        if (checksum == std::size_t(-1))
+            hpx::cout << checksum << "\n";
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    //initialize program
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("vector_size"
+        , hpx::program_options::value<std::size_t>()->default_value(1048576)
+        , "size of the arrays (default: 1048576)")
+
+        ("test_count"
+        , hpx::program_options::value<int>()->default_value(100)
+        , "number of tests to be averaged (default: 100)")
+
+        ("seed"
+        , hpx::program_options::value<unsigned int>()->default_value(0)
+        , "seed for the random number generator (default: 0)")
+
+        ("csv_output"
+        , "print results in csv format")
+        ;
+    // clang-format on
+
+    return hpx::init(cmdline, argc, argv, cfg);
+}
@@ -0,0 +1,227 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the execution times of parallel loops with an
+// imbalanced workload (the time spent on each element grows linearly with its
+// index, optionally with randomly placed expensive elements) when using
+// different executor parameters: static, dynamic, and guided chunking, and
+// lazy binary splitting. The loops are run using for_each, for_loop,
+// transform, and transform_reduce.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_executor_parameters.hpp>
+#include <hpx/iostream.hpp>
+#include <hpx/numeric.hpp>
+
+#include "worker_timed.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+int test_count = 100;
+bool csv_output = false;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename F>
+std::uint64_t measure(F&& f)
+{
+    std::uint64_t time = 0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+        f();
+        time += hpx::chrono::high_resolution_clock::now() - start;
+    }
+    return time / test_count;
+}
+
+template <typename Parameters>
+std::uint64_t measure_for_each(
+    Parameters&& params, std::vector<std::uint64_t> const& costs)
+{
+    return measure([&]() {
+        hpx::for_each(hpx::execution::par.with(params), costs.begin(),
+            costs.end(), [](std::uint64_t cost) { worker_timed(cost); });
+    });
+}
+
+template <typename Parameters>
+std::uint64_t measure_for_loop(
+    Parameters&& params, std::vector<std::uint64_t> const& costs)
+{
+    return measure([&]() {
+        hpx::for_loop(hpx::execution::par.with(params), std::size_t(0),
+            costs.size(), [&costs](std::size_t i) { worker_timed(costs[i]); });
+    });
+}
+
+template <typename Parameters>
+std::uint64_t measure_transform(Parameters&& params,
+    std::vector<std::uint64_t> const& costs, std::vector<std::uint64_t>& dest)
+{
+    return measure([&]() {
+        hpx::transform(hpx::execution::par.with(params), costs.begin(),
+            costs.end(), dest.begin(), [](std::uint64_t cost) {
+                worker_timed(cost);
+                return cost;
+            });
+    });
+}
+
+template <typename Parameters>
+std::uint64_t measure_transform_reduce(
+    Parameters&& params, std::vector<std::uint64_t> const& costs)
+{
+    return measure([&]() {
+        hpx::transform_reduce(hpx::execution::par.with(params), costs.begin(),
+            costs.end(), std::uint64_t(0), std::plus<std::uint64_t>(),
+            [](std::uint64_t cost) {
+                worker_timed(cost);
+                return cost;
+            });
+    });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void print_result(char const* algorithm, char const* parameters,
+    std::size_t vector_size, std::uint64_t time)
+{
+    if (csv_output)
+    {
+        hpx::cout << algorithm << "," << parameters << "," << vector_size
+                  << "," << time / 1e9 << "\n"
+                  << hpx::flush;
+    }
+    else
+    {
+        hpx::cout << algorithm << ", " << parameters << ", " << vector_size
+                  << ": " << time / 1e9 << "s\n"
+                  << hpx::flush;
+    }
+}
+
+template <typename Parameters>
+void run_benchmarks(char const* name, Parameters&& params,
+    std::vector<std::uint64_t> const& costs)
+{
+    std::vector<std::uint64_t> dest(costs.size());
+
+    print_result(
+        "for_each", name, costs.size(), measure_for_each(params, costs));
+    print_result(
+        "for_loop", name, costs.size(), measure_for_loop(params, costs));
+    print_result("transform", name, costs.size(),
+        measure_transform(params, costs, dest));
+    print_result("transform_reduce", name, costs.size(),
+        measure_transform_reduce(params, costs));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t vector_size = vm["vector_size"].as<std::size_t>();
+    std::uint64_t delay = vm["delay"].as<std::uint64_t>();
+    double spike_ratio = vm["spike_ratio"].as<double>();
+    std::uint64_t spike_delay = vm["spike_delay"].as<std::uint64_t>();
+    test_count = vm["test_count"].as<int>();
+    csv_output = vm.count("csv_output") != 0;
+
+    unsigned int seed = vm["seed"].as<unsigned int>();
+    std::mt19937 gen(seed);
+
+    // verify that input is within domain of program
+    if (test_count <= 0)
+    {
+        hpx::cout << "test_count cannot be zero or negative...\n" << hpx::flush;
+    }
+    else if (vector_size == 0)
+    {
+        hpx::cout << "vector_size cannot be zero...\n" << hpx::flush;
+    }
+    else
+    {
+        // the cost of the elements grows linearly from 0 to 2 * delay, a
+        // fraction of randomly chosen elements is more expensive
+        std::uniform_real_distribution<double> dist(0.0, 1.0);
+
+        std::vector<std::uint64_t> costs(vector_size);
+        for (std::size_t i = 0; i != vector_size; ++i)
+        {
+            costs[i] = 2 * delay * i / vector_size;
+            if (dist(gen) < spike_ratio)
+                costs[i] += spike_delay;
+        }
+
+        if (csv_output)
+        {
+            hpx::cout << "algorithm,parameters,size,time[s]\n" << hpx::flush;
+        }
+
+        run_benchmarks(
+            "static_chunk_size", hpx::execution::static_chunk_size(), costs);
+        run_benchmarks(
+            "dynamic_chunk_size", hpx::execution::dynamic_chunk_size(), costs);
+        run_benchmarks(
+            "guided_chunk_size", hpx::execution::guided_chunk_size(), costs);
+        run_benchmarks("lazy_splitting_chunk_size",
+            hpx::execution::lazy_splitting_chunk_size(), costs);
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    //initialize program
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("vector_size"
+        , hpx::program_options::value<std::size_t>()->default_value(10000)
+        , "number of loop iterations (default: 10000)")
+
+        ("delay"
+        , hpx::program_options::value<std::uint64_t>()->default_value(1000)
+        , "average time in nanoseconds spent on each element "
+          "(default: 1000)")
+
+        ("spike_ratio"
+        , hpx::program_options::value<double>()->default_value(0.01)
+        , "fraction of elements which are more expensive (default: 0.01)")
+
+        ("spike_delay"
+        , hpx::program_options::value<std::uint64_t>()->default_value(100000)
+        , "additional time in nanoseconds spent on expensive elements "
+          "(default: 100000)")
+
+        ("test_count"
+        , hpx::program_options::value<int>()->default_value(100)
+        , "number of tests to be averaged (default: 100)")
+
+        ("seed"
+        , hpx::program_options::value<unsigned int>()->default_value(0)
+        , "seed for the random number generator (default: 0)")
+
+        ("csv_output"
+        , "print results in csv format")
+        ;
+    // clang-format on
+
+    return hpx::init(cmdline, argc, argv, cfg);
+}
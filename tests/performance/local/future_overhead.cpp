@@ -7,6 +7,7 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/config.hpp>
+#include <hpx/allocator_support/thread_local_slab_allocator.hpp>
 #if defined(HPX_HAVE_DISTRIBUTED_RUNTIME)
 #include <hpx/actions_base/plain_action.hpp>
 #include <hpx/runtime/actions/continuation.hpp>
@@ -57,6 +58,7 @@ static std::string queuing = "default";
 static std::size_t numa_sensitive = 0;
 static std::uint64_t num_threads = 1;
 static std::string info_string = "";
+static bool report_allocations = false;
 
 ///////////////////////////////////////////////////////////////////////////////
 void print_stats(const char* title, const char* wait, const char* exec,
@@ -80,6 +82,31 @@ void print_stats(const char* title, const char* wait, const char* exec,
             count, title, wait, exec, duration, us, queuing, numa_sensitive,
             num_threads, info_string);
     }
+    if (report_allocations)
+    {
+        // number of shared states allocated from the slab allocator and the
+        // global allocator, and the number of shared states released on a
+        // different thread, all per future
+        double const allocations =
+            double(hpx::util::get_slab_allocation_count(true)) / count;
+        double const fallback_allocations =
+            double(hpx::util::get_slab_fallback_allocation_count(true)) / count;
+        double const remote_frees =
+            double(hpx::util::get_slab_remote_free_count(true)) / count;
+
+        if (csv)
+        {
+            hpx::util::format_to(temp, ", {:8}, {:8}, {:8}", allocations,
+                fallback_allocations, remote_frees);
+        }
+        else
+        {
+            hpx::util::format_to(temp,
+                ", slab allocations {:8}, global allocations {:8}, remote "
+                "frees {:8} per future",
+                allocations, fallback_allocations, remote_frees);
+        }
+    }
     std::cout << temp.str() << std::endl;
     // CDash graph plotting
     //hpx::util::print_cdash_timing(title, duration);
@@ -539,6 +566,14 @@ int hpx_main(variables_map& vm)
 
         num_iterations = vm["delay-iterations"].as<std::uint64_t>();
 
+        report_allocations = vm.count("allocation-stats") != 0;
+        if (report_allocations)
+        {
+            hpx::util::get_slab_allocation_count(true);
+            hpx::util::get_slab_fallback_allocation_count(true);
+            hpx::util::get_slab_remote_free_count(true);
+        }
+
         const std::uint64_t count = vm["futures"].as<std::uint64_t>();
         bool csv = vm.count("csv") != 0;
         if (HPX_UNLIKELY(0 == count))
@@ -596,6 +631,8 @@ int main(int argc, char* argv[])
          "number of iterations in the delay loop")
 
         ("csv", "output results as csv (format: count,duration)")
+        ("allocation-stats", "report the number of shared state allocations "
+         "per future")
         ("test-all", "run all benchmarks")
         ("repetitions", value<int>()->default_value(1),
          "number of repetitions of the full benchmark")
@@ -0,0 +1,148 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the latency of running new work on an idle runtime and the CPU
+// time consumed by idle worker threads for the different idle policies of the
+// scheduler: spinning, exponential backoff (enable_idle_backoff), and parking
+// the worker threads (enable_idle_parking). The corresponding performance
+// counters can be printed in addition, e.g.:
+//
+//      idle_wake_latency \
+//          --hpx:print-counter=/threads/time/average-wake-latency \
+//          --hpx:print-counter=/threads/idle-park-rate
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_executors.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <iostream>
+#include <thread>
+
+using hpx::threads::policies::scheduler_mode;
+
+///////////////////////////////////////////////////////////////////////////////
+// Let the runtime become idle, then measure the time between scheduling a task
+// on another worker thread and the task starting to run. The worker thread
+// running this function is kept busy to make sure it can't run the task
+// itself.
+double measure_wake_latency(std::size_t samples, std::chrono::microseconds idle)
+{
+    std::size_t const num_threads = hpx::get_os_thread_count();
+    std::size_t const this_thread = hpx::get_worker_thread_num();
+
+    std::uint64_t latency = 0;
+    for (std::size_t i = 0; i != samples; ++i)
+    {
+        // give the other worker threads time to go idle
+        std::this_thread::sleep_for(idle);
+
+        std::size_t const target = (this_thread + 1 + i % (num_threads - 1)) %
+            num_threads;
+        hpx::threads::thread_schedule_hint const hint(
+            static_cast<std::int16_t>(target));
+        hpx::execution::parallel_executor exec(hint);
+
+        std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+        hpx::future<std::uint64_t> f = hpx::async(
+            exec, []() { return hpx::chrono::high_resolution_clock::now(); });
+
+        while (!f.is_ready())
+        {
+            // spin
+        }
+        latency += f.get() - start;
+    }
+    return double(latency) / double(samples) / 1e3;
+}
+
+// Measure the CPU time used by the process while all worker threads but the
+// one running this function are idle, the result is given in units of cores.
+double measure_idle_cpu_usage(std::chrono::milliseconds idle)
+{
+    std::clock_t const cpu_start = std::clock();
+    hpx::chrono::high_resolution_timer t;
+
+    // blocking the OS thread does not consume any CPU time
+    std::this_thread::sleep_for(idle);
+
+    double const cpu_time =
+        double(std::clock() - cpu_start) / double(CLOCKS_PER_SEC);
+    return cpu_time / t.elapsed();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void run(char const* name, scheduler_mode to_add, scheduler_mode to_remove,
+    std::size_t samples, std::chrono::microseconds idle)
+{
+    hpx::threads::add_remove_scheduler_mode(to_add, to_remove);
+
+    double const latency = measure_wake_latency(samples, idle);
+    double const cpu_usage = measure_idle_cpu_usage(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            idle * samples));
+
+    hpx::util::format_to(std::cout, "{1:>10} {2:>20.2f} {3:>20.2f}\n", name,
+        latency, cpu_usage);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (hpx::get_os_thread_count() < 2)
+    {
+        std::cerr << "idle_wake_latency needs at least two worker threads\n";
+        return hpx::finalize();
+    }
+
+    std::size_t const samples = vm["samples"].as<std::size_t>();
+    std::chrono::microseconds const idle(vm["idle-time"].as<std::size_t>());
+
+    hpx::util::format_to(std::cout, "{1:>10} {2:>20} {3:>20}\n", "policy",
+        "wake latency [us]", "idle CPU [cores]");
+
+    run("spin", scheduler_mode::nothing_special,
+        scheduler_mode(scheduler_mode::enable_idle_backoff |
+            scheduler_mode::enable_idle_parking),
+        samples, idle);
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    run("backoff", scheduler_mode::enable_idle_backoff,
+        scheduler_mode::enable_idle_parking, samples, idle);
+
+    run("park", scheduler_mode::enable_idle_parking,
+        scheduler_mode::enable_idle_backoff, samples, idle);
+#else
+    std::cout << "idle backoff and parking are available only if "
+                 "HPX_WITH_THREAD_MANAGER_IDLE_BACKOFF=ON\n";
+#endif
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::program_options::options_description cmdline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("samples",
+         hpx::program_options::value<std::size_t>()->default_value(100),
+         "the number of wake ups to measure per idle policy (default: 100)")
+        ("idle-time",
+         hpx::program_options::value<std::size_t>()->default_value(10000),
+         "the time the runtime is idle before each wake up in microseconds "
+         "(default: 10000)")
+        ;
+    // clang-format on
+
+    return hpx::init(cmdline, argc, argv);
+}
@@ -9,12 +9,14 @@
 #include <hpx/include/lcos.hpp>
 #include <hpx/iostream.hpp>
 #include <hpx/modules/timing.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
 
 #include <hpx/modules/program_options.hpp>
 
 #include <cstddef>
 #include <cstdint>
 #include <numeric>
+#include <string>
 #include <vector>
 
 #include "worker_timed.hpp"
@@ -83,19 +85,36 @@ int hpx_main(hpx::program_options::variables_map& vm)
     if (do_child)
         parent_stealing_time = measure(hpx::launch::fork);
 
+    // overall task spawn throughput (tasks per second of accumulated time)
+    double const num_tasks = static_cast<double>(
+        iterations * hpx::get_os_thread_count());
+    double child_stealing_rate = child_stealing_time != 0 ?
+        num_tasks / child_stealing_time :
+        0.0;
+    double parent_stealing_rate = parent_stealing_time != 0 ?
+        num_tasks / parent_stealing_time :
+        0.0;
+
+    std::string scheduler = hpx::get_config_entry("hpx.scheduler", "");
+
     if (print_header)
     {
         hpx::cout
-            << "num_cores,num_threads,child_stealing_time[s],parent_stealing_time[s]"
+            << "scheduler,num_cores,num_threads,child_stealing_time[s],"
+               "parent_stealing_time[s],child_stealing_rate[1/s],"
+               "parent_stealing_rate[1/s]"
             << hpx::endl;
     }
 
     hpx::util::format_to(hpx::cout,
-        "{},{},{},{}",
+        "{},{},{},{},{},{},{}",
+        scheduler,
         num_cores,
         iterations,
         child_stealing_time,
-        parent_stealing_time) << hpx::endl;
+        parent_stealing_time,
+        child_stealing_rate,
+        parent_stealing_rate) << hpx::endl;
 
     return hpx::finalize();
 }
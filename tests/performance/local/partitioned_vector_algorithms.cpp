@@ -0,0 +1,159 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the segmented algorithms which have to exchange
+// data between the partitions of a hpx::partitioned_vector (sort, copy,
+// equal, merge, and unique). It is meant to be run on several localities.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/parallel_copy.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/iostream.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(int);
+
+///////////////////////////////////////////////////////////////////////////////
+int test_count = 10;
+unsigned int seed = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+void fill_random(hpx::partitioned_vector<int>& v, int max_value)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(0, max_value);
+
+    std::vector<std::size_t> pos(v.size());
+    std::vector<int> data(v.size());
+    for (std::size_t i = 0; i != data.size(); ++i)
+    {
+        pos[i] = i;
+        data[i] = dist(gen);
+    }
+
+    v.set_values(hpx::launch::sync, pos, data);
+}
+
+template <typename Policy>
+void run_benchmarks(Policy const& policy, std::string const& policy_name,
+    std::size_t vector_size, hpx::container_distribution_policy const& layout)
+{
+    std::uint64_t sort_time = 0;
+    std::uint64_t copy_time = 0;
+    std::uint64_t equal_time = 0;
+    std::uint64_t merge_time = 0;
+    std::uint64_t unique_time = 0;
+
+    for (int i = 0; i != test_count; ++i)
+    {
+        hpx::partitioned_vector<int> v1(vector_size, layout);
+        hpx::partitioned_vector<int> v2(vector_size, layout);
+        hpx::partitioned_vector<int> dest(2 * vector_size, layout);
+
+        fill_random(v1, int(vector_size));
+
+        std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+        hpx::parallel::sort(policy, v1.begin(), v1.end());
+        sort_time += hpx::chrono::high_resolution_clock::now() - start;
+
+        start = hpx::chrono::high_resolution_clock::now();
+        hpx::copy(policy, v1.begin(), v1.end(), v2.begin());
+        copy_time += hpx::chrono::high_resolution_clock::now() - start;
+
+        start = hpx::chrono::high_resolution_clock::now();
+        if (!hpx::equal(policy, v1.begin(), v1.end(), v2.begin()))
+        {
+            hpx::cout << "copied sequences compare unequal\n" << hpx::flush;
+        }
+        equal_time += hpx::chrono::high_resolution_clock::now() - start;
+
+        start = hpx::chrono::high_resolution_clock::now();
+        hpx::merge(policy, v1.begin(), v1.end(), v2.begin(), v2.end(),
+            dest.begin());
+        merge_time += hpx::chrono::high_resolution_clock::now() - start;
+
+        start = hpx::chrono::high_resolution_clock::now();
+        hpx::parallel::unique(policy, dest.begin(), dest.end());
+        unique_time += hpx::chrono::high_resolution_clock::now() - start;
+    }
+
+    hpx::cout << policy_name << ", partitions " << layout.get_num_partitions()
+              << ": sort " << sort_time / (test_count * 1e9) << "s, copy "
+              << copy_time / (test_count * 1e9) << "s, equal "
+              << equal_time / (test_count * 1e9) << "s, merge "
+              << merge_time / (test_count * 1e9) << "s, unique "
+              << unique_time / (test_count * 1e9) << "s\n"
+              << hpx::flush;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t vector_size = vm["vector_size"].as<std::size_t>();
+    test_count = vm["test_count"].as<int>();
+    seed = vm["seed"].as<unsigned int>();
+
+    // verify that input is within domain of program
+    if (test_count <= 0)
+    {
+        hpx::cout << "test_count cannot be zero or negative...\n" << hpx::flush;
+    }
+    else
+    {
+        std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+        hpx::cout << "localities: " << localities.size()
+                  << ", vector size: " << vector_size << "\n"
+                  << hpx::flush;
+
+        run_benchmarks(hpx::execution::seq, "execution::seq", vector_size,
+            hpx::container_layout(localities));
+        run_benchmarks(hpx::execution::par, "execution::par", vector_size,
+            hpx::container_layout(localities));
+        run_benchmarks(hpx::execution::par, "execution::par", vector_size,
+            hpx::container_layout(4 * localities.size(), localities));
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    //initialize program
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("vector_size"
+        , hpx::program_options::value<std::size_t>()->default_value(1000000)
+        , "size of vectors (default: 1000000)")
+
+        ("test_count"
+        , hpx::program_options::value<int>()->default_value(10)
+        , "number of tests to be averaged (default: 10)")
+
+        ("seed"
+        , hpx::program_options::value<unsigned int>()->default_value(0)
+        , "seed for the random number generator (default: 0)")
+        ;
+    // clang-format on
+
+    return hpx::init(cmdline, argc, argv, cfg);
+}
@@ -0,0 +1,141 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the number of bytes written per checkpoint and the
+// time needed to create it for a hpx::partitioned_vector which is sparsely
+// updated between the checkpoints. It compares full checkpoints of the local
+// partitions with incremental ones which store the changed pages only.
+
+#include <hpx/chrono.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_checkpoint.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/iostream.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double);
+
+///////////////////////////////////////////////////////////////////////////////
+int test_count = 10;
+unsigned int seed = 0;
+
+///////////////////////////////////////////////////////////////////////////////
+void update_random(hpx::partitioned_vector<double>& v, std::size_t updates,
+    std::mt19937& gen)
+{
+    std::uniform_int_distribution<std::size_t> dist(0, v.size() - 1);
+
+    std::vector<std::size_t> pos(updates);
+    std::vector<double> data(updates);
+    for (std::size_t i = 0; i != updates; ++i)
+    {
+        pos[i] = dist(gen);
+        data[i] = double(gen());
+    }
+
+    v.set_values(hpx::launch::sync, pos, data);
+}
+
+void run_benchmark(std::size_t vector_size, std::size_t page_size,
+    std::size_t updates, bool incremental)
+{
+    std::vector<hpx::id_type> localities(4, hpx::find_here());
+    hpx::partitioned_vector<double> v(
+        vector_size, 0.0, hpx::container_layout(4, localities));
+
+    hpx::partitioned_vector_incremental_checkpoint<double> ckp(page_size);
+    std::mt19937 gen(seed);
+
+    // create the base checkpoint
+    std::uint64_t base_bytes = ckp.save(v).size();
+
+    std::uint64_t bytes = 0;
+    std::uint64_t time = 0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        update_random(v, updates, gen);
+
+        std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+        bytes += ckp.save(v, !incremental).size();
+        time += hpx::chrono::high_resolution_clock::now() - start;
+    }
+
+    hpx::cout << (incremental ? "incremental" : "full") << ", updates "
+              << updates << ": base " << base_bytes << " bytes, "
+              << bytes / test_count << " bytes/checkpoint, "
+              << time / (test_count * 1e9) << "s/checkpoint\n"
+              << hpx::flush;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t vector_size = vm["vector_size"].as<std::size_t>();
+    std::size_t page_size = vm["page_size"].as<std::size_t>();
+    test_count = vm["test_count"].as<int>();
+    seed = vm["seed"].as<unsigned int>();
+
+    // verify that input is within domain of program
+    if (test_count <= 0)
+    {
+        hpx::cout << "test_count cannot be zero or negative...\n" << hpx::flush;
+    }
+    else
+    {
+        hpx::cout << "vector size: " << vector_size
+                  << ", page size: " << page_size << "\n"
+                  << hpx::flush;
+
+        for (std::size_t updates = 1; updates <= vector_size / 100;
+             updates *= 10)
+        {
+            run_benchmark(vector_size, page_size, updates, false);
+            run_benchmark(vector_size, page_size, updates, true);
+        }
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    //initialize program
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("vector_size"
+        , hpx::program_options::value<std::size_t>()->default_value(10000000)
+        , "size of the vector (default: 10000000)")
+
+        ("page_size"
+        , hpx::program_options::value<std::size_t>()->default_value(8192)
+        , "number of elements per page (default: 8192)")
+
+        ("test_count"
+        , hpx::program_options::value<int>()->default_value(10)
+        , "number of checkpoints to be averaged (default: 10)")
+
+        ("seed"
+        , hpx::program_options::value<unsigned int>()->default_value(0)
+        , "seed for the random number generator (default: 0)")
+        ;
+    // clang-format on
+
+    return hpx::init(cmdline, argc, argv, cfg);
+}
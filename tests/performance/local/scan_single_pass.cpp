@@ -0,0 +1,282 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the execution times of the two modes of the scan
+// partitioner: the normal mode, which runs the first step on all partitions
+// before the third step traverses the sequence again, and the single pass
+// mode, which runs the third step on each partition right after its prefix
+// was determined by looking back at the partitions to its left. An inclusive
+// scan and a stream compaction (copy_if) are performed using both modes.
+
+#include <hpx/chrono.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/iostream.hpp>
+#include <hpx/iterator_support/zip_iterator.hpp>
+#include <hpx/parallel/util/loop.hpp>
+#include <hpx/parallel/util/scan_partitioner.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+int test_count = 100;
+bool csv_output = false;
+
+using hpx::parallel::util::scan_partitioner_normal_tag;
+using hpx::parallel::util::scan_partitioner_single_pass_tag;
+
+///////////////////////////////////////////////////////////////////////////////
+// inclusive scan based on the scan partitioner using the given mode
+template <typename Tag, typename T>
+void inclusive_scan(std::vector<T> const& data, std::vector<T>& result)
+{
+    using hpx::get;
+    using hpx::util::make_zip_iterator;
+
+    using iterator = typename std::vector<T>::const_iterator;
+    using result_iterator = typename std::vector<T>::iterator;
+    using zip_iterator = hpx::util::zip_iterator<iterator, result_iterator>;
+
+    using scan_partitioner_type =
+        hpx::parallel::util::scan_partitioner<hpx::execution::parallel_policy,
+            void, T, void, Tag>;
+
+    scan_partitioner_type::call(hpx::execution::par,
+        make_zip_iterator(data.begin(), result.begin()), data.size(), T(0),
+        // step 1 performs first part of scan algorithm
+        [](zip_iterator part_begin, std::size_t part_size) -> T {
+            T sum = T(0);
+            hpx::parallel::util::loop_n<hpx::execution::sequenced_policy>(
+                part_begin, part_size, [&sum](zip_iterator it) {
+                    sum += get<0>(*it);
+                    get<1>(*it) = sum;
+                });
+            return sum;
+        },
+        // step 2 propagates the partition results from left to right
+        hpx::util::unwrapping(std::plus<T>()),
+        // step 3 runs final accumulation on each partition
+        [](zip_iterator part_begin, std::size_t part_size,
+            hpx::shared_future<T> curr, hpx::shared_future<T> next) {
+            next.get();    // rethrow exceptions
+
+            T val = curr.get();
+            hpx::parallel::util::loop_n<hpx::execution::sequenced_policy>(
+                part_begin, part_size,
+                [val](zip_iterator it) { get<1>(*it) += val; });
+        },
+        // step 4 use this return value
+        [](std::vector<hpx::shared_future<T>>&&,
+            std::vector<hpx::future<void>>&&) {});
+}
+
+// stream compaction based on the scan partitioner using the given mode, all
+// elements smaller than 50 are copied
+template <typename Tag, typename T>
+std::size_t copy_if(std::vector<T> const& data, std::vector<T>& result)
+{
+    using hpx::get;
+    using hpx::util::make_zip_iterator;
+
+    using iterator = typename std::vector<T>::const_iterator;
+    using zip_iterator = hpx::util::zip_iterator<iterator, bool*>;
+
+    using scan_partitioner_type =
+        hpx::parallel::util::scan_partitioner<hpx::execution::parallel_policy,
+            std::size_t, std::size_t, void, Tag>;
+
+    std::unique_ptr<bool[]> flags(new bool[data.size()]);
+    auto dest = result.begin();
+
+    return scan_partitioner_type::call(hpx::execution::par,
+        make_zip_iterator(data.begin(), flags.get()), data.size(),
+        std::size_t(0),
+        // step 1 performs first part of scan algorithm
+        [](zip_iterator part_begin, std::size_t part_size) -> std::size_t {
+            std::size_t curr = 0;
+            hpx::parallel::util::loop_n<hpx::execution::sequenced_policy>(
+                part_begin, part_size, [&curr](zip_iterator it) {
+                    if ((get<1>(*it) = (get<0>(*it) < T(50))))
+                        ++curr;
+                });
+            return curr;
+        },
+        // step 2 propagates the partition results from left to right
+        hpx::util::unwrapping(std::plus<std::size_t>()),
+        // step 3 runs final accumulation on each partition
+        [dest](zip_iterator part_begin, std::size_t part_size,
+            hpx::shared_future<std::size_t> curr,
+            hpx::shared_future<std::size_t> next) mutable {
+            next.get();    // rethrow exceptions
+
+            std::advance(dest, curr.get());
+            hpx::parallel::util::loop_n<hpx::execution::sequenced_policy>(
+                part_begin, part_size, [&dest](zip_iterator it) {
+                    if (get<1>(*it))
+                        *dest++ = get<0>(*it);
+                });
+        },
+        // step 4 use this return value
+        [](std::vector<hpx::shared_future<std::size_t>>&& items,
+            std::vector<hpx::future<void>>&&) -> std::size_t {
+            return items.back().get();
+        });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename F>
+std::uint64_t measure(F&& f)
+{
+    std::uint64_t time = 0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+        f();
+        time += hpx::chrono::high_resolution_clock::now() - start;
+    }
+    return time / test_count;
+}
+
+void print_result(char const* algorithm, char const* type,
+    std::size_t vector_size, std::uint64_t normal, std::uint64_t single_pass)
+{
+    double const speedup = double(normal) / double(single_pass);
+    if (csv_output)
+    {
+        hpx::cout << algorithm << "," << type << "," << vector_size << ","
+                  << normal / 1e9 << "," << single_pass / 1e9 << "," << speedup
+                  << "\n"
+                  << hpx::flush;
+    }
+    else
+    {
+        hpx::cout << algorithm << "<" << type << ">, " << vector_size
+                  << ": normal " << normal / 1e9 << "s, single pass "
+                  << single_pass / 1e9 << "s, speedup " << speedup << "\n"
+                  << hpx::flush;
+    }
+}
+
+template <typename T>
+bool run_benchmarks(
+    char const* type, std::size_t vector_size, std::mt19937& gen)
+{
+    std::uniform_int_distribution<int> dist(0, 100);
+
+    std::vector<T> data(vector_size);
+    for (auto& v : data)
+        v = T(dist(gen));
+
+    std::vector<T> expected(vector_size), result(vector_size);
+    bool verified = true;
+
+    // inclusive scan
+    std::uint64_t normal = measure([&]() {
+        inclusive_scan<scan_partitioner_normal_tag>(data, expected);
+    });
+    std::uint64_t single_pass = measure([&]() {
+        inclusive_scan<scan_partitioner_single_pass_tag>(data, result);
+    });
+    verified = verified && result == expected;
+    print_result("inclusive_scan", type, vector_size, normal, single_pass);
+
+    // stream compaction
+    std::size_t expected_count = 0, result_count = 0;
+    normal = measure([&]() {
+        expected_count = copy_if<scan_partitioner_normal_tag>(data, expected);
+    });
+    single_pass = measure([&]() {
+        result_count = copy_if<scan_partitioner_single_pass_tag>(data, result);
+    });
+    verified = verified && result_count == expected_count &&
+        std::equal(expected.begin(), expected.begin() + expected_count,
+            result.begin());
+    print_result("copy_if", type, vector_size, normal, single_pass);
+
+    return verified;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t vector_size = vm["vector_size"].as<std::size_t>();
+    test_count = vm["test_count"].as<int>();
+    csv_output = vm.count("csv_output") != 0;
+
+    unsigned int seed = vm["seed"].as<unsigned int>();
+    std::mt19937 gen(seed);
+
+    // verify that input is within domain of program
+    if (test_count <= 0)
+    {
+        hpx::cout << "test_count cannot be zero or negative...\n" << hpx::flush;
+    }
+    else if (vector_size == 0)
+    {
+        hpx::cout << "vector_size cannot be zero...\n" << hpx::flush;
+    }
+    else
+    {
+        if (csv_output)
+        {
+            hpx::cout << "algorithm,type,size,normal[s],single_pass[s],"
+                         "speedup\n"
+                      << hpx::flush;
+        }
+
+        bool verified = run_benchmarks<std::int32_t>("int32", vector_size, gen);
+        verified =
+            run_benchmarks<std::int64_t>("int64", vector_size, gen) && verified;
+        verified =
+            run_benchmarks<double>("double", vector_size, gen) && verified;
+
+        if (!verified)
+        {
+            hpx::cout << "the results of both modes differ\n" << hpx::flush;
+        }
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    //initialize program
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("vector_size"
+        , hpx::program_options::value<std::size_t>()->default_value(16777216)
+        , "size of the arrays (default: 16777216)")
+
+        ("test_count"
+        , hpx::program_options::value<int>()->default_value(100)
+        , "number of tests to be averaged (default: 100)")
+
+        ("seed"
+        , hpx::program_options::value<unsigned int>()->default_value(0)
+        , "seed for the random number generator (default: 0)")
+
+        ("csv_output"
+        , "print results in csv format")
+        ;
+    // clang-format on
+
+    return hpx::init(cmdline, argc, argv, cfg);
+}
@@ -16,12 +16,17 @@
 
 // This code implements two versions of the skynet micro benchmark: a 'normal'
 // and a futurized one.
+//
+// Run with different --hpx:queuing options (e.g. local-priority-fifo vs.
+// local-priority-workstealing) to compare the task spawn throughput of the
+// schedulers.
 
 #include <hpx/hpx_main.hpp>
 #include <hpx/hpx.hpp>
 #include <hpx/iostream.hpp>
 
 #include <cstdint>
+#include <string>
 #include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -80,6 +85,29 @@ skynet_f(std::int64_t num, std::int64_t size, std::int64_t div)
     return hpx::make_ready_future(num);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// overall number of tasks created by one invocation of skynet(0, size, div)
+std::int64_t num_tasks(std::int64_t size, std::int64_t div)
+{
+    std::int64_t count = 1;
+    while (size != 1)
+    {
+        size /= div;
+        count = count * div + 1;
+    }
+    return count;
+}
+
+void print_result(char const* name, std::int64_t result, std::uint64_t t)
+{
+    static std::string const scheduler =
+        hpx::get_config_entry("hpx.scheduler", "");
+
+    hpx::cout << name << ": " << result << " in " << (t / 1e6) << " ms ("
+              << (num_tasks(1000000, 10) / (t / 1e9)) << " tasks/s, "
+              << scheduler << ").\n";
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int main()
 {
@@ -91,9 +119,7 @@ int main()
 
         t = hpx::chrono::high_resolution_clock::now() - t;
 
-        hpx::cout
-            << "Result 1: " << result.get() << " in "
-            << (t / 1e6) << " ms.\n";
+        print_result("Result 1", result.get(), t);
     }
 
     {
@@ -104,9 +130,7 @@ int main()
 
         t = hpx::chrono::high_resolution_clock::now() - t;
 
-        hpx::cout
-            << "Result 2: " << result.get() << " in "
-            << (t / 1e6) << " ms.\n";
+        print_result("Result 2", result.get(), t);
     }
     return 0;
 }
@@ -0,0 +1,132 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the per-key operations of hpx::unordered_map with
+// the bulk operations which send one request per partition.
+
+#include <hpx/chrono.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/unordered_map.hpp>
+#include <hpx/iostream.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_UNORDERED_MAP(std::uint64_t, double);
+
+typedef hpx::unordered_map<std::uint64_t, double> map_type;
+
+///////////////////////////////////////////////////////////////////////////////
+void print_result(char const* name, std::size_t count, std::uint64_t elapsed)
+{
+    hpx::cout << name << ": " << count / (elapsed * 1e-9) << " ops/s\n"
+              << hpx::flush;
+}
+
+void benchmark_per_key(map_type& m, std::size_t count)
+{
+    std::vector<hpx::future<void>> set_futures;
+    set_futures.reserve(count);
+
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+    for (std::size_t i = 0; i != count; ++i)
+        set_futures.push_back(m.set_value(i, double(i)));
+    hpx::wait_all(set_futures);
+    print_result("per-key set_value",
+        count, hpx::chrono::high_resolution_clock::now() - start);
+
+    std::vector<hpx::future<double>> get_futures;
+    get_futures.reserve(count);
+
+    start = hpx::chrono::high_resolution_clock::now();
+    for (std::size_t i = 0; i != count; ++i)
+        get_futures.push_back(m.get_value(i));
+    hpx::wait_all(get_futures);
+    print_result("per-key get_value",
+        count, hpx::chrono::high_resolution_clock::now() - start);
+
+    std::vector<hpx::future<std::size_t>> erase_futures;
+    erase_futures.reserve(count);
+
+    start = hpx::chrono::high_resolution_clock::now();
+    for (std::size_t i = 0; i != count; ++i)
+        erase_futures.push_back(m.erase(i));
+    hpx::wait_all(erase_futures);
+    print_result("per-key erase    ",
+        count, hpx::chrono::high_resolution_clock::now() - start);
+}
+
+void benchmark_bulk(map_type& m, std::size_t count)
+{
+    std::vector<std::pair<std::uint64_t, double>> data;
+    std::vector<std::uint64_t> keys;
+    data.reserve(count);
+    keys.reserve(count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        data.emplace_back(i, double(i));
+        keys.push_back(i);
+    }
+
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+    m.insert(hpx::launch::sync, data.begin(), data.end());
+    print_result("bulk insert      ",
+        count, hpx::chrono::high_resolution_clock::now() - start);
+
+    start = hpx::chrono::high_resolution_clock::now();
+    m.get_values(hpx::launch::sync, keys);
+    print_result("bulk get_values  ",
+        count, hpx::chrono::high_resolution_clock::now() - start);
+
+    start = hpx::chrono::high_resolution_clock::now();
+    m.erase(hpx::launch::sync, keys);
+    print_result("bulk erase       ",
+        count, hpx::chrono::high_resolution_clock::now() - start);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t count = vm["count"].as<std::size_t>();
+
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    hpx::cout << "localities: " << localities.size() << ", keys: " << count
+              << "\n"
+              << hpx::flush;
+
+    map_type m(hpx::container_layout(localities));
+
+    benchmark_per_key(m, count);
+    benchmark_bulk(m, count);
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    //initialize program
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("count"
+        , hpx::program_options::value<std::size_t>()->default_value(100000)
+        , "number of keys to insert, look up, and erase (default: 100000)")
+        ;
+    // clang-format on
+
+    return hpx::init(cmdline, argc, argv, cfg);
+}
@@ -0,0 +1,175 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the throughput and the round trip latency of a coalesced action
+// for different offered loads (parcels per second), once using the fixed
+// coalescing parameters and once using the adaptive coalescing mode of the
+// coalescing message handler.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/parcel_coalescing.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t echo(std::int64_t value)
+{
+    return value;
+}
+
+HPX_PLAIN_ACTION(echo, echo_action);
+HPX_ACTION_USES_MESSAGE_COALESCING(echo_action);
+
+///////////////////////////////////////////////////////////////////////////////
+struct measurement
+{
+    double throughput;      // [parcels/s]
+    double mean_latency;    // [us]
+    double p99_latency;     // [us]
+};
+
+// Send the given number of parcels at the given rate (zero: as fast as
+// possible) and measure the time until each of the responses arrives
+measurement measure(
+    hpx::id_type const& dest, std::size_t num_parcels, double rate)
+{
+    std::vector<double> latencies(num_parcels, 0.0);
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(num_parcels);
+
+    hpx::chrono::high_resolution_timer t;
+    for (std::size_t i = 0; i != num_parcels; ++i)
+    {
+        // pace the parcels according to the offered load
+        if (rate != 0.0)
+        {
+            double const send_at = double(i) / rate;
+            while (t.elapsed() < send_at)
+            {
+                hpx::this_thread::yield();
+            }
+        }
+
+        double const sent = t.elapsed();
+        hpx::future<std::int64_t> response =
+            hpx::async<echo_action>(dest, std::int64_t(i));
+
+        futures.push_back(response.then(
+            [&latencies, &t, sent, i](hpx::future<std::int64_t>&& f) {
+                f.get();
+                latencies[i] = t.elapsed() - sent;
+            }));
+    }
+    hpx::wait_all(futures);
+
+    double const elapsed = t.elapsed();
+
+    std::sort(latencies.begin(), latencies.end());
+    double sum = 0.0;
+    for (double l : latencies)
+    {
+        sum += l;
+    }
+
+    return measurement{double(num_parcels) / elapsed,
+        1e6 * sum / double(num_parcels),
+        1e6 * latencies[(num_parcels * 99) / 100]};
+}
+
+std::vector<double> parse_rates(std::string const& rates)
+{
+    std::vector<double> result;
+    std::string::size_type start = 0;
+    while (start < rates.size())
+    {
+        std::string::size_type end = rates.find(',', start);
+        if (end == std::string::npos)
+            end = rates.size();
+        result.push_back(std::stod(rates.substr(start, end - start)));
+        start = end + 1;
+    }
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const num_parcels = vm["parcels"].as<std::size_t>();
+    std::vector<double> const rates =
+        parse_rates(vm["rates"].as<std::string>());
+
+    std::vector<hpx::id_type> const localities =
+        hpx::find_remote_localities();
+    if (localities.empty())
+    {
+        std::cout << "This benchmark requires at least two localities\n";
+        return hpx::finalize();
+    }
+
+    hpx::set_config_entry(
+        "hpx.plugins.coalescing_message_handler.latency_budget",
+        vm["latency-budget"].as<std::size_t>());
+
+    hpx::util::format_to(std::cout, "{1:10} {2:16} {3:18} {4:14} {5:14}\n",
+        "mode", "offered [1/s]", "throughput [1/s]", "mean [us]",
+        "p99 [us]");
+
+    for (char const* mode : {"fixed", "adaptive"})
+    {
+        hpx::set_config_entry(
+            "hpx.plugins.coalescing_message_handler.adaptive",
+            std::string(mode) == "adaptive" ? "1" : "0");
+
+        for (double rate : rates)
+        {
+            // warm up
+            measure(localities[0], num_parcels / 10 + 1, rate);
+
+            measurement const m = measure(localities[0], num_parcels, rate);
+            hpx::util::format_to(std::cout,
+                "{1:10} {2:16} {3:18.0f} {4:14.2f} {5:14.2f}\n", mode,
+                rate == 0.0 ? std::string("unlimited") :
+                              std::to_string(std::int64_t(rate)),
+                m.throughput, m.mean_latency, m.p99_latency);
+        }
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using hpx::program_options::options_description;
+    using hpx::program_options::value;
+
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("parcels", value<std::size_t>()->default_value(10000),
+         "the number of parcels to send for each offered load "
+         "(default: 10000)")
+        ("rates", value<std::string>()->default_value("1000,10000,100000,0"),
+         "comma separated list of offered loads in parcels per second, 0 "
+         "sends parcels as fast as possible (default: 1000,10000,100000,0)")
+        ("latency-budget", value<std::size_t>()->default_value(100),
+         "the latency budget used by the adaptive mode in microseconds "
+         "(default: 100)")
+        ;
+    // clang-format on
+
+    return hpx::init(desc_commandline, argc, argv);
+}
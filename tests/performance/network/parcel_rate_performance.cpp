@@ -0,0 +1,111 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the rate of small parcels which can be sent to another locality
+// for different numbers of parcels in flight. Run it on loopback once with
+// the io_uring based socket operations of the TCP parcelport enabled (the
+// default if it was built) and once with them disabled:
+//
+//      parcel_rate_performance --hpx:ini=hpx.parcel.tcp.io_uring=0 ...
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t echo(std::int64_t value)
+{
+    return value;
+}
+
+HPX_PLAIN_ACTION(echo, echo_action);
+
+///////////////////////////////////////////////////////////////////////////////
+// Send the given number of parcels keeping at most 'window' of them in
+// flight, return the achieved rate [parcels/s]
+double measure(
+    hpx::id_type const& dest, std::size_t num_parcels, std::size_t window)
+{
+    std::vector<hpx::future<std::int64_t>> futures;
+    futures.reserve(window);
+
+    hpx::chrono::high_resolution_timer t;
+    for (std::size_t i = 0; i != num_parcels; i += window)
+    {
+        std::size_t const n = (std::min)(window, num_parcels - i);
+        for (std::size_t j = 0; j != n; ++j)
+        {
+            futures.push_back(
+                hpx::async<echo_action>(dest, std::int64_t(i + j)));
+        }
+        hpx::wait_all(futures);
+        futures.clear();
+    }
+    return double(num_parcels) / t.elapsed();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const num_parcels = vm["parcels"].as<std::size_t>();
+    std::size_t const max_window = vm["max-window"].as<std::size_t>();
+
+    std::vector<hpx::id_type> const localities =
+        hpx::find_remote_localities();
+    if (localities.empty())
+    {
+        std::cout << "This benchmark requires at least two localities\n";
+        return hpx::finalize();
+    }
+
+    std::cout << "io_uring: "
+              << hpx::get_config_entry("hpx.parcel.tcp.io_uring", "0")
+              << "\n";
+
+    hpx::util::format_to(
+        std::cout, "{1:12} {2:18}\n", "in flight", "rate [parcels/s]");
+
+    for (std::size_t window = 1; window <= max_window; window *= 2)
+    {
+        // warm up
+        measure(localities[0], num_parcels / 10 + 1, window);
+
+        double const rate = measure(localities[0], num_parcels, window);
+        hpx::util::format_to(std::cout, "{1:12} {2:18.0f}\n", window, rate);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::program_options::options_description cmdline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    cmdline.add_options()
+        ("parcels",
+         hpx::program_options::value<std::size_t>()->default_value(100000),
+         "the number of parcels to send per measurement (default: 100000)")
+        ("max-window",
+         hpx::program_options::value<std::size_t>()->default_value(256),
+         "the maximal number of parcels in flight (default: 256)")
+        ;
+
+    std::vector<std::string> const cfg = {
+        "hpx.run_hpx_main!=1"
+    };
+
+    return hpx::init(cmdline, argc, argv, cfg);
+}
@@ -0,0 +1,124 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the round trip latency and the bandwidth of messages of different
+// sizes sent between two localities running on the same node. Run it once
+// with the shared memory parcelport enabled (the default if it was built) and
+// once with it disabled to compare against the TCP loopback:
+//
+//      shmem_pingpong_performance --hpx:ini=hpx.parcel.shmem.enable=0 ...
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/serialization.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+typedef hpx::serialization::serialize_buffer<char> buffer_type;
+
+buffer_type pong(buffer_type const& b)
+{
+    return b;
+}
+
+HPX_PLAIN_ACTION(pong, pong_action);
+
+///////////////////////////////////////////////////////////////////////////////
+// Return the average time [s] needed for one round trip of a message of the
+// given size
+double measure(hpx::id_type const& dest, std::size_t size,
+    std::size_t iterations)
+{
+    std::unique_ptr<char[]> data(new char[size]);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        data[i] = static_cast<char>(i);
+    }
+
+    buffer_type b(data.get(), size, buffer_type::reference);
+
+    // warm up
+    pong_action()(dest, b);
+
+    hpx::chrono::high_resolution_timer t;
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        pong_action()(dest, b);
+    }
+    return t.elapsed() / double(iterations);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const min_size = vm["min-size"].as<std::size_t>();
+    std::size_t const max_size = vm["max-size"].as<std::size_t>();
+    std::size_t const iterations = vm["iterations"].as<std::size_t>();
+
+    std::vector<hpx::id_type> const localities =
+        hpx::find_remote_localities();
+    if (localities.empty())
+    {
+        std::cout << "This benchmark requires at least two localities\n";
+        return hpx::finalize();
+    }
+
+    std::string const shmem =
+        hpx::get_config_entry("hpx.parcel.shmem.enable", "0");
+    std::cout << "shared memory parcelport: "
+              << (shmem != "0" ? "enabled" : "disabled") << "\n";
+
+    hpx::util::format_to(std::cout, "{1:12} {2:14} {3:16}\n", "size [B]",
+        "latency [us]", "bandwidth [MB/s]");
+
+    for (std::size_t size = min_size; size <= max_size;
+         size = size == 0 ? 1 : 2 * size)
+    {
+        // reduce the number of iterations for large messages
+        std::size_t const n = size > 65536 ?
+            (std::max)(iterations / (size / 65536), std::size_t(10)) :
+            iterations;
+
+        double const round_trip = measure(localities[0], size, n);
+        hpx::util::format_to(std::cout, "{1:12} {2:14.2f} {3:16.2f}\n", size,
+            1e6 * round_trip / 2, 2 * double(size) / round_trip / 1e6);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::program_options::options_description cmdline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    cmdline.add_options()
+        ("min-size",
+         hpx::program_options::value<std::size_t>()->default_value(1),
+         "the size of the smallest message (default: 1)")
+        ("max-size",
+         hpx::program_options::value<std::size_t>()->default_value(4194304),
+         "the size of the largest message (default: 4194304)")
+        ("iterations",
+         hpx::program_options::value<std::size_t>()->default_value(1000),
+         "the number of round trips per message size (default: 1000)")
+        ;
+
+    std::vector<std::string> const cfg = {
+        "hpx.run_hpx_main!=1"
+    };
+
+    return hpx::init(cmdline, argc, argv, cfg);
+}
@@ -0,0 +1,129 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the end-to-end bandwidth achieved when sending large
+// serialize_buffer<double> messages to another locality. Run this with
+// --hpx:ini=hpx.parcel.zero_copy_receive_optimization=0 to compare against
+// copying the received data while de-serializing the parcels.
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/serialization.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+using buffer_type = hpx::serialization::serialize_buffer<double>;
+
+// touch the received data to account for the cost of accessing it
+double consume(buffer_type const& buffer)
+{
+    return buffer.size() != 0 ? buffer[0] + buffer[buffer.size() - 1] : 0.0;
+}
+HPX_PLAIN_ACTION(consume, consume_action);
+
+///////////////////////////////////////////////////////////////////////////////
+double run_benchmark(hpx::id_type const& dest, std::size_t message_size,
+    std::size_t iterations, std::size_t window_size)
+{
+    std::size_t const count = message_size / sizeof(double);
+
+    buffer_type buffer(count);
+    for (std::size_t i = 0; i != count; ++i)
+        buffer[i] = double(i);
+
+    consume_action act;
+    std::vector<hpx::future<double>> futures;
+    futures.reserve(window_size);
+
+    hpx::chrono::high_resolution_timer t;
+
+    for (std::size_t i = 0; i < iterations; i += window_size)
+    {
+        futures.clear();
+        for (std::size_t j = 0; j != window_size && i + j != iterations; ++j)
+        {
+            futures.push_back(hpx::async(act, dest, buffer));
+        }
+        hpx::wait_all(futures);
+    }
+
+    double const elapsed = t.elapsed();
+
+    // MB/s
+    return (double(message_size) * iterations) / (elapsed * 1024 * 1024);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const min_size = vm["min-size"].as<std::size_t>();
+    std::size_t const max_size = vm["max-size"].as<std::size_t>();
+    std::size_t const iterations = vm["iterations"].as<std::size_t>();
+    std::size_t const window_size = vm["window-size"].as<std::size_t>();
+
+    std::vector<hpx::id_type> localities = hpx::find_remote_localities();
+    if (localities.empty())
+    {
+        std::cout << "This benchmark requires to be run on at least two "
+                     "localities"
+                  << std::endl;
+        return hpx::finalize();
+    }
+
+    std::string const zero_copy_receive = hpx::get_config_entry(
+        "hpx.parcel.zero_copy_receive_optimization", "1");
+
+    std::cout << "-------------- Benchmark Config --------------" << std::endl;
+    std::cout << "zero copy receive : " << zero_copy_receive << std::endl;
+    std::cout << "iterations        : " << iterations << std::endl;
+    std::cout << "window size       : " << window_size << std::endl;
+    std::cout << "----------------------------------------------\n"
+              << std::endl;
+
+    hpx::util::format_to(std::cout, "{1:12} {2:16}\n", "size [bytes]",
+        "bandwidth [MB/s]");
+
+    for (std::size_t size = min_size; size <= max_size; size *= 2)
+    {
+        double const bandwidth =
+            run_benchmark(localities[0], size, iterations, window_size);
+        hpx::util::format_to(std::cout, "{1:12} {2:16.2f}\n", size,
+            bandwidth);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using hpx::program_options::options_description;
+    using hpx::program_options::value;
+
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("min-size", value<std::size_t>()->default_value(64 * 1024),
+         "the smallest message size to measure in bytes (default: 64kB)")
+        ("max-size", value<std::size_t>()->default_value(128 * 1024 * 1024),
+         "the largest message size to measure in bytes (default: 128MB)")
+        ("iterations", value<std::size_t>()->default_value(20),
+         "the number of messages sent for each message size (default: 20)")
+        ("window-size", value<std::size_t>()->default_value(4),
+         "the number of messages in flight at the same time (default: 4)")
+        ;
+    // clang-format on
+
+    return hpx::init(desc_commandline, argc, argv);
+}
@@ -0,0 +1,155 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Test that tasks can be placed on the NUMA domain of the data they touch and
+// that parallel algorithms running on the shared priority scheduler produce
+// correct results when their chunks are placed based on the address of the
+// data they operate on.
+
+#include <hpx/hpx_init.hpp>
+
+#include <hpx/algorithm.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/include/resource_partitioner.hpp>
+#include <hpx/include/threads.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/threading_base/numa_schedule_hint.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+constexpr std::size_t num_elements = 1024 * 1024;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_numa_domain_lookup(std::vector<double> const& data)
+{
+    hpx::threads::topology const& topo = hpx::threads::create_topology();
+    std::size_t const num_numa_nodes = topo.get_number_of_numa_nodes();
+
+    // the memory was touched already, so it must be located somewhere
+    int const domain = topo.get_numa_domain_cached(data.data());
+    HPX_TEST(domain >= 0);
+    HPX_TEST(num_numa_nodes <= 1 || std::size_t(domain) < num_numa_nodes);
+
+    // cached lookups have to give the same answer
+    HPX_TEST_EQ(topo.get_numa_domain_cached(data.data()), domain);
+    topo.reset_numa_domain_cache();
+    HPX_TEST_EQ(topo.get_numa_domain_cached(data.data()), domain);
+
+    hpx::threads::thread_schedule_hint const fallback(std::int16_t(0));
+    hpx::threads::thread_schedule_hint const hint =
+        hpx::threads::get_numa_schedule_hint(
+            data.data(), data.size() * sizeof(double), fallback);
+
+    if (num_numa_nodes <= 1)
+    {
+        // there is nothing to place on a single domain system
+        HPX_TEST(hint == fallback);
+    }
+    else
+    {
+        HPX_TEST_EQ(
+            hint.mode, hpx::threads::thread_schedule_hint_mode_numa);
+        HPX_TEST_EQ(std::size_t(hint.hint),
+            std::size_t(hpx::threads::get_numa_domain(
+                data.data(), data.size() * sizeof(double))));
+    }
+
+    // empty ranges can't be placed
+    HPX_TEST(hpx::threads::get_numa_schedule_hint(data.data(), 0, fallback) ==
+        fallback);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_numa_hinted_tasks(std::vector<double> const& data)
+{
+    std::size_t const num_numa_nodes =
+        hpx::threads::create_topology().get_number_of_numa_nodes();
+
+    std::atomic<std::size_t> count(0);
+    std::vector<hpx::future<void>> tasks;
+
+    // tasks placed on each of the domains
+    for (std::size_t i = 0; i != 256; ++i)
+    {
+        hpx::execution::parallel_executor exec(
+            hpx::threads::thread_schedule_hint(
+                hpx::threads::thread_schedule_hint_mode_numa,
+                std::int16_t(i % (num_numa_nodes == 0 ? 1 : num_numa_nodes))));
+
+        tasks.push_back(hpx::async(exec, [&count]() {
+            hpx::this_thread::yield();
+            ++count;
+        }));
+    }
+
+    // tasks placed on the domain of the data they touch
+    std::size_t const chunk_size = data.size() / 64;
+    for (std::size_t i = 0; i != data.size(); i += chunk_size)
+    {
+        double const* chunk = data.data() + i;
+        hpx::execution::parallel_executor exec(
+            hpx::threads::get_numa_schedule_hint(
+                chunk, chunk_size * sizeof(double)));
+
+        tasks.push_back(hpx::async(exec, [&count, chunk, chunk_size]() {
+            double sum = std::accumulate(chunk, chunk + chunk_size, 0.0);
+            HPX_TEST_EQ(sum, double(chunk_size));
+            ++count;
+        }));
+    }
+
+    hpx::wait_all(tasks);
+    HPX_TEST_EQ(count.load(), 256 + data.size() / chunk_size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_algorithm_placement(std::vector<double>& data)
+{
+    hpx::for_each(hpx::execution::par, data.begin(), data.end(),
+        [](double& d) { d += 1.0; });
+
+    double const sum =
+        hpx::reduce(hpx::execution::par, data.begin(), data.end(), 0.0);
+    HPX_TEST_EQ(sum, 2.0 * double(data.size()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    auto const current = hpx::threads::get_self_id_data()->get_scheduler_base();
+    std::cout << "Scheduler is " << current->get_description() << std::endl;
+
+    std::vector<double> data(num_elements, 1.0);
+
+    test_numa_domain_lookup(data);
+    test_numa_hinted_tasks(data);
+    test_algorithm_placement(data);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::init_params init_args;
+
+    init_args.rp_callback = [](auto& rp) {
+        // the default mode steals from the own numa domain first
+        rp.create_thread_pool("default",
+            hpx::resource::scheduling_policy::shared_priority,
+            hpx::threads::policies::scheduler_mode(
+                hpx::threads::policies::default_mode));
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}